@@ -33,6 +33,7 @@
 #include "pylith/feassemble/Quadrature.hh" // USES Quadrature
 
 #include "pylith/utils/EventLogger.hh" // USES EventLogger
+#include "pylith/utils/BatchQuery.hh" // USES BatchQuery
 
 #include "spatialdata/spatialdb/SpatialDB.hh" // USES SpatialDB
 #include "spatialdata/geocoords/CoordSys.hh" // USES CoordSys
@@ -162,32 +163,51 @@ pylith::bc::AbsorbingDampers::initialize(const topology::Mesh& mesh,
 
   PetscScalar* dampingConstsArray = dampingConstsVisitor.localArray();
 
+  // Gather coordinates of quadrature points in boundary mesh and
+  // query database in a batch.
+  const PetscInt numCells = cEnd - cStart;
+  utils::BatchQuery batch;
+  batch.resize(numCells*numQuadPts, spaceDim);
   for(PetscInt c = cStart; c < cEnd; ++c) {
     // Compute geometry information for current cell
     coordsVisitor.getClosure(&coordsCell, c);
     _quadrature->computeGeometry(&coordsCell[0], coordsCell.size(), c);
 
-    const PetscInt doff = dampingConstsVisitor.sectionOffset(c);
-    assert(fiberDim == dampingConstsVisitor.sectionDof(c));
-
     const scalar_array& quadPtsNondim = _quadrature->quadPts();
-    const scalar_array& quadPtsRef = _quadrature->quadPtsRef();
     quadPtsGlobal = quadPtsNondim;
     _normalizer->dimensionalize(&quadPtsGlobal[0], quadPtsGlobal.size(), lengthScale);
 
+    for(int iQuad = 0; iQuad < numQuadPts; ++iQuad)
+      batch.point((c-cStart)*numQuadPts+iQuad, &quadPtsGlobal[iQuad*spaceDim]);
+  } // for
+
+  scalar_array queryDataAll(numCells*numQuadPts*numValues);
+  const int errPoint = batch.query(numCells ? &queryDataAll[0] : 0, numValues, _db, cs);
+  if (errPoint >= 0) {
+    const double* xyz = batch.point(errPoint);
+    std::ostringstream msg;
+    msg << "Could not find parameters for physical properties at \n"
+        << "(";
+    for (int i=0; i < spaceDim; ++i)
+      msg << "  " << xyz[i];
+    msg << ") for absorbing boundary condition '" << _label
+        << "' using spatial database '" << _db->label() << "'.";
+    throw std::runtime_error(msg.str());
+  } // if
+
+  const scalar_array& quadPtsRef = _quadrature->quadPtsRef();
+  for(PetscInt c = cStart; c < cEnd; ++c) {
+    coordsVisitor.getClosure(&coordsCell, c);
+
+    const PetscInt doff = dampingConstsVisitor.sectionOffset(c);
+    assert(fiberDim == dampingConstsVisitor.sectionDof(c));
+
     for(int iQuad = 0; iQuad < numQuadPts; ++iQuad) {
       // Compute damping constants in normal/tangential coordinates
-      const int err = _db->query(&queryData[0], numValues, &quadPtsGlobal[iQuad*spaceDim], spaceDim, cs);
-      if (err) {
-        std::ostringstream msg;
-        msg << "Could not find parameters for physical properties at \n"
-            << "(";
-        for (int i=0; i < spaceDim; ++i)
-          msg << "  " << quadPtsGlobal[iQuad*spaceDim+i];
-        msg << ") for absorbing boundary condition '" << _label
-            << "' using spatial database '" << _db->label() << "'.";
-        throw std::runtime_error(msg.str());
-      } // if
+      const int iPoint = (c-cStart)*numQuadPts + iQuad;
+      for (int i=0; i < numValues; ++i)
+        queryData[i] = queryDataAll[iPoint*numValues+i];
+
       // Nondimensionalize damping constants
       const PylithScalar densityN = _normalizer->nondimensionalize(queryData[0], densityScale);
       const PylithScalar vpN = _normalizer->nondimensionalize(queryData[1], velocityScale);
@@ -29,6 +29,7 @@
 #include "pylith/topology/Stratum.hh" // USES Stratum
 
 #include "pylith/feassemble/Quadrature.hh" // USES Quadrature
+#include "pylith/utils/BatchQuery.hh" // USES BatchQuery
 
 #include "spatialdata/spatialdb/SpatialDB.hh" // USES SpatialDB
 #include "spatialdata/spatialdb/TimeHistory.hh" // USES TimeHistory
@@ -405,9 +406,7 @@ pylith::bc::Neumann::_queryDB(const char* name,
   const int numQuadPts = _quadrature->numQuadPts();
   const int spaceDim = _quadrature->spaceDim();
   
-  // Containers for database query results and quadrature coordinates in
-  // reference geometry.
-  scalar_array valuesCell(numQuadPts*querySize);
+  // Container for quadrature coordinates in reference geometry.
   scalar_array quadPtsGlobal(numQuadPts*spaceDim);
 
   // Get sections.
@@ -428,7 +427,11 @@ pylith::bc::Neumann::_queryDB(const char* name,
   // Compute quadrature information
   _quadrature->initializeGeometry();
 
-  // Loop over cells in boundary mesh and perform queries.
+  // Gather coordinates of quadrature points in boundary mesh and
+  // query database in a batch.
+  const PetscInt numCells = cEnd - cStart;
+  utils::BatchQuery batch;
+  batch.resize(numCells*numQuadPts, spaceDim);
   for(PetscInt c = cStart; c < cEnd; ++c) {
     // Compute geometry information for current cell
     coordsVisitor.getClosure(&coordsCell, c);
@@ -437,30 +440,33 @@ pylith::bc::Neumann::_queryDB(const char* name,
     const scalar_array& quadPtsNondim = _quadrature->quadPts();
     quadPtsGlobal = quadPtsNondim;
     _normalizer->dimensionalize(&quadPtsGlobal[0], quadPtsGlobal.size(), lengthScale);
-    
-    valuesCell = 0.0;
-    for (int iQuad=0, iSpace=0; iQuad < numQuadPts; ++iQuad, iSpace+=spaceDim) {
-      const int err = db->query(&valuesCell[iQuad*querySize], querySize,
-                                &quadPtsGlobal[iSpace], spaceDim, cs);
-      
-      if (err) {
-        std::ostringstream msg;
-        msg << "Could not find values at (";
-        for (int i=0; i < spaceDim; ++i)
-          msg << " " << quadPtsGlobal[i+iSpace];
-        msg << ") for traction boundary condition '" << _label
-            << "' using spatial database '" << db->label() << "'.";
-        throw std::runtime_error(msg.str());
-      } // if
-    } // for
-    _normalizer->nondimensionalize(&valuesCell[0], valuesCell.size(), scale);
 
-    // Update section
+    for (int iQuad=0; iQuad < numQuadPts; ++iQuad)
+      batch.point((c-cStart)*numQuadPts+iQuad, &quadPtsGlobal[iQuad*spaceDim]);
+  } // for
+
+  scalar_array values(numCells*numQuadPts*querySize);
+  const int errPoint = batch.query(numCells ? &values[0] : 0, querySize, db, cs);
+  if (errPoint >= 0) {
+    const double* xyz = batch.point(errPoint);
+    std::ostringstream msg;
+    msg << "Could not find values at (";
+    for (int i=0; i < spaceDim; ++i)
+      msg << " " << xyz[i];
+    msg << ") for traction boundary condition '" << _label
+        << "' using spatial database '" << db->label() << "'.";
+    throw std::runtime_error(msg.str());
+  } // if
+  _normalizer->nondimensionalize(&values[0], values.size(), scale);
+
+  // Update section
+  for(PetscInt c = cStart; c < cEnd; ++c) {
     const PetscInt voff = valueVisitor.sectionOffset(c);
     const PetscInt vdof = valueVisitor.sectionDof(c);
     assert(numQuadPts*querySize == vdof);
+    const PetscInt ioff = (c-cStart)*numQuadPts*querySize;
     for(PetscInt d = 0; d < vdof; ++d)
-      valueArray[voff+d] = valuesCell[d];
+      valueArray[voff+d] = values[ioff+d];
   } // for
 
   PYLITH_METHOD_END;
@@ -26,6 +26,7 @@
 #include "pylith/topology/CoordsVisitor.hh" // USES CoordsVisitor
 #include "pylith/topology/VisitorMesh.hh" // USES VecVisitorMesh
 #include "pylith/topology/Stratum.hh" // USES Stratum
+#include "pylith/utils/BatchQuery.hh" // USES BatchQuery
 
 #include "spatialdata/spatialdb/SpatialDB.hh" // USES SpatialDB
 #include "spatialdata/spatialdb/TimeHistory.hh" // USES TimeHistory
@@ -248,33 +249,40 @@ pylith::bc::TimeDependentPoints::_queryDB(const char* name,
   topology::VecVisitorMesh parametersVisitor(parametersField);
   PetscScalar* parametersArray = parametersVisitor.localArray();
 
-  scalar_array valueVertex(querySize);
+  // Gather dimensionalized coordinates of vertices and query
+  // database in a batch.
   const int numPoints = _points.size();
+  utils::BatchQuery batch;
+  batch.resize(numPoints, spaceDim);
   for (int iPoint=0; iPoint < numPoints; ++iPoint) {
-    // Get dimensionalized coordinates of vertex
     const int coff = coordsVisitor.sectionOffset(_points[iPoint]);
     assert(spaceDim == coordsVisitor.sectionDof(_points[iPoint]));
     for (PetscInt d = 0; d < spaceDim; ++d) {
       coordsVertex[d] = coordArray[coff+d];
     } // for
     normalizer.dimensionalize(&coordsVertex[0], coordsVertex.size(), lengthScale);
+    batch.point(iPoint, &coordsVertex[0]);
+  } // for
 
-    int err = db->query(&valueVertex[0], valueVertex.size(), &coordsVertex[0], coordsVertex.size(), cs);
-    if (err) {
-      std::ostringstream msg;
-      msg << "Error querying for '" << name << "' at (";
-      for (int i=0; i < spaceDim; ++i)
-        msg << "  " << coordsVertex[i];
-      msg << ") using spatial database '" << db->label() << "'.";
-      throw std::runtime_error(msg.str());
-    } // if
-    normalizer.nondimensionalize(&valueVertex[0], valueVertex.size(), scale);
+  scalar_array values(numPoints*querySize);
+  const int errPoint = batch.query(numPoints ? &values[0] : 0, querySize, db, cs);
+  if (errPoint >= 0) {
+    const double* xyz = batch.point(errPoint);
+    std::ostringstream msg;
+    msg << "Error querying for '" << name << "' at (";
+    for (int i=0; i < spaceDim; ++i)
+      msg << "  " << xyz[i];
+    msg << ") using spatial database '" << db->label() << "'.";
+    throw std::runtime_error(msg.str());
+  } // if
+  normalizer.nondimensionalize(&values[0], values.size(), scale);
 
+  for (int iPoint=0; iPoint < numPoints; ++iPoint) {
     // Update section
     const PetscInt off = parametersVisitor.sectionOffset(_points[iPoint]);
     assert(querySize == parametersVisitor.sectionDof(_points[iPoint]));
     for(int i = 0; i < querySize; ++i) {
-      parametersArray[off+i] = valueVertex[i];
+      parametersArray[off+i] = values[iPoint*querySize+i];
     } // for
   } // for
 
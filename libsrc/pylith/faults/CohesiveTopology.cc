@@ -24,6 +24,8 @@
 #include "pylith/topology/Mesh.hh" // USES Mesh
 
 #include <cassert> // USES assert()
+#include <sstream> // USES std::ostringstream
+#include <stdexcept> // USES std::logic_error
 
 #include "pylith/utils/error.h" // USES PYLITH_CHECK_ERROR
 
@@ -105,8 +107,8 @@ pylith::faults::CohesiveTopology::create(topology::Mesh* mesh,
   assert(mesh);
   PetscDM        sdm = NULL;
   PetscDM        dm  = mesh->dmMesh();assert(dm);
-  PetscDMLabel   subpointMap = NULL, label = NULL, mlabel = NULL;
-  PetscInt       dim, cMax, cEnd, numCohesiveCellsOld;
+  PetscDMLabel   label = NULL, mlabel = NULL;
+  PetscInt       cMax, cEnd, numCohesiveCellsOld;
   PetscErrorCode err;
 
   // Have to remember the old number of cohesive cells
@@ -114,9 +116,275 @@ pylith::faults::CohesiveTopology::create(topology::Mesh* mesh,
   err = DMPlexGetHybridBounds(dm, &cMax, NULL, NULL, NULL);PYLITH_CHECK_ERROR(err);
   numCohesiveCellsOld = cEnd - (cMax < 0 ? cEnd : cMax);
   // Create cohesive cells
+  _createSplitLabel(&label, *mesh, faultMesh, faultBdLabel);
+  err = DMPlexConstructCohesiveCells(dm, label, NULL, &sdm);PYLITH_CHECK_ERROR(err);
+
+  err = DMGetLabel(sdm, "material-id", &mlabel);PYLITH_CHECK_ERROR(err);
+  if (mlabel) {
+    err = DMPlexGetHeightStratum(sdm, 0, NULL, &cEnd);PYLITH_CHECK_ERROR(err);
+    err = DMPlexGetHybridBounds(sdm, &cMax, NULL, NULL, NULL);PYLITH_CHECK_ERROR(err);
+    assert(cEnd > cMax + numCohesiveCellsOld);
+    for (PetscInt cell = cMax; cell < cEnd - numCohesiveCellsOld; ++cell) {
+      PetscInt onBd;
+
+      /* Eliminate hybrid cells on the boundary of the split from cohesive label,
+         they are marked with -(cell number) since the hybrid cell number aliases vertices in the old mesh */
+      err = DMLabelGetValue(label, -cell, &onBd);PYLITH_CHECK_ERROR(err);
+      //if (onBd == dim) continue;
+      err = DMLabelSetValue(mlabel, cell, materialId);PYLITH_CHECK_ERROR(err);
+    }
+  }
+  err = DMLabelDestroy(&label);PYLITH_CHECK_ERROR(err);
+
+  PetscReal lengthScale = 1.0;
+  err = DMPlexGetScale(dm, PETSC_UNIT_LENGTH, &lengthScale);PYLITH_CHECK_ERROR(err);
+  err = DMPlexSetScale(sdm, PETSC_UNIT_LENGTH, lengthScale);PYLITH_CHECK_ERROR(err);
+  mesh->dmMesh(sdm);
+} // createInterpolated
+
+// ----------------------------------------------------------------------
+// Create cohesive cells for several faults with a single construction
+// of the mesh topology.
+void
+pylith::faults::CohesiveTopology::create(topology::Mesh* mesh,
+					 const topology::Mesh* const* faultMeshes,
+					 PetscDMLabel* faultBdLabels,
+					 const int* materialIds,
+					 const int numFaults,
+					 bool* inserted)
+{ // create
+  PYLITH_METHOD_BEGIN;
+
+  assert(mesh);
+  assert(faultMeshes || 0 == numFaults);
+  assert(faultBdLabels || 0 == numFaults);
+  assert(materialIds || 0 == numFaults);
+  assert(inserted || 0 == numFaults);
+
+  PetscDM dm = mesh->dmMesh();assert(dm);
+  PetscInt pStart = 0, pEnd = 0, cMax = 0, cEnd = 0;
+  PetscErrorCode err;
+
+  err = DMPlexGetChart(dm, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+  err = DMPlexGetHeightStratum(dm, 0, NULL, &cEnd);PYLITH_CHECK_ERROR(err);
+  err = DMPlexGetHybridBounds(dm, &cMax, NULL, NULL, NULL);PYLITH_CHECK_ERROR(err);
+  const PetscInt numCohesiveCellsOld = cEnd - (cMax < 0 ? cEnd : cMax);
+  const PetscInt faceDepth = mesh->dimension()-1;
+
+  // Create split labels and find faults that overlap an earlier fault
+  // inserted in this pass. Only points of faults that are inserted are
+  // marked, so a deferred fault does not block later faults and a
+  // chain of intersecting faults is inserted in two passes.
+  std::vector<PetscDMLabel> labels(numFaults, NULL);
+  std::vector<int> overlaps(numFaults, 0);
+  std::vector<bool> isSplit(pEnd-pStart, false);
+  std::vector<PetscInt> points;
+  std::vector<PetscInt> values;
+  for (int iFault=0; iFault < numFaults; ++iFault) {
+    assert(faultMeshes[iFault]);
+    _createSplitLabel(&labels[iFault], *mesh, *faultMeshes[iFault], faultBdLabels[iFault]);
+    _getLabelPoints(&points, &values, labels[iFault]);
+
+    const size_t numPoints = points.size();
+    for (size_t i=0; i < numPoints && !overlaps[iFault]; ++i) {
+      assert(points[i] >= pStart && points[i] < pEnd);
+      overlaps[iFault] = isSplit[points[i]-pStart] ? 1 : 0;
+    } // for
+    if (!overlaps[iFault]) {
+      for (size_t i=0; i < numPoints; ++i) {
+	isSplit[points[i]-pStart] = true;
+      } // for
+    } // if
+  } // for
+
+  // In a distributed mesh a fault may overlap an earlier fault on only
+  // some processes, so all processes must agree on which faults to
+  // insert. Points of a fault deferred only by other processes remain
+  // marked here, which may defer additional faults but never inserts
+  // overlapping faults together.
+  int commSize = 1;
+  err = MPI_Comm_size(mesh->comm(), &commSize);PYLITH_CHECK_ERROR(err);
+  if (numFaults > 0 && commSize > 1) {
+    err = MPI_Allreduce(MPI_IN_PLACE, &overlaps[0], numFaults, MPI_INT, MPI_LOR, mesh->comm());PYLITH_CHECK_ERROR(err);
+  } // if
+
+  // Merge labels of faults that do not overlap any earlier fault.
+  PetscDMLabel splitLabel = NULL;
+  std::vector<PetscInt> faceMaterial(pEnd-pStart, -1);
+  for (int iFault=0; iFault < numFaults; ++iFault) {
+    PetscDMLabel label = labels[iFault];
+    inserted[iFault] = !overlaps[iFault];
+    if (overlaps[iFault]) {
+      err = DMLabelDestroy(&label);PYLITH_CHECK_ERROR(err);
+      continue;
+    } // if
+
+    _getLabelPoints(&points, &values, label);
+    const size_t numPoints = points.size();
+    for (size_t i=0; i < numPoints; ++i) {
+      if (faceDepth == values[i]) {
+	faceMaterial[points[i]-pStart] = materialIds[iFault];
+      } // if
+    } // for
+    if (!splitLabel) {
+      splitLabel = label;
+    } else {
+      for (size_t i=0; i < numPoints; ++i) {
+	err = DMLabelSetValue(splitLabel, points[i], values[i]);PYLITH_CHECK_ERROR(err);
+      } // for
+      err = DMLabelDestroy(&label);PYLITH_CHECK_ERROR(err);
+    } // if/else
+  } // for
+  if (!splitLabel) {
+    PYLITH_METHOD_END;
+  } // if
+
+  // Cohesive cells are created in the order of the faces they split.
+  std::vector<PetscInt> cohesiveMaterials;
+  PetscInt numFacesOwned = 0;
+  PetscIS facesIS = NULL;
+  err = DMLabelGetStratumIS(splitLabel, faceDepth, &facesIS);PYLITH_CHECK_ERROR(err);
+  if (facesIS) {
+    PetscInt numFaces = 0;
+    const PetscInt* faces = NULL;
+    err = ISGetLocalSize(facesIS, &numFaces);PYLITH_CHECK_ERROR(err);
+    err = ISGetIndices(facesIS, &faces);PYLITH_CHECK_ERROR(err);
+    cohesiveMaterials.resize(numFaces);
+    for (PetscInt i=0; i < numFaces; ++i) {
+      cohesiveMaterials[i] = faceMaterial[faces[i]-pStart];
+    } // for
+    numFacesOwned = _numOwnedPoints(dm, faces, numFaces);
+    err = ISRestoreIndices(facesIS, &faces);PYLITH_CHECK_ERROR(err);
+    err = ISDestroy(&facesIS);PYLITH_CHECK_ERROR(err);
+  } // if
+
+  // Each process classifies the points around the fault using only
+  // the cells in its partition. A process with cells that touch the
+  // fault at vertices or edges, but have no faces on the fault, may
+  // classify the shared points differently than the owner. The
+  // numbers of cohesive cells would still match, so check the
+  // classification of the shared points directly.
+  if (commSize > 1) {
+    const PetscInt numInconsistent = _numInconsistentSplitPoints(dm, splitLabel, mesh->dimension());
+    if (numInconsistent > 0) {
+      err = DMLabelDestroy(&splitLabel);PYLITH_CHECK_ERROR(err);
+      std::ostringstream msg;
+      msg << "Could not create cohesive cells in distributed mesh. " << numInconsistent
+	  << " points shared among processes are split inconsistently. A process may have cells that touch"
+	  << " the fault only at vertices or edges. Insert the faults before distributing the mesh.";
+      throw std::runtime_error(msg.str());
+    } // if
+  } // if
+
+  PetscDM sdm = NULL;
+  err = DMPlexConstructCohesiveCells(dm, splitLabel, NULL, &sdm);PYLITH_CHECK_ERROR(err);
+  err = DMLabelDestroy(&splitLabel);PYLITH_CHECK_ERROR(err);
+
+  err = DMPlexGetHeightStratum(sdm, 0, NULL, &cEnd);PYLITH_CHECK_ERROR(err);
+  err = DMPlexGetHybridBounds(sdm, &cMax, NULL, NULL, NULL);PYLITH_CHECK_ERROR(err);
+  const PetscInt numCohesiveCellsNew = cEnd - numCohesiveCellsOld - cMax;
+
+  // Faces on the boundary between partitions are present on several
+  // processes. Each copy is split, so each process creates a
+  // cohesive cell for the face, and the point SF of the new DM must
+  // identify the copies of the cohesive cells in the same way as it
+  // identifies the copies of the face.
+  if (commSize > 1) {
+    std::vector<PetscInt> cohesiveCells(numCohesiveCellsNew);
+    for (PetscInt i=0; i < numCohesiveCellsNew; ++i) {
+      cohesiveCells[i] = cMax + i;
+    } // for
+    PetscInt numOwned[2];
+    numOwned[0] = numFacesOwned;
+    numOwned[1] = _numOwnedPoints(sdm, numCohesiveCellsNew > 0 ? &cohesiveCells[0] : NULL, numCohesiveCellsNew);
+    err = MPI_Allreduce(MPI_IN_PLACE, numOwned, 2, MPIU_INT, MPI_SUM, mesh->comm());PYLITH_CHECK_ERROR(err);
+    if (numOwned[0] != numOwned[1]) {
+      std::ostringstream msg;
+      msg << "Internal error while creating cohesive cells in a distributed mesh. Created " << numOwned[1]
+	  << " cohesive cells for " << numOwned[0] << " fault faces.";
+      err = DMDestroy(&sdm);PYLITH_CHECK_ERROR(err);
+      throw std::logic_error(msg.str());
+    } // if
+  } // if
+
+  PetscDMLabel mlabel = NULL;
+  err = DMGetLabel(sdm, "material-id", &mlabel);PYLITH_CHECK_ERROR(err);
+  if (mlabel) {
+    if (numCohesiveCellsNew != PetscInt(cohesiveMaterials.size())) {
+      std::ostringstream msg;
+      msg << "Internal error while creating cohesive cells. Created " << numCohesiveCellsNew
+	  << " cohesive cells for " << cohesiveMaterials.size() << " fault faces.";
+      err = DMDestroy(&sdm);PYLITH_CHECK_ERROR(err);
+      throw std::logic_error(msg.str());
+    } // if
+    for (PetscInt i=0; i < numCohesiveCellsNew; ++i) {
+      err = DMLabelSetValue(mlabel, cMax+i, cohesiveMaterials[i]);PYLITH_CHECK_ERROR(err);
+    } // for
+  } // if
+
+  PetscReal lengthScale = 1.0;
+  err = DMPlexGetScale(dm, PETSC_UNIT_LENGTH, &lengthScale);PYLITH_CHECK_ERROR(err);
+  err = DMPlexSetScale(sdm, PETSC_UNIT_LENGTH, lengthScale);PYLITH_CHECK_ERROR(err);
+  mesh->dmMesh(sdm);
+
+  PYLITH_METHOD_END;
+} // create
+
+// ----------------------------------------------------------------------
+// Form a parallel fault mesh using the cohesive cell information
+void
+pylith::faults::CohesiveTopology::createFaultParallel(topology::Mesh* faultMesh,
+						      const topology::Mesh& mesh,
+						      const int materialId,
+						      const char* label,
+						      const bool constraintCell)
+{ // createFaultParallel
+  PYLITH_METHOD_BEGIN;
+
+  assert(faultMesh);
+  const char    *labelname = "material-id";
+  PetscErrorCode err;
+
+  faultMesh->coordsys(mesh.coordsys());
+
+  PetscDM dmMesh = mesh.dmMesh();assert(dmMesh);
+  PetscDM dmFaultMesh;
+
+
+  err = DMPlexCreateCohesiveSubmesh(dmMesh, constraintCell ? PETSC_TRUE : PETSC_FALSE, labelname, materialId, &dmFaultMesh);PYLITH_CHECK_ERROR(err);
+  err = DMViewFromOptions(dmFaultMesh, NULL, "-pylith_fault_dm_view");PYLITH_CHECK_ERROR(err);
+  err = DMPlexOrient(dmFaultMesh);PYLITH_CHECK_ERROR(err);
+  std::string meshLabel = "fault_" + std::string(label);
+
+  PetscReal lengthScale = 1.0;
+  err = DMPlexGetScale(dmMesh, PETSC_UNIT_LENGTH, &lengthScale);PYLITH_CHECK_ERROR(err);
+  err = DMPlexSetScale(dmFaultMesh, PETSC_UNIT_LENGTH, lengthScale);PYLITH_CHECK_ERROR(err);
+
+  faultMesh->dmMesh(dmFaultMesh, meshLabel.c_str());
+
+  PYLITH_METHOD_END;
+} // createFaultParallel
+
+// ----------------------------------------------------------------------
+// Create label marking points to split for a fault.
+void
+pylith::faults::CohesiveTopology::_createSplitLabel(PetscDMLabel* label,
+						    const topology::Mesh& mesh,
+						    const topology::Mesh& faultMesh,
+						    PetscDMLabel faultBdLabel)
+{ // _createSplitLabel
+  PYLITH_METHOD_BEGIN;
+
+  assert(label);
+  PetscDM        dm  = mesh.dmMesh();assert(dm);
+  PetscDMLabel   subpointMap = NULL;
+  PetscInt       dim;
+  PetscErrorCode err;
+
+  err = DMPlexGetSubpointMap(faultMesh.dmMesh(), &subpointMap);PYLITH_CHECK_ERROR(err);
   err = DMPlexGetSubpointMap(faultMesh.dmMesh(), &subpointMap);PYLITH_CHECK_ERROR(err);
-  err = DMLabelDuplicate(subpointMap, &label);PYLITH_CHECK_ERROR(err);
-  err = DMLabelClearStratum(label, mesh->dimension());PYLITH_CHECK_ERROR(err);
+  err = DMLabelDuplicate(subpointMap, label);PYLITH_CHECK_ERROR(err);
+  err = DMLabelClearStratum(*label, mesh.dimension());PYLITH_CHECK_ERROR(err);
   // Fix over-aggressive completion of boundary label
   err = DMGetDimension(dm, &dim);PYLITH_CHECK_ERROR(err);
   if (faultBdLabel && (dim > 2)) {
@@ -157,14 +425,14 @@ pylith::faults::CohesiveTopology::create(topology::Mesh* mesh,
           err = DMPlexGetSupportSize(dm, verts[0], &supportSizeA);PYLITH_CHECK_ERROR(err);
           err = DMPlexGetSupport(dm, verts[0], &supportA);PYLITH_CHECK_ERROR(err);
           for (s = 0, sA = 0; s < supportSizeA; ++s) {
-            err = DMLabelGetValue(label, supportA[s], &val);PYLITH_CHECK_ERROR(err);
+            err = DMLabelGetValue(*label, supportA[s], &val);PYLITH_CHECK_ERROR(err);
             err = DMLabelGetValue(faultBdLabel, supportA[s], &bval);PYLITH_CHECK_ERROR(err);
             if (val >= 0 && bval >= 0) ++sA;
           }
           err = DMPlexGetSupportSize(dm, verts[1], &supportSizeB);PYLITH_CHECK_ERROR(err);
           err = DMPlexGetSupport(dm, verts[1], &supportB);PYLITH_CHECK_ERROR(err);
           for (s = 0, sB = 0; s < supportSizeB; ++s) {
-            err = DMLabelGetValue(label, supportB[s], &val);PYLITH_CHECK_ERROR(err);
+            err = DMLabelGetValue(*label, supportB[s], &val);PYLITH_CHECK_ERROR(err);
             err = DMLabelGetValue(faultBdLabel, supportB[s], &bval);PYLITH_CHECK_ERROR(err);
             if (val >= 0 && bval >= 0) ++sB;
           }
@@ -185,66 +453,148 @@ pylith::faults::CohesiveTopology::create(topology::Mesh* mesh,
     err = ISDestroy(&bdIS);PYLITH_CHECK_ERROR(err);
   }
   // Completes the set of cells scheduled to be replaced
-  err = DMPlexLabelCohesiveComplete(dm, label, faultBdLabel, PETSC_FALSE, faultMesh.dmMesh());PYLITH_CHECK_ERROR(err);
-  err = DMPlexConstructCohesiveCells(dm, label, NULL, &sdm);PYLITH_CHECK_ERROR(err);
+  err = DMPlexLabelCohesiveComplete(dm, *label, faultBdLabel, PETSC_FALSE, faultMesh.dmMesh());PYLITH_CHECK_ERROR(err);
 
-  err = DMGetLabel(sdm, "material-id", &mlabel);PYLITH_CHECK_ERROR(err);
-  if (mlabel) {
-    err = DMPlexGetHeightStratum(sdm, 0, NULL, &cEnd);PYLITH_CHECK_ERROR(err);
-    err = DMPlexGetHybridBounds(sdm, &cMax, NULL, NULL, NULL);PYLITH_CHECK_ERROR(err);
-    assert(cEnd > cMax + numCohesiveCellsOld);
-    for (PetscInt cell = cMax; cell < cEnd - numCohesiveCellsOld; ++cell) {
-      PetscInt onBd;
+  PYLITH_METHOD_END;
+} // _createSplitLabel
 
-      /* Eliminate hybrid cells on the boundary of the split from cohesive label,
-         they are marked with -(cell number) since the hybrid cell number aliases vertices in the old mesh */
-      err = DMLabelGetValue(label, -cell, &onBd);PYLITH_CHECK_ERROR(err);
-      //if (onBd == dim) continue;
-      err = DMLabelSetValue(mlabel, cell, materialId);PYLITH_CHECK_ERROR(err);
-    }
-  }
-  err = DMLabelDestroy(&label);PYLITH_CHECK_ERROR(err);
+// ----------------------------------------------------------------------
+// Get points and values in label.
+void
+pylith::faults::CohesiveTopology::_getLabelPoints(std::vector<PetscInt>* points,
+						  std::vector<PetscInt>* values,
+						  PetscDMLabel label)
+{ // _getLabelPoints
+  PYLITH_METHOD_BEGIN;
 
-  PetscReal lengthScale = 1.0;
-  err = DMPlexGetScale(dm, PETSC_UNIT_LENGTH, &lengthScale);PYLITH_CHECK_ERROR(err);
-  err = DMPlexSetScale(sdm, PETSC_UNIT_LENGTH, lengthScale);PYLITH_CHECK_ERROR(err);
-  mesh->dmMesh(sdm);
-} // createInterpolated
+  assert(points);
+  assert(values);
+  assert(label);
+
+  points->clear();
+  values->clear();
+
+  PetscIS valuesIS = NULL;
+  PetscInt numValues = 0;
+  const PetscInt* labelValues = NULL;
+  PetscErrorCode err;
+  err = DMLabelGetValueIS(label, &valuesIS);PYLITH_CHECK_ERROR(err);
+  err = ISGetLocalSize(valuesIS, &numValues);PYLITH_CHECK_ERROR(err);
+  err = ISGetIndices(valuesIS, &labelValues);PYLITH_CHECK_ERROR(err);
+  for (PetscInt iValue=0; iValue < numValues; ++iValue) {
+    PetscIS pointsIS = NULL;
+    err = DMLabelGetStratumIS(label, labelValues[iValue], &pointsIS);PYLITH_CHECK_ERROR(err);
+    if (!pointsIS) {
+      continue;
+    } // if
+    PetscInt numPoints = 0;
+    const PetscInt* labelPoints = NULL;
+    err = ISGetLocalSize(pointsIS, &numPoints);PYLITH_CHECK_ERROR(err);
+    err = ISGetIndices(pointsIS, &labelPoints);PYLITH_CHECK_ERROR(err);
+    points->insert(points->end(), labelPoints, labelPoints+numPoints);
+    values->insert(values->end(), numPoints, labelValues[iValue]);
+    err = ISRestoreIndices(pointsIS, &labelPoints);PYLITH_CHECK_ERROR(err);
+    err = ISDestroy(&pointsIS);PYLITH_CHECK_ERROR(err);
+  } // for
+  err = ISRestoreIndices(valuesIS, &labelValues);PYLITH_CHECK_ERROR(err);
+  err = ISDestroy(&valuesIS);PYLITH_CHECK_ERROR(err);
+
+  PYLITH_METHOD_END;
+} // _getLabelPoints
 
 // ----------------------------------------------------------------------
-// Form a parallel fault mesh using the cohesive cell information
-void
-pylith::faults::CohesiveTopology::createFaultParallel(topology::Mesh* faultMesh,
-						      const topology::Mesh& mesh,
-						      const int materialId,
-						      const char* label,
-						      const bool constraintCell)
-{ // createFaultParallel
+// Get number of points owned by this process.
+PetscInt
+pylith::faults::CohesiveTopology::_numOwnedPoints(PetscDM dm,
+						  const PetscInt* points,
+						  const PetscInt numPoints)
+{ // _numOwnedPoints
   PYLITH_METHOD_BEGIN;
 
-  assert(faultMesh);
-  const char    *labelname = "material-id";
+  assert(dm);
+  assert(points || 0 == numPoints);
+
   PetscErrorCode err;
+  PetscSF pointSF = NULL;
+  PetscInt numRoots = 0, numLeaves = 0;
+  const PetscInt* leaves = NULL;
+  err = DMGetPointSF(dm, &pointSF);PYLITH_CHECK_ERROR(err);
+  err = PetscSFGetGraph(pointSF, &numRoots, &numLeaves, &leaves, NULL);PYLITH_CHECK_ERROR(err);
+  if (numRoots < 0 || numLeaves <= 0) {
+    PYLITH_METHOD_RETURN(numPoints);
+  } // if
 
-  faultMesh->coordsys(mesh.coordsys());
+  PetscInt pStart = 0, pEnd = 0;
+  err = DMPlexGetChart(dm, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+  std::vector<bool> isLeaf(pEnd-pStart, false);
+  for (PetscInt i=0; i < numLeaves; ++i) {
+    const PetscInt leaf = leaves ? leaves[i] : i;
+    isLeaf[leaf-pStart] = true;
+  } // for
 
-  PetscDM dmMesh = mesh.dmMesh();assert(dmMesh);
-  PetscDM dmFaultMesh;
+  PetscInt numOwned = 0;
+  for (PetscInt i=0; i < numPoints; ++i) {
+    assert(points[i] >= pStart && points[i] < pEnd);
+    numOwned += isLeaf[points[i]-pStart] ? 0 : 1;
+  } // for
 
+  PYLITH_METHOD_RETURN(numOwned);
+} // _numOwnedPoints
 
-  err = DMPlexCreateCohesiveSubmesh(dmMesh, constraintCell ? PETSC_TRUE : PETSC_FALSE, labelname, materialId, &dmFaultMesh);PYLITH_CHECK_ERROR(err);
-  err = DMViewFromOptions(dmFaultMesh, NULL, "-pylith_fault_dm_view");PYLITH_CHECK_ERROR(err);
-  err = DMPlexOrient(dmFaultMesh);PYLITH_CHECK_ERROR(err);
-  std::string meshLabel = "fault_" + std::string(label);
+// ----------------------------------------------------------------------
+// Get number of shared points classified inconsistently by the split label.
+PetscInt
+pylith::faults::CohesiveTopology::_numInconsistentSplitPoints(PetscDM dm,
+							      PetscDMLabel splitLabel,
+							      const int dim)
+{ // _numInconsistentSplitPoints
+  PYLITH_METHOD_BEGIN;
 
-  PetscReal lengthScale = 1.0;
-  err = DMPlexGetScale(dmMesh, PETSC_UNIT_LENGTH, &lengthScale);PYLITH_CHECK_ERROR(err);
-  err = DMPlexSetScale(dmFaultMesh, PETSC_UNIT_LENGTH, lengthScale);PYLITH_CHECK_ERROR(err);
+  assert(dm);
+  assert(splitLabel);
 
-  faultMesh->dmMesh(dmFaultMesh, meshLabel.c_str());
+  PetscErrorCode err;
+  PetscSF pointSF = NULL;
+  PetscInt numRoots = 0, numLeaves = 0;
+  const PetscInt* leaves = NULL;
+  err = DMGetPointSF(dm, &pointSF);PYLITH_CHECK_ERROR(err);
+  err = PetscSFGetGraph(pointSF, &numRoots, &numLeaves, &leaves, NULL);PYLITH_CHECK_ERROR(err);
+
+  PetscInt pStart = 0, pEnd = 0;
+  err = DMPlexGetChart(dm, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+  assert(0 == pStart);
+
+  // Classify points: 0 = split (on fault), 1 = positive side or not
+  // near fault, 2 = negative side. Points on the positive side keep
+  // the original points in their cones, just like points that are
+  // not in the label.
+  std::vector<PetscInt> classes(pEnd, 1);
+  for (PetscInt p=pStart; p < pEnd; ++p) {
+    PetscInt value = -1;
+    err = DMLabelGetValue(splitLabel, p, &value);PYLITH_CHECK_ERROR(err);
+    if (value >= 0 && value < dim) {
+      classes[p] = 0;
+    } else if (value < -1) {
+      classes[p] = 2;
+    } // if/else
+  } // for
+
+  PetscInt numInconsistent = 0;
+  if (numRoots >= 0) {
+    std::vector<PetscInt> rootClasses(pEnd, -1);
+    PetscInt* classesArray = pEnd > 0 ? &classes[0] : NULL;
+    PetscInt* rootClassesArray = pEnd > 0 ? &rootClasses[0] : NULL;
+    err = PetscSFBroadcastBegin(pointSF, MPIU_INT, classesArray, rootClassesArray);PYLITH_CHECK_ERROR(err);
+    err = PetscSFBroadcastEnd(pointSF, MPIU_INT, classesArray, rootClassesArray);PYLITH_CHECK_ERROR(err);
+    for (PetscInt i=0; i < numLeaves; ++i) {
+      const PetscInt leaf = leaves ? leaves[i] : i;
+      numInconsistent += (rootClasses[leaf] != classes[leaf]) ? 1 : 0;
+    } // for
+  } // if
+  err = MPI_Allreduce(MPI_IN_PLACE, &numInconsistent, 1, MPIU_INT, MPI_SUM, PetscObjectComm((PetscObject) dm));PYLITH_CHECK_ERROR(err);
 
-  PYLITH_METHOD_END;
-} // createFaultParallel
+  PYLITH_METHOD_RETURN(numInconsistent);
+} // _numInconsistentSplitPoints
 
 
 // End of file
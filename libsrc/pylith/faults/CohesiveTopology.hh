@@ -30,6 +30,7 @@
 #include "pylith/topology/Mesh.hh" // USES Mesh::IntSection
 
 #include <map>
+#include <vector> // USES std::vector
 
 // CohesiveTopology -----------------------------------------------------
 /// Creation of cohesive cells.
@@ -78,6 +79,39 @@ public :
               int& firstFaultCell,
               const bool constraintCell = false);
 
+  /** Create cohesive cells for several faults in an interpolated mesh
+   * with a single construction of the mesh topology.
+   *
+   * A fault is inserted only if the points split by the fault do not
+   * overlap the points split by an earlier fault in the list that is
+   * inserted in this call. Faults that are not inserted do not block
+   * later faults, so a chain of intersecting faults is inserted in
+   * two calls. Faults that are not inserted must be inserted in a
+   * later call using fault meshes created from the updated mesh.
+   *
+   * The mesh may be distributed. In that case the method must be
+   * called on all processes, and each process inserts cohesive cells
+   * for the fault faces in its partition. Each process classifies the
+   * points around the fault using the cells in its partition, so a
+   * process with cells that touch the fault only at vertices or edges
+   * cannot classify them. An exception is thrown on all processes if
+   * the classification of any shared point differs among processes.
+   *
+   * @param mesh Finite-element mesh.
+   * @param faultMeshes Array of finite-element meshes of faults.
+   * @param faultBdLabels Array of labels for buried edges of faults (NULL if none).
+   * @param materialIds Array of material ids for cohesive elements.
+   * @param numFaults Number of faults.
+   * @param inserted Array of flags indicating which faults were inserted (output).
+   */
+  static
+  void create(topology::Mesh* mesh,
+	      const topology::Mesh* const* faultMeshes,
+	      PetscDMLabel* faultBdLabels,
+	      const int* materialIds,
+	      const int numFaults,
+	      bool* inserted);
+
   /** Create (distributed) fault mesh from cohesive cells.
    *
    * @param faultMesh Finite-element mesh of fault (output).
@@ -94,6 +128,62 @@ public :
 			   const char* label,
 			   const bool constraintCell =false);
 
+  // PRIVATE METHODS ////////////////////////////////////////////////////
+private :
+
+  /** Create label marking points to split for a fault.
+   *
+   * @param label Label marking points to split (output).
+   * @param mesh Finite-element mesh.
+   * @param faultMesh Finite-element mesh of fault.
+   * @param faultBdLabel Label for buried edges of fault (NULL if none).
+   */
+  static
+  void _createSplitLabel(PetscDMLabel* label,
+			 const topology::Mesh& mesh,
+			 const topology::Mesh& faultMesh,
+			 PetscDMLabel faultBdLabel);
+
+  /** Get points and values in label.
+   *
+   * @param points Points in label (output).
+   * @param values Values of points in label (output).
+   * @param label Label.
+   */
+  static
+  void _getLabelPoints(std::vector<PetscInt>* points,
+		       std::vector<PetscInt>* values,
+		       PetscDMLabel label);
+
+  /** Get number of points owned by this process.
+   *
+   * Points that are leaves of the point SF are owned by other processes.
+   *
+   * @param dm PETSc DM for mesh.
+   * @param points Array of points.
+   * @param numPoints Number of points.
+   * @returns Number of points owned by this process.
+   */
+  static
+  PetscInt _numOwnedPoints(PetscDM dm,
+			   const PetscInt* points,
+			   const PetscInt numPoints);
+
+  /** Get number of points shared among processes that are classified
+   * differently by the split label on the process that owns the
+   * point and a process with a copy of the point. Must be called on
+   * all processes.
+   *
+   * @param dm PETSc DM for mesh.
+   * @param splitLabel Label marking points to split.
+   * @param dim Dimension of mesh.
+   * @returns Number of inconsistent points over all processes.
+   */
+  static
+  PetscInt _numInconsistentSplitPoints(PetscDM dm,
+				       PetscDMLabel splitLabel,
+				       const int dim);
+
 }; // class CohesiveTopology
 
 #endif // pylith_faults_cohesivetopology_hh
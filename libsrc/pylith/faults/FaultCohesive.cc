@@ -28,6 +28,7 @@
 #include <cassert> // USES assert()
 #include <sstream> // USES std::ostringstream
 #include <stdexcept> // USES std::runtime_error
+#include <vector> // USES std::vector
 
 // ----------------------------------------------------------------------
 // Default constructor.
@@ -89,7 +90,10 @@ pylith::faults::FaultCohesive::numVerticesNoMesh(const topology::Mesh& mesh) con
     // We do not have labels on all ranks until after distribution
     err = MPI_Comm_rank(PetscObjectComm((PetscObject) dmMesh), &rank);PYLITH_CHECK_ERROR(err);
     err = DMHasLabel(dmMesh, label(), &hasLabel);PYLITH_CHECK_ERROR(err);
-    if (!hasLabel && !rank) {
+    // Reduce flag, so all processes throw the exception.
+    int missingLabel = (!hasLabel && !rank) ? 1 : 0;
+    err = MPI_Allreduce(MPI_IN_PLACE, &missingLabel, 1, MPI_INT, MPI_MAX, mesh.comm());PYLITH_CHECK_ERROR(err);
+    if (missingLabel) {
       std::ostringstream msg;
       msg << "Mesh missing group of vertices '" << label() << "' for fault interface condition.";
       throw std::runtime_error(msg.str());
@@ -118,48 +122,9 @@ pylith::faults::FaultCohesive::adjustTopology(topology::Mesh* const mesh,
   
   try {
     topology::Mesh faultMesh;
-  
-    // Get group of vertices associated with fault
-    PetscDM dmMesh = mesh->dmMesh();assert(dmMesh);
-    
-    if (!_useFaultMesh) {
-      const char* charlabel = label();
-
-      PetscDMLabel   groupField;
-      PetscBool      hasLabel;
-      PetscInt       depth, gdepth, dim;
-      PetscMPIInt    rank;
-      PetscErrorCode err;
-      // We do not have labels on all ranks until after distribution
-      err = MPI_Comm_rank(PetscObjectComm((PetscObject) dmMesh), &rank);PYLITH_CHECK_ERROR(err);
-      err = DMHasLabel(dmMesh, charlabel, &hasLabel);PYLITH_CHECK_ERROR(err);
-      if (!hasLabel && !rank) {
-        std::ostringstream msg;
-        msg << "Mesh missing group of vertices '" << label()
-            << "' for fault interface condition.";
-        throw std::runtime_error(msg.str());
-      } // if
-      err = DMGetDimension(dmMesh, &dim);PYLITH_CHECK_ERROR(err);
-      err = DMPlexGetDepth(dmMesh, &depth);PYLITH_CHECK_ERROR(err);
-      err = MPI_Allreduce(&depth, &gdepth, 1, MPIU_INT, MPI_MAX, mesh->comm());PYLITH_CHECK_ERROR(err);
-      err = DMGetLabel(dmMesh, charlabel, &groupField);PYLITH_CHECK_ERROR(err);
-      CohesiveTopology::createFault(&faultMesh, *mesh, groupField);
-      PetscDMLabel faultBdLabel = NULL;
-
-      // We do not have labels on all ranks until after distribution
-      if (strlen(edge()) > 0 && !rank) {
-	err = DMGetLabel(dmMesh, edge(), &faultBdLabel);PYLITH_CHECK_ERROR(err);
-	if (!faultBdLabel) {
-	  std::ostringstream msg;
-	  msg << "Could not find nodeset/pset '" << edge() << "' marking buried edges for fault '" << label() << "'.";
-	  throw std::runtime_error(msg.str());
-	} // if
-      } // if
-      CohesiveTopology::create(mesh, faultMesh, faultBdLabel, id(), *firstFaultVertex, *firstLagrangeVertex, *firstFaultCell, useLagrangeConstraints());
-    } else {
-      assert(3 == mesh->dimension());
-      throw std::logic_error("Support for UCD fault files no longer implemented."); 
-    } // if/else
+    PetscDMLabel faultBdLabel = NULL;
+    _createFaultMesh(&faultMesh, &faultBdLabel, *mesh);
+    CohesiveTopology::create(mesh, faultMesh, faultBdLabel, id(), *firstFaultVertex, *firstLagrangeVertex, *firstFaultCell, useLagrangeConstraints());
 
     // Check consistency of mesh.
     topology::MeshOps::checkTopology(*mesh);
@@ -176,5 +141,152 @@ pylith::faults::FaultCohesive::adjustTopology(topology::Mesh* const mesh,
   PYLITH_METHOD_END;
 } // adjustTopology
 
+// ----------------------------------------------------------------------
+// Adjust mesh topology for several faults.
+void
+pylith::faults::FaultCohesive::adjustTopologyAll(topology::Mesh* const mesh,
+						 FaultCohesive** faults,
+						 const int numFaults)
+{ // adjustTopologyAll
+  PYLITH_METHOD_BEGIN;
+
+  assert(mesh);
+  assert(faults || 0 == numFaults);
+
+  std::vector<int> remaining(numFaults);
+  for (int i=0; i < numFaults; ++i) {
+    assert(faults[i]);
+    remaining[i] = i;
+  } // for
+
+  // Each pass inserts the remaining faults that do not intersect an
+  // earlier fault inserted in the same pass.
+  while (!remaining.empty()) {
+    const size_t numRemaining = remaining.size();
+    std::vector<topology::Mesh*> faultMeshes(numRemaining, (topology::Mesh*)0);
+    std::vector<PetscDMLabel> faultBdLabels(numRemaining, (PetscDMLabel)NULL);
+    std::vector<int> materialIds(numRemaining);
+    bool* inserted = new bool[numRemaining];
+    int iFault = -1;
+    try {
+      for (size_t i=0; i < numRemaining; ++i) {
+	iFault = remaining[i];
+	faultMeshes[i] = new topology::Mesh;
+	faults[iFault]->_createFaultMesh(faultMeshes[i], &faultBdLabels[i], *mesh);
+	materialIds[i] = faults[iFault]->id();
+      } // for
+      iFault = -1;
+      CohesiveTopology::create(mesh, &faultMeshes[0], &faultBdLabels[0], &materialIds[0], numRemaining, inserted);
+      for (size_t i=0; i < numRemaining; ++i) {
+	if (inserted[i]) {
+	  iFault = remaining[i];
+	  topology::MeshOps::checkTopology(*faultMeshes[i]);
+	} // if
+      } // for
+    } catch (const std::exception& err) {
+      for (size_t i=0; i < numRemaining; ++i) {
+	delete faultMeshes[i]; faultMeshes[i] = 0;
+      } // for
+      delete[] inserted; inserted = 0;
+      std::ostringstream msg;
+      if (iFault >= 0) {
+	msg << "Error occurred while adjusting topology to create cohesive cells for fault '" << faults[iFault]->label() << "'.\n";
+      } else {
+	msg << "Error occurred while adjusting topology to create cohesive cells for faults.\n";
+      } // if/else
+      msg << err.what();
+      throw std::runtime_error(msg.str());
+    } // try/catch
+
+    std::vector<int> deferred;
+    for (size_t i=0; i < numRemaining; ++i) {
+      delete faultMeshes[i]; faultMeshes[i] = 0;
+      if (!inserted[i]) {
+	deferred.push_back(remaining[i]);
+      } // if
+    } // for
+    delete[] inserted; inserted = 0;
+    if (deferred.size() == numRemaining) {
+      throw std::logic_error("Could not insert any of the remaining faults.");
+    } // if
+    remaining = deferred;
+  } // while
+
+  // Check consistency of mesh.
+  try {
+    topology::MeshOps::checkTopology(*mesh);
+  } catch (const std::exception& err) {
+    std::ostringstream msg;
+    msg << "Error occurred while adjusting topology to create cohesive cells for faults.\n"
+	<< err.what();
+    throw std::runtime_error(msg.str());
+  } // try/catch
+
+  PYLITH_METHOD_END;
+} // adjustTopologyAll
+
+// ----------------------------------------------------------------------
+// Create fault mesh from group of vertices associated with fault.
+void
+pylith::faults::FaultCohesive::_createFaultMesh(topology::Mesh* faultMesh,
+						PetscDMLabel* faultBdLabel,
+						const topology::Mesh& mesh) const
+{ // _createFaultMesh
+  PYLITH_METHOD_BEGIN;
+
+  assert(faultMesh);
+  assert(faultBdLabel);
+  assert(std::string("") != label());
+
+  *faultBdLabel = NULL;
+
+  // Get group of vertices associated with fault
+  PetscDM dmMesh = mesh.dmMesh();assert(dmMesh);
+
+  if (!_useFaultMesh) {
+    const char* charlabel = label();
+
+    PetscDMLabel   groupField;
+    PetscBool      hasLabel;
+    PetscInt       depth, gdepth, dim;
+    PetscMPIInt    rank;
+    PetscErrorCode err;
+    // We do not have labels on all ranks until after distribution
+    err = MPI_Comm_rank(PetscObjectComm((PetscObject) dmMesh), &rank);PYLITH_CHECK_ERROR(err);
+    err = DMHasLabel(dmMesh, charlabel, &hasLabel);PYLITH_CHECK_ERROR(err);
+    // Reduce flag, so all processes throw the exception.
+    int missingLabel = (!hasLabel && !rank) ? 1 : 0;
+    err = MPI_Allreduce(MPI_IN_PLACE, &missingLabel, 1, MPI_INT, MPI_MAX, mesh.comm());PYLITH_CHECK_ERROR(err);
+    if (missingLabel) {
+      std::ostringstream msg;
+      msg << "Mesh missing group of vertices '" << label()
+	  << "' for fault interface condition.";
+      throw std::runtime_error(msg.str());
+    } // if
+    err = DMGetDimension(dmMesh, &dim);PYLITH_CHECK_ERROR(err);
+    err = DMPlexGetDepth(dmMesh, &depth);PYLITH_CHECK_ERROR(err);
+    err = MPI_Allreduce(&depth, &gdepth, 1, MPIU_INT, MPI_MAX, mesh.comm());PYLITH_CHECK_ERROR(err);
+    err = DMGetLabel(dmMesh, charlabel, &groupField);PYLITH_CHECK_ERROR(err);
+    CohesiveTopology::createFault(faultMesh, mesh, groupField);
+
+    // We do not have labels on all ranks until after distribution
+    if (strlen(edge()) > 0) {
+      err = DMGetLabel(dmMesh, edge(), faultBdLabel);PYLITH_CHECK_ERROR(err);
+      int missingEdge = (!*faultBdLabel && !rank) ? 1 : 0;
+      err = MPI_Allreduce(MPI_IN_PLACE, &missingEdge, 1, MPI_INT, MPI_MAX, mesh.comm());PYLITH_CHECK_ERROR(err);
+      if (missingEdge) {
+	std::ostringstream msg;
+	msg << "Could not find nodeset/pset '" << edge() << "' marking buried edges for fault '" << label() << "'.";
+	throw std::runtime_error(msg.str());
+      } // if
+    } // if
+  } else {
+    assert(3 == mesh.dimension());
+    throw std::logic_error("Support for UCD fault files no longer implemented.");
+  } // if/else
+
+  PYLITH_METHOD_END;
+} // _createFaultMesh
+
 
 // End of file 
@@ -89,6 +89,23 @@ public :
                       int *firstLagrangeVertex,
                       int *firstFaultCell);
 
+  /** Adjust mesh topology for several faults.
+   *
+   * Cohesive cells for faults that do not intersect are created with
+   * a single construction of the mesh topology. A fault that
+   * intersects an earlier fault inserted in the same pass is deferred
+   * to a later pass. Deferred faults do not block later faults, so a
+   * fault may be inserted before an earlier fault that it intersects.
+   *
+   * @param mesh PETSc mesh.
+   * @param faults Array of faults.
+   * @param numFaults Number of faults.
+   */
+  static
+  void adjustTopologyAll(topology::Mesh* const mesh,
+			 FaultCohesive** faults,
+			 const int numFaults);
+
   /** Cohesive cells use Lagrange multiplier constraints?
    *
    * @returns True if implementation using Lagrange multiplier
@@ -113,6 +130,19 @@ protected :
   /// Map label of cohesive cell to label of fault cell.
   std::map<PetscInt, PetscInt> _cohesiveToFault;
 
+// PRIVATE METHODS ////////////////////////////////////////////////////
+private :
+
+  /** Create fault mesh from group of vertices associated with fault.
+   *
+   * @param faultMesh Finite-element mesh of fault (output).
+   * @param faultBdLabel Label for buried edges of fault (output, NULL if none).
+   * @param mesh PETSc mesh.
+   */
+  void _createFaultMesh(topology::Mesh* faultMesh,
+			PetscDMLabel* faultBdLabel,
+			const topology::Mesh& mesh) const;
+
 // PRIVATE MEMBERS ////////////////////////////////////////////////////
 private :
 
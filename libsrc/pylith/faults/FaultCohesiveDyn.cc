@@ -22,6 +22,7 @@
 
 #include "CohesiveTopology.hh" // USES CohesiveTopology
 #include "TractPerturbation.hh" // HOLDSA TractPerturbation
+#include "FaultStatistics.hh" // HOLDSA FaultStatistics
 
 #include "pylith/topology/Mesh.hh" // USES Mesh
 #include "pylith/topology/Field.hh" // USES Field
@@ -66,6 +67,10 @@ pylith::faults::FaultCohesiveDyn::FaultCohesiveDyn(void) :
     _zeroToleranceNormal(1.0e-10),
     _tractPerturbation(0),
     _friction(0),
+    _dbStats(0),
+    _stats(0),
+    _statsFilename(""),
+    _statsSlipRateThreshold(0.0),
     _jacobian(0),
     _ksp(0),
     _openFreeSurf(true)
@@ -89,7 +94,9 @@ void pylith::faults::FaultCohesiveDyn::deallocate(void)
 
     _tractPerturbation = 0; // :TODO: Use shared pointer
     _friction = 0; // :TODO: Use shared pointer
+    _dbStats = 0; // :TODO: Use shared pointer
 
+    delete _stats; _stats = 0;
     delete _jacobian; _jacobian = 0;
     PetscErrorCode err = KSPDestroy(&_ksp); PYLITH_CHECK_ERROR(err);
 
@@ -151,6 +158,45 @@ pylith::faults::FaultCohesiveDyn::openFreeSurf(const bool value)
     _openFreeSurf = value;
 } // openFreeSurf
 
+// ----------------------------------------------------------------------
+// Set spatial database with density and Vs for rupture statistics.
+void
+pylith::faults::FaultCohesiveDyn::statsProperties(spatialdata::spatialdb::SpatialDB* db)
+{ // statsProperties
+    _dbStats = db;
+} // statsProperties
+
+// ----------------------------------------------------------------------
+// Set slip rate threshold for detecting events in rupture statistics.
+void
+pylith::faults::FaultCohesiveDyn::statsSlipRateThreshold(const PylithScalar value)
+{ // statsSlipRateThreshold
+    if (value < 0.0) {
+        std::ostringstream msg;
+        msg << "Slip rate threshold (" << value << ") for detecting events on "
+        "fault " << label() << " must be nonnegative.";
+        throw std::runtime_error(msg.str());
+    } // if
+
+    _statsSlipRateThreshold = value;
+} // statsSlipRateThreshold
+
+// ----------------------------------------------------------------------
+// Set filename for tables of rupture statistics.
+void
+pylith::faults::FaultCohesiveDyn::statsFilename(const char* filename)
+{ // statsFilename
+    _statsFilename = filename;
+} // statsFilename
+
+// ----------------------------------------------------------------------
+// Get rupture statistics.
+const pylith::faults::FaultStatistics*
+pylith::faults::FaultCohesiveDyn::statistics(void) const
+{ // statistics
+    return _stats;
+} // statistics
+
 // ----------------------------------------------------------------------
 // Initialize fault. Determine orientation and setup boundary
 void
@@ -189,6 +235,20 @@ pylith::faults::FaultCohesiveDyn::initialize(const topology::Mesh& mesh,
     velRel.vectorFieldType(topology::FieldBase::VECTOR);
     velRel.scale(_normalizer->lengthScale() / _normalizer->timeScale());
 
+    // Cache area and shear modulus at fault vertices for rupture statistics.
+    if (_dbStats) {
+        const int numVertices = _cohesiveVertices.size();
+        std::vector<PetscInt> statsVertices(numVertices);
+        for (int iVertex=0; iVertex < numVertices; ++iVertex) {
+            statsVertices[iVertex] = (_cohesiveVertices[iVertex].lagrange < 0) ? -1 : _cohesiveVertices[iVertex].fault;
+        } // for
+
+        delete _stats; _stats = new FaultStatistics;assert(_stats);
+        _stats->slipRateThreshold(_statsSlipRateThreshold);
+        _stats->filename(_statsFilename.c_str());
+        _stats->initialize(*_faultMesh, _fields->get("area"), statsVertices, _dbStats, *_normalizer);
+    } // if
+
     PYLITH_METHOD_END;
 } // initialize
 
@@ -430,6 +490,7 @@ pylith::faults::FaultCohesiveDyn::updateStateVars(const PylithScalar t,
     const PetscScalar* orientationArray = orientationVisitor.localArray();
 
     const int numVertices = _cohesiveVertices.size();
+    _friction->createPropsStateVarsVisitors();
     for (int iVertex=0; iVertex < numVertices; ++iVertex) {
         const int e_lagrange = _cohesiveVertices[iVertex].lagrange;
         const int v_fault = _cohesiveVertices[iVertex].fault;
@@ -489,6 +550,9 @@ pylith::faults::FaultCohesiveDyn::updateStateVars(const PylithScalar t,
             const PylithScalar slipRateMag = fabs(slipRateVertex[0]);
             const PylithScalar tractionNormal = tractionTpdtVertex[1];
             _friction->updateStateVars(t, slipMag, slipRateMag, tractionNormal, v_fault);
+            if (_stats) {
+                _stats->accumulate(iVertex, slipMag, slipRateMag);
+            } // if
             break;
         } // case 2
         case 3: { // case 3
@@ -499,6 +563,9 @@ pylith::faults::FaultCohesiveDyn::updateStateVars(const PylithScalar t,
                      slipRateVertex[1]*slipRateVertex[1]);
             const PylithScalar tractionNormal = tractionTpdtVertex[2];
             _friction->updateStateVars(t, slipMag, slipRateMag, tractionNormal, v_fault);
+            if (_stats) {
+                _stats->accumulate(iVertex, slipMag, slipRateMag);
+            } // if
             break;
         } // case 3
         default:
@@ -506,6 +573,12 @@ pylith::faults::FaultCohesiveDyn::updateStateVars(const PylithScalar t,
             throw std::logic_error("Unknown spatial dimension in FaultCohesiveDyn::updateStateVars().");
         } // switch
     } // for
+    _friction->destroyPropsStateVarsVisitors();
+
+    // Slip and slip rate correspond to the solution at time t+dt.
+    if (_stats) {
+        _stats->update(t + _dt);
+    } // if
 
     PYLITH_METHOD_END;
 } // updateStateVars
@@ -594,6 +667,7 @@ pylith::faults::FaultCohesiveDyn::constrainSolnSpace(topology::SolutionFields* c
     } // switch
 
     const int numVertices = _cohesiveVertices.size();
+    _friction->createPropsStateVarsVisitors();
     for (int iVertex=0; iVertex < numVertices; ++iVertex) {
         const int e_lagrange = _cohesiveVertices[iVertex].lagrange;
         const int v_fault = _cohesiveVertices[iVertex].fault;
@@ -739,6 +813,7 @@ pylith::faults::FaultCohesiveDyn::constrainSolnSpace(topology::SolutionFields* c
         } // for
 
     } // for
+    _friction->destroyPropsStateVarsVisitors();
     dispTIncrAdjVisitor.clear();
     dLagrangeVisitor.clear();
 
@@ -1159,6 +1234,7 @@ pylith::faults::FaultCohesiveDyn::adjustSolnLumped(topology::SolutionFields* con
 
     PetscErrorCode err = 0;
     const int numVertices = _cohesiveVertices.size();
+    _friction->createPropsStateVarsVisitors();
     for (int iVertex=0; iVertex < numVertices; ++iVertex) {
         const int e_lagrange = _cohesiveVertices[iVertex].lagrange;
         const int v_fault = _cohesiveVertices[iVertex].fault;
@@ -1348,6 +1424,7 @@ pylith::faults::FaultCohesiveDyn::adjustSolnLumped(topology::SolutionFields* con
         _logger->eventEnd(updateEvent);
 #endif
     } // for
+    _friction->destroyPropsStateVarsVisitors();
     PetscLogFlops(numVertices*spaceDim*(17 + // adjust solve
                                         9 + // updates
                                         spaceDim*9));
@@ -2105,6 +2182,7 @@ pylith::faults::FaultCohesiveDyn::_constrainSolnSpaceNorm(const PylithScalar alp
     bool isOpening = false;
     PylithScalar norm2 = 0.0;
     int numVertices = _cohesiveVertices.size();
+    _friction->createPropsStateVarsVisitors();
     for (int iVertex=0; iVertex < numVertices; ++iVertex) {
         const int e_lagrange = _cohesiveVertices[iVertex].lagrange;
         const int v_fault = _cohesiveVertices[iVertex].fault;
@@ -2254,6 +2332,7 @@ pylith::faults::FaultCohesiveDyn::_constrainSolnSpaceNorm(const PylithScalar alp
             norm2 += tractionMisfitVertex[d]*tractionMisfitVertex[d];
         } // for
     } // for
+    _friction->destroyPropsStateVarsVisitors();
 
     if (isOpening && alpha < 1.0) {
         norm2 = PYLITH_MAXFLOAT;
@@ -89,6 +89,34 @@ public :
    */
   void openFreeSurf(const bool value);
 
+  /** Set spatial database with density and Vs for computing rupture
+   * statistics during the simulation.
+   *
+   * Rupture statistics are computed only if the database is set.
+   *
+   * @param db Spatial database with density and Vs.
+   */
+  void statsProperties(spatialdata::spatialdb::SpatialDB* db);
+
+  /** Set slip rate threshold for detecting events in rupture statistics.
+   *
+   * @param value Slip rate threshold (m/s); events are not detected
+   *   if value is zero.
+   */
+  void statsSlipRateThreshold(const PylithScalar value);
+
+  /** Set filename for tables of rupture statistics.
+   *
+   * @param filename Name of file.
+   */
+  void statsFilename(const char* filename);
+
+  /** Get rupture statistics.
+   *
+   * @returns Rupture statistics (NULL if not computed).
+   */
+  const FaultStatistics* statistics(void) const;
+
   /** Initialize fault. Determine orientation and setup boundary
    * condition parameters.
    *
@@ -297,6 +325,13 @@ private :
   /// To identify constitutive model
   friction::FrictionModel* _friction;
 
+  /// Spatial database with density and Vs for rupture statistics.
+  spatialdata::spatialdb::SpatialDB* _dbStats;
+
+  FaultStatistics* _stats; ///< Rupture statistics.
+  std::string _statsFilename; ///< Filename for rupture statistics.
+  PylithScalar _statsSlipRateThreshold; ///< Slip rate threshold (m/s) for events.
+
   /// Sparse matrix for sensitivity solve.
   topology::Jacobian* _jacobian;
 
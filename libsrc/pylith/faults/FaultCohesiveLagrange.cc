@@ -57,7 +57,9 @@
 // ----------------------------------------------------------------------
 // Default constructor.
 pylith::faults::FaultCohesiveLagrange::FaultCohesiveLagrange(void) :
-    _cohesiveIS(0)
+    _cohesiveIS(0),
+    _hasPrecondInfo(false),
+    _precondMatId(0)
 { // constructor
     _useLagrangeConstraints = true;
 } // constructor
@@ -79,6 +81,10 @@ pylith::faults::FaultCohesiveLagrange::deallocate(void)
     FaultCohesive::deallocate();
     delete _cohesiveIS; _cohesiveIS = 0;
 
+    _precondInfo.clear();
+    _hasPrecondInfo = false;
+    _precondMatId = 0;
+
     PYLITH_METHOD_END;
 } // deallocate
 
@@ -627,10 +633,11 @@ pylith::faults::FaultCohesiveLagrange::calcPreconditioner(PetscMat* const precon
      */
 
     const int setupEvent = _logger->eventId("FaPr setup");
-    const int computeEvent = _logger->eventId("FaPr compute");
 #if defined(DETAILED_EVENT_LOGGING)
     const int restrictEvent = _logger->eventId("FaPr restrict");
     const int updateEvent = _logger->eventId("FaPr update");
+#else
+    const int computeEvent = _logger->eventId("FaPr compute");
 #endif
 
     _logger->eventBegin(setupEvent);
@@ -639,126 +646,113 @@ pylith::faults::FaultCohesiveLagrange::calcPreconditioner(PetscMat* const precon
     const int spaceDim = _quadrature->spaceDim();
 
     // Allocate vectors for vertex values
-    scalar_array jacobianVertexP(spaceDim*spaceDim);
-    scalar_array jacobianVertexN(spaceDim*spaceDim);
-    scalar_array jacobianInvVertexP(spaceDim);
-    scalar_array jacobianInvVertexN(spaceDim);
     scalar_array precondVertexL(spaceDim);
-    int_array indicesN(spaceDim);
-    int_array indicesP(spaceDim);
-    int_array indicesRel(spaceDim);
-    for (int i=0; i < spaceDim; ++i) {
-        indicesRel[i] = i;
-    } // for
+
+    // The layout of the solution and the constraint preconditioning
+    // matrix does not change between reforms of the Jacobian, so we
+    // compute the offsets of the entries only once.
+    if (!_hasPrecondInfo) {
+        _initializePrecondInfo(*fields);
+    } // if
 
     // Get fields
     topology::Field& area = _fields->get("area");
     topology::VecVisitorMesh areaVisitor(area);
     const PetscScalar* areaArray = areaVisitor.localArray();
 
-    PetscSection solnGlobalSection = fields->solution().globalSection(); assert(solnGlobalSection);
-
-    PetscDM lagrangeDM = fields->solution().subfieldInfo("lagrange_multiplier").dm; assert(lagrangeDM);
-    PetscSection lagrangeGlobalSection = NULL;
-    PetscErrorCode err = DMGetDefaultGlobalSection(lagrangeDM, &lagrangeGlobalSection); PYLITH_CHECK_ERROR(err);
+    // We only need the diagonal of the Jacobian at the vertices on
+    // the negative and positive sides of the fault, so we use the
+    // local vector (including ghosted vertices) with the diagonal
+    // rather than extracting a submatrix. The Jacobian extracts the
+    // diagonal once per reform and shares it among all faults.
+    const PetscVec jacobianDiagVec = jacobian->localDiagonal(fields->solution()); assert(jacobianDiagVec);
+    PetscErrorCode err = 0;
 
     _logger->eventEnd(setupEvent);
 #if !defined(DETAILED_EVENT_LOGGING)
     _logger->eventBegin(computeEvent);
 #endif
 
-    PetscMat jacobianNP = NULL;
-    std::map<int, int> indicesMatToSubmat;
-    _getJacobianSubmatrixNP(&jacobianNP, &indicesMatToSubmat, *jacobian, *fields);
+    const PetscScalar* jacobianDiagArray = NULL;
+    err = VecGetArrayRead(jacobianDiagVec, &jacobianDiagArray); PYLITH_CHECK_ERROR(err);
 
-    const int numVertices = _cohesiveVertices.size();
-    for (int iVertex=0; iVertex < numVertices; ++iVertex) {
-        const int e_lagrange = _cohesiveVertices[iVertex].lagrange;
-        const int v_fault = _cohesiveVertices[iVertex].fault;
-        const int v_negative = _cohesiveVertices[iVertex].negative;
-        const int v_positive = _cohesiveVertices[iVertex].positive;
-
-        if (e_lagrange < 0) { // Skip clamped edges.
-            continue;
-        } // if
-
-        // Compute contribution only if Lagrange constraint is local.
-        PetscInt gloff = 0;
-        err = PetscSectionGetOffset(solnGlobalSection, e_lagrange, &gloff); PYLITH_CHECK_ERROR(err);
-        if (gloff < 0) {
-            continue;
-        } // if
+    // The entries persist only as long as the preconditioning
+    // matrix, so update all of them if the solver created a new matrix
+    // since the last computation. PETSc never reuses object ids.
+    PetscObjectId precondMatId = 0;
+    err = PetscObjectGetId((PetscObject) *precondMatrix, &precondMatId); PYLITH_CHECK_ERROR(err);
+    const bool updateAll = precondMatId != _precondMatId;
+    int numUpdated = 0;
+    const int numPrecondVertices = _precondInfo.size();
+    for (int iVertex=0; iVertex < numPrecondVertices; ++iVertex) {
+        const PrecondInfo& info = _precondInfo[iVertex];
 
 #if defined(DETAILED_EVENT_LOGGING)
         _logger->eventBegin(restrictEvent);
 #endif
 
-        // Get area associated with fault vertex.
-        const PetscInt aoff = areaVisitor.sectionOffset(v_fault);
-        assert(1 == areaVisitor.sectionDof(v_fault));
-
-        PetscInt gnoff = 0;
-        err = PetscSectionGetOffset(solnGlobalSection, v_negative, &gnoff); PYLITH_CHECK_ERROR(err);
-        indicesN = indicesRel + indicesMatToSubmat[gnoff];
-        err = MatGetValues(jacobianNP,
-                           indicesN.size(), &indicesN[0], indicesN.size(), &indicesN[0],
-                           &jacobianVertexN[0]); PYLITH_CHECK_ERROR(err);
-
-        PetscInt gpoff = 0;
-        err = PetscSectionGetOffset(solnGlobalSection, v_positive, &gpoff); PYLITH_CHECK_ERROR(err);
-        indicesP = indicesRel + indicesMatToSubmat[gpoff];
-        err = MatGetValues(jacobianNP,
-                           indicesP.size(), &indicesP[0], indicesP.size(), &indicesP[0],
-                           &jacobianVertexP[0]); PYLITH_CHECK_ERROR(err);
+        // Skip vertices where the Jacobian has not changed since the
+        // preconditioner was last computed; the entries in the
+        // preconditioning matrix persist across reforms.
+        PylithScalar* jacobianDiagN = &_precondJacobianDiag[(2*iVertex  )*spaceDim];
+        PylithScalar* jacobianDiagP = &_precondJacobianDiag[(2*iVertex+1)*spaceDim];
+        bool changed = updateAll;
+        for (int iDim=0; iDim < spaceDim; ++iDim) {
+            if (jacobianDiagN[iDim] != jacobianDiagArray[info.offN+iDim] ||
+                jacobianDiagP[iDim] != jacobianDiagArray[info.offP+iDim]) {
+                changed = true;
+            } // if
+            jacobianDiagN[iDim] = jacobianDiagArray[info.offN+iDim];
+            jacobianDiagP[iDim] = jacobianDiagArray[info.offP+iDim];
+        } // for
 
 #if defined(DETAILED_EVENT_LOGGING)
         _logger->eventEnd(restrictEvent);
-        _logger->eventBegin(computeEvent);
 #endif
 
-        // Compute inverse of Jacobian diagonals
-        for (int iDim=0; iDim < spaceDim; ++iDim) {
-            jacobianInvVertexN[iDim] = 1.0/jacobianVertexN[iDim*spaceDim+iDim];
-            jacobianInvVertexP[iDim] = 1.0/jacobianVertexP[iDim*spaceDim+iDim];
-        } // for
+        if (!changed) {
+            continue;
+        } // if
+        ++numUpdated;
 
         // Compute -[L] [Adiag]^(-1) [L]^T
         //   L_{ii} = L^T{ii} = areaVertex
         //   Adiag^{-1}_{ii} = jacobianInvVertexN[i] + jacobianInvVertexP[i]
-        precondVertexL = 0.0;
+        //
+        // A zero diagonal entry corresponds to a constrained DOF
+        // (Dirichlet BC on a fault vertex), which is not in the global
+        // vector. The constrained DOF does not contribute to the Schur
+        // complement, so we use zero for its inverse.
+        const PylithScalar areaVertex = areaArray[info.offArea];
         for (int iDim=0; iDim < spaceDim; ++iDim) {
-            precondVertexL[iDim] -= areaArray[aoff] * areaArray[aoff] *
-                                    (jacobianInvVertexN[iDim] + jacobianInvVertexP[iDim]);
+            const PylithScalar jacobianInvN = (jacobianDiagN[iDim] != 0.0) ? 1.0/jacobianDiagN[iDim] : 0.0;
+            const PylithScalar jacobianInvP = (jacobianDiagP[iDim] != 0.0) ? 1.0/jacobianDiagP[iDim] : 0.0;
+            precondVertexL[iDim] = -areaVertex * areaVertex * (jacobianInvN + jacobianInvP);
         } // for
 
-
 #if defined(DETAILED_EVENT_LOGGING)
-        _logger->eventEnd(computeEvent);
         _logger->eventBegin(updateEvent);
 #endif
 
         // Set diagonal entries in preconditioned matrix.
-        PetscInt poff = 0;
-        err = PetscSectionGetOffset(lagrangeGlobalSection, e_lagrange, &poff); PYLITH_CHECK_ERROR(err);
-
         for (int iDim=0; iDim < spaceDim; ++iDim) {
-            err = MatSetValue(*precondMatrix, poff+iDim, poff+iDim, precondVertexL[iDim], INSERT_VALUES); PYLITH_CHECK_ERROR(err);
+            err = MatSetValue(*precondMatrix, info.poff+iDim, info.poff+iDim, precondVertexL[iDim], INSERT_VALUES); PYLITH_CHECK_ERROR(err);
         } // for
 
 #if 0 // DEBUGGING
-        std::cout << "1/P_vertex " << e_lagrange << ", poff: " << poff << std::endl;
+        std::cout << "1/P_vertex " << iVertex << ", poff: " << info.poff << std::endl;
         for(int iDim = 0; iDim < spaceDim; ++iDim) {
             std::cout << "  " << precondVertexL[iDim] << std::endl;
         } // for
 #endif
 
-
 #if defined(DETAILED_EVENT_LOGGING)
         _logger->eventEnd(updateEvent);
 #endif
     } // for
-    err = MatDestroy(&jacobianNP); PYLITH_CHECK_ERROR(err);
-    PetscLogFlops(numVertices*spaceDim*6);
+    err = VecRestoreArrayRead(jacobianDiagVec, &jacobianDiagArray); PYLITH_CHECK_ERROR(err);
+    _precondMatId = precondMatId;
+    PetscLogFlops(numUpdated*spaceDim*6);
 
 #if !defined(DETAILED_EVENT_LOGGING)
     _logger->eventEnd(computeEvent);
@@ -1875,103 +1869,64 @@ pylith::faults::FaultCohesiveLagrange::_allocateBufferScalarField(void)
 } // _allocateBufferScalarField
 
 // ----------------------------------------------------------------------
-//  Get submatrix of Jacobian matrix associated with the negative and
-//  positive sides of the fault.
+// Initialize cached offsets for computing custom preconditioner.
 void
-pylith::faults::FaultCohesiveLagrange::_getJacobianSubmatrixNP(PetscMat* jacobianSub,
-                                                               std::map<int,int>* indicesMatToSubmat,
-                                                               const topology::Jacobian& jacobian,
-                                                               const topology::SolutionFields& fields)
-{ // _getJacobianSubmatrixNP
+pylith::faults::FaultCohesiveLagrange::_initializePrecondInfo(const topology::SolutionFields& fields)
+{ // _initializePrecondInfo
     PYLITH_METHOD_BEGIN;
 
-    assert(jacobianSub);
-    assert(indicesMatToSubmat);
-
-    // Get global order
-    PetscSection solutionGlobalSection = fields.solution().globalSection(); assert(solutionGlobalSection);
-
-    PetscErrorCode err;
-
-    // Get Jacobian matrix
-    const PetscMat jacobianMatrix = jacobian.matrix();
-    assert(jacobianMatrix);
+    assert(_fields);
 
     const spatialdata::geocoords::CoordSys* cs = fields.mesh().coordsys(); assert(cs);
     const int spaceDim = cs->spaceDim();
 
-    const int numVertices = _cohesiveVertices.size();
-    int numIndicesNP = 0;
-    for (int iVertex=0; iVertex < numVertices; ++iVertex) {
-        const int e_lagrange = _cohesiveVertices[iVertex].lagrange;
-        if (e_lagrange < 0) { // Ignore clamped edges.
-            continue;
-        } // if
+    const topology::Field& solution = fields.solution();
+    PetscSection solnSection = solution.localSection(); assert(solnSection);
+    PetscSection solnGlobalSection = solution.globalSection(); assert(solnGlobalSection);
 
-        // Compute contribution only if Lagrange constraint is local.
-        PetscInt goff = 0;
-        err = PetscSectionGetOffset(solutionGlobalSection, e_lagrange, &goff); PYLITH_CHECK_ERROR(err);
-        if (goff < 0) {
-            continue;
-        } // if
+    PetscDM lagrangeDM = solution.subfieldInfo("lagrange_multiplier").dm; assert(lagrangeDM);
+    PetscSection lagrangeGlobalSection = NULL;
+    PetscErrorCode err = DMGetDefaultGlobalSection(lagrangeDM, &lagrangeGlobalSection); PYLITH_CHECK_ERROR(err);
 
-        numIndicesNP += 2;
-    } // for
-    int_array indicesNP(numIndicesNP*spaceDim);
+    topology::Field& area = _fields->get("area");
+    topology::VecVisitorMesh areaVisitor(area);
 
-    for (int iVertex=0, indexNP=0; iVertex < numVertices; ++iVertex) {
+    _precondInfo.clear();
+    const int numVertices = _cohesiveVertices.size();
+    _precondInfo.reserve(numVertices);
+    for (int iVertex=0; iVertex < numVertices; ++iVertex) {
         const int e_lagrange = _cohesiveVertices[iVertex].lagrange;
+        const int v_fault = _cohesiveVertices[iVertex].fault;
         const int v_negative = _cohesiveVertices[iVertex].negative;
         const int v_positive = _cohesiveVertices[iVertex].positive;
 
-        if (e_lagrange < 0) { // Ignore clamped edges.
+        if (e_lagrange < 0) { // Skip clamped edges.
             continue;
         } // if
 
         // Compute contribution only if Lagrange constraint is local.
         PetscInt gloff = 0;
-        err = PetscSectionGetOffset(solutionGlobalSection, e_lagrange, &gloff); PYLITH_CHECK_ERROR(err);
-        if (gloff < 0)
+        err = PetscSectionGetOffset(solnGlobalSection, e_lagrange, &gloff); PYLITH_CHECK_ERROR(err);
+        if (gloff < 0) {
             continue;
+        } // if
 
-        PetscInt gnoff = 0;
-        err = PetscSectionGetOffset(solutionGlobalSection, v_negative, &gnoff); PYLITH_CHECK_ERROR(err);
-        gnoff = gnoff < 0 ? -(gnoff+1) : gnoff;
-
-        PetscInt gpoff = 0;
-        err = PetscSectionGetOffset(solutionGlobalSection, v_positive, &gpoff); PYLITH_CHECK_ERROR(err);
-        gpoff = gpoff < 0 ? -(gpoff+1) : gpoff;
-
-        // Set global order indices
-        for(int iDim=0; iDim < spaceDim; ++iDim)
-            indicesNP[indexNP*spaceDim+iDim] = gnoff + iDim;
-        ++indexNP;
-        for(int iDim=0; iDim < spaceDim; ++iDim)
-            indicesNP[indexNP*spaceDim+iDim] = gpoff + iDim;
-        ++indexNP;
+        PrecondInfo info;
+        assert(1 == areaVisitor.sectionDof(v_fault));
+        info.offArea = areaVisitor.sectionOffset(v_fault);
+        err = PetscSectionGetOffset(solnSection, v_negative, &info.offN); PYLITH_CHECK_ERROR(err);
+        err = PetscSectionGetOffset(solnSection, v_positive, &info.offP); PYLITH_CHECK_ERROR(err);
+        err = PetscSectionGetOffset(lagrangeGlobalSection, e_lagrange, &info.poff); PYLITH_CHECK_ERROR(err);
+        _precondInfo.push_back(info);
     } // for
 
-    // MatCreateSubMatrices requires sorted indices
-    std::sort(&indicesNP[0], &indicesNP[indicesNP.size()]);
-
-    PetscMat* subMat = NULL;
-    IS indicesIS[1];
-    err = ISCreateGeneral(PETSC_COMM_SELF, indicesNP.size(), &indicesNP[0], PETSC_USE_POINTER, &indicesIS[0]);PYLITH_CHECK_ERROR(err);
-    err = MatCreateSubMatrices(jacobianMatrix, 1, indicesIS, indicesIS, MAT_INITIAL_MATRIX, &subMat);PYLITH_CHECK_ERROR(err);
-    err = ISDestroy(&indicesIS[0]); PYLITH_CHECK_ERROR(err);
-
-    *jacobianSub = subMat[0];
-    err = PetscFree(subMat); PYLITH_CHECK_ERROR(err);
-
-    // Create map from global indices to local indices (using only the
-    // first index as to match the global order.
-    indicesMatToSubmat->clear();
-    const int indicesNPSize = indicesNP.size();
-    for (int i=0; i < indicesNPSize; i+=spaceDim)
-        (*indicesMatToSubmat)[indicesNP[i]] = i;
+    _precondJacobianDiag.resize(2*_precondInfo.size()*spaceDim);
+    _precondJacobianDiag = 0.0;
+    _hasPrecondInfo = true;
+    _precondMatId = 0;
 
     PYLITH_METHOD_END;
-} // _getJacobianSubmatrixNP
+} // _initializePrecondInfo
 
 
 // ----------------------------------------------------------------------
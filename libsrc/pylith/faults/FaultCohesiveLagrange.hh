@@ -250,6 +250,16 @@ protected :
     int fault; ///< Point (vertex) in fault mesh.
   };
 
+  /** Data structure to hold offsets of entries used in computing the
+   *  custom preconditioner at a cohesive vertex.
+   */
+  struct PrecondInfo {
+    PetscInt offN; ///< Offset in local solution of vertex on negative side.
+    PetscInt offP; ///< Offset in local solution of vertex on positive side.
+    PetscInt offArea; ///< Offset in area field of fault vertex.
+    PetscInt poff; ///< Global row in preconditioning matrix for constraint.
+  };
+
   // PROTECTED METHODS //////////////////////////////////////////////////
 protected :
 
@@ -273,21 +283,14 @@ protected :
   /// Allocate buffer for scalar field.
   void _allocateBufferScalarField(void);
 
-  /** Get submatrix of Jacobian matrix associated with the negative
-   *  and positive sides of the fault.
+  /** Initialize offsets for computing custom preconditioner.
    *
-   *  The submatrix and the mapping from global indices to submatrix
-   *  indices are returned through the arguments.
+   * The offsets depend only on the layout of the solution field, so
+   * they are cached across reforms of the Jacobian.
    *
-   * @param submatrix PETSc matrix for submatrix.
-   * @param mapGlobalToLocal Mapping from global to local indices.
-   * @param jacobian Sparse matrix for Jacobian of system.
    * @param fields Solution fields
    */
-  void _getJacobianSubmatrixNP(PetscMat* submatrix,
-			       std::map<int,int>* mapGlobalToLocal,
-			       const topology::Jacobian& jacobian,
-			       const topology::SolutionFields& fields);
+  void _initializePrecondInfo(const topology::SolutionFields& fields);
 
   // PRIVATE METHODS ////////////////////////////////////////////////////
 private :
@@ -317,6 +320,16 @@ protected :
 
   topology::StratumIS* _cohesiveIS; ///< Index set of cohesive cells.
 
+  /// Offsets of entries for custom preconditioner at local cohesive vertices.
+  std::vector<PrecondInfo> _precondInfo;
+
+  /// Jacobian diagonal at negative and positive vertices used in
+  /// last computation of custom preconditioner.
+  scalar_array _precondJacobianDiag;
+
+  bool _hasPrecondInfo; ///< True if offsets for preconditioner have been computed.
+  PetscObjectId _precondMatId; ///< Id of matrix with current preconditioner entries (0 if none).
+
   // NOT IMPLEMENTED ////////////////////////////////////////////////////
 private :
 
@@ -0,0 +1,377 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "FaultStatistics.hh" // implementation of object methods
+
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/Field.hh" // USES Field
+#include "pylith/topology/CoordsVisitor.hh" // USES CoordsVisitor
+#include "pylith/topology/VisitorMesh.hh" // USES VecVisitorMesh
+
+#include "spatialdata/spatialdb/SpatialDB.hh" // USES SpatialDB
+#include "spatialdata/geocoords/CoordSys.hh" // USES CoordSys
+#include "spatialdata/units/Nondimensional.hh" // USES Nondimensional
+
+#include "pylith/utils/error.h" // USES PYLITH_CHECK_ERROR
+
+#include <cmath> // USES log10()
+#include <iomanip> // USES std::setw(), std::setprecision()
+#include <cassert> // USES assert()
+#include <stdexcept> // USES std::runtime_error
+#include <sstream> // USES std::ostringstream
+
+// ----------------------------------------------------------------------
+namespace pylith {
+  namespace faults {
+    namespace _FaultStatistics {
+      /** Insert suffix into filename before the extension.
+       *
+       * @param filename Name of file.
+       * @param suffix Suffix to insert.
+       * @returns Name of file with suffix.
+       */
+      std::string insertSuffix(const std::string& filename,
+			       const char* suffix) {
+	const size_t indexExt = filename.find_last_of('.');
+	const size_t indexDir = filename.find_last_of('/');
+	if (indexExt == std::string::npos ||
+	    (indexDir != std::string::npos && indexExt < indexDir))
+	  return filename + suffix;
+	return filename.substr(0, indexExt) + suffix + filename.substr(indexExt);
+      } // insertSuffix
+    } // _FaultStatistics
+  } // faults
+} // pylith
+
+// ----------------------------------------------------------------------
+// Default constructor.
+pylith::faults::FaultStatistics::FaultStatistics(void) :
+  _filename(""),
+  _peakSlipRateLocal(0.0),
+  _slipRateThreshold(0.0),
+  _lengthScale(1.0),
+  _velocityScale(1.0),
+  _timeScale(1.0),
+  _comm(PETSC_COMM_WORLD),
+  _commRank(0),
+  _numEvents(0),
+  _eventActive(false)
+{ // constructor
+  for (int i=0; i < NUM_SUMS; ++i)
+    _sumsLocal[i] = 0.0;
+
+  _stepStats.t = 0.0;
+  _stepStats.duration = 0.0;
+  _stepStats.ruptureArea = 0.0;
+  _stepStats.potency = 0.0;
+  _stepStats.moment = 0.0;
+  _stepStats.peakSlipRate = 0.0;
+  _stepStats.eventId = -1;
+  _eventCurrent = _stepStats;
+} // constructor
+
+// ----------------------------------------------------------------------
+// Destructor.
+pylith::faults::FaultStatistics::~FaultStatistics(void)
+{ // destructor
+  deallocate();
+} // destructor
+
+// ----------------------------------------------------------------------
+// Deallocate data structures and close files.
+void
+pylith::faults::FaultStatistics::deallocate(void)
+{ // deallocate
+  // Record event in progress at end of simulation.
+  if (_eventActive)
+    _endEvent();
+
+  if (_stepsFile.is_open())
+    _stepsFile.close();
+  if (_eventsFile.is_open())
+    _eventsFile.close();
+
+  _area.resize(0);
+  _areaMu.resize(0);
+  _slip.resize(0);
+  _slipStart.resize(0);
+  _ruptured.clear();
+} // deallocate
+
+// ----------------------------------------------------------------------
+// Set slip rate threshold for detecting events.
+void
+pylith::faults::FaultStatistics::slipRateThreshold(const PylithScalar value)
+{ // slipRateThreshold
+  if (value < 0.0) {
+    std::ostringstream msg;
+    msg << "Slip rate threshold (" << value << ") for detecting events "
+	<< "must be nonnegative.";
+    throw std::runtime_error(msg.str());
+  } // if
+
+  _slipRateThreshold = value;
+} // slipRateThreshold
+
+// ----------------------------------------------------------------------
+// Set filename for tables of statistics.
+void
+pylith::faults::FaultStatistics::filename(const char* value)
+{ // filename
+  _filename = value;
+} // filename
+
+// ----------------------------------------------------------------------
+// Compute area and shear modulus associated with fault vertices.
+void
+pylith::faults::FaultStatistics::initialize(const topology::Mesh& faultMesh,
+					    const topology::Field& area,
+					    const std::vector<PetscInt>& vertices,
+					    spatialdata::spatialdb::SpatialDB* db,
+					    const spatialdata::units::Nondimensional& normalizer)
+{ // initialize
+  PYLITH_METHOD_BEGIN;
+
+  assert(db);
+
+  _lengthScale = normalizer.lengthScale();
+  _timeScale = normalizer.timeScale();
+  _velocityScale = _lengthScale / _timeScale;
+  const PylithScalar areaScale = area.scale();
+
+  _comm = faultMesh.comm();
+  PetscErrorCode err = MPI_Comm_rank(_comm, &_commRank);PYLITH_CHECK_ERROR(err);
+
+  const spatialdata::geocoords::CoordSys* cs = faultMesh.coordsys();assert(cs);
+  const int spaceDim = cs->spaceDim();
+
+  const size_t numVertices = vertices.size();
+  _area.resize(numVertices);
+  _area = 0.0;
+  _areaMu.resize(numVertices);
+  _areaMu = 0.0;
+  _slip.resize(numVertices);
+  _slip = 0.0;
+  _slipStart.resize(numVertices);
+  _slipStart = 0.0;
+  _ruptured.assign(numVertices, false);
+
+  PetscDM dmMesh = faultMesh.dmMesh();assert(dmMesh);
+  topology::CoordsVisitor coordsVisitor(dmMesh);
+  const PetscScalar* coordsArray = coordsVisitor.localArray();
+
+  // Only count area of vertices owned by this process.
+  PetscSection areaGlobalSection = area.globalSection();assert(areaGlobalSection);
+  topology::VecVisitorMesh areaVisitor(area);
+  const PetscScalar* areaArray = areaVisitor.localArray();
+
+  db->open();
+  const char* propertyNames[2] = { "density", "vs" };
+  db->queryVals(propertyNames, 2);
+
+  scalar_array coordsVertex(spaceDim);
+  scalar_array propertiesVertex(2);
+  for (size_t i=0; i < numVertices; ++i) {
+    const PetscInt v = vertices[i];
+    if (v < 0)
+      continue;
+
+    PetscInt goff = 0;
+    err = PetscSectionGetOffset(areaGlobalSection, v, &goff);PYLITH_CHECK_ERROR(err);
+    if (goff < 0)
+      continue;
+
+    const PetscInt coff = coordsVisitor.sectionOffset(v);
+    assert(spaceDim == coordsVisitor.sectionDof(v));
+    for (int d=0; d < spaceDim; ++d)
+      coordsVertex[d] = coordsArray[coff+d];
+    normalizer.dimensionalize(&coordsVertex[0], coordsVertex.size(), _lengthScale);
+
+    const int qerr = db->query(&propertiesVertex[0], propertiesVertex.size(), &coordsVertex[0], coordsVertex.size(), cs);
+    if (qerr) {
+      db->close();
+      std::ostringstream msg;
+      msg << "Could not find density and Vs for fault statistics at (";
+      for (int d=0; d < spaceDim; ++d)
+	msg << "  " << coordsVertex[d];
+      msg << ") using spatial database '" << db->label() << "'.";
+      throw std::runtime_error(msg.str());
+    } // if
+    const PylithScalar density = propertiesVertex[0];
+    const PylithScalar vs = propertiesVertex[1];
+    const PylithScalar shearModulus = density * vs * vs;
+
+    const PetscInt aoff = areaVisitor.sectionOffset(v);
+    assert(1 == areaVisitor.sectionDof(v));
+    _area[i] = areaArray[aoff] * areaScale;
+    _areaMu[i] = _area[i] * shearModulus;
+  } // for
+  db->close();
+
+  PYLITH_METHOD_END;
+} // initialize
+
+// ----------------------------------------------------------------------
+// Reduce accumulated values across processes, detect events, and
+// write statistics for the time step.
+void
+pylith::faults::FaultStatistics::update(const PylithScalar t)
+{ // update
+  PYLITH_METHOD_BEGIN;
+
+  double sums[NUM_SUMS];
+  double peakSlipRate = 0.0;
+  PetscErrorCode err = 0;
+  err = MPI_Allreduce(_sumsLocal, sums, NUM_SUMS, MPI_DOUBLE, MPI_SUM, _comm);PYLITH_CHECK_ERROR(err);
+  err = MPI_Allreduce(&_peakSlipRateLocal, &peakSlipRate, 1, MPI_DOUBLE, MPI_MAX, _comm);PYLITH_CHECK_ERROR(err);
+
+  const double tDim = t * _timeScale;
+
+  if (_slipRateThreshold > 0.0 && peakSlipRate > _slipRateThreshold) {
+    if (!_eventActive) {
+      _eventActive = true;
+      _eventCurrent.eventId = _numEvents++;
+      _eventCurrent.t = tDim;
+      _eventCurrent.peakSlipRate = 0.0;
+    } // if
+    _eventCurrent.duration = tDim - _eventCurrent.t;
+    _eventCurrent.ruptureArea = sums[EVENT_AREA];
+    _eventCurrent.potency = sums[EVENT_POTENCY];
+    _eventCurrent.moment = sums[EVENT_MOMENT];
+    if (peakSlipRate > _eventCurrent.peakSlipRate)
+      _eventCurrent.peakSlipRate = peakSlipRate;
+  } else if (_eventActive) {
+    _endEvent();
+  } // if/else
+
+  _stepStats.t = tDim;
+  _stepStats.duration = 0.0;
+  _stepStats.ruptureArea = sums[STEP_AREA];
+  _stepStats.potency = sums[STEP_POTENCY];
+  _stepStats.moment = sums[STEP_MOMENT];
+  _stepStats.peakSlipRate = peakSlipRate;
+  _stepStats.eventId = _eventActive ? _eventCurrent.eventId : -1;
+
+  if (!_commRank && _filename.length() > 0) {
+    if (!_stepsFile.is_open())
+      _openFiles();
+    _writeStats(_stepsFile, _stepStats, false);
+  } // if
+
+  // Slip of next event is relative to slip at end of this time step.
+  if (!_eventActive)
+    _slipStart = _slip;
+
+  // Area of current event accumulates over the event.
+  _sumsLocal[STEP_AREA] = 0.0;
+  _sumsLocal[STEP_POTENCY] = 0.0;
+  _sumsLocal[STEP_MOMENT] = 0.0;
+  _sumsLocal[EVENT_POTENCY] = 0.0;
+  _sumsLocal[EVENT_MOMENT] = 0.0;
+  _peakSlipRateLocal = 0.0;
+
+  PYLITH_METHOD_END;
+} // update
+
+// ----------------------------------------------------------------------
+// Compute moment magnitude from seismic moment.
+double
+pylith::faults::FaultStatistics::momentMagnitude(const double moment)
+{ // momentMagnitude
+  // Same relation as pylith_eqinfo.
+  return (moment > 0.0) ? 2.0/3.0*(log10(moment) - 9.05) : -1.0e+30;
+} // momentMagnitude
+
+// ----------------------------------------------------------------------
+// Open files for tables.
+void
+pylith::faults::FaultStatistics::_openFiles(void)
+{ // _openFiles
+  const std::string& stepsFilename = _FaultStatistics::insertSuffix(_filename, "_steps");
+  _stepsFile.open(stepsFilename.c_str());
+  if (!_stepsFile.is_open() || !_stepsFile.good()) {
+    std::ostringstream msg;
+    msg << "Could not open file '" << stepsFilename << "' for fault statistics.";
+    throw std::runtime_error(msg.str());
+  } // if
+  _stepsFile
+    << "# t(s)  rupture_area(m^2)  potency(m^3)  moment(N-m)  Mw  peak_slip_rate(m/s)  event\n";
+
+  const std::string& eventsFilename = _FaultStatistics::insertSuffix(_filename, "_events");
+  _eventsFile.open(eventsFilename.c_str());
+  if (!_eventsFile.is_open() || !_eventsFile.good()) {
+    std::ostringstream msg;
+    msg << "Could not open file '" << eventsFilename << "' for fault statistics.";
+    throw std::runtime_error(msg.str());
+  } // if
+  _eventsFile
+    << "# event  t_start(s)  duration(s)  rupture_area(m^2)  potency(m^3)  moment(N-m)  Mw  peak_slip_rate(m/s)\n";
+} // _openFiles
+
+// ----------------------------------------------------------------------
+// End current event and write its statistics.
+void
+pylith::faults::FaultStatistics::_endEvent(void)
+{ // _endEvent
+  assert(_eventActive);
+
+  _events.push_back(_eventCurrent);
+  if (!_commRank && _filename.length() > 0) {
+    if (!_eventsFile.is_open())
+      _openFiles();
+    _writeStats(_eventsFile, _eventCurrent, true);
+    _eventsFile.flush();
+  } // if
+
+  _eventActive = false;
+  _ruptured.assign(_ruptured.size(), false);
+  _sumsLocal[EVENT_AREA] = 0.0;
+} // _endEvent
+
+// ----------------------------------------------------------------------
+// Write statistics to table.
+void
+pylith::faults::FaultStatistics::_writeStats(std::ostream& sout,
+					     const Stats& stats,
+					     const bool isEvent)
+{ // _writeStats
+  const double mw = momentMagnitude(stats.moment);
+
+  sout << std::scientific << std::setprecision(6);
+  if (isEvent) {
+    sout << std::setw(6) << stats.eventId
+	 << std::setw(15) << stats.t
+	 << std::setw(15) << stats.duration;
+  } else {
+    sout << std::setw(15) << stats.t;
+  } // if/else
+  sout << std::setw(15) << stats.ruptureArea
+       << std::setw(15) << stats.potency
+       << std::setw(15) << stats.moment
+       << std::fixed << std::setprecision(3) << std::setw(8) << ((mw > -1.0e+10) ? mw : 0.0)
+       << std::scientific << std::setprecision(6)
+       << std::setw(15) << stats.peakSlipRate;
+  if (!isEvent)
+    sout << std::setw(6) << stats.eventId;
+  sout << "\n";
+} // _writeStats
+
+
+// End of file
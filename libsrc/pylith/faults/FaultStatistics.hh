@@ -0,0 +1,240 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+/** @file libsrc/faults/FaultStatistics.hh
+ *
+ * @brief C++ object for accumulating rupture statistics (rupture
+ * area, potency, seismic moment, and peak slip rate) on a fault
+ * during a simulation.
+ *
+ * The area and shear modulus associated with each fault vertex are
+ * computed once in initialize(). The fault implementation passes the
+ * slip and slip rate magnitudes at each vertex to accumulate() while
+ * it loops over the vertices, and update() reduces the sums across
+ * processes and appends a row to the table of statistics for the time
+ * step. This avoids writing slip at every time step and
+ * post-processing the output with pylith_eqinfo.
+ *
+ * If the slip rate threshold is positive, an event starts when the
+ * peak slip rate exceeds the threshold and ends when the peak slip
+ * rate drops below it. The potency and moment of an event are
+ * computed from the slip relative to the slip before the event
+ * started; the rupture area of an event is the area of the vertices
+ * where the slip rate exceeded the threshold.
+ *
+ * Process 0 writes the statistics for each time step to
+ * ROOT_steps.EXT and the statistics for each event to
+ * ROOT_events.EXT, where the filename is ROOT.EXT.
+ */
+
+#if !defined(pylith_faults_faultstatistics_hh)
+#define pylith_faults_faultstatistics_hh
+
+// Include directives ---------------------------------------------------
+#include "faultsfwd.hh" // forward declarations
+
+#include "pylith/topology/topologyfwd.hh" // USES Mesh, Field
+
+#include "spatialdata/spatialdb/spatialdbfwd.hh" // USES SpatialDB
+#include "spatialdata/units/unitsfwd.hh" // USES Nondimensional
+
+#include "pylith/utils/array.hh" // HASA scalar_array
+
+#include <string> // HASA std::string
+#include <vector> // HASA std::vector
+#include <fstream> // HASA std::ofstream
+
+// FaultStatistics ------------------------------------------------------
+/// C++ object for accumulating rupture statistics on a fault.
+class pylith::faults::FaultStatistics
+{ // class FaultStatistics
+  friend class TestFaultStatistics; // unit testing
+
+  // PUBLIC STRUCTS /////////////////////////////////////////////////////
+public :
+
+  /// Rupture statistics for a time step or an event (dimensional).
+  struct Stats {
+    double t; ///< Time (time step) or start time (event).
+    double duration; ///< Duration of event (0 for time step).
+    double ruptureArea; ///< Area with nonzero slip (or slipping above threshold).
+    double potency; ///< Integral of slip over fault area.
+    double moment; ///< Integral of shear modulus times slip over fault area.
+    double peakSlipRate; ///< Maximum slip rate.
+    int eventId; ///< Id of event (-1 if no event).
+  }; // Stats
+
+  // PUBLIC METHODS /////////////////////////////////////////////////////
+public :
+
+  /// Default constructor.
+  FaultStatistics(void);
+
+  /// Destructor.
+  ~FaultStatistics(void);
+
+  /// Deallocate data structures and close files.
+  void deallocate(void);
+
+  /** Set slip rate threshold for detecting events.
+   *
+   * @param value Slip rate threshold (m/s); events are not detected
+   *   if value is zero.
+   */
+  void slipRateThreshold(const PylithScalar value);
+
+  /** Set filename for tables of statistics.
+   *
+   * @param value Name of file (empty string means do not write files).
+   */
+  void filename(const char* value);
+
+  /** Compute area and shear modulus associated with fault vertices.
+   *
+   * The shear modulus is computed from the density and shear wave
+   * speed in the spatial database.
+   *
+   * @param faultMesh Finite-element mesh of fault.
+   * @param area Field with area associated with fault vertices.
+   * @param vertices Vertices in fault mesh in the order they will be
+   *   passed to accumulate() (negative for vertices to skip).
+   * @param db Spatial database with density and Vs.
+   * @param normalizer Nondimensionalizer.
+   */
+  void initialize(const topology::Mesh& faultMesh,
+		  const topology::Field& area,
+		  const std::vector<PetscInt>& vertices,
+		  spatialdata::spatialdb::SpatialDB* db,
+		  const spatialdata::units::Nondimensional& normalizer);
+
+  /** Accumulate slip and slip rate at a fault vertex for the current
+   * time step.
+   *
+   * @param index Index of vertex in array of vertices passed to initialize().
+   * @param slipMag Magnitude of slip (nondimensional).
+   * @param slipRateMag Magnitude of slip rate (nondimensional).
+   */
+  void accumulate(const int index,
+		  const PylithScalar slipMag,
+		  const PylithScalar slipRateMag);
+
+  /** Reduce accumulated values across processes, detect events, and
+   * write statistics for the time step.
+   *
+   * @param t Time associated with slip (nondimensional).
+   */
+  void update(const PylithScalar t);
+
+  /** Get statistics for the most recent time step.
+   *
+   * @returns Statistics for time step.
+   */
+  const Stats& stepStats(void) const;
+
+  /** Get statistics for events that have ended.
+   *
+   * @returns Statistics for events.
+   */
+  const std::vector<Stats>& eventStats(void) const;
+
+  /** Compute moment magnitude from seismic moment.
+   *
+   * @param moment Seismic moment (N-m).
+   * @returns Moment magnitude.
+   */
+  static
+  double momentMagnitude(const double moment);
+
+  // PRIVATE ENUMS //////////////////////////////////////////////////////
+private :
+
+  /// Indices of values summed across processes.
+  enum SumEnum {
+    STEP_AREA=0,
+    STEP_POTENCY=1,
+    STEP_MOMENT=2,
+    EVENT_AREA=3,
+    EVENT_POTENCY=4,
+    EVENT_MOMENT=5,
+    NUM_SUMS=6
+  }; // SumEnum
+
+  // PRIVATE METHODS ////////////////////////////////////////////////////
+private :
+
+  /// Open files for tables.
+  void _openFiles(void);
+
+  /// End current event and write its statistics.
+  void _endEvent(void);
+
+  /** Write statistics to table.
+   *
+   * @param sout Output stream.
+   * @param stats Statistics.
+   * @param isEvent True if statistics are for an event.
+   */
+  static
+  void _writeStats(std::ostream& sout,
+		   const Stats& stats,
+		   const bool isEvent);
+
+  // PRIVATE MEMBERS ////////////////////////////////////////////////////
+private :
+
+  std::string _filename; ///< Root name of files for tables.
+  std::ofstream _stepsFile; ///< File for statistics of time steps.
+  std::ofstream _eventsFile; ///< File for statistics of events.
+
+  scalar_array _area; ///< Area (m^2) of vertices (0 if not local).
+  scalar_array _areaMu; ///< Area times shear modulus (N-m^-1) of vertices.
+  scalar_array _slip; ///< Slip (m) of vertices for current time step.
+  scalar_array _slipStart; ///< Slip (m) of vertices before current event.
+  std::vector<bool> _ruptured; ///< True if vertex slipped above threshold in current event.
+
+  double _sumsLocal[NUM_SUMS]; ///< Sums for local vertices.
+  double _peakSlipRateLocal; ///< Peak slip rate over local vertices.
+
+  Stats _stepStats; ///< Statistics for most recent time step.
+  Stats _eventCurrent; ///< Statistics for current event.
+  std::vector<Stats> _events; ///< Statistics for events that have ended.
+
+  PylithScalar _slipRateThreshold; ///< Slip rate threshold (m/s) for events.
+  PylithScalar _lengthScale; ///< Scale for length.
+  PylithScalar _velocityScale; ///< Scale for velocity.
+  PylithScalar _timeScale; ///< Scale for time.
+
+  MPI_Comm _comm; ///< Communicator for fault mesh.
+  int _commRank; ///< Rank of this process.
+  int _numEvents; ///< Number of events detected.
+  bool _eventActive; ///< True if an event is in progress.
+
+  // NOT IMPLEMENTED ////////////////////////////////////////////////////
+private :
+
+  FaultStatistics(const FaultStatistics&); ///< Not implemented
+  const FaultStatistics& operator=(const FaultStatistics&); ///< Not implemented
+
+}; // class FaultStatistics
+
+#include "FaultStatistics.icc" // inline methods
+
+#endif // pylith_faults_faultstatistics_hh
+
+
+// End of file
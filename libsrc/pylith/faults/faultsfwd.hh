@@ -50,6 +50,7 @@ namespace pylith {
 
     class Nucleator;
     class TractPerturbation;
+    class FaultStatistics;
 
     class TopologyOps;
   } // faults
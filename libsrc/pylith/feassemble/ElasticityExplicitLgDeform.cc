@@ -122,6 +122,15 @@ pylith::feassemble::ElasticityExplicitLgDeform::normViscosity(const PylithScalar
   PYLITH_METHOD_END;
 } // normViscosity
 
+// ----------------------------------------------------------------------
+// Check whether integrator can restrict integrateResidual() to
+// boundary or interior cells.
+bool
+pylith::feassemble::ElasticityExplicitLgDeform::splitsCells(void) const
+{ // splitsCells
+  return true;
+} // splitsCells
+
 // ----------------------------------------------------------------------
 // Integrate constributions to residual term (r) for operator.
 void
@@ -192,28 +201,34 @@ pylith::feassemble::ElasticityExplicitLgDeform::integrateResidual(const topology
   // Get cell information
   PetscDM dmMesh = fields->mesh().dmMesh();assert(dmMesh);
   assert(_materialIS);
-  const PetscInt* cells = _materialIS->points();
-  const PetscInt numCells = _materialIS->size();
+  const PetscInt* cells = NULL;
+  PetscInt numCells = 0;
+  _residualCells(&cells, &numCells, fields->mesh());
 
   // Setup field visitors.
   scalar_array accCell(numBasis*spaceDim);
   topology::VecVisitorMesh accVisitor(fields->get("acceleration(t)"), "displacement");
   accVisitor.optimizeClosure();
+  _useClosureIndexMap(&accVisitor, dmMesh);
 
   scalar_array velCell(numBasis*spaceDim);
   topology::VecVisitorMesh velVisitor(fields->get("velocity(t)"), "displacement");
   velVisitor.optimizeClosure();
+  _useClosureIndexMap(&velVisitor, dmMesh);
 
   scalar_array dispCell(numBasis*spaceDim);
   scalar_array dispAdjCell(numBasis*spaceDim);
   topology::VecVisitorMesh dispVisitor(fields->get("disp(t)"), "displacement");
   dispVisitor.optimizeClosure();
+  _useClosureIndexMap(&dispVisitor, dmMesh);
 
   topology::VecVisitorMesh residualVisitor(residual, "displacement");
   residualVisitor.optimizeClosure();
+  _useClosureIndexMap(&residualVisitor, dmMesh);
 
   scalar_array coordsCell(numBasis*spaceDim); // :KULDGE: Update numBasis to numCorners after implementing higher order
   topology::CoordsVisitor coordsVisitor(dmMesh);
+  _useClosureIndexMap(&coordsVisitor, dmMesh);
 
   _material->createPropsAndVarsVisitors();
 
@@ -388,10 +403,12 @@ pylith::feassemble::ElasticityExplicitLgDeform::integrateJacobian(topology::Fiel
   // Setup field visitors.
   scalar_array valuesIJ(numBasis);
   topology::VecVisitorMesh jacobianVisitor(*jacobian, "displacement");
+  _useClosureIndexMap(&jacobianVisitor, dmMesh);
   // Don't optimize closure since we compute the Jacobian only once.
 
   scalar_array coordsCell(numBasis*spaceDim); // :KULDGE: Update numBasis to numCorners after implementing higher order
   topology::CoordsVisitor coordsVisitor(dmMesh);
+  _useClosureIndexMap(&coordsVisitor, dmMesh);
 
   _material->createPropsAndVarsVisitors();
 
@@ -106,6 +106,13 @@ public :
    */
   void normViscosity(const PylithScalar viscosity);
 
+  /** Check whether integrator can restrict integrateResidual() to
+   * boundary or interior cells.
+   *
+   * @returns True.
+   */
+  bool splitsCells(void) const;
+
   /** Integrate contributions to residual term (r) for operator.
    *
    * @param residual Field containing values for residual
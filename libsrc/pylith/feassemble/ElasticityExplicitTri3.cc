@@ -132,6 +132,15 @@ pylith::feassemble::ElasticityExplicitTri3::normViscosity(const PylithScalar vis
   PYLITH_METHOD_END;
 } // normViscosity
 
+// ----------------------------------------------------------------------
+// Check whether integrator can restrict integrateResidual() to
+// boundary or interior cells.
+bool
+pylith::feassemble::ElasticityExplicitTri3::splitsCells(void) const
+{ // splitsCells
+  return true;
+} // splitsCells
+
 // ----------------------------------------------------------------------
 // Integrate constributions to residual term (r) for operator.
 void
@@ -192,28 +201,34 @@ pylith::feassemble::ElasticityExplicitTri3::integrateResidual(const topology::Fi
   // Get cell information
   PetscDM dmMesh = fields->mesh().dmMesh();assert(dmMesh);
   assert(_materialIS);
-  const PetscInt* cells = _materialIS->points();
-  const PetscInt numCells = _materialIS->size();
+  const PetscInt* cells = NULL;
+  PetscInt numCells = 0;
+  _residualCells(&cells, &numCells, fields->mesh());
 
   // Setup field visitors.
   scalar_array accCell(numBasis*spaceDim);
   topology::VecVisitorMesh accVisitor(fields->get("acceleration(t)"), "displacement");
   accVisitor.optimizeClosure();
+  _useClosureIndexMap(&accVisitor, dmMesh);
 
   scalar_array velCell(numBasis*spaceDim);
   topology::VecVisitorMesh velVisitor(fields->get("velocity(t)"), "displacement");
   velVisitor.optimizeClosure();
+  _useClosureIndexMap(&velVisitor, dmMesh);
 
   scalar_array dispCell(numBasis*spaceDim);
   scalar_array dispAdjCell(numBasis*spaceDim);
   topology::VecVisitorMesh dispVisitor(fields->get("disp(t)"), "displacement");
   dispVisitor.optimizeClosure();
+  _useClosureIndexMap(&dispVisitor, dmMesh);
   
   topology::VecVisitorMesh residualVisitor(residual, "displacement");
   residualVisitor.optimizeClosure();
+  _useClosureIndexMap(&residualVisitor, dmMesh);
 
   scalar_array coordsCell(numCorners*spaceDim);
   topology::CoordsVisitor coordsVisitor(dmMesh);
+  _useClosureIndexMap(&coordsVisitor, dmMesh);
 
   _material->createPropsAndVarsVisitors();
 
@@ -452,12 +467,14 @@ pylith::feassemble::ElasticityExplicitTri3::integrateJacobian(topology::Field* j
 
   // Setup visitors.
   topology::VecVisitorMesh jacobianVisitor(*jacobian, "displacement");
+  _useClosureIndexMap(&jacobianVisitor, dmMesh);
   // Don't optimize closure since we compute the Jacobian only once.
 
   _material->createPropsAndVarsVisitors();
 
   scalar_array coordsCell(numCorners*spaceDim);
   topology::CoordsVisitor coordsVisitor(dmMesh);
+  _useClosureIndexMap(&coordsVisitor, dmMesh);
 
   _logger->eventEnd(setupEvent);
 #if !defined(DETAILED_EVENT_LOGGING)
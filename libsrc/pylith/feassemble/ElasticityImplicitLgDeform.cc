@@ -170,20 +170,32 @@ pylith::feassemble::ElasticityImplicitLgDeform::integrateResidual(const topology
   const PetscInt* cells = _materialIS->points();
   const PetscInt numCells = _materialIS->size();
 
+  // Store strain for reuse in updating state variables.
+  const bool storeStrain = _storeStrain && _material->hasStateVars();
+  const int strainSize = numQuadPts*tensorSize;
+  _strainAtSolution = false;
+  if (storeStrain && _strainStored.size() != size_t(numCells*strainSize)) {
+    _strainStored.resize(numCells*strainSize);
+  } // if
+
   // Setup field visitors.
   scalar_array dispCell(numBasis*spaceDim);
   topology::VecVisitorMesh dispVisitor(fields->get("disp(t)"), "displacement");
   dispVisitor.optimizeClosure();
+  _useClosureIndexMap(&dispVisitor, dmMesh);
 
   scalar_array dispIncrCell(numBasis*spaceDim);
   topology::VecVisitorMesh dispIncrVisitor(fields->get("dispIncr(t->t+dt)"), "displacement");
   dispIncrVisitor.optimizeClosure();
+  _useClosureIndexMap(&dispIncrVisitor, dmMesh);
 
   topology::VecVisitorMesh residualVisitor(residual, "displacement");
   residualVisitor.optimizeClosure();
+  _useClosureIndexMap(&residualVisitor, dmMesh);
 
   scalar_array coordsCell(numBasis*spaceDim); // :KLUDGE: numBasis to numCorners after switching to higher order
   topology::CoordsVisitor coordsVisitor(dmMesh);
+  _useClosureIndexMap(&coordsVisitor, dmMesh);
 
   _material->createPropsAndVarsVisitors();
 
@@ -257,6 +269,9 @@ pylith::feassemble::ElasticityImplicitLgDeform::integrateResidual(const topology
     _calcDeformation(&deformCell, basisDeriv, &dispTpdtCell[0], numBasis, numQuadPts, spaceDim);
     calcTotalStrainFn(&strainCell, deformCell, numQuadPts);
     const scalar_array& stressCell = _material->calcStress(strainCell, true);
+    if (storeStrain) {
+      _strainStored[std::slice(c*strainSize, strainSize, 1)] = strainCell;
+    } // if
 
     CALL_MEMBER_FN(*this, elasticityResidualFn)(stressCell, dispTpdtCell);
 
@@ -344,13 +359,16 @@ pylith::feassemble::ElasticityImplicitLgDeform::integrateJacobian(topology::Jaco
   scalar_array dispCell(numBasis*spaceDim);
   topology::VecVisitorMesh dispVisitor(fields->get("disp(t)"), "displacement");
   dispVisitor.optimizeClosure();
+  _useClosureIndexMap(&dispVisitor, dmMesh);
 
   scalar_array dispIncrCell(numBasis*spaceDim);
   topology::VecVisitorMesh dispIncrVisitor(fields->get("dispIncr(t->t+dt)"), "displacement");
   dispIncrVisitor.optimizeClosure();
+  _useClosureIndexMap(&dispIncrVisitor, dmMesh);
 
   scalar_array coordsCell(numBasis*spaceDim); // :KLUDGE: numBasis to numCorners after switching to higher order
   topology::CoordsVisitor coordsVisitor(dmMesh);
+  _useClosureIndexMap(&coordsVisitor, dmMesh);
 
   // Get sparse matrix
   const PetscMat jacobianMat = jacobian->matrix();assert(jacobianMat);
@@ -50,6 +50,16 @@ class pylith::feassemble::Integrator
 { // Integrator
   friend class TestIntegrator; // unit testing
 
+// PUBLIC ENUMS /////////////////////////////////////////////////////////
+public :
+
+  /// Subsets of cells for integrating the residual in two phases.
+  enum CellSubsetEnum {
+    ALL_CELLS=0, ///< All cells.
+    BOUNDARY_CELLS=1, ///< Cells with points owned by other processors in their closure.
+    INTERIOR_CELLS=2, ///< Cells without points owned by other processors in their closure.
+  }; // CellSubsetEnum
+
 // PUBLIC MEMBERS ///////////////////////////////////////////////////////
 public :
 
@@ -121,6 +131,21 @@ public :
   virtual
   bool isJacobianSymmetric(void) const;
 
+  /** Check whether integrator can restrict integrateResidual() to
+   * boundary or interior cells.
+   *
+   * @returns True if integrator honors the subset of cells, false otherwise.
+   */
+  virtual
+  bool splitsCells(void) const;
+
+  /** Set subset of cells used in integrateResidual(). Only used if
+   * splitsCells() returns true.
+   *
+   * @param value Subset of cells.
+   */
+  void cellSubset(const CellSubsetEnum value);
+
   /** Initialize integrator.
    *
    * @param mesh Finite-element mesh.
@@ -203,6 +228,23 @@ public :
   void updateStateVars(const PylithScalar t,
 		       topology::SolutionFields* const fields);
 
+  /** Set flag for storing quantities computed during residual
+   * evaluation for reuse in updateStateVars().
+   *
+   * @param flag True to store quantities, false otherwise.
+   */
+  virtual
+  void storeResidualState(const bool flag);
+
+  /** Indicate whether the most recent residual evaluation used the
+   * current solution, so that quantities stored during that
+   * evaluation can be used in updateStateVars().
+   *
+   * @param flag True if residual was evaluated at current solution.
+   */
+  virtual
+  void residualAtSolution(const bool flag);
+
   /** Constrain solution space.
    *
    * @param fields Solution fields.
@@ -285,6 +327,9 @@ protected :
   /// Default is false;
   bool _isJacobianSymmetric;
 
+  /// Subset of cells used in integrateResidual().
+  CellSubsetEnum _cellSubset;
+
 // NOT IMPLEMENTED //////////////////////////////////////////////////////
 private :
 
@@ -30,6 +30,8 @@
 #include "pylith/topology/Stratum.hh" // USES Stratum
 #include "pylith/topology/VisitorMesh.hh" // USES VecVisitorMesh
 #include "pylith/topology/CoordsVisitor.hh" // USES CoordsVisitor
+#include "pylith/topology/ClosureIndexMap.hh" // USES ClosureIndexMap
+#include "pylith/topology/MeshOps.hh" // USES MeshOps
 #include "pylith/materials/ElasticMaterial.hh" // USES ElasticMaterial
 
 #include "spatialdata/units/Nondimensional.hh" // USES Nondimensional
@@ -49,7 +51,16 @@
 pylith::feassemble::IntegratorElasticity::IntegratorElasticity(void) :
     _material(0),
     _materialIS(0),
-    _outputFields(0)
+    _closureMap(0),
+    _coordsClosureMap(0),
+    _numBoundaryCells(0),
+    _outputFields(0),
+    _storeStrain(false),
+    _strainAtSolution(false),
+    _stateVarsDispState(-1),
+    _tensorCacheDispState(-1),
+    _tensorCacheStress(false),
+    _stressRequested(false)
 { // constructor
 } // constructor
 
@@ -71,7 +82,13 @@ pylith::feassemble::IntegratorElasticity::deallocate(void)
 
     _material = 0; // :TODO: Use shared pointer.
     delete _materialIS; _materialIS = 0;
+    delete _closureMap; _closureMap = 0;
+    delete _coordsClosureMap; _coordsClosureMap = 0;
+    _orderedCells.clear();
+    _numBoundaryCells = 0;
     delete _outputFields; _outputFields = 0;
+    _strainStored.resize(0);
+    _strainAtSolution = false;
 
     PYLITH_METHOD_END;
 } // deallocate
@@ -125,8 +142,14 @@ pylith::feassemble::IntegratorElasticity::initialize(const topology::Mesh& mesh)
     // Optimize coordinate retrieval in closure
     topology::CoordsVisitor::optimizeClosure(dmMesh);
 
-    // Initialize material.
+    // Initialize material. Setup time is dominated by querying the
+    // spatial databases, so we log it separately for each material.
+    assert(_logger);
+    const std::string& setupEvent = std::string("ElII ") + _material->label();
+    const int setupEventId = _logger->registerEvent(setupEvent.c_str());
+    _logger->eventBegin(setupEventId);
     _material->initialize(mesh, _quadrature);
+    _logger->eventEnd(setupEventId);
     _isJacobianSymmetric = _material->isJacobianSymmetric();
 
     // Allocate vectors and matrices for cell values.
@@ -160,6 +183,12 @@ pylith::feassemble::IntegratorElasticity::updateStateVars(const PylithScalar t,
     if (!_material->hasStateVars())
         PYLITH_METHOD_END;
 
+    // Use strain from residual evaluation if it matches the solution.
+    if (_updateStateVarsStoredStrain()) {
+        _stateVarsDispState = _fieldState(fields->get("disp(t)"));
+        PYLITH_METHOD_END;
+    } // if
+
     // Get cell information that doesn't depend on particular cell
     const int cellDim = _quadrature->cellDim();
     const int numQuadPts = _quadrature->numQuadPts();
@@ -192,9 +221,11 @@ pylith::feassemble::IntegratorElasticity::updateStateVars(const PylithScalar t,
     scalar_array dispCell(numBasis*spaceDim);
     topology::VecVisitorMesh dispVisitor(fields->get("disp(t)"), "displacement");
     dispVisitor.optimizeClosure();
+    _useClosureIndexMap(&dispVisitor, dmMesh);
 
     scalar_array coordsCell(numCorners*spaceDim);
     topology::CoordsVisitor coordsVisitor(dmMesh);
+    _useClosureIndexMap(&coordsVisitor, dmMesh);
 
     _material->createPropsAndVarsVisitors();
 
@@ -221,9 +252,79 @@ pylith::feassemble::IntegratorElasticity::updateStateVars(const PylithScalar t,
     } // for
     _material->destroyPropsAndVarsVisitors();
 
+    // Restoring the array increases the state of the displacement
+    // vector, so get the state after releasing the visitor.
+    dispVisitor.clear();
+    _stateVarsDispState = _fieldState(fields->get("disp(t)"));
+
     PYLITH_METHOD_END;
 } // updateStateVars
 
+// ----------------------------------------------------------------------
+// Set flag for storing total strain computed during residual evaluation.
+void
+pylith::feassemble::IntegratorElasticity::storeResidualState(const bool flag)
+{ // storeResidualState
+    _storeStrain = flag;
+    if (!flag) {
+        _strainStored.resize(0);
+        _strainAtSolution = false;
+    } // if
+} // storeResidualState
+
+// ----------------------------------------------------------------------
+// Indicate whether most recent residual evaluation used current solution.
+void
+pylith::feassemble::IntegratorElasticity::residualAtSolution(const bool flag)
+{ // residualAtSolution
+    _strainAtSolution = flag && _strainStored.size() > 0;
+} // residualAtSolution
+
+// ----------------------------------------------------------------------
+// Update state variables using total strain from residual evaluation.
+bool
+pylith::feassemble::IntegratorElasticity::_updateStateVarsStoredStrain(void)
+{ // _updateStateVarsStoredStrain
+    PYLITH_METHOD_BEGIN;
+
+    if (!_strainAtSolution) {
+        PYLITH_METHOD_RETURN(false);
+    } // if
+    _strainAtSolution = false; // State variables change, so don't reuse strain again.
+
+    assert(_quadrature);
+    assert(_material);
+    assert(_materialIS);
+
+    const int numQuadPts = _quadrature->numQuadPts();
+    const int tensorSize = _material->tensorSize();
+    const PetscInt* cells = _materialIS->points();
+    const PetscInt numCells = _materialIS->size();
+    const int strainSize = numQuadPts*tensorSize;
+    if (_strainStored.size() != size_t(numCells*strainSize)) {
+        PYLITH_METHOD_RETURN(false);
+    } // if
+
+    scalar_array strainCell(strainSize);
+
+    _material->createPropsAndVarsVisitors();
+
+    // Loop over cells
+    for(PetscInt c = 0; c < numCells; ++c) {
+        const PetscInt cell = cells[c];
+
+        // Get physical properties and state variables for cell.
+        _material->retrievePropsAndVars(cell);
+
+        // Update material state
+        strainCell = _strainStored[std::slice(c*strainSize, strainSize, 1)];
+        _material->updateStateVars(strainCell, cell);
+    } // for
+    _material->destroyPropsAndVarsVisitors();
+
+    PYLITH_METHOD_RETURN(true);
+} // _updateStateVarsStoredStrain
+
 // ----------------------------------------------------------------------
 // Verify configuration is acceptable.
 void
@@ -474,8 +575,30 @@ pylith::feassemble::IntegratorElasticity::_calcStrainStressField(topology::Field
     assert(field);
     assert(_quadrature);
     assert(_material);
+    assert(_outputFields);
+    assert(fields);
 
     const bool calcStress = (0 == strcasecmp(name, "stress") || 0 == strcasecmp(name, "cauchy_stress")) ? true : false;
+    if (calcStress) {
+        _stressRequested = true;
+    } // if
+
+    // Strain and stress are computed in the same traversal, so the
+    // other one may be available from the previous call.
+    const PetscObjectState dispState = _fieldState(fields->get("disp(t)"));
+    if (!_outputFields->hasField("buffer (tensor cache)")) {
+        _outputFields->add("buffer (tensor cache)", "buffer");
+        topology::Field& cache = _outputFields->get("buffer (tensor cache)");
+        cache.cloneSection(*field);
+        _tensorCacheDispState = -1;
+    } // if
+    topology::Field& cache = _outputFields->get("buffer (tensor cache)");
+    if (dispState == _tensorCacheDispState && calcStress == _tensorCacheStress) {
+        PetscErrorCode err = VecCopy(cache.localVector(), field->localVector());PYLITH_CHECK_ERROR(err);
+        _tensorCacheDispState = -1;
+        PYLITH_METHOD_END;
+    } // if
+    _tensorCacheDispState = -1;
 
     // Get cell information that doesn't depend on particular cell
     const int cellDim = _quadrature->cellDim();
@@ -494,6 +617,17 @@ pylith::feassemble::IntegratorElasticity::_calcStrainStressField(topology::Field
         throw std::logic_error("Bad cell dimension in IntegratorElasticity.");
     } // else
 
+    // Total strain stored as a state variable matches the current
+    // displacement if the state variables were updated after the last
+    // change in displacement, so we don't need to recompute it.
+    int useStateVarsStrainLocal = (calcStress && _material->hasStateVar("total_strain") && dispState == _stateVarsDispState) ? 1 : 0;
+    int useStateVarsStrainAll = 0;
+    MPI_Allreduce(&useStateVarsStrainLocal, &useStateVarsStrainAll, 1, MPI_INT, MPI_MIN, fields->mesh().comm());
+    const bool useStateVarsStrain = 1 == useStateVarsStrainAll;
+
+    // Compute stress along with strain if stress has been requested.
+    const bool calcBoth = calcStress || _stressRequested;
+
     // Allocate arrays for cell data.
     scalar_array dispCellTmp(numBasis*spaceDim);
     const int tensorCellSize = numQuadPts*tensorSize;
@@ -512,12 +646,20 @@ pylith::feassemble::IntegratorElasticity::_calcStrainStressField(topology::Field
     scalar_array dispCell(numBasis*spaceDim);
     topology::VecVisitorMesh dispVisitor(fields->get("disp(t)"), "displacement");
     dispVisitor.optimizeClosure();
+    _useClosureIndexMap(&dispVisitor, dmMesh);
+
+    if (useStateVarsStrain) {
+        _material->getField(&cache, "total_strain");
+    } // if
+    topology::VecVisitorMesh cacheVisitor(cache);
+    PetscScalar* cacheArray = cacheVisitor.localArray();
 
     topology::VecVisitorMesh fieldVisitor(*field);
     PetscScalar* fieldArray = fieldVisitor.localArray();
 
     scalar_array coordsCell(numBasis*spaceDim); // :KULDGE: Update numBasis to numCorners after implementing higher order
     topology::CoordsVisitor coordsVisitor(dmMesh);
+    _useClosureIndexMap(&coordsVisitor, dmMesh);
 
     _material->createPropsAndVarsVisitors();
 
@@ -525,37 +667,112 @@ pylith::feassemble::IntegratorElasticity::_calcStrainStressField(topology::Field
     for(PetscInt c = 0; c < numCells; ++c) {
         const PetscInt cell = cells[c];
 
-        // Retrieve geometry information for current cell
-        coordsVisitor.getClosure(&coordsCell, cell);
-        _quadrature->computeGeometry(&coordsCell[0], coordsCell.size(), cell);
-
-        // Get cell geometry information that depends on cell
-        dispVisitor.getClosure(&dispCell, cell);
-        const scalar_array& basisDeriv = _quadrature->basisDeriv();
-
-        // Compute strains
-        calcTotalStrainFn(&strainCell, basisDeriv, &dispCell[0], numBasis, spaceDim, numQuadPts);
-
         const PetscInt off = fieldVisitor.sectionOffset(cell);
         assert(tensorCellSize == fieldVisitor.sectionDof(cell));
-        if (!calcStress) {
+        const PetscInt coff = cacheVisitor.sectionOffset(cell);
+        assert(tensorCellSize == cacheVisitor.sectionDof(cell));
+
+        if (useStateVarsStrain) {
             for (int i=0; i < tensorCellSize; ++i) {
-                fieldArray[off+i] = strainCell[i];
+                strainCell[i] = cacheArray[coff+i];
             } // for
         } else {
+            // Retrieve geometry information for current cell
+            coordsVisitor.getClosure(&coordsCell, cell);
+            _quadrature->computeGeometry(&coordsCell[0], coordsCell.size(), cell);
+
+            // Get cell geometry information that depends on cell
+            dispVisitor.getClosure(&dispCell, cell);
+            const scalar_array& basisDeriv = _quadrature->basisDeriv();
+
+            // Compute strains
+            calcTotalStrainFn(&strainCell, basisDeriv, &dispCell[0], numBasis, spaceDim, numQuadPts);
+        } // if/else
+
+        if (calcBoth) {
             _material->retrievePropsAndVars(cell);
             stressCell = _material->calcStress(strainCell);
+        } // if
 
+        const scalar_array& valuesCell = calcStress ? stressCell : strainCell;
+        for (int i=0; i < tensorCellSize; ++i) {
+            fieldArray[off+i] = valuesCell[i];
+        } // for
+        if (calcBoth) {
+            const scalar_array& otherCell = calcStress ? strainCell : stressCell;
             for (int i=0; i < tensorCellSize; ++i) {
-                fieldArray[off+i] = stressCell[i];
+                cacheArray[coff+i] = otherCell[i];
             } // for
-        } // else
+        } // if
     } // for
     _material->destroyPropsAndVarsVisitors();
 
+    if (calcBoth) {
+        dispVisitor.clear();
+        _tensorCacheDispState = _fieldState(fields->get("disp(t)"));
+        _tensorCacheStress = !calcStress;
+    } // if
+
     PYLITH_METHOD_END;
 } // _calcStrainStressField
 
+// ----------------------------------------------------------------------
+// Get state of values in field.
+PetscObjectState
+pylith::feassemble::IntegratorElasticity::_fieldState(const topology::Field& field)
+{ // _fieldState
+    PYLITH_METHOD_BEGIN;
+
+    PetscObjectState state = 0;
+    PetscErrorCode err = PetscObjectStateGet((PetscObject) field.localVector(), &state);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_RETURN(state);
+} // _fieldState
+
+// ----------------------------------------------------------------------
+// Use table of offsets for closures of material cells with visitor
+// for a field.
+void
+pylith::feassemble::IntegratorElasticity::_useClosureIndexMap(topology::VecVisitorMesh* visitor,
+                                                              PetscDM dmMesh)
+{ // _useClosureIndexMap
+    PYLITH_METHOD_BEGIN;
+
+    assert(visitor);
+    assert(_materialIS);
+
+    if (!_closureMap) {
+        _closureMap = new topology::ClosureIndexMap; assert(_closureMap);
+        _closureMap->initialize(dmMesh, visitor->localSection(), _materialIS->points(), _materialIS->size());
+    } // if
+    visitor->closureIndexMap(_closureMap);
+
+    PYLITH_METHOD_END;
+} // _useClosureIndexMap
+
+// ----------------------------------------------------------------------
+// Use table of offsets for closures of material cells with visitor
+// for coordinates.
+void
+pylith::feassemble::IntegratorElasticity::_useClosureIndexMap(topology::CoordsVisitor* visitor,
+                                                              PetscDM dmMesh)
+{ // _useClosureIndexMap
+    PYLITH_METHOD_BEGIN;
+
+    assert(visitor);
+    assert(_materialIS);
+
+    if (!_coordsClosureMap) {
+        PetscSection coordSection = NULL;
+        PetscErrorCode err = DMGetCoordinateSection(dmMesh, &coordSection); PYLITH_CHECK_ERROR(err); assert(coordSection);
+        _coordsClosureMap = new topology::ClosureIndexMap; assert(_coordsClosureMap);
+        _coordsClosureMap->initialize(dmMesh, coordSection, _materialIS->points(), _materialIS->size());
+    } // if
+    visitor->closureIndexMap(_coordsClosureMap);
+
+    PYLITH_METHOD_END;
+} // _useClosureIndexMap
+
 // ----------------------------------------------------------------------
 // Integrate elasticity term in residual for 2-D cells.
 void
@@ -893,5 +1110,42 @@ pylith::feassemble::IntegratorElasticity::_calcTotalStrain3D(scalar_array* strai
         }                             // for
 } // calcTotalStrain3D
 
+// ----------------------------------------------------------------------
+// Get material cells in subset of cells used in integrateResidual().
+void
+pylith::feassemble::IntegratorElasticity::_residualCells(const PetscInt** cells,
+							  PetscInt* numCells,
+							  const topology::Mesh& mesh)
+{ // _residualCells
+    PYLITH_METHOD_BEGIN;
+
+    assert(cells);
+    assert(numCells);
+    assert(_materialIS);
+
+    const PetscInt numMaterialCells = _materialIS->size();
+    if (ALL_CELLS == _cellSubset || 0 == numMaterialCells) {
+        *cells = _materialIS->points();
+        *numCells = numMaterialCells;
+        PYLITH_METHOD_END;
+    } // if
+
+    if (_orderedCells.size() != size_t(numMaterialCells)) {
+        _orderedCells.resize(numMaterialCells);
+        _numBoundaryCells = topology::MeshOps::orderBoundaryCells(&_orderedCells[0], mesh, _materialIS->points(), numMaterialCells);
+    } // if
+
+    if (BOUNDARY_CELLS == _cellSubset) {
+        *cells = &_orderedCells[0];
+        *numCells = _numBoundaryCells;
+    } else {
+        assert(INTERIOR_CELLS == _cellSubset);
+        *cells = &_orderedCells[_numBoundaryCells];
+        *numCells = numMaterialCells - _numBoundaryCells;
+    } // if/else
+
+    PYLITH_METHOD_END;
+} // _residualCells
+
 
 // End of file
@@ -36,6 +36,8 @@
 
 #include "pylith/utils/arrayfwd.hh" // USES std::vector, scalar_array
 
+#include <vector> // HASA std::vector
+
 // IntegratorElasticity -------------------------------------------------
 /** @brief General elasticity operations for implicit and explicit
  * time integration of the elasticity equation.
@@ -98,6 +100,23 @@ public :
   void updateStateVars(const PylithScalar t,
 		       topology::SolutionFields* const fields);
 
+  /** Set flag for storing total strain computed during residual
+   * evaluation for reuse in updateStateVars().
+   *
+   * @param flag True to store strain, false otherwise.
+   */
+  virtual
+  void storeResidualState(const bool flag);
+
+  /** Indicate whether the most recent residual evaluation used the
+   * current solution, so that the stored total strain can be used in
+   * updateStateVars().
+   *
+   * @param flag True if residual was evaluated at current solution.
+   */
+  virtual
+  void residualAtSolution(const bool flag);
+
   /** Verify configuration is acceptable.
    *
    * @param mesh Finite-element mesh
@@ -135,6 +154,12 @@ protected :
   void _allocateTensorField(const topology::Mesh& mesh);
 
   /** Calculate stress or strain field from solution field.
+   *
+   * Strain and stress are computed in the same traversal once stress
+   * has been requested, and the other quantity is cached until the
+   * displacement changes. Stress is computed from the total strain
+   * state variable, if available and current, instead of from the
+   * displacement field.
    *
    * @param field Field in which to store stress or strain.
    * @param name Name of field to compute ['total_strain', 'stress', 'cauchy_stress'].
@@ -145,6 +170,56 @@ protected :
 			      const char* name,
 			      topology::SolutionFields* const fields);
 
+  /** Update state variables using total strain stored during the
+   * most recent residual evaluation.
+   *
+   * @returns True if state variables were updated, false if stored
+   * strain is not available or not consistent with current solution.
+   */
+  bool _updateStateVarsStoredStrain(void);
+
+  /** Get state of values in field (changes whenever the values change).
+   *
+   * @param field Field.
+   * @returns PETSc object state of local vector of field.
+   */
+  static
+  PetscObjectState _fieldState(const topology::Field& field);
+
+  /** Use table of offsets for closures of material cells with visitor
+   * for a field.
+   *
+   * The table is created from the section of the first field and
+   * reused for fields with the same layout in later calls.
+   *
+   * @param visitor Visitor for field over mesh.
+   * @param dmMesh PETSc DM for mesh.
+   */
+  void _useClosureIndexMap(topology::VecVisitorMesh* visitor,
+			   PetscDM dmMesh);
+
+  /** Use table of offsets for closures of material cells with visitor
+   * for coordinates.
+   *
+   * @param visitor Visitor for coordinates.
+   * @param dmMesh PETSc DM for mesh.
+   */
+  void _useClosureIndexMap(topology::CoordsVisitor* visitor,
+			   PetscDM dmMesh);
+
+  /** Get material cells in subset of cells used in integrateResidual().
+   *
+   * The boundary and interior cells are found the first time a subset
+   * other than all cells is requested.
+   *
+   * @param cells Array of cells in subset (output).
+   * @param numCells Number of cells in subset (output).
+   * @param mesh Finite-element mesh.
+   */
+  void _residualCells(const PetscInt** cells,
+		      PetscInt* numCells,
+		      const topology::Mesh& mesh);
+
   /** Integrate elasticity term in residual for 2-D cells.
    *
    * @param stress Stress tensor for cell at quadrature points.
@@ -214,9 +289,32 @@ protected :
   materials::ElasticMaterial* _material; ///< Material associated with integrator.
 
   topology::StratumIS* _materialIS; ///< Index set for material cells.
+
+  topology::ClosureIndexMap* _closureMap; ///< Offsets for closures of material cells for solution fields.
+  topology::ClosureIndexMap* _coordsClosureMap; ///< Offsets for closures of material cells for coordinates.
+
+  /// Material cells with boundary cells before interior cells.
+  std::vector<PetscInt> _orderedCells;
+  PetscInt _numBoundaryCells; ///< Number of boundary cells in _orderedCells.
   
   topology::Fields* _outputFields; ///< Buffers for output.
 
+  /** Total strain at quadrature points of all cells from most recent
+   * residual evaluation.
+   *
+   * size = numCells * numQuadPts * tensorSize
+   * index = (iCell * numQuadPts + iQuadPt) * tensorSize + iStrain
+   */
+  scalar_array _strainStored;
+
+  bool _storeStrain; ///< True if storing strain during residual evaluation.
+  bool _strainAtSolution; ///< True if stored strain corresponds to current solution.
+
+  PetscObjectState _stateVarsDispState; ///< State of displacement field when state variables were last updated.
+  PetscObjectState _tensorCacheDispState; ///< State of displacement field for cached output tensor (-1 if none).
+  bool _tensorCacheStress; ///< True if cached output tensor is stress, false if strain.
+  bool _stressRequested; ///< True if stress has been requested for output.
+
 // NOT IMPLEMENTED //////////////////////////////////////////////////////
 private :
 
@@ -80,6 +80,10 @@ pylith::feassemble::IntegratorElasticityLgDeform::updateStateVars(const PylithSc
   if (!_material->hasStateVars())
     PYLITH_METHOD_END;
 
+  // Use strain from residual evaluation if it matches the solution.
+  if (_updateStateVarsStoredStrain())
+    PYLITH_METHOD_END;
+
   // Get cell information that doesn't depend on particular cell
   const int cellDim = _quadrature->cellDim();
   const int numQuadPts = _quadrature->numQuadPts();
@@ -113,9 +117,11 @@ pylith::feassemble::IntegratorElasticityLgDeform::updateStateVars(const PylithSc
   scalar_array dispCell(numBasis*spaceDim);
   topology::VecVisitorMesh dispVisitor(fields->get("disp(t)"), "displacement");
   dispVisitor.optimizeClosure();
+  _useClosureIndexMap(&dispVisitor, dmMesh);
 
   scalar_array coordsCell(numBasis*spaceDim); // :KULDGE: Update numBasis to numCorners after implementing higher order
   topology::CoordsVisitor coordsVisitor(dmMesh);
+  _useClosureIndexMap(&coordsVisitor, dmMesh);
 
   _material->createPropsAndVarsVisitors();
 
@@ -201,12 +207,14 @@ pylith::feassemble::IntegratorElasticityLgDeform::_calcStrainStressField(topolog
   scalar_array dispCell(numBasis*spaceDim);
   topology::VecVisitorMesh dispVisitor(fields->get("disp(t)"), "displacement");
   dispVisitor.optimizeClosure();
+  _useClosureIndexMap(&dispVisitor, dmMesh);
 
   topology::VecVisitorMesh fieldVisitor(*field);
   PetscScalar* fieldArray = fieldVisitor.localArray();
 
   scalar_array coordsCell(numBasis*spaceDim); // :KULDGE: Update numBasis to numCorners after implementing higher order
   topology::CoordsVisitor coordsVisitor(dmMesh);
+  _useClosureIndexMap(&coordsVisitor, dmMesh);
 
   _material->createPropsAndVarsVisitors();
 
@@ -69,6 +69,9 @@ pylith::friction::FrictionModel::deallocate(void)
 { // deallocate
   PYLITH_METHOD_BEGIN;
 
+  destroyPropsStateVarsVisitors();
+  _propsStateVarsHandles.clear();
+
   delete _normalizer; _normalizer = 0;
   delete _fieldsPropsStateVars; _fieldsPropsStateVars = 0;
   _propsFiberDim = 0;
@@ -310,37 +313,69 @@ pylith::friction::FrictionModel::retrievePropsStateVars(const int point)
   PYLITH_METHOD_BEGIN;
 
   assert(_fieldsPropsStateVars);
-  PetscInt iOff = 0;
+  const size_t numFields = _propsStateVarsHandles.size();
+  assert(_propsStateVarsVisitors.empty() || _propsStateVarsVisitors.size() == numFields);
 
-  for (int i=0; i < _metadata.numProperties(); ++i) {
-    const materials::Metadata::ParamDescription& property = _metadata.getProperty(i);
-    // TODO This needs to be an integer instead of a string
-    topology::Field& propertyField = _fieldsPropsStateVars->get(property.name.c_str());
-    topology::VecVisitorMesh propertyVisitor(propertyField);
-    PetscScalar* propertyArray = propertyVisitor.localArray();
-    const PetscInt off = propertyVisitor.sectionOffset(point);
-    const PetscInt dof = propertyVisitor.sectionDof(point);
-    for(PetscInt d = 0; d < dof; ++d, ++iOff) {
-      _propsStateVarsVertex[iOff] = propertyArray[off+d];
-    } // for
-  } // for
-  for (int i=0; i < _metadata.numStateVars(); ++i) {
-    const materials::Metadata::ParamDescription& stateVar = _metadata.getStateVar(i);
-    // TODO This needs to be an integer instead of a string
-    topology::Field& stateVarField = _fieldsPropsStateVars->get(stateVar.name.c_str());
-    topology::VecVisitorMesh stateVarVisitor(stateVarField);
-    PetscScalar* stateVarArray = stateVarVisitor.localArray();
-    const PetscInt off = stateVarVisitor.sectionOffset(point);
-    const PetscInt dof = stateVarVisitor.sectionDof(point);
-    for(PetscInt d = 0; d < dof; ++d, ++iOff) {
-      _propsStateVarsVertex[iOff] = stateVarArray[off+d];
-    } // for
+  PetscInt iOff = 0;
+  for (size_t i=0; i < numFields; ++i) {
+    if (!_propsStateVarsVisitors.empty()) {
+      const topology::VecVisitorMesh* visitor = _propsStateVarsVisitors[i];assert(visitor);
+      const PetscScalar* fieldArray = visitor->localArray();
+      const PetscInt off = visitor->sectionOffset(point);
+      const PetscInt dof = visitor->sectionDof(point);
+      for(PetscInt d = 0; d < dof; ++d, ++iOff) {
+	_propsStateVarsVertex[iOff] = fieldArray[off+d];
+      } // for
+    } else {
+      topology::VecVisitorMesh visitor(*_fieldsPropsStateVars, _propsStateVarsHandles[i]);
+      const PetscScalar* fieldArray = visitor.localArray();
+      const PetscInt off = visitor.sectionOffset(point);
+      const PetscInt dof = visitor.sectionDof(point);
+      for(PetscInt d = 0; d < dof; ++d, ++iOff) {
+	_propsStateVarsVertex[iOff] = fieldArray[off+d];
+      } // for
+    } // if/else
   } // for
   assert(_propsStateVarsVertex.size() == size_t(iOff));
 
   PYLITH_METHOD_END;
 } // retrievePropsStateVars
 
+// ----------------------------------------------------------------------
+// Create visitors for properties and state variables.
+void
+pylith::friction::FrictionModel::createPropsStateVarsVisitors(void)
+{ // createPropsStateVarsVisitors
+  PYLITH_METHOD_BEGIN;
+
+  assert(_fieldsPropsStateVars);
+
+  destroyPropsStateVarsVisitors();
+  const size_t numFields = _propsStateVarsHandles.size();
+  _propsStateVarsVisitors.resize(numFields);
+  for (size_t i=0; i < numFields; ++i) {
+    _propsStateVarsVisitors[i] = new topology::VecVisitorMesh(*_fieldsPropsStateVars, _propsStateVarsHandles[i]);assert(_propsStateVarsVisitors[i]);
+  } // for
+
+  PYLITH_METHOD_END;
+} // createPropsStateVarsVisitors
+
+// ----------------------------------------------------------------------
+// Destroy visitors for properties and state variables.
+void
+pylith::friction::FrictionModel::destroyPropsStateVarsVisitors(void)
+{ // destroyPropsStateVarsVisitors
+  PYLITH_METHOD_BEGIN;
+
+  const size_t numVisitors = _propsStateVarsVisitors.size();
+  for (size_t i=0; i < numVisitors; ++i) {
+    delete _propsStateVarsVisitors[i]; _propsStateVarsVisitors[i] = 0;
+  } // for
+  _propsStateVarsVisitors.clear();
+
+  PYLITH_METHOD_END;
+} // destroyPropsStateVarsVisitors
+
 // ----------------------------------------------------------------------
 // Compute friction at vertex.
 PylithScalar
@@ -411,31 +446,29 @@ pylith::friction::FrictionModel::updateStateVars(const PylithScalar t,
 		   &stateVarsVertex[0], _varsFiberDim,
 		   &propertiesVertex[0], _propsFiberDim);
 
-  PetscInt iOff = 0;
-
-  for (int i=0; i < _metadata.numProperties(); ++i) {
-    const materials::Metadata::ParamDescription& property = _metadata.getProperty(i);
-    // TODO This needs to be an integer instead of a string
-    topology::Field& propertyField = _fieldsPropsStateVars->get(property.name.c_str());
-    topology::VecVisitorMesh propertyVisitor(propertyField);
-    PetscScalar* propertyArray = propertyVisitor.localArray();
-    const PetscInt off = propertyVisitor.sectionOffset(vertex);
-    const PetscInt dof = propertyVisitor.sectionDof(vertex);
-    for(PetscInt d = 0; d < dof; ++d, ++iOff) {
-      propertyArray[off+d] = _propsStateVarsVertex[iOff];
-    } // for
-  } // for
-  for (int i=0; i < _metadata.numStateVars(); ++i) {
-    const materials::Metadata::ParamDescription& stateVar = _metadata.getStateVar(i);
-    // TODO This needs to be an integer instead of a string
-    topology::Field& stateVarField = _fieldsPropsStateVars->get(stateVar.name.c_str());
-    topology::VecVisitorMesh stateVarVisitor(stateVarField);
-    PetscScalar* stateVarArray = stateVarVisitor.localArray();
-    const PetscInt off = stateVarVisitor.sectionOffset(vertex);
-    const PetscInt dof = stateVarVisitor.sectionDof(vertex);
-    for(PetscInt d = 0; d < dof; ++d, ++iOff) {
-      stateVarArray[off+d] = _propsStateVarsVertex[iOff];
-    } // for
+  // Only state variables change, so skip writing properties.
+  const size_t numFields = _propsStateVarsHandles.size();
+  assert(_propsStateVarsVisitors.empty() || _propsStateVarsVisitors.size() == numFields);
+
+  PetscInt iOff = _propsFiberDim;
+  for (size_t i=_metadata.numProperties(); i < numFields; ++i) {
+    if (!_propsStateVarsVisitors.empty()) {
+      const topology::VecVisitorMesh* visitor = _propsStateVarsVisitors[i];assert(visitor);
+      PetscScalar* fieldArray = visitor->localArray();
+      const PetscInt off = visitor->sectionOffset(vertex);
+      const PetscInt dof = visitor->sectionDof(vertex);
+      for(PetscInt d = 0; d < dof; ++d, ++iOff) {
+	fieldArray[off+d] = _propsStateVarsVertex[iOff];
+      } // for
+    } else {
+      topology::VecVisitorMesh visitor(*_fieldsPropsStateVars, _propsStateVarsHandles[i]);
+      PetscScalar* fieldArray = visitor.localArray();
+      const PetscInt off = visitor.sectionOffset(vertex);
+      const PetscInt dof = visitor.sectionDof(vertex);
+      for(PetscInt d = 0; d < dof; ++d, ++iOff) {
+	fieldArray[off+d] = _propsStateVarsVertex[iOff];
+      } // for
+    } // if/else
   } // for
   assert(_propsStateVarsVertex.size() == size_t(iOff));
 
@@ -492,12 +525,15 @@ pylith::friction::FrictionModel::_setupPropsStateVars(void)
 
   // Setup fields
   assert(_fieldsPropsStateVars);
+  destroyPropsStateVarsVisitors();
+  _propsStateVarsHandles.resize(numProperties + numStateVars);
 
   for (int i=0, iScale=0; i < numProperties; ++i) {
     const materials::Metadata::ParamDescription& property = 
       _metadata.getProperty(i);
     _fieldsPropsStateVars->add(property.name.c_str(), property.name.c_str());
-    topology::Field& propertyField = _fieldsPropsStateVars->get(property.name.c_str());
+    _propsStateVarsHandles[i] = _fieldsPropsStateVars->handle(property.name.c_str());
+    topology::Field& propertyField = _fieldsPropsStateVars->get(_propsStateVarsHandles[i]);
     propertyField.newSection(topology::FieldBase::VERTICES_FIELD, property.fiberDim);
     propertyField.allocate();
     propertyField.vectorFieldType(property.fieldType);
@@ -510,7 +546,8 @@ pylith::friction::FrictionModel::_setupPropsStateVars(void)
     const materials::Metadata::ParamDescription& stateVar = 
       _metadata.getStateVar(i);
     _fieldsPropsStateVars->add(stateVar.name.c_str(), stateVar.name.c_str());
-    topology::Field& stateVarField = _fieldsPropsStateVars->get(stateVar.name.c_str());
+    _propsStateVarsHandles[numProperties+i] = _fieldsPropsStateVars->handle(stateVar.name.c_str());
+    topology::Field& stateVarField = _fieldsPropsStateVars->get(_propsStateVarsHandles[numProperties+i]);
     stateVarField.newSection(topology::FieldBase::VERTICES_FIELD, stateVar.fiberDim);
     stateVarField.allocate();
     stateVarField.vectorFieldType(stateVar.fieldType);
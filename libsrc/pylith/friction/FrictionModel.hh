@@ -35,6 +35,7 @@
 #include "pylith/materials/Metadata.hh" // HASA Metadata
 
 #include <string> // HASA std::string
+#include <vector> // HASA std::vector
 
 // FrictionModel --------------------------------------------------------
 /** @brief C++ abstract base class for FrictionModel object.
@@ -157,6 +158,17 @@ public :
    */
   void retrievePropsStateVars(const int point);
 
+  /** Create visitors for properties and state variables.
+   *
+   * Visitors are reused by retrievePropsStateVars() and
+   * updateStateVars() until destroyPropsStateVarsVisitors() is
+   * called, so they should bracket loops over vertices.
+   */
+  void createPropsStateVarsVisitors(void);
+
+  /// Destroy visitors for properties and state variables.
+  void destroyPropsStateVarsVisitors(void);
+
   /** Compute friction at vertex.
    *
    * @pre Must call retrievePropsAndVars for cell before calling
@@ -369,6 +381,12 @@ private :
   /// Buffer for properties and state variables at vertex.
   scalar_array _propsStateVarsVertex;
 
+  /// Handles for properties followed by state variables in fields manager.
+  std::vector<int> _propsStateVarsHandles;
+
+  /// Visitors for properties followed by state variables (empty if not created).
+  std::vector<topology::VecVisitorMesh*> _propsStateVarsVisitors;
+
   int _propsFiberDim; ///< Number of properties per point.
   int _varsFiberDim; ///< Number of state variables per point.
 
@@ -45,9 +45,15 @@ public :
    * guess in the case where the
    * actual initial guess is zero.
    *
+   * The initial bracket spans effStressInitialGuess*(1 +/- bracketWidth).
+   * A narrow bracket is appropriate when the initial guess is a
+   * converged value from a previous solve; the bracket is expanded
+   * as needed.
+   *
    * @param effStressInitialGuess Initial guess for effective stress.
-   * @param effStressParams Parameters used in computing effective stress.
+   * @param stressScale Scale used when initial guess is zero.
    * @param material Material with effective stress function.
+   * @param bracketWidth Relative half-width of initial bracket.
    *
    * @returns Computed effective stress.
    */
@@ -55,7 +61,8 @@ public :
   static
   PylithScalar calculate(const PylithScalar effStressInitialGuess,
 		   const PylithScalar stressScale,
-		   material_type* const material);
+		   material_type* const material,
+		   const PylithScalar bracketWidth =0.5);
 
   // PRIVATE METHODS /////////////////////////////////////////////////////
 private :
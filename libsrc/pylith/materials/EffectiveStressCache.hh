@@ -0,0 +1,115 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+/** @file libsrc/materials/EffectiveStressCache.hh
+ *
+ * @brief C++ EffectiveStressCache object.
+ */
+
+#if !defined(pylith_materials_effectivestresscache_hh)
+#define pylith_materials_effectivestresscache_hh
+
+// Include directives ---------------------------------------------------
+#include "materialsfwd.hh"
+
+#include "pylith/utils/types.hh" // HASA PylithScalar
+
+#include <vector> // HASA std::vector
+
+// EffectiveStressCache -------------------------------------------------
+/** @brief C++ EffectiveStressCache object.
+ *
+ * Converged effective stress at each quadrature point for materials
+ * that use EffectiveStress. The stress, elastic constants, and state
+ * variables are computed from identical parameters within a time
+ * step, so the converged value is reused when the parameters match
+ * those of the previous solve at the quadrature point. Otherwise, the
+ * root-finding algorithm starts from a narrow bracket about the
+ * previous converged value.
+ *
+ * Parameters are compared bitwise, so params_type must be a plain
+ * struct of PylithScalar values (no padding).
+ */
+template<typename params_type>
+class pylith::materials::EffectiveStressCache
+{ // class EffectiveStressCache
+
+  // PUBLIC METHODS /////////////////////////////////////////////////////
+public :
+
+  /// Default constructor.
+  EffectiveStressCache(void);
+
+  /// Discard all cached values.
+  void clear(void);
+
+  /** Get effective stress at quadrature point.
+   *
+   * @param index Index of quadrature point.
+   * @param params Parameters of effective stress function.
+   * @param effStressInitialGuess Effective stress at beginning of time step.
+   * @param stressScale Scale used when initial guess is zero.
+   * @param material Material with effective stress function.
+   *
+   * @returns Effective stress at end of time step.
+   */
+  template<typename material_type>
+  PylithScalar calculate(const int index,
+			 const params_type& params,
+			 const PylithScalar effStressInitialGuess,
+			 const PylithScalar stressScale,
+			 material_type* const material);
+
+  /** Get number of lookups that reused a converged value.
+   *
+   * @returns Number of cache hits.
+   */
+  int numHits(void) const;
+
+  /** Get number of lookups that required a root-finding solve.
+   *
+   * @returns Number of cache misses.
+   */
+  int numMisses(void) const;
+
+  // PRIVATE STRUCTS ////////////////////////////////////////////////////
+private :
+
+  struct EntryStruct {
+    params_type params;
+    PylithScalar effStress;
+    bool valid;
+  };
+
+  // PRIVATE MEMBERS ////////////////////////////////////////////////////
+private :
+
+  std::vector<EntryStruct> _entries; ///< Cached values at quadrature points.
+  int _numHits; ///< Number of lookups that reused a converged value.
+  int _numMisses; ///< Number of lookups that required a solve.
+
+  static const PylithScalar _bracketWidth; ///< Relative half-width of bracket about cached value.
+
+}; // class EffectiveStressCache
+
+#include "EffectiveStressCache.icc" // template methods
+
+#endif // pylith_materials_effectivestresscache_hh
+
+
+// End of file
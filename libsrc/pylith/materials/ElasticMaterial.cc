@@ -46,6 +46,7 @@ pylith::materials::ElasticMaterial::ElasticMaterial(const int dimension,
 						    const int numElasticConsts,
 						    const Metadata& metadata) :
   Material(dimension, tensorSize, metadata),
+  _quadPtIndex(0),
   _dbInitialStress(0),
   _dbInitialStrain(0),
   _initialFields(0),
@@ -54,7 +55,9 @@ pylith::materials::ElasticMaterial::ElasticMaterial(const int dimension,
   _propertiesVisitor(0),
   _stateVarsVisitor(0),
   _stressVisitor(0),
-  _strainVisitor(0)
+  _strainVisitor(0),
+  _propertiesSection(NULL),
+  _cellQuadPtOffset(0)
 { // constructor
 } // constructor
 
@@ -79,6 +82,7 @@ pylith::materials::ElasticMaterial::deallocate(void)
   delete _stateVarsVisitor; _stateVarsVisitor = 0;
   delete _stressVisitor; _stressVisitor = 0;
   delete _strainVisitor; _strainVisitor = 0;
+  _propertiesSection = NULL;
 
   _dbInitialStress = 0; // :TODO: Use shared pointer.
   _dbInitialStrain = 0; // :TODO: Use shared pointer.
@@ -120,8 +124,14 @@ pylith::materials::ElasticMaterial::createPropsAndVarsVisitors(void)
   assert(_properties);
   assert(_stateVars);
 
-  delete _propertiesVisitor; _propertiesVisitor = new pylith::topology::VecVisitorMesh(*_properties);assert(_propertiesVisitor);
-  _propertiesVisitor->optimizeClosure();
+  delete _propertiesVisitor; _propertiesVisitor = 0;
+  _propertiesSection = NULL;
+  if (_propertiesStoredCompact) {
+    _propertiesSection = _properties->localSection();assert(_propertiesSection);
+  } else {
+    _propertiesVisitor = new pylith::topology::VecVisitorMesh(*_properties);assert(_propertiesVisitor);
+    _propertiesVisitor->optimizeClosure();
+  } // if/else
   if (hasStateVars()) {
     delete _stateVarsVisitor; _stateVarsVisitor = new pylith::topology::VecVisitorMesh(*_stateVars);assert(_stateVarsVisitor);
     _stateVarsVisitor->optimizeClosure();
@@ -153,6 +163,7 @@ pylith::materials::ElasticMaterial::destroyPropsAndVarsVisitors(void)
   delete _stateVarsVisitor; _stateVarsVisitor = 0;
   delete _stressVisitor; _stressVisitor = 0;
   delete _strainVisitor; _strainVisitor = 0;
+  _propertiesSection = NULL;
 
   PYLITH_METHOD_END;
 } // destroyPropsAndVarsVisitors
@@ -172,13 +183,21 @@ pylith::materials::ElasticMaterial::retrievePropsAndVars(const int cell)
   assert(_propertiesCell.size() == size_t(propertiesSize));
   assert(_stateVarsCell.size() == size_t(stateVarsSize));
 
-  assert(_propertiesVisitor);
-  PetscScalar* propertiesArray = _propertiesVisitor->localArray();
-  const PetscInt poff = _propertiesVisitor->sectionOffset(cell);
-  assert(propertiesSize == _propertiesVisitor->sectionDof(cell));
-  for(PetscInt d = 0; d < propertiesSize; ++d) {
-    _propertiesCell[d] = propertiesArray[poff+d];
-  } // for
+  PetscInt poff = 0;
+  if (_propertiesStoredCompact) {
+    assert(_propertiesSection);
+    PetscErrorCode err = PetscSectionGetOffset(_propertiesSection, cell, &poff);PYLITH_CHECK_ERROR(err);
+    _getPropertiesCell(&_propertiesCell[0], propertiesSize, poff);
+  } else {
+    assert(_propertiesVisitor);
+    PetscScalar* propertiesArray = _propertiesVisitor->localArray();
+    poff = _propertiesVisitor->sectionOffset(cell);
+    assert(propertiesSize == _propertiesVisitor->sectionDof(cell));
+    for(PetscInt d = 0; d < propertiesSize; ++d) {
+      _propertiesCell[d] = propertiesArray[poff+d];
+    } // for
+  } // if/else
+  _cellQuadPtOffset = poff / _numPropsQuadPt;
 
   if (hasStateVars()) {
     assert(_stateVarsVisitor);
@@ -238,7 +257,8 @@ pylith::materials::ElasticMaterial::calcStress(const scalar_array& totalStrain,
   assert(_initialStrainCell.size() == size_t(numQuadPts*_tensorSize));
   assert(totalStrain.size() == size_t(numQuadPts*_tensorSize));
 
-  for (int iQuad=0; iQuad < numQuadPts; ++iQuad)
+  for (int iQuad=0; iQuad < numQuadPts; ++iQuad) {
+    _quadPtIndex = _cellQuadPtOffset + iQuad;
     _calcStress(&_stressCell[iQuad*_tensorSize], _tensorSize,
 		&_propertiesCell[iQuad*numPropsQuadPt], numPropsQuadPt,
 		&_stateVarsCell[iQuad*numVarsQuadPt], numVarsQuadPt,
@@ -246,6 +266,7 @@ pylith::materials::ElasticMaterial::calcStress(const scalar_array& totalStrain,
 		&_initialStressCell[iQuad*_tensorSize], _tensorSize,
 		&_initialStrainCell[iQuad*_tensorSize], _tensorSize,
 		computeStateVars);
+  } // for
 
   PYLITH_METHOD_RETURN(_stressCell);
 } // calcStress
@@ -267,7 +288,8 @@ pylith::materials::ElasticMaterial::calcDerivElastic(const scalar_array& totalSt
   assert(_initialStrainCell.size() == size_t(numQuadPts*_tensorSize));
   assert(totalStrain.size() == size_t(numQuadPts*_tensorSize));
 
-  for (int iQuad=0; iQuad < numQuadPts; ++iQuad)
+  for (int iQuad=0; iQuad < numQuadPts; ++iQuad) {
+    _quadPtIndex = _cellQuadPtOffset + iQuad;
     _calcElasticConsts(&_elasticConstsCell[iQuad*_numElasticConsts], 
 		       _numElasticConsts,
 		       &_propertiesCell[iQuad*numPropsQuadPt], 
@@ -276,6 +298,7 @@ pylith::materials::ElasticMaterial::calcDerivElastic(const scalar_array& totalSt
 		       &totalStrain[iQuad*_tensorSize], _tensorSize,
 		       &_initialStressCell[iQuad*_tensorSize], _tensorSize,
 		       &_initialStrainCell[iQuad*_tensorSize], _tensorSize);
+  } // for
 
   PYLITH_METHOD_RETURN(_elasticConstsCell);
 } // calcDerivElastic
@@ -297,13 +320,15 @@ pylith::materials::ElasticMaterial::updateStateVars(const scalar_array& totalStr
   assert(_initialStrainCell.size() == size_t(numQuadPts*_tensorSize));
   assert(totalStrain.size() == size_t(numQuadPts*_tensorSize));
 
-  for (int iQuad=0; iQuad < numQuadPts; ++iQuad)
+  for (int iQuad=0; iQuad < numQuadPts; ++iQuad) {
+    _quadPtIndex = _cellQuadPtOffset + iQuad;
     _updateStateVars(&_stateVarsCell[iQuad*numVarsQuadPt], numVarsQuadPt,
 		     &_propertiesCell[iQuad*numPropsQuadPt], 
 		     numPropsQuadPt,
 		     &totalStrain[iQuad*_tensorSize], _tensorSize,
 		     &_initialStressCell[iQuad*_tensorSize], _tensorSize,
 		     &_initialStrainCell[iQuad*_tensorSize], _tensorSize);
+  } // for
   
   topology::VecVisitorMesh stateVarsVisitor(*_stateVars);
   PetscScalar* stateVarsArray = stateVarsVisitor.localArray();
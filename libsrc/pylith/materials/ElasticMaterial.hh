@@ -432,6 +432,17 @@ protected :
   PylithScalar scalarProduct3D(const PylithScalar* tensor1,
 			       const PylithScalar* tensor2);
   
+  // PROTECTED MEMBERS //////////////////////////////////////////////////
+protected :
+
+  /** Index of current quadrature point over all cells in material.
+   *
+   * Set before each call to _calcStress(), _calcElasticConsts(), and
+   * _updateStateVars() so materials can cache values at quadrature
+   * points between calls.
+   */
+  int _quadPtIndex;
+
   // PRIVATE METHODS ////////////////////////////////////////////////////
 private :
 
@@ -525,6 +536,9 @@ private :
   pylith::topology::VecVisitorMesh* _stateVarsVisitor; ///< Visitor for stateVars field.
   pylith::topology::VecVisitorMesh* _stressVisitor; ///< Visitor for initial stress field.
   pylith::topology::VecVisitorMesh* _strainVisitor; ///< Visitor for initial strain field.
+  PetscSection _propertiesSection; ///< Section for properties stored in compact form.
+
+  int _cellQuadPtOffset; ///< Index of first quadrature point of current cell.
 
   // NOT IMPLEMENTED ////////////////////////////////////////////////////
 private :
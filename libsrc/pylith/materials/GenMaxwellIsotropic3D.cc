@@ -695,7 +695,7 @@ pylith::materials::GenMaxwellIsotropic3D::_calcElasticConstsViscoelastic(
     if (shearRatio != 0.0) {
       maxwellTime = properties[p_maxwellTime + imodel];
       visFac +=
-	shearRatio*ViscoelasticMaxwell::viscousStrainParam(_dt, maxwellTime);
+	shearRatio*_viscousStrainParams.viscousStrainParam(_dt, maxwellTime);
     } // if
   } // for
   PylithScalar elasFrac = 1.0 - visFrac;
@@ -965,10 +965,14 @@ pylith::materials::GenMaxwellIsotropic3D::_computeStateVars(
 
   // Compute Prony series terms
   scalar_array dq(numMaxwellModels);
+  scalar_array expFac(numMaxwellModels);
   dq = 0.0;
+  expFac = 0.0;
   for (int i=0; i < numMaxwellModels; ++i)
-    if (muRatio[i] != 0.0)
-      dq[i] = ViscoelasticMaxwell::viscousStrainParam(_dt, maxwellTime[i]);
+    if (muRatio[i] != 0.0) {
+      dq[i] = _viscousStrainParams.viscousStrainParam(_dt, maxwellTime[i]);
+      expFac[i] = _viscousStrainParams.expFactor(_dt, maxwellTime[i]);
+    } // if
 
   // Compute new viscous strains
   PylithScalar devStrainTpdt = 0.0;
@@ -984,7 +988,7 @@ pylith::materials::GenMaxwellIsotropic3D::_computeStateVars(
     int imodel = 0;
     if (0.0 != muRatio[imodel]) {
       _viscousStrain[imodel * tensorSize+iComp] = 
-	exp(-_dt/maxwellTime[imodel]) *
+	expFac[imodel] *
 	stateVars[s_viscousStrain1 + iComp] + dq[imodel] * deltaStrain;
       PetscLogFlops(6);
     } // if
@@ -993,7 +997,7 @@ pylith::materials::GenMaxwellIsotropic3D::_computeStateVars(
     imodel = 1;
     if (0.0 != muRatio[imodel]) {
       _viscousStrain[imodel*tensorSize+iComp] =
-	exp(-_dt/maxwellTime[imodel]) *
+	expFac[imodel] *
 	stateVars[s_viscousStrain2 + iComp] + dq[imodel] * deltaStrain;
       PetscLogFlops(6);
     } // if
@@ -1002,7 +1006,7 @@ pylith::materials::GenMaxwellIsotropic3D::_computeStateVars(
     imodel = 2;
     if (0.0 != muRatio[imodel]) {
       _viscousStrain[imodel*tensorSize+iComp] =
-	exp(-_dt/maxwellTime[imodel]) *
+	expFac[imodel] *
 	stateVars[s_viscousStrain3 + iComp] + dq[imodel] * deltaStrain;
       PetscLogFlops(6);
     } // if
@@ -30,6 +30,7 @@
 
 // Include directives ---------------------------------------------------
 #include "ElasticMaterial.hh" // ISA ElasticMaterial
+#include "ViscoelasticMaxwell.hh" // HASA ViscoelasticMaxwell::ParamCache
 
 // GenMaxwellIsotropic3D ------------------------------------------------
 /** @brief 3-D, isotropic, generalized linear Maxwell viscoelastic material.
@@ -493,6 +494,9 @@ private :
   /// Viscous strain array.
   scalar_array _viscousStrain;
 
+  /// Cache of viscous strain parameters.
+  ViscoelasticMaxwell::ParamCache _viscousStrainParams;
+
   /// Method to use for _calcElasticConsts().
   calcElasticConsts_fn_type _calcElasticConstsFn;
 
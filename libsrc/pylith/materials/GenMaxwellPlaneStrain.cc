@@ -686,7 +686,7 @@ pylith::materials::GenMaxwellPlaneStrain::_calcElasticConstsViscoelastic(
     if (shearRatio != 0.0) {
       maxwellTime = properties[p_maxwellTime + imodel];
       visFac +=
-	shearRatio * ViscoelasticMaxwell::viscousStrainParam(_dt, maxwellTime);
+	shearRatio * _viscousStrainParams.viscousStrainParam(_dt, maxwellTime);
     } // if
   } // for
   PylithScalar elasFrac = 1.0 - visFrac;
@@ -920,10 +920,14 @@ pylith::materials::GenMaxwellPlaneStrain::_computeStateVars(
 
   // Compute Prony series terms
   scalar_array dq(numMaxwellModels);
+  scalar_array expFac(numMaxwellModels);
   dq = 0.0;
+  expFac = 0.0;
   for (int i=0; i < numMaxwellModels; ++i)
-    if (muRatio[i] != 0.0)
-      dq[i] = ViscoelasticMaxwell::viscousStrainParam(_dt, maxwellTime[i]);
+    if (muRatio[i] != 0.0) {
+      dq[i] = _viscousStrainParams.viscousStrainParam(_dt, maxwellTime[i]);
+      expFac[i] = _viscousStrainParams.expFactor(_dt, maxwellTime[i]);
+    } // if
 
   // Compute new viscous strains
   PylithScalar devStrainTpdt = 0.0;
@@ -938,7 +942,7 @@ pylith::materials::GenMaxwellPlaneStrain::_computeStateVars(
     // Maxwell model 1
     int imodel = 0;
     if (0.0 != muRatio[imodel]) {
-      _viscousStrain[imodel * 4 + iComp] = exp(-_dt / maxwellTime[imodel]) *
+      _viscousStrain[imodel * 4 + iComp] = expFac[imodel] *
 	stateVars[s_viscousStrain1 + iComp] + dq[imodel] * deltaStrain;
       PetscLogFlops(6);
     } // if
@@ -946,7 +950,7 @@ pylith::materials::GenMaxwellPlaneStrain::_computeStateVars(
     // Maxwell model 2
     imodel = 1;
     if (0.0 != muRatio[imodel]) {
-      _viscousStrain[imodel * 4 + iComp] = exp(-_dt / maxwellTime[imodel]) *
+      _viscousStrain[imodel * 4 + iComp] = expFac[imodel] *
 	stateVars[s_viscousStrain2 + iComp] + dq[imodel] * deltaStrain;
       PetscLogFlops(6);
     } // if
@@ -954,7 +958,7 @@ pylith::materials::GenMaxwellPlaneStrain::_computeStateVars(
     // Maxwell model 3
     imodel = 2;
     if (0.0 != muRatio[imodel]) {
-      _viscousStrain[imodel * 4 + iComp] = exp(-_dt / maxwellTime[imodel]) *
+      _viscousStrain[imodel * 4 + iComp] = expFac[imodel] *
 	stateVars[s_viscousStrain3 + iComp] + dq[imodel] * deltaStrain;
       PetscLogFlops(6);
     } // if
@@ -27,6 +27,7 @@
 
 // Include directives ---------------------------------------------------
 #include "ElasticMaterial.hh" // ISA ElasticMaterial
+#include "ViscoelasticMaxwell.hh" // HASA ViscoelasticMaxwell::ParamCache
 
 // GenMaxwellPlaneStrain ---------------------------------------------------
 /** @brief 2-D, isotropic, generalized linear Maxwell viscoelastic material for
@@ -503,6 +504,9 @@ private :
   /// Viscous strain array.
   scalar_array _viscousStrain;
 
+  /// Cache of viscous strain parameters.
+  ViscoelasticMaxwell::ParamCache _viscousStrainParams;
+
   /// Method to use for _calcElasticConsts().
   calcElasticConsts_fn_type _calcElasticConstsFn;
 
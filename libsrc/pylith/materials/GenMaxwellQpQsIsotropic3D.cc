@@ -758,10 +758,10 @@ pylith::materials::GenMaxwellQpQsIsotropic3D::_calcElasticConstsViscoelastic(
 
     const PylithScalar maxwellTimeShear = properties[p_maxwellTimeShear+iModel];
     visFactorDev +=
-      shearRatio*ViscoelasticMaxwell::viscousStrainParam(_dt, maxwellTimeShear);
+      shearRatio*_viscousStrainParams.viscousStrainParam(_dt, maxwellTimeShear);
     const PylithScalar maxwellTimeBulk = properties[p_maxwellTimeBulk+iModel];
     visFactorBulk +=
-      bulkRatio*ViscoelasticMaxwell::viscousStrainParam(_dt, maxwellTimeBulk);
+      bulkRatio*_viscousStrainParams.viscousStrainParam(_dt, maxwellTimeBulk);
   } // for
   const PylithScalar tolerance = 1.0e-6;
   assert(elasFracShear >= -tolerance);
@@ -1046,7 +1046,9 @@ pylith::materials::GenMaxwellQpQsIsotropic3D::_computeStateVars(
   for (int iModel=0; iModel < numMaxwellModels; ++iModel) {
 
     const PylithScalar dq = 
-      ViscoelasticMaxwell::viscousStrainParam(_dt, properties[p_maxwellTimeShear+iModel]);
+      _viscousStrainParams.viscousStrainParam(_dt, properties[p_maxwellTimeShear+iModel]);
+    const PylithScalar expFac =
+      _viscousStrainParams.expFactor(_dt, properties[p_maxwellTimeShear+iModel]);
 
     for (int i=0; i < tensorSize; ++i) {
       const PylithScalar devStrainTpdt = totalStrain[i] - diag[i]*meanStrainTpdt;
@@ -1054,7 +1056,7 @@ pylith::materials::GenMaxwellQpQsIsotropic3D::_computeStateVars(
       const PylithScalar deltaStrain = devStrainTpdt - devStrainT;
       
       _viscousDevStrain[iModel*tensorSize+i] = 
-	exp(-_dt/properties[p_maxwellTimeShear+iModel]) * 
+	expFac * 
 	stateVars[s_viscousDevStrain+iModel*tensorSize+i] + 
 	properties[p_shearRatio+iModel] * dq * deltaStrain;
     } // for
@@ -1067,12 +1069,14 @@ pylith::materials::GenMaxwellQpQsIsotropic3D::_computeStateVars(
   for (int iModel=0; iModel < numMaxwellModels; ++iModel) {
 
     const PylithScalar dq = 
-      ViscoelasticMaxwell::viscousStrainParam(_dt, properties[p_maxwellTimeBulk+iModel]);
+      _viscousStrainParams.viscousStrainParam(_dt, properties[p_maxwellTimeBulk+iModel]);
+    const PylithScalar expFac =
+      _viscousStrainParams.expFactor(_dt, properties[p_maxwellTimeBulk+iModel]);
 
     const PylithScalar deltaStrain = meanStrainTpdt - meanStrainT;
 
     _viscousMeanStrain[iModel] =  
-      exp(-_dt/properties[p_maxwellTimeBulk+iModel]) * 
+      expFac * 
       stateVars[s_viscousMeanStrain+iModel] + 
       properties[p_bulkRatio+iModel] * dq * deltaStrain;
   } // for
@@ -30,6 +30,7 @@
 
 // Include directives ---------------------------------------------------
 #include "ElasticMaterial.hh" // ISA ElasticMaterial
+#include "ViscoelasticMaxwell.hh" // HASA ViscoelasticMaxwell::ParamCache
 
 // GenMaxwellQpQsIsotropic3D ------------------------------------------------
 /** @brief 3-D, isotropic, generalized linear Maxwell viscoelastic material.
@@ -492,6 +493,9 @@ private :
   /// Viscous mean strain [numMaxwellModels].
   scalar_array _viscousMeanStrain;
 
+  /// Cache of viscous strain parameters.
+  ViscoelasticMaxwell::ParamCache _viscousStrainParams;
+
   /// Method to use for _calcElasticConsts().
   calcElasticConsts_fn_type _calcElasticConstsFn;
 
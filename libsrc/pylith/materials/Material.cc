@@ -27,6 +27,7 @@
 #include "pylith/topology/Stratum.hh" // USES StratumIS
 #include "pylith/feassemble/Quadrature.hh" // USES Quadrature
 #include "pylith/utils/array.hh" // USES scalar_array, std::vector
+#include "pylith/utils/BatchQuery.hh" // USES BatchQuery
 
 #include "spatialdata/spatialdb/SpatialDB.hh" // USES SpatialDB
 #include "spatialdata/units/Nondimensional.hh" // USES Nondimensional
@@ -52,6 +53,10 @@ pylith::materials::Material::Material(const int dimension,
   _tensorSize(tensorSize),
   _needNewJacobian(false),
   _isJacobianSymmetric(true),
+  _singlePrecisionProperties(false),
+  _compressProperties(false),
+  _propertiesStoredCompact(false),
+  _propertiesLayout(PROPERTIES_QUADPTS),
   _dbProperties(0),
   _dbInitialState(0),
   _id(0),
@@ -87,6 +92,10 @@ pylith::materials::Material::deallocate(void)
   delete _materialIS; _materialIS = 0;
   delete _properties; _properties = 0;
   delete _stateVars; _stateVars = 0;
+  _propertiesSingle.clear();
+  _propertiesDouble.clear();
+  _propertiesStoredCompact = false;
+  _propertiesLayout = PROPERTIES_QUADPTS;
 
   _dbProperties = 0; // :TODO: Use shared pointer.
   _dbInitialState = 0; // :TODO: Use shared pointer.
@@ -201,6 +210,10 @@ pylith::materials::Material::initialize(const topology::Mesh& mesh,
   assert(_normalizer);
   const PylithScalar lengthScale = _normalizer->lengthScale();
 
+  // Gather coordinates of quadrature points in all cells, so we can
+  // query the databases in a batch with the points in spatial order.
+  utils::BatchQuery batch;
+  batch.resize(numCells*numQuadPts, spaceDim);
   for(PetscInt c = 0; c < numCells; ++c) {
     const PetscInt cell = cells[c];
 
@@ -212,30 +225,52 @@ pylith::materials::Material::initialize(const topology::Mesh& mesh,
     quadPtsGlobal = quadPtsNonDim;
     _normalizer->dimensionalize(&quadPtsGlobal[0], quadPtsGlobal.size(), lengthScale);
 
-    // Loop over quadrature points in cell and query database
-    for (int iQuadPt=0, index=0; iQuadPt < numQuadPts; ++iQuadPt, index+=spaceDim) {
-      int err = _dbProperties->query(&propertiesQuery[0], numDBProperties, &quadPtsGlobal[index], spaceDim, cs);
-      if (err) {
-	std::ostringstream msg;
-	msg << "Could not find parameters for physical properties at " << "(";
-	for (int i=0; i < spaceDim; ++i)
-	  msg << "  " << quadPtsGlobal[index+i];
-	msg << ") in material '" << _label << "' using spatial database '" << _dbProperties->label() << "'.";
-	throw std::runtime_error(msg.str());
-      } // if
+    for (int iQuadPt=0; iQuadPt < numQuadPts; ++iQuadPt)
+      batch.point(c*numQuadPts+iQuadPt, &quadPtsGlobal[iQuadPt*spaceDim]);
+  } // for
+
+  // Query databases
+  scalar_array propertiesQueryAll(numCells*numQuadPts*numDBProperties);
+  int errPoint = batch.query(numCells ? &propertiesQueryAll[0] : 0, numDBProperties, _dbProperties, cs);
+  if (errPoint >= 0) {
+    const double* xyz = batch.point(errPoint);
+    std::ostringstream msg;
+    msg << "Could not find parameters for physical properties at " << "(";
+    for (int i=0; i < spaceDim; ++i)
+      msg << "  " << xyz[i];
+    msg << ") in material '" << _label << "' using spatial database '" << _dbProperties->label() << "'.";
+    throw std::runtime_error(msg.str());
+  } // if
+
+  scalar_array stateVarsQueryAll;
+  if (_dbInitialState) {
+    stateVarsQueryAll.resize(numCells*numQuadPts*numDBStateVars);
+    errPoint = batch.query(numCells ? &stateVarsQueryAll[0] : 0, numDBStateVars, _dbInitialState, cs);
+    if (errPoint >= 0) {
+      const double* xyz = batch.point(errPoint);
+      std::ostringstream msg;
+      msg << "Could not find initial state variables at \n" << "(";
+      for (int i=0; i < spaceDim; ++i)
+	msg << "  " << xyz[i];
+      msg << ") in material '" << _label << "' using spatial database '" << _dbInitialState->label() << "'.";
+      throw std::runtime_error(msg.str());
+    } // if
+  } // if
+
+  for(PetscInt c = 0; c < numCells; ++c) {
+    const PetscInt cell = cells[c];
+
+    // Convert values from databases at quadrature points in cell
+    for (int iQuadPt=0; iQuadPt < numQuadPts; ++iQuadPt) {
+      const int iPoint = c*numQuadPts + iQuadPt;
+      for (int i=0; i < numDBProperties; ++i)
+	propertiesQuery[i] = propertiesQueryAll[iPoint*numDBProperties+i];
       _dbToProperties(&propertiesCell[iQuadPt*_numPropsQuadPt], propertiesQuery);
       _nondimProperties(&propertiesCell[iQuadPt*_numPropsQuadPt], _numPropsQuadPt);
 
       if (_dbInitialState) {
-	err = _dbInitialState->query(&stateVarsQuery[0], numDBStateVars, &quadPtsGlobal[index], spaceDim, cs);
-	if (err) {
-	  std::ostringstream msg;
-	  msg << "Could not find initial state variables at \n" << "(";
-	  for (int i=0; i < spaceDim; ++i)
-	    msg << "  " << quadPtsGlobal[index+i];
-	  msg << ") in material '" << _label << "' using spatial database '" << _dbInitialState->label() << "'.";
-	  throw std::runtime_error(msg.str());
-	} // if
+	for (int i=0; i < numDBStateVars; ++i)
+	  stateVarsQuery[i] = stateVarsQueryAll[iPoint*numDBStateVars+i];
 	_dbToStateVars(&stateVarsCell[iQuadPt*_numVarsQuadPt], stateVarsQuery);
 	_nondimStateVars(&stateVarsCell[iQuadPt*_numVarsQuadPt], _numVarsQuadPt);
       } // if
@@ -259,6 +294,19 @@ pylith::materials::Material::initialize(const topology::Mesh& mesh,
   } // for
   delete stateVarsVisitor; stateVarsVisitor = 0;
 
+  // Store properties in compact form if requested.
+  _propertiesSingle.clear();
+  _propertiesDouble.clear();
+  _propertiesStoredCompact = false;
+  _propertiesLayout = PROPERTIES_QUADPTS;
+  if (_compressProperties) {
+    _propertiesLayout = _findPropertiesLayout(propertiesArray, numCells*propsFiberDim, propsFiberDim);
+  } // if
+  propertiesVisitor.clear();
+  if (_singlePrecisionProperties || PROPERTIES_QUADPTS != _propertiesLayout) {
+    _storePropertiesCompact(propsFiberDim);
+  } // if
+
   // Close databases
   _dbProperties->close();
   if (_dbInitialState)
@@ -275,6 +323,20 @@ pylith::materials::Material::propertiesField() const
   return _properties;
 } // propertiesField
 
+// ----------------------------------------------------------------------
+// Get number of values stored for physical properties.
+int
+pylith::materials::Material::propertiesStorageSize(void) const
+{ // propertiesStorageSize
+  PYLITH_METHOD_BEGIN;
+
+  if (_propertiesStoredCompact) {
+    PYLITH_METHOD_RETURN(_propertiesSingle.size() + _propertiesDouble.size());
+  } // if
+
+  PYLITH_METHOD_RETURN(_properties ? _properties->sectionSize() : 0);
+} // propertiesStorageSize
+
 // ----------------------------------------------------------------------
 // Get the state variables field.
 const pylith::topology::Field*
@@ -347,14 +409,23 @@ pylith::materials::Material::getField(topology::Field *field,
     for (int i=0; i < propertyIndex; ++i)
       propOffset += _metadata.getProperty(i).fiberDim;
     const int fiberDim = _metadata.getProperty(propertyIndex).fiberDim;
-    topology::VecVisitorMesh propertiesVisitor(*_properties);
-    PetscScalar* propertiesArray = propertiesVisitor.localArray();
+
+    // Properties are either in the properties field or in compact
+    // storage.
+    PetscSection propertiesSection = _properties->localSection();assert(propertiesSection);
+    topology::VecVisitorMesh* propertiesVisitor = 0;
+    const PetscScalar* propertiesArray = NULL;
+    if (!_propertiesStoredCompact) {
+      propertiesVisitor = new topology::VecVisitorMesh(*_properties);assert(propertiesVisitor);
+      propertiesArray = propertiesVisitor->localArray();
+    } // if
+    PetscErrorCode err = 0;
 
     // Get properties section
     PetscInt totalPropsFiberDimLocal = 0;
     PetscInt totalPropsFiberDim = 0;
     if (numCells > 0) {
-      totalPropsFiberDimLocal = propertiesVisitor.sectionDof(cells[0]);
+      err = PetscSectionGetDof(propertiesSection, cells[0], &totalPropsFiberDimLocal);PYLITH_CHECK_ERROR(err);
     } // if
     MPI_Allreduce((void *) &totalPropsFiberDimLocal, (void *) &totalPropsFiberDim, 1, MPIU_INT, MPI_MAX, field->mesh().comm());
     assert(totalPropsFiberDim > 0);
@@ -371,7 +442,7 @@ pylith::materials::Material::getField(topology::Field *field,
       PetscInt totalFiberDimCurrent = 0;
       if (numCells > 0) {
 	PetscSection fieldSection = field->localSection();
-	PetscErrorCode err = PetscSectionGetDof(fieldSection, cells[0], &totalFiberDimCurrentLocal);PYLITH_CHECK_ERROR(err);
+	err = PetscSectionGetDof(fieldSection, cells[0], &totalFiberDimCurrentLocal);PYLITH_CHECK_ERROR(err);
       } // if
       MPI_Allreduce((void *) &totalFiberDimCurrentLocal, (void *) &totalFiberDimCurrent, 1, MPIU_INT, MPI_MAX, field->mesh().comm());
       assert(totalFiberDimCurrent > 0);
@@ -389,21 +460,32 @@ pylith::materials::Material::getField(topology::Field *field,
 
     // Buffer for property at cell's quadrature points
     scalar_array propertiesCell(numPropsQuadPt);
+    scalar_array propertiesCompactCell(propertiesArray ? 0 : totalPropsFiberDim);
 
     // Loop over cells
     for(PetscInt c = 0; c < numCells; ++c) {
       const PetscInt cell = cells[c];
 
-      const PetscInt poff = propertiesVisitor.sectionOffset(cell);
+      PetscInt poff = 0;
+      err = PetscSectionGetOffset(propertiesSection, cell, &poff);PYLITH_CHECK_ERROR(err);
       const PetscInt foff = fieldVisitor.sectionOffset(cell);
+      if (!propertiesArray) {
+	_getPropertiesCell(&propertiesCompactCell[0], totalPropsFiberDim, poff);
+      } // if
       for (int iQuad=0; iQuad < numQuadPts; ++iQuad) {
-        for (int i=0; i < numPropsQuadPt; ++i)
-          propertiesCell[i] = propertiesArray[iQuad*numPropsQuadPt + poff+i];
+	if (propertiesArray) {
+	  for (int i=0; i < numPropsQuadPt; ++i)
+	    propertiesCell[i] = propertiesArray[iQuad*numPropsQuadPt + poff+i];
+	} else {
+	  for (int i=0; i < numPropsQuadPt; ++i)
+	    propertiesCell[i] = propertiesCompactCell[iQuad*numPropsQuadPt + i];
+	} // if/else
         _dimProperties(&propertiesCell[0], numPropsQuadPt);
         for (int i=0; i < fiberDim; ++i)
           fieldArray[iQuad*fiberDim + foff+i] = propertiesCell[propOffset+i];
       } // for
     } // for
+    delete propertiesVisitor; propertiesVisitor = 0;
   } else { // field is a state variable
     assert(stateVarIndex >= 0);
     
@@ -535,5 +617,103 @@ pylith::materials::Material::_findField(int* propertyIndex,
   PYLITH_METHOD_END;
 } // _findField
   
+// ----------------------------------------------------------------------
+// Determine the most compact layout for the physical properties.
+pylith::materials::Material::PropertiesLayoutEnum
+pylith::materials::Material::_findPropertiesLayout(const PylithScalar* propertiesArray,
+						   const PetscInt size,
+						   const int fiberDim) const
+{ // _findPropertiesLayout
+  PYLITH_METHOD_BEGIN;
+
+  assert(propertiesArray || 0 == size);
+  assert(fiberDim > 0);
+  assert(0 == size % fiberDim);
+
+  // Compare values exactly, so the compact form reproduces the values
+  // at every quadrature point.
+  const int numPropsQuadPt = _numPropsQuadPt;
+  bool isUniform = true;
+  for (PetscInt off=0; off < size; off += fiberDim) {
+    for (int iOff=0; iOff < fiberDim; iOff += numPropsQuadPt) {
+      for (int i=0; i < numPropsQuadPt; ++i) {
+	if (propertiesArray[off+iOff+i] != propertiesArray[off+i]) {
+	  PYLITH_METHOD_RETURN(PROPERTIES_QUADPTS);
+	} // if
+	if (propertiesArray[off+iOff+i] != propertiesArray[i]) {
+	  isUniform = false;
+	} // if
+      } // for
+    } // for
+  } // for
+
+  PYLITH_METHOD_RETURN(isUniform ? PROPERTIES_UNIFORM : PROPERTIES_CELLS);
+} // _findPropertiesLayout
+
+// ----------------------------------------------------------------------
+// Copy physical properties to compact storage.
+void
+pylith::materials::Material::_storePropertiesCompact(const int fiberDim)
+{ // _storePropertiesCompact
+  PYLITH_METHOD_BEGIN;
+
+  assert(_properties);
+  assert(fiberDim > 0);
+
+  PetscVec propertiesVec = _properties->localVector();assert(propertiesVec);
+  PetscInt size = 0;
+  const PetscScalar* propertiesArray = NULL;
+  PetscErrorCode err = 0;
+  err = VecGetLocalSize(propertiesVec, &size);PYLITH_CHECK_ERROR(err);
+  err = VecGetArrayRead(propertiesVec, &propertiesArray);PYLITH_CHECK_ERROR(err);
+
+  // Number of values per cell and stride between cells in storage.
+  const int numPropsQuadPt = _numPropsQuadPt;
+  PetscInt numCompact = 0;
+  int numCellValues = 0;
+  switch (_propertiesLayout) {
+  case PROPERTIES_QUADPTS:
+    numCompact = size;
+    numCellValues = fiberDim;
+    break;
+  case PROPERTIES_CELLS:
+    numCompact = (size / fiberDim) * numPropsQuadPt;
+    numCellValues = numPropsQuadPt;
+    break;
+  case PROPERTIES_UNIFORM:
+    numCompact = (size > 0) ? numPropsQuadPt : 0;
+    numCellValues = numPropsQuadPt;
+    break;
+  default:
+    assert(0);
+    throw std::logic_error("Unknown layout for physical properties.");
+  } // switch
+
+  _propertiesSingle.clear();
+  _propertiesDouble.clear();
+  if (_singlePrecisionProperties) {
+    _propertiesSingle.resize(numCompact);
+  } else {
+    _propertiesDouble.resize(numCompact);
+  } // if/else
+  for (PetscInt iCompact=0, off=0; iCompact < numCompact; iCompact += numCellValues, off += fiberDim) {
+    for (int i=0; i < numCellValues; ++i) {
+      if (_singlePrecisionProperties) {
+	_propertiesSingle[iCompact+i] = float(propertiesArray[off+i]);
+      } else {
+	_propertiesDouble[iCompact+i] = propertiesArray[off+i];
+      } // if/else
+    } // for
+  } // for
+  err = VecRestoreArrayRead(propertiesVec, &propertiesArray);PYLITH_CHECK_ERROR(err);
+
+  // Free the values in the field; the section remains with the
+  // field's DM.
+  _properties->clear();
+  _propertiesStoredCompact = true;
+
+  PYLITH_METHOD_END;
+} // _storePropertiesCompact
+  
 
 // End of file 
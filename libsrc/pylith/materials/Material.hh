@@ -35,6 +35,7 @@
 #include "Metadata.hh" // HASA Metadata
 
 #include <string> // HASA std::string
+#include <vector> // HASA std::vector
 
 // Material -------------------------------------------------------------
 /** @brief C++ abstract base class for Material object.
@@ -48,6 +49,16 @@ class pylith::materials::Material
 { // class Material
   friend class TestMaterial; // unit testing
 
+  // PUBLIC ENUMS ///////////////////////////////////////////////////////
+public :
+
+  /// Layout of stored physical properties.
+  enum PropertiesLayoutEnum {
+    PROPERTIES_QUADPTS=0, ///< Values at every quadrature point of every cell.
+    PROPERTIES_CELLS=1, ///< Values once per cell.
+    PROPERTIES_UNIFORM=2, ///< Values once for the material.
+  }; // PropertiesLayoutEnum
+
   // PUBLIC METHODS /////////////////////////////////////////////////////
 public :
 
@@ -173,6 +184,49 @@ public :
   virtual
   void useElasticBehavior(const bool flag);
 
+  /** Set flag for storing physical properties in single precision.
+   *
+   * The values are converted to double precision when they are
+   * retrieved for a cell.
+   *
+   * @pre Must be called before initialize().
+   *
+   * @param flag True to store properties in single precision.
+   */
+  void singlePrecisionProperties(const bool flag);
+
+  /** Get flag for storing physical properties in single precision.
+   *
+   * @returns True if properties are stored in single precision.
+   */
+  bool singlePrecisionProperties(void) const;
+
+  /** Set flag for storing physical properties in compressed form.
+   *
+   * If the properties are the same at all quadrature points in each
+   * cell, they are stored once per cell. If they are the same in all
+   * cells, they are stored once for the material. The values are
+   * expanded to all quadrature points when they are retrieved for a
+   * cell.
+   *
+   * @pre Must be called before initialize().
+   *
+   * @param flag True to compress properties, false otherwise.
+   */
+  void compressProperties(const bool flag);
+
+  /** Get layout of stored physical properties.
+   *
+   * @returns Layout of properties.
+   */
+  PropertiesLayoutEnum propertiesLayout(void) const;
+
+  /** Get number of values stored for physical properties.
+   *
+   * @returns Number of values stored on this process.
+   */
+  int propertiesStorageSize(void) const;
+
   /** Check whether material has a field as a property.
    *
    * @param name Name of field.
@@ -269,6 +323,19 @@ protected :
   void _dimStateVars(PylithScalar* const values,
 			const int nvalues) const;
 
+  /** Get physical properties at the quadrature points of a cell from
+   * compact storage.
+   *
+   * @pre Properties must be stored outside the properties field.
+   *
+   * @param values Array of values at quadrature points (output).
+   * @param numValues Number of values (numQuadPts * numPropsQuadPt).
+   * @param offset Offset of cell in section of properties field.
+   */
+  void _getPropertiesCell(PylithScalar* values,
+			  const int numValues,
+			  const PetscInt offset) const;
+
   // PROTECTED MEMBERS //////////////////////////////////////////////////
 protected :
 
@@ -280,6 +347,14 @@ protected :
   /// Field containing the state variables for the material.
   topology::Field *_stateVars;
 
+  /** Physical properties stored outside the properties field in
+   * single or double precision (empty if properties are stored in the
+   * properties field). The values follow the order of the section of
+   * the properties field with the layout _propertiesLayout.
+   */
+  std::vector<float> _propertiesSingle;
+  std::vector<PylithScalar> _propertiesDouble;
+
   spatialdata::units::Nondimensional* _normalizer; ///< Nondimensionalizer
   
   topology::StratumIS* _materialIS; ///< Index set for material cells.
@@ -290,6 +365,10 @@ protected :
   const int _tensorSize; ///< Tensor size for material.
   bool _needNewJacobian; ///< True if need to reform Jacobian, false otherwise.
   bool _isJacobianSymmetric; ///< True if Jacobian is symmetric;
+  bool _singlePrecisionProperties; ///< True if properties are stored in single precision.
+  bool _compressProperties; ///< True if properties are stored in compressed form when possible.
+  bool _propertiesStoredCompact; ///< True if properties are stored outside the properties field.
+  PropertiesLayoutEnum _propertiesLayout; ///< Layout of stored properties.
 
   // PRIVATE METHODS ////////////////////////////////////////////////////
 private :
@@ -306,6 +385,26 @@ private :
 		  int* stateVarIndex,
 		  const char* name) const;
 
+  /** Determine the most compact layout for the physical properties.
+   *
+   * @param propertiesArray Array of values for properties field.
+   * @param size Size of array.
+   * @param fiberDim Number of values per cell.
+   *
+   * @returns Layout of properties.
+   */
+  PropertiesLayoutEnum _findPropertiesLayout(const PylithScalar* propertiesArray,
+					     const PetscInt size,
+					     const int fiberDim) const;
+
+  /** Copy physical properties to compact storage using the current
+   * layout and free the values in the properties field. The section
+   * of the properties field is retained to provide the offsets.
+   *
+   * @param fiberDim Number of values per cell.
+   */
+  void _storePropertiesCompact(const int fiberDim);
+
   // PRIVATE MEMBERS ////////////////////////////////////////////////////
 private :
 
@@ -572,7 +572,7 @@ pylith::materials::MaxwellIsotropic3D::_calcElasticConstsViscoelastic(
   const PylithScalar mu2 = 2.0 * mu;
   const PylithScalar bulkModulus = lambda + mu2 / 3.0;
 
-  PylithScalar dq = ViscoelasticMaxwell::viscousStrainParam(_dt, maxwellTime);
+  PylithScalar dq = _viscousStrainParams.viscousStrainParam(_dt, maxwellTime);
 
   const PylithScalar visFac = mu * dq / 3.0;
 
@@ -799,8 +799,8 @@ pylith::materials::MaxwellIsotropic3D::_computeStateVars(
       stateVars[s_totalStrain+2] ) / 3.0;
   
   // Time integration.
-  PylithScalar dq = ViscoelasticMaxwell::viscousStrainParam(_dt, maxwellTime);
-  const PylithScalar expFac = exp(-_dt/maxwellTime);
+  PylithScalar dq = _viscousStrainParams.viscousStrainParam(_dt, maxwellTime);
+  const PylithScalar expFac = _viscousStrainParams.expFactor(_dt, maxwellTime);
 
   PylithScalar devStrainTpdt = 0.0;
   PylithScalar devStrainT = 0.0;
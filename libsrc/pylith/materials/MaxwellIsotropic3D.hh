@@ -26,6 +26,7 @@
 
 // Include directives ---------------------------------------------------
 #include "ElasticMaterial.hh" // ISA ElasticMaterial
+#include "ViscoelasticMaxwell.hh" // HASA ViscoelasticMaxwell::ParamCache
 
 // MaxwellIsotropic3D ---------------------------------------------------
 /** @brief 3-D, isotropic, linear Maxwell viscoelastic material.
@@ -480,6 +481,9 @@ private :
 
   scalar_array _viscousStrain; ///< Array for viscous strain tensor
 
+  /// Cache of viscous strain parameters.
+  ViscoelasticMaxwell::ParamCache _viscousStrainParams;
+
   /// Method to use for _calcElasticConsts().
   calcElasticConsts_fn_type _calcElasticConstsFn;
 
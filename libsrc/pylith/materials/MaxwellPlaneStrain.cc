@@ -568,7 +568,7 @@ pylith::materials::MaxwellPlaneStrain::_calcElasticConstsViscoelastic(
   const PylithScalar mu2 = 2.0 * mu;
   const PylithScalar bulkModulus = lambda + mu2 / 3.0;
 
-  PylithScalar dq = ViscoelasticMaxwell::viscousStrainParam(_dt, maxwellTime);
+  PylithScalar dq = _viscousStrainParams.viscousStrainParam(_dt, maxwellTime);
 
   const PylithScalar visFac = mu * dq / 3.0;
   elasticConsts[ 0] = bulkModulus + 4.0 * visFac; // C1111
@@ -769,8 +769,8 @@ pylith::materials::MaxwellPlaneStrain::_computeStateVars(
   const PylithScalar diag[] = { 1.0, 1.0, 1.0, 0.0 };
 
   // Time integration.
-  PylithScalar dq = ViscoelasticMaxwell::viscousStrainParam(_dt, maxwellTime);
-  const PylithScalar expFac = exp(-_dt/maxwellTime);
+  PylithScalar dq = _viscousStrainParams.viscousStrainParam(_dt, maxwellTime);
+  const PylithScalar expFac = _viscousStrainParams.expFactor(_dt, maxwellTime);
 
   PylithScalar devStrainTpdt = 0.0;
   PylithScalar devStrainT = 0.0;
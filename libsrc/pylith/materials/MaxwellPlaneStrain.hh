@@ -27,6 +27,7 @@
 
 // Include directives ---------------------------------------------------
 #include "ElasticMaterial.hh" // ISA ElasticMaterial
+#include "ViscoelasticMaxwell.hh" // HASA ViscoelasticMaxwell::ParamCache
 
 // MaxwellPlaneStrain ---------------------------------------------------
 /** @brief 2-D, isotropic, linear Maxwell viscoelastic material for
@@ -494,6 +495,9 @@ private :
 
   scalar_array _viscousStrain; ///< Array for viscous strain tensor
 
+  /// Cache of viscous strain parameters.
+  ViscoelasticMaxwell::ParamCache _viscousStrainParams;
+
   /// Method to use for _calcElasticConsts().
   calcElasticConsts_fn_type _calcElasticConstsFn;
 
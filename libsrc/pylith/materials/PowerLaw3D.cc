@@ -21,7 +21,6 @@
 #include "PowerLaw3D.hh" // implementation of object methods
 
 #include "Metadata.hh" // USES Metadata
-#include "EffectiveStress.hh" // USES EffectiveStress
 
 #include "pylith/utils/array.hh" // USES scalar_array
 #include "pylith/utils/constdefs.h" // USES PYLITH_MAXSCALAR
@@ -673,8 +672,7 @@ pylith::materials::PowerLaw3D::_calcStressViscoelastic(
       const PylithScalar effStressInitialGuess = effStressT;
 
       effStressTpdt =
-	EffectiveStress::calculate<PowerLaw3D>(effStressInitialGuess,
-					       stressScale, this);
+	_calcEffStress(effStressInitialGuess, stressScale);
     } // if
 
     // Compute stresses from effective stress.
@@ -813,6 +811,19 @@ pylith::materials::PowerLaw3D::effStressFuncDerivFunc(PylithScalar* func,
   PetscLogFlops(46);
 } // effStressFuncDFunc
 
+// ----------------------------------------------------------------------
+// Compute effective stress at current quadrature point.
+PylithScalar
+pylith::materials::PowerLaw3D::_calcEffStress(
+				const PylithScalar effStressInitialGuess,
+				const PylithScalar stressScale)
+{ // _calcEffStress
+  return _effStressCache.calculate<PowerLaw3D>(_quadPtIndex,
+						_effStressParams,
+						effStressInitialGuess,
+						stressScale, this);
+} // _calcEffStress
+
 // ----------------------------------------------------------------------
 // Compute derivative of elasticity matrix at location from properties.
 void
@@ -1053,8 +1064,7 @@ pylith::materials::PowerLaw3D::_calcElasticConstsViscoelastic(
     const PylithScalar effStressInitialGuess = effStressT;
     
     const PylithScalar effStressTpdt =
-      EffectiveStress::calculate<PowerLaw3D>(effStressInitialGuess,
-					     stressScale, this);
+      _calcEffStress(effStressInitialGuess, stressScale);
   
     // Compute quantities at intermediate time tau used to compute values at
     // end of time step.
@@ -1342,8 +1352,7 @@ pylith::materials::PowerLaw3D::_updateStateVarsViscoelastic(
     const PylithScalar effStressInitialGuess = effStressT;
 
     effStressTpdt =
-      EffectiveStress::calculate<PowerLaw3D>(effStressInitialGuess,
-					     stressScale, this);
+      _calcEffStress(effStressInitialGuess, stressScale);
 
   } // if
 
@@ -27,6 +27,8 @@
 // Include directives ---------------------------------------------------
 #include "ElasticMaterial.hh" // ISA ElasticMaterial
 
+#include "EffectiveStressCache.hh" // HASA EffectiveStressCache
+
 // Powerlaw3D -----------------------------------------------------------
 /** @brief 3-D, isotropic, power-law viscoelastic material. 
  *
@@ -485,6 +487,16 @@ private :
 				    const PylithScalar* initialStrain,
 				    const int initialStrainSize);
 
+  /** Compute effective stress at current quadrature point using the
+   * parameters in _effStressParams.
+   *
+   * @param effStressInitialGuess Effective stress at beginning of time step.
+   * @param stressScale Scale used when initial guess is zero.
+   *
+   * @returns Effective stress at end of time step.
+   */
+  PylithScalar _calcEffStress(const PylithScalar effStressInitialGuess,
+			      const PylithScalar stressScale);
 
   // PRIVATE STRUCTS ////////////////////////////////////////////////////
 private :
@@ -508,6 +520,9 @@ private :
   /// Structure to hold parameters for effective stress computation.
   EffStressStruct _effStressParams;
 
+  /// Converged effective stress at quadrature points.
+  EffectiveStressCache<EffStressStruct> _effStressCache;
+
   /// Method to use for _calcElasticConsts().
   calcElasticConsts_fn_type _calcElasticConstsFn;
 
@@ -21,7 +21,6 @@
 #include "PowerLawPlaneStrain.hh" // implementation of object methods
 
 #include "Metadata.hh" // USES Metadata
-#include "EffectiveStress.hh" // USES EffectiveStress
 
 #include "pylith/utils/array.hh" // USES scalar_array
 #include "pylith/utils/constdefs.h" // USES PYLITH_MAXSCALAR
@@ -655,8 +654,7 @@ pylith::materials::PowerLawPlaneStrain::_calcStressViscoelastic(
       const PylithScalar effStressInitialGuess = effStressT;
 
       effStressTpdt =
-	EffectiveStress::calculate<PowerLawPlaneStrain>(effStressInitialGuess,
-					       stressScale, this);
+	_calcEffStress(effStressInitialGuess, stressScale);
     } // if
 
     // Compute stresses from effective stress.
@@ -801,6 +799,19 @@ pylith::materials::PowerLawPlaneStrain::effStressFuncDerivFunc( PylithScalar* fu
   PetscLogFlops(46);
 } // effStressFuncDFunc
 
+// ----------------------------------------------------------------------
+// Compute effective stress at current quadrature point.
+PylithScalar
+pylith::materials::PowerLawPlaneStrain::_calcEffStress(
+				const PylithScalar effStressInitialGuess,
+				const PylithScalar stressScale)
+{ // _calcEffStress
+  return _effStressCache.calculate<PowerLawPlaneStrain>(_quadPtIndex,
+						_effStressParams,
+						effStressInitialGuess,
+						stressScale, this);
+} // _calcEffStress
+
 // ----------------------------------------------------------------------
 // Compute derivative of elasticity matrix at location from properties.
 void
@@ -1004,8 +1015,7 @@ pylith::materials::PowerLawPlaneStrain::_calcElasticConstsViscoelastic(
     const PylithScalar effStressInitialGuess = effStressT;
     
     const PylithScalar effStressTpdt =
-      EffectiveStress::calculate<PowerLawPlaneStrain>(effStressInitialGuess,
-					     stressScale, this);
+      _calcEffStress(effStressInitialGuess, stressScale);
   
     // Compute quantities at intermediate time tau used to compute values at
     // end of time step.
@@ -1249,8 +1259,7 @@ pylith::materials::PowerLawPlaneStrain::_updateStateVarsViscoelastic(
     const PylithScalar effStressInitialGuess = effStressT;
 
     effStressTpdt =
-      EffectiveStress::calculate<PowerLawPlaneStrain>(effStressInitialGuess,
-					     stressScale, this);
+      _calcEffStress(effStressInitialGuess, stressScale);
 
   } // if
 
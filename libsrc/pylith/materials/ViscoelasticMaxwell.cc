@@ -74,5 +74,27 @@ pylith::materials::ViscoelasticMaxwell::viscousStrainParam(const PylithScalar dt
   return dq;
 } // viscousStrainParam
   
+// ----------------------------------------------------------------------
+// Constructor.
+pylith::materials::ViscoelasticMaxwell::ParamCache::ParamCache(void)
+{ // constructor
+  clear();
+} // constructor
+
+// ----------------------------------------------------------------------
+// Remove all entries.
+void
+pylith::materials::ViscoelasticMaxwell::ParamCache::clear(void)
+{ // clear
+  // Maxwell times must be positive, so an entry with a negative
+  // Maxwell time never matches.
+  for (int i=0; i < _size; ++i) {
+    _dt[i] = 0.0;
+    _maxwellTime[i] = -1.0;
+    _dq[i] = 0.0;
+    _expFac[i] = 0.0;
+  } // for
+} // clear
+
 
 // End of file 
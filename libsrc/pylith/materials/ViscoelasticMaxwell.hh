@@ -51,8 +51,80 @@ public :
   static PylithScalar viscousStrainParam(const PylithScalar dt,
 				   const PylithScalar maxwellTime);
 
+  // PUBLIC CLASSES /////////////////////////////////////////////////////
+public :
+
+  /** @brief Cache of viscous strain parameters and decay factors.
+   *
+   * The time step is usually uniform and Maxwell times are usually
+   * piecewise constant in space, so most quadrature points use the
+   * same few parameters. The cache is direct mapped on the Maxwell
+   * time, and entries are keyed on both the time step and Maxwell
+   * time, so a change in time step invalidates them.
+   */
+  class ParamCache
+  { // class ParamCache
+  public :
+
+    /// Constructor.
+    ParamCache(void);
+
+    /// Remove all entries.
+    void clear(void);
+
+    /** Get viscous strain parameter, computing it if not in cache.
+     *
+     * @param dt Time step.
+     * @param maxwellTime Maxwell time.
+     *
+     * @returns Viscous strain parameter.
+     */
+    PylithScalar viscousStrainParam(const PylithScalar dt,
+				    const PylithScalar maxwellTime);
+
+    /** Get factor exp(-dt/maxwellTime) for decay of viscous strain
+     * over time step, computing it if not in cache.
+     *
+     * @param dt Time step.
+     * @param maxwellTime Maxwell time.
+     *
+     * @returns Decay factor.
+     */
+    PylithScalar expFactor(const PylithScalar dt,
+			   const PylithScalar maxwellTime);
+
+  private :
+
+    /** Get index of entry for time step and Maxwell time, computing
+     * values of entry if not in cache.
+     *
+     * @param dt Time step.
+     * @param maxwellTime Maxwell time.
+     * @returns Index of entry.
+     */
+    int _entry(const PylithScalar dt,
+	       const PylithScalar maxwellTime);
+
+    /** Get index of entry for Maxwell time.
+     *
+     * @param maxwellTime Maxwell time.
+     * @returns Index of entry.
+     */
+    static
+    int _index(const PylithScalar maxwellTime);
+
+    static const int _size = 64; ///< Number of entries (power of 2).
+
+    PylithScalar _dt[_size]; ///< Time step for entries.
+    PylithScalar _maxwellTime[_size]; ///< Maxwell time for entries.
+    PylithScalar _dq[_size]; ///< Viscous strain parameter for entries.
+    PylithScalar _expFac[_size]; ///< Decay factor for entries.
+  }; // class ParamCache
+
 }; // class ViscoelasticMaxwell
 
+#include "ViscoelasticMaxwell.icc" // inline methods
+
 #endif // pylith_materials_viscoelasticmaxwell_hh
 
 
@@ -52,6 +52,7 @@ namespace pylith {
     class DruckerPragerPlaneStrain;
 
     class EffectiveStress;
+    template<typename params_type> class EffectiveStressCache;
     class ViscoelasticMaxwell;
 
   } // materials
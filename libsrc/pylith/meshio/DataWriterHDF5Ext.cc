@@ -39,12 +39,18 @@ extern PetscErrorCode VecView_Seq(Vec, PetscViewer);
 extern PetscErrorCode VecView_MPI(Vec, PetscViewer);
 }
 
+// ----------------------------------------------------------------------
+pylith::meshio::DataWriterHDF5Ext::shared_type pylith::meshio::DataWriterHDF5Ext::_sharedDatasets;
+
 // ----------------------------------------------------------------------
 // Constructor
 pylith::meshio::DataWriterHDF5Ext::DataWriterHDF5Ext(void) :
     _filename("output.h5"),
     _h5(new HDF5),
-    _tstampIndex(0)
+    _tstampIndex(0),
+    _numVertices(0),
+    _numCells(0),
+    _shareTopology(false)
 { // constructor
 } // constructor
 
@@ -73,6 +79,14 @@ pylith::meshio::DataWriterHDF5Ext::deallocate(void)
         err = PetscViewerDestroy(&d_iter->second.viewer); PYLITH_CHECK_ERROR(err);
     } // for
 
+    // Stop sharing datasets written by this writer so that the map
+    // does not grow without bound and never refers to stale files.
+    const size_t numSharedKeys = _sharedKeys.size();
+    for (size_t i=0; i < numSharedKeys; ++i) {
+        _sharedDatasets.erase(_sharedKeys[i]);
+    } // for
+    _sharedKeys.clear();
+
     PYLITH_METHOD_END;
 } // deallocate
 
@@ -82,7 +96,10 @@ pylith::meshio::DataWriterHDF5Ext::DataWriterHDF5Ext(const DataWriterHDF5Ext& w)
     DataWriter(w),
     _filename(w._filename),
     _h5(new HDF5),
-    _tstampIndex(0)
+    _tstampIndex(0),
+    _numVertices(0),
+    _numCells(0),
+    _shareTopology(w._shareTopology)
 { // copy constructor
 } // copy constructor
 
@@ -122,56 +139,75 @@ pylith::meshio::DataWriterHDF5Ext::open(const topology::Mesh& mesh,
 
         const hid_t scalartype = (sizeof(double) == sizeof(PylithScalar)) ? H5T_IEEE_F64BE : H5T_IEEE_F32BE;
 
+        _verticesKey = _sharedKey(dmMesh, "vertices", 0, 0);
+        _cellsKey = _sharedKey(dmMesh, "cells", label, labelId);
+
         // Write vertex coordinates
         const spatialdata::geocoords::CoordSys* cs = mesh.coordsys(); assert(cs);
 
-        /* TODO Get rid of this and use the createScatterWithBC(numbering) code */
-        PetscDM dmCoord = NULL;
-        PetscVec coordinates = NULL;
-        PetscReal lengthScale;
-        topology::FieldBase::Metadata metadata;
-
-        metadata.label = "vertices";
-        metadata.vectorFieldType = topology::FieldBase::VECTOR;
-        err = DMPlexGetScale(dmMesh, PETSC_UNIT_LENGTH, &lengthScale); PYLITH_CHECK_ERROR(err);
-        err = DMGetCoordinateDM(dmMesh, &dmCoord); PYLITH_CHECK_ERROR(err); assert(dmCoord);
-        err = PetscObjectReference((PetscObject) dmCoord); PYLITH_CHECK_ERROR(err);
-        err = DMGetCoordinatesLocal(dmMesh, &coordinates); PYLITH_CHECK_ERROR(err);
-        topology::Field coordinatesField(mesh, dmCoord, coordinates, metadata);
-        coordinatesField.createScatterWithBC(mesh, "", 0, metadata.label.c_str());
-        coordinatesField.scatterLocalToGlobal(metadata.label.c_str());
-        PetscVec coordVector = coordinatesField.vector(metadata.label.c_str()); assert(coordVector);
-        err = VecScale(coordVector, lengthScale); PYLITH_CHECK_ERROR(err);
-
-        const std::string& filenameVertices = _datasetFilename("vertices");
-        err = PetscViewerBinaryOpen(comm, filenameVertices.c_str(), FILE_MODE_WRITE, &binaryViewer); PYLITH_CHECK_ERROR(err);
-        err = PetscViewerBinarySetSkipHeader(binaryViewer, PETSC_TRUE); PYLITH_CHECK_ERROR(err);
+        std::string filenameVertices = _datasetFilename("vertices");
+        PetscInt numVertices = 0;
+        const shared_type::const_iterator sharedVertices = _shareTopology ? _sharedDatasets.find(_verticesKey) : _sharedDatasets.end();
+        if (sharedVertices != _sharedDatasets.end()) {
+            // Reuse vertices written by another writer for this mesh.
+            filenameVertices = sharedVertices->second.filename;
+            numVertices = sharedVertices->second.numPoints;
+        } else {
+            /* TODO Get rid of this and use the createScatterWithBC(numbering) code */
+            PetscDM dmCoord = NULL;
+            PetscVec coordinates = NULL;
+            PetscReal lengthScale;
+            topology::FieldBase::Metadata metadata;
+
+            metadata.label = "vertices";
+            metadata.vectorFieldType = topology::FieldBase::VECTOR;
+            err = DMPlexGetScale(dmMesh, PETSC_UNIT_LENGTH, &lengthScale); PYLITH_CHECK_ERROR(err);
+            err = DMGetCoordinateDM(dmMesh, &dmCoord); PYLITH_CHECK_ERROR(err); assert(dmCoord);
+            err = PetscObjectReference((PetscObject) dmCoord); PYLITH_CHECK_ERROR(err);
+            err = DMGetCoordinatesLocal(dmMesh, &coordinates); PYLITH_CHECK_ERROR(err);
+            topology::Field coordinatesField(mesh, dmCoord, coordinates, metadata);
+            coordinatesField.createScatterWithBC(mesh, "", 0, metadata.label.c_str());
+            coordinatesField.scatterLocalToGlobal(metadata.label.c_str());
+            PetscVec coordVector = coordinatesField.vector(metadata.label.c_str()); assert(coordVector);
+            err = VecScale(coordVector, lengthScale); PYLITH_CHECK_ERROR(err);
+
+            err = PetscViewerBinaryOpen(comm, filenameVertices.c_str(), FILE_MODE_WRITE, &binaryViewer); PYLITH_CHECK_ERROR(err);
+            err = PetscViewerBinarySetSkipHeader(binaryViewer, PETSC_TRUE); PYLITH_CHECK_ERROR(err);
 #if 0
-        err = VecView(coordVector, binaryViewer); PYLITH_CHECK_ERROR(err);
+            err = VecView(coordVector, binaryViewer); PYLITH_CHECK_ERROR(err);
 #else
-        PetscBool isseq;
-        err = PetscObjectTypeCompare((PetscObject) coordVector, VECSEQ, &isseq); PYLITH_CHECK_ERROR(err);
-        if (isseq) {err = VecView_Seq(coordVector, binaryViewer); PYLITH_CHECK_ERROR(err); }
-        else       {err = VecView_MPI(coordVector, binaryViewer); PYLITH_CHECK_ERROR(err); }
+            PetscBool isseq;
+            err = PetscObjectTypeCompare((PetscObject) coordVector, VECSEQ, &isseq); PYLITH_CHECK_ERROR(err);
+            if (isseq) {err = VecView_Seq(coordVector, binaryViewer); PYLITH_CHECK_ERROR(err); }
+            else       {err = VecView_MPI(coordVector, binaryViewer); PYLITH_CHECK_ERROR(err); }
 #endif
-        err = PetscViewerDestroy(&binaryViewer); PYLITH_CHECK_ERROR(err);
-
-        PetscInt vStart, vEnd;
-        PetscInt n, numVerticesLocal = 0, numVertices;
-        PetscIS globalVertexNumbers = NULL;
-        err = DMPlexGetDepthStratum(dmMesh, 0, &vStart, &vEnd); PYLITH_CHECK_ERROR(err);
-        err = DMPlexGetVertexNumbering(dmMesh, &globalVertexNumbers); PYLITH_CHECK_ERROR(err);
-        err = ISGetLocalSize(globalVertexNumbers, &n); PYLITH_CHECK_ERROR(err);
-        if (n > 0) {
-            const PetscInt *indices = NULL;
-            err = ISGetIndices(globalVertexNumbers, &indices); PYLITH_CHECK_ERROR(err);
-            for(PetscInt v = 0; v < n; ++v) {
-                if (indices[v] >= 0) ++numVerticesLocal;
-            } // for
-            err = ISRestoreIndices(globalVertexNumbers, &indices); PYLITH_CHECK_ERROR(err);
-        } // if
-        err = MPI_Allreduce(&numVerticesLocal, &numVertices, 1, MPI_INT, MPI_SUM, comm); PYLITH_CHECK_ERROR(err);
+            err = PetscViewerDestroy(&binaryViewer); PYLITH_CHECK_ERROR(err);
+
+            PetscInt n, numVerticesLocal = 0;
+            PetscIS globalVertexNumbers = NULL;
+            err = DMPlexGetVertexNumbering(dmMesh, &globalVertexNumbers); PYLITH_CHECK_ERROR(err);
+            err = ISGetLocalSize(globalVertexNumbers, &n); PYLITH_CHECK_ERROR(err);
+            if (n > 0) {
+                const PetscInt *indices = NULL;
+                err = ISGetIndices(globalVertexNumbers, &indices); PYLITH_CHECK_ERROR(err);
+                for(PetscInt v = 0; v < n; ++v) {
+                    if (indices[v] >= 0) ++numVerticesLocal;
+                } // for
+                err = ISRestoreIndices(globalVertexNumbers, &indices); PYLITH_CHECK_ERROR(err);
+            } // if
+            err = MPI_Allreduce(&numVerticesLocal, &numVertices, 1, MPI_INT, MPI_SUM, comm); PYLITH_CHECK_ERROR(err);
+
+            if (_shareTopology) {
+                SharedDataset dataset;
+                dataset.filename = filenameVertices;
+                dataset.numPoints = numVertices;
+                dataset.numCols = cs->spaceDim();
+                _sharedDatasets[_verticesKey] = dataset;
+                _sharedKeys.push_back(_verticesKey);
+            } // if
+        } // if/else
         assert(numVertices > 0);
+        _numVertices = numVertices;
 
         // Create external dataset for coordinates
         if (!commRank) {
@@ -183,98 +219,118 @@ pylith::meshio::DataWriterHDF5Ext::open(const topology::Mesh& mesh,
         } // if
 
         // Write cells
-
-        // Account for censored cells
-        PetscInt cellHeight, cStart, cEnd, cMax, conesSize, numCells, numCorners, numCornersLocal = 0;
-        err = DMPlexGetVTKCellHeight(dmMesh, &cellHeight); PYLITH_CHECK_ERROR(err);
-        err = DMPlexGetHeightStratum(dmMesh, cellHeight, &cStart, &cEnd); PYLITH_CHECK_ERROR(err);
-        err = DMPlexGetHybridBounds(dmMesh, &cMax, PETSC_NULL, PETSC_NULL, PETSC_NULL); PYLITH_CHECK_ERROR(err);
-        if (cMax >= 0) {
-            cEnd = PetscMin(cEnd, cMax);
-        } // if
-        for(PetscInt cell = cStart; cell < cEnd; ++cell) {
-            PetscInt *closure = NULL;
-            PetscInt closureSize, v;
-
-            err = DMPlexGetTransitiveClosure(dmMesh, cell, PETSC_TRUE, &closureSize, &closure); PYLITH_CHECK_ERROR(err);
-            numCornersLocal = 0;
-            for (v = 0; v < closureSize*2; v += 2) {
-                if ((closure[v] >= vStart) && (closure[v] < vEnd)) {
-                    ++numCornersLocal;
-                } // if
-            } // for
-            err = DMPlexRestoreTransitiveClosure(dmMesh, cell, PETSC_TRUE, &closureSize, &closure); PYLITH_CHECK_ERROR(err);
-            if (numCornersLocal) break;
-        } // for
-        err = MPI_Allreduce(&numCornersLocal, &numCorners, 1, MPIU_INT, MPI_MAX, comm); PYLITH_CHECK_ERROR(err);
-        if (label) {
-            conesSize = 0;
+        std::string filenameCells = _datasetFilename("cells");
+        PetscInt numCells = 0, numCorners = 0;
+        const shared_type::const_iterator sharedCells = _shareTopology ? _sharedDatasets.find(_cellsKey) : _sharedDatasets.end();
+        if (sharedCells != _sharedDatasets.end()) {
+            // Reuse cells written by another writer for this mesh and label.
+            filenameCells = sharedCells->second.filename;
+            numCells = sharedCells->second.numPoints;
+            numCorners = sharedCells->second.numCols;
+        } else {
+            // Account for censored cells
+            PetscInt vStart, vEnd, cellHeight, cStart, cEnd, cMax, conesSize, numCornersLocal = 0;
+            err = DMPlexGetDepthStratum(dmMesh, 0, &vStart, &vEnd); PYLITH_CHECK_ERROR(err);
+            err = DMPlexGetVTKCellHeight(dmMesh, &cellHeight); PYLITH_CHECK_ERROR(err);
+            err = DMPlexGetHeightStratum(dmMesh, cellHeight, &cStart, &cEnd); PYLITH_CHECK_ERROR(err);
+            err = DMPlexGetHybridBounds(dmMesh, &cMax, PETSC_NULL, PETSC_NULL, PETSC_NULL); PYLITH_CHECK_ERROR(err);
+            if (cMax >= 0) {
+                cEnd = PetscMin(cEnd, cMax);
+            } // if
             for(PetscInt cell = cStart; cell < cEnd; ++cell) {
-                PetscInt value;
-
-                err = DMGetLabelValue(dmMesh, label, cell, &value); PYLITH_CHECK_ERROR(err);
-                if (value == labelId) ++conesSize;
+                PetscInt *closure = NULL;
+                PetscInt closureSize, v;
+
+                err = DMPlexGetTransitiveClosure(dmMesh, cell, PETSC_TRUE, &closureSize, &closure); PYLITH_CHECK_ERROR(err);
+                numCornersLocal = 0;
+                for (v = 0; v < closureSize*2; v += 2) {
+                    if ((closure[v] >= vStart) && (closure[v] < vEnd)) {
+                        ++numCornersLocal;
+                    } // if
+                } // for
+                err = DMPlexRestoreTransitiveClosure(dmMesh, cell, PETSC_TRUE, &closureSize, &closure); PYLITH_CHECK_ERROR(err);
+                if (numCornersLocal) break;
             } // for
-            conesSize *= numCorners;
-        } else {
-            conesSize = (cEnd - cStart)*numCorners;
-        } // if/else
+            err = MPI_Allreduce(&numCornersLocal, &numCorners, 1, MPIU_INT, MPI_MAX, comm); PYLITH_CHECK_ERROR(err);
+            if (label) {
+                conesSize = 0;
+                for(PetscInt cell = cStart; cell < cEnd; ++cell) {
+                    PetscInt value;
 
-        globalVertexNumbers = NULL;
-        const PetscInt *gvertex = NULL;
-        PetscVec cellVec = NULL;
-        PetscScalar *vertices = NULL;
-        const PetscInt meshDim = mesh.dimension();
-
-        err = DMPlexGetVertexNumbering(dmMesh, &globalVertexNumbers); PYLITH_CHECK_ERROR(err);
-        err = ISGetIndices(globalVertexNumbers, &gvertex); PYLITH_CHECK_ERROR(err);
-        err = VecCreate(comm, &cellVec); PYLITH_CHECK_ERROR(err);
-        err = VecSetSizes(cellVec, conesSize, PETSC_DETERMINE); PYLITH_CHECK_ERROR(err);
-        err = VecSetBlockSize(cellVec, numCorners); PYLITH_CHECK_ERROR(err);
-        err = VecSetFromOptions(cellVec); PYLITH_CHECK_ERROR(err);
-        err = PetscObjectSetName((PetscObject) cellVec, "cells"); PYLITH_CHECK_ERROR(err);
-        err = VecGetArray(cellVec, &vertices); PYLITH_CHECK_ERROR(err);
-        for(PetscInt cell = cStart, v = 0; cell < cEnd; ++cell) {
-            PetscInt *closure = NULL;
-            PetscInt closureSize, nC = 0, p;
+                    err = DMGetLabelValue(dmMesh, label, cell, &value); PYLITH_CHECK_ERROR(err);
+                    if (value == labelId) ++conesSize;
+                } // for
+                conesSize *= numCorners;
+            } else {
+                conesSize = (cEnd - cStart)*numCorners;
+            } // if/else
 
-            if (label) {
-                PetscInt value;
+            PetscIS globalVertexNumbers = NULL;
+            const PetscInt *gvertex = NULL;
+            PetscVec cellVec = NULL;
+            PetscScalar *vertices = NULL;
+            const PetscInt meshDim = mesh.dimension();
 
-                err = DMGetLabelValue(dmMesh, label, cell, &value); PYLITH_CHECK_ERROR(err);
-                if (value != labelId) continue;
-            } // if
-            err = DMPlexGetTransitiveClosure(dmMesh, cell, PETSC_TRUE, &closureSize, &closure); PYLITH_CHECK_ERROR(err);
-            for(p = 0; p < closureSize*2; p += 2) {
-                if ((closure[p] >= vStart) && (closure[p] < vEnd)) {
-                    closure[nC++] = closure[p];
+            err = DMPlexGetVertexNumbering(dmMesh, &globalVertexNumbers); PYLITH_CHECK_ERROR(err);
+            err = ISGetIndices(globalVertexNumbers, &gvertex); PYLITH_CHECK_ERROR(err);
+            err = VecCreate(comm, &cellVec); PYLITH_CHECK_ERROR(err);
+            err = VecSetSizes(cellVec, conesSize, PETSC_DETERMINE); PYLITH_CHECK_ERROR(err);
+            err = VecSetBlockSize(cellVec, numCorners); PYLITH_CHECK_ERROR(err);
+            err = VecSetFromOptions(cellVec); PYLITH_CHECK_ERROR(err);
+            err = PetscObjectSetName((PetscObject) cellVec, "cells"); PYLITH_CHECK_ERROR(err);
+            err = VecGetArray(cellVec, &vertices); PYLITH_CHECK_ERROR(err);
+            for(PetscInt cell = cStart, v = 0; cell < cEnd; ++cell) {
+                PetscInt *closure = NULL;
+                PetscInt closureSize, nC = 0, p;
+
+                if (label) {
+                    PetscInt value;
+
+                    err = DMGetLabelValue(dmMesh, label, cell, &value); PYLITH_CHECK_ERROR(err);
+                    if (value != labelId) continue;
                 } // if
+                err = DMPlexGetTransitiveClosure(dmMesh, cell, PETSC_TRUE, &closureSize, &closure); PYLITH_CHECK_ERROR(err);
+                for(p = 0; p < closureSize*2; p += 2) {
+                    if ((closure[p] >= vStart) && (closure[p] < vEnd)) {
+                        closure[nC++] = closure[p];
+                    } // if
+                } // for
+                err = DMPlexInvertCell(meshDim, nC, closure); PYLITH_CHECK_ERROR(err);
+                for (p = 0; p < nC; ++p) {
+                    const PetscInt gv = gvertex[closure[p] - vStart];
+                    vertices[v++] = gv < 0 ? -(gv+1) : gv;
+                }
+                err = DMPlexRestoreTransitiveClosure(dmMesh, cell, PETSC_TRUE, &closureSize, &closure); PYLITH_CHECK_ERROR(err);
+                //assert(v == (cell-cStart+1)*numCorners); Would be true without label check
             } // for
-            err = DMPlexInvertCell(meshDim, nC, closure); PYLITH_CHECK_ERROR(err);
-            for (p = 0; p < nC; ++p) {
-                const PetscInt gv = gvertex[closure[p] - vStart];
-                vertices[v++] = gv < 0 ? -(gv+1) : gv;
-            }
-            err = DMPlexRestoreTransitiveClosure(dmMesh, cell, PETSC_TRUE, &closureSize, &closure); PYLITH_CHECK_ERROR(err);
-            //assert(v == (cell-cStart+1)*numCorners); Would be true without label check
-        } // for
-        err = ISRestoreIndices(globalVertexNumbers, &gvertex); PYLITH_CHECK_ERROR(err);
-        err = VecRestoreArray(cellVec, &vertices); PYLITH_CHECK_ERROR(err);
-        err = VecGetSize(cellVec, &numCells); PYLITH_CHECK_ERROR(err);
-        numCells /= numCorners;
-
-        const std::string& filenameCells = _datasetFilename("cells");
-        err = PetscViewerBinaryOpen(comm, filenameCells.c_str(), FILE_MODE_WRITE, &binaryViewer); PYLITH_CHECK_ERROR(err);
-        err = PetscViewerBinarySetSkipHeader(binaryViewer, PETSC_TRUE); PYLITH_CHECK_ERROR(err);
+            err = ISRestoreIndices(globalVertexNumbers, &gvertex); PYLITH_CHECK_ERROR(err);
+            err = VecRestoreArray(cellVec, &vertices); PYLITH_CHECK_ERROR(err);
+            err = VecGetSize(cellVec, &numCells); PYLITH_CHECK_ERROR(err);
+            numCells /= numCorners;
+
+            err = PetscViewerBinaryOpen(comm, filenameCells.c_str(), FILE_MODE_WRITE, &binaryViewer); PYLITH_CHECK_ERROR(err);
+            err = PetscViewerBinarySetSkipHeader(binaryViewer, PETSC_TRUE); PYLITH_CHECK_ERROR(err);
 #if 0
-        err = VecView(cellVec, binaryViewer); PYLITH_CHECK_ERROR(err);
+            err = VecView(cellVec, binaryViewer); PYLITH_CHECK_ERROR(err);
 #else
-        err = PetscObjectTypeCompare((PetscObject) cellVec, VECSEQ, &isseq); PYLITH_CHECK_ERROR(err);
-        if (isseq) {err = VecView_Seq(cellVec, binaryViewer); PYLITH_CHECK_ERROR(err); }
-        else       {err = VecView_MPI(cellVec, binaryViewer); PYLITH_CHECK_ERROR(err); }
+            PetscBool isseq;
+            err = PetscObjectTypeCompare((PetscObject) cellVec, VECSEQ, &isseq); PYLITH_CHECK_ERROR(err);
+            if (isseq) {err = VecView_Seq(cellVec, binaryViewer); PYLITH_CHECK_ERROR(err); }
+            else       {err = VecView_MPI(cellVec, binaryViewer); PYLITH_CHECK_ERROR(err); }
 #endif
-        err = VecDestroy(&cellVec); PYLITH_CHECK_ERROR(err);
-        err = PetscViewerDestroy(&binaryViewer); PYLITH_CHECK_ERROR(err);
+            err = VecDestroy(&cellVec); PYLITH_CHECK_ERROR(err);
+            err = PetscViewerDestroy(&binaryViewer); PYLITH_CHECK_ERROR(err);
+
+            if (_shareTopology) {
+                SharedDataset dataset;
+                dataset.filename = filenameCells;
+                dataset.numPoints = numCells;
+                dataset.numCols = numCorners;
+                _sharedDatasets[_cellsKey] = dataset;
+                _sharedKeys.push_back(_cellsKey);
+            } // if
+        } // if/else
+        _numCells = numCells;
 
         // Create external dataset for cells
         if (!commRank) {
@@ -383,31 +439,40 @@ pylith::meshio::DataWriterHDF5Ext::writeVertexField(const PylithScalar t,
 
         // Add dataset to HDF5 file, if necessary
         if (createdExternalDataset) {
-            PetscDM dm = NULL;
-            PetscSection section = NULL;
-            PetscInt dof = 0, n, numVerticesLocal = 0, numVertices, vStart;
-            PetscIS globalVertexNumbers = NULL;
-
-            err = VecGetDM(vector, &dm); PYLITH_CHECK_ERROR(err); assert(dm);
-            err = DMGetDefaultSection(dm, &section); PYLITH_CHECK_ERROR(err); assert(section);
+            // Number of vertices is known from open() for the same mesh,
+            // and the global size of the vector gives the fiber dimension,
+            // so no reductions are needed.
+            PetscInt numVertices = 0;
+            if (_sharedKey(dmMesh, "vertices", 0, 0) == _verticesKey) {
+                numVertices = _numVertices;
+            } else {
+                PetscInt n, numVerticesLocal = 0;
+                PetscIS globalVertexNumbers = NULL;
 
-            err = DMPlexGetDepthStratum(dmMesh, 0, &vStart, PETSC_NULL); PYLITH_CHECK_ERROR(err);
-            err = DMPlexGetVertexNumbering(dmMesh, &globalVertexNumbers); PYLITH_CHECK_ERROR(err);
-            err = ISGetLocalSize(globalVertexNumbers, &n); PYLITH_CHECK_ERROR(err);
-            if (n > 0) {
-                const PetscInt *indices = NULL;
-                err = ISGetIndices(globalVertexNumbers, &indices); PYLITH_CHECK_ERROR(err);
-                err = PetscSectionGetDof(section, vStart, &dof); PYLITH_CHECK_ERROR(err);
-                for(PetscInt v = 0; v < n; ++v) {
-                    if (indices[v] >= 0) ++numVerticesLocal;
-                } // for
-                err = ISRestoreIndices(globalVertexNumbers, &indices); PYLITH_CHECK_ERROR(err);
+                err = DMPlexGetVertexNumbering(dmMesh, &globalVertexNumbers); PYLITH_CHECK_ERROR(err);
+                err = ISGetLocalSize(globalVertexNumbers, &n); PYLITH_CHECK_ERROR(err);
+                if (n > 0) {
+                    const PetscInt *indices = NULL;
+                    err = ISGetIndices(globalVertexNumbers, &indices); PYLITH_CHECK_ERROR(err);
+                    for(PetscInt v = 0; v < n; ++v) {
+                        if (indices[v] >= 0) ++numVerticesLocal;
+                    } // for
+                    err = ISRestoreIndices(globalVertexNumbers, &indices); PYLITH_CHECK_ERROR(err);
+                } // if
+                err = MPI_Allreduce(&numVerticesLocal, &numVertices, 1, MPI_INT, MPI_SUM, comm); PYLITH_CHECK_ERROR(err);
+            } // if/else
+            assert(numVertices > 0);
+
+            PetscInt vectorSize = 0;
+            err = VecGetSize(vector, &vectorSize); PYLITH_CHECK_ERROR(err);
+            if (vectorSize % numVertices) {
+                std::ostringstream msg;
+                msg << "Size of vector (" << vectorSize << ") for field '" << field.label()
+                    << "' is not a multiple of the number of vertices (" << numVertices << ").";
+                throw std::logic_error(msg.str());
             } // if
-            int fiberDimLocal = dof;
-            int fiberDim = 0;
-            err = MPI_Allreduce(&fiberDimLocal, &fiberDim, 1, MPI_INT, MPI_MAX, comm); PYLITH_CHECK_ERROR(err);
-            err = MPI_Allreduce(&numVerticesLocal, &numVertices, 1, MPI_INT, MPI_SUM, comm); PYLITH_CHECK_ERROR(err);
-            assert(fiberDim > 0); assert(numVertices > 0);
+            const PetscInt fiberDim = vectorSize / numVertices;
+            assert(fiberDim > 0);
 
             datasetInfo.numPoints = numVertices;
             datasetInfo.fiberDim = fiberDim;
@@ -529,41 +594,54 @@ pylith::meshio::DataWriterHDF5Ext::writeCellField(const PylithScalar t,
 
         // Add dataset to HDF5 file, if necessary
         if (createdExternalDataset) {
-            // Get cell information
-            PetscSection section = field.localSection(); assert(section);
-            PetscInt dof = 0, numLocalCells = 0, numCells, cellHeight, cStart, cEnd;
-            PetscIS globalCellNumbers;
-
-            err = DMPlexGetVTKCellHeight(dmMesh, &cellHeight); PYLITH_CHECK_ERROR(err);
-            err = DMPlexGetHeightStratum(dmMesh, cellHeight, &cStart, &cEnd); PYLITH_CHECK_ERROR(err);
-            if (label) {
-                topology::StratumIS cellsIS(dmMesh, label, labelId);
-                numCells = cellsIS.size();
-                const PetscInt* cells = (numCells > 0) ? cellsIS.points() : 0;
-                for(PetscInt c = 0; c < numCells; ++c) {
-                    err = PetscSectionGetDof(section, cells[0], &dof); PYLITH_CHECK_ERROR(err);
-                    if ((cells[c] >= cStart) && (cells[c] < cEnd)) {
-                        ++numLocalCells;
-                    } // if
-                } // for
+            // Number of cells is known from open() for the same mesh and
+            // label, and the global size of the vector gives the fiber
+            // dimension, so no reductions are needed.
+            PetscInt numCells = 0;
+            if (_sharedKey(dmMesh, "cells", label, labelId) == _cellsKey) {
+                numCells = _numCells;
             } else {
-                err = DMPlexGetCellNumbering(dmMesh, &globalCellNumbers); PYLITH_CHECK_ERROR(err);
-                err = ISGetLocalSize(globalCellNumbers, &numCells); PYLITH_CHECK_ERROR(err);
-                if (numCells > 0) {
-                    const PetscInt *indices = NULL;
-                    err = ISGetIndices(globalCellNumbers, &indices); PYLITH_CHECK_ERROR(err);
-                    err = PetscSectionGetDof(section, cStart, &dof); PYLITH_CHECK_ERROR(err);
-                    for(PetscInt v = 0; v < numCells; ++v) {
-                        if (indices[v] >= 0) ++numLocalCells;
+                PetscInt numLocalCells = 0, cellHeight, cStart, cEnd;
+                PetscIS globalCellNumbers;
+
+                err = DMPlexGetVTKCellHeight(dmMesh, &cellHeight); PYLITH_CHECK_ERROR(err);
+                err = DMPlexGetHeightStratum(dmMesh, cellHeight, &cStart, &cEnd); PYLITH_CHECK_ERROR(err);
+                if (label) {
+                    topology::StratumIS cellsIS(dmMesh, label, labelId);
+                    const PetscInt numStratumCells = cellsIS.size();
+                    const PetscInt* cells = (numStratumCells > 0) ? cellsIS.points() : 0;
+                    for(PetscInt c = 0; c < numStratumCells; ++c) {
+                        if ((cells[c] >= cStart) && (cells[c] < cEnd)) {
+                            ++numLocalCells;
+                        } // if
                     } // for
-                    err = ISRestoreIndices(globalCellNumbers, &indices); PYLITH_CHECK_ERROR(err);
-                } // if
+                } else {
+                    PetscInt n = 0;
+                    err = DMPlexGetCellNumbering(dmMesh, &globalCellNumbers); PYLITH_CHECK_ERROR(err);
+                    err = ISGetLocalSize(globalCellNumbers, &n); PYLITH_CHECK_ERROR(err);
+                    if (n > 0) {
+                        const PetscInt *indices = NULL;
+                        err = ISGetIndices(globalCellNumbers, &indices); PYLITH_CHECK_ERROR(err);
+                        for(PetscInt v = 0; v < n; ++v) {
+                            if (indices[v] >= 0) ++numLocalCells;
+                        } // for
+                        err = ISRestoreIndices(globalCellNumbers, &indices); PYLITH_CHECK_ERROR(err);
+                    } // if
+                } // if/else
+                err = MPI_Allreduce(&numLocalCells, &numCells, 1, MPI_INT, MPI_SUM, comm); PYLITH_CHECK_ERROR(err);
             } // if/else
-            int fiberDimLocal = dof;
-            int fiberDim = 0;
-            MPI_Allreduce(&fiberDimLocal, &fiberDim, 1, MPI_INT, MPI_MAX, comm);
-            err = MPI_Allreduce(&numLocalCells, &numCells, 1, MPI_INT, MPI_SUM, comm); PYLITH_CHECK_ERROR(err);
-            assert(fiberDim > 0); assert(numCells > 0);
+            assert(numCells > 0);
+
+            PetscInt vectorSize = 0;
+            err = VecGetSize(vector, &vectorSize); PYLITH_CHECK_ERROR(err);
+            if (vectorSize % numCells) {
+                std::ostringstream msg;
+                msg << "Size of vector (" << vectorSize << ") for field '" << field.label()
+                    << "' is not a multiple of the number of cells (" << numCells << ").";
+                throw std::logic_error(msg.str());
+            } // if
+            const PetscInt fiberDim = vectorSize / numCells;
+            assert(fiberDim > 0);
 
             datasetInfo.numPoints = numCells;
             datasetInfo.fiberDim = fiberDim;
@@ -773,5 +851,32 @@ pylith::meshio::DataWriterHDF5Ext::_writeTimeStamp(const PylithScalar t)
     PYLITH_METHOD_END;
 } // _writeTimeStamp
 
+// ----------------------------------------------------------------------
+// Generate key for dataset shared among writers.
+std::string
+pylith::meshio::DataWriterHDF5Ext::_sharedKey(PetscDM dmMesh,
+                                              const char* name,
+                                              const char* label,
+                                              const int labelId)
+{ // _sharedKey
+    PYLITH_METHOD_BEGIN;
+
+    assert(dmMesh);
+    assert(name);
+
+    // Object ids are unique for the lifetime of the process, unlike
+    // addresses, so a new mesh never matches a destroyed one.
+    PetscObjectId meshId = 0;
+    PetscErrorCode err = PetscObjectGetId((PetscObject) dmMesh, &meshId); PYLITH_CHECK_ERROR(err);
+
+    std::ostringstream key;
+    key << meshId << "/" << name;
+    if (label) {
+        key << "/" << label << "=" << labelId;
+    } // if
+
+    PYLITH_METHOD_RETURN(std::string(key.str()));
+} // _sharedKey
+
 
 // End of file
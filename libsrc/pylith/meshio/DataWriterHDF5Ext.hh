@@ -37,6 +37,11 @@
  *   cell_fields - group
  *     CELL_FIELD (name of cell field) - dataset
  *       [ntimesteps, ncells, fiberdim]
+ *
+ * If sharing topology is enabled, writers for the same mesh reuse
+ * the external files with the vertices (and cells for the same label)
+ * written by the first writer opened for that mesh instead of writing
+ * them again.
  */
 
 #if !defined(pylith_meshio_datawriterhdf5ext_hh)
@@ -47,6 +52,7 @@
 
 #include <string> // USES std::string
 #include <map> // HASA std::map
+#include <vector> // HASA std::vector
 
 // DataWriterHDF5Ext ----------------------------------------------------
 /// Object for writing finite-element data to HDF5 file.
@@ -82,6 +88,13 @@ void deallocate(void);
  */
 void filename(const char* filename);
 
+/** Set flag for sharing vertices and cells datasets with other
+ * writers for the same mesh.
+ *
+ * @param flag True to share datasets, false otherwise.
+ */
+void shareTopology(const bool flag);
+
 /** Generate filename for HDF5 file.
  *
  * Appends _info if only writing parameters.
@@ -160,6 +173,20 @@ std::string _datasetFilename(const char* field) const;
  */
 void _writeTimeStamp(const PylithScalar t);
 
+/** Generate key for dataset shared among writers.
+ *
+ * @param dmMesh PETSc DM for mesh.
+ * @param name Name of dataset.
+ * @param label Name of label defining cells (=0 for all cells).
+ * @param labelId Value of label defining cells.
+ * @returns Key identifying dataset.
+ */
+static
+std::string _sharedKey(PetscDM dmMesh,
+                       const char* name,
+                       const char* label,
+                       const int labelId);
+
 // NOT IMPLEMENTED //////////////////////////////////////////////////////
 private:
 
@@ -176,6 +203,14 @@ struct ExternalDataset {
 };
 typedef std::map<std::string, ExternalDataset> dataset_type;
 
+/// Raw external file shared among writers.
+struct SharedDataset {
+    std::string filename; ///< Name of raw external file.
+    PetscInt numPoints; ///< Number of points (rows).
+    PetscInt numCols; ///< Number of values per point (columns).
+};
+typedef std::map<std::string, SharedDataset> shared_type;
+
 // PRIVATE MEMBERS //////////////////////////////////////////////////////
 private:
 
@@ -184,6 +219,17 @@ HDF5* _h5;   ///< HDF5 file
 dataset_type _datasets;   ///< Datasets
 int _tstampIndex;   ///< Index of last time stamp written.
 
+/// Layout of mesh in open(), reused when creating field datasets.
+std::string _verticesKey; ///< Key for vertices of mesh in open().
+std::string _cellsKey; ///< Key for cells of mesh and label in open().
+PetscInt _numVertices; ///< Number of vertices in mesh.
+PetscInt _numCells; ///< Number of cells in mesh with label.
+
+bool _shareTopology; ///< Share vertices and cells with other writers.
+std::vector<std::string> _sharedKeys; ///< Keys of shared datasets written by this writer.
+
+static shared_type _sharedDatasets; ///< Datasets shared among writers.
+
 }; // DataWriterHDF5Ext
 
 #include "DataWriterHDF5Ext.icc" // inline methods
@@ -0,0 +1,729 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ======================================================================
+//
+
+#include <portinfo>
+
+#include "DataWriterVTU.hh" // Implementation of class methods
+
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/Field.hh" // USES Field
+
+#include <petscdmplex.h>
+
+#include <mpi.h> // USES MPI routines
+
+#include <algorithm> // USES std::fill()
+#include <cassert> // USES assert()
+#include <cstdio> // USES sprintf()
+#include <fstream> // USES std::ofstream
+#include <sstream> // USES std::ostringstream
+#include <stdexcept> // USES std::runtime_error
+
+// ----------------------------------------------------------------------
+// Constructor
+pylith::meshio::DataWriterVTU::DataWriterVTU(void) :
+  _timeConstant(1.0),
+  _t(0.0),
+  _filename("output.vtu"),
+  _timeFormat("%f"),
+  _commRank(0),
+  _commSize(1),
+  _hasEmptyPiece(false),
+  _isOpen(false),
+  _isOpenTimeStep(false)
+{ // constructor
+} // constructor
+
+// ----------------------------------------------------------------------
+// Destructor
+pylith::meshio::DataWriterVTU::~DataWriterVTU(void)
+{ // destructor
+  deallocate();
+} // destructor
+
+// ----------------------------------------------------------------------
+// Deallocate PETSc and local data structures.
+void
+pylith::meshio::DataWriterVTU::deallocate(void)
+{ // deallocate
+  PYLITH_METHOD_BEGIN;
+
+  _pieceVertices.clear();
+  _pieceCells.clear();
+  _coordinates.clear();
+  _connectivity.clear();
+  _offsets.clear();
+  _cellTypes.clear();
+  _vertexFields.clear();
+  _cellFields.clear();
+  _timeSeries.clear();
+  _fiberDims.clear();
+
+  DataWriter::deallocate();
+
+  PYLITH_METHOD_END;
+} // deallocate
+
+// ----------------------------------------------------------------------
+// Copy constructor.
+pylith::meshio::DataWriterVTU::DataWriterVTU(const DataWriterVTU& w) :
+  DataWriter(w),
+  _timeConstant(w._timeConstant),
+  _t(0.0),
+  _filename(w._filename),
+  _timeFormat(w._timeFormat),
+  _commRank(0),
+  _commSize(1),
+  _hasEmptyPiece(false),
+  _isOpen(false),
+  _isOpenTimeStep(false)
+{ // copy constructor
+} // copy constructor
+
+// ----------------------------------------------------------------------
+// Set value used to normalize time stamp in name of VTU files.
+void
+pylith::meshio::DataWriterVTU::timeConstant(const PylithScalar value)
+{ // timeConstant
+  PYLITH_METHOD_BEGIN;
+
+  if (value <= 0.0) {
+    std::ostringstream msg;
+    msg << "Time used to normalize time stamp in VTU data files must be "
+	<< "positive.\nCurrent value is " << value << ".";
+    throw std::runtime_error(msg.str());
+  } // if
+  _timeConstant = value;
+
+  PYLITH_METHOD_END;
+} // timeConstant
+
+// ----------------------------------------------------------------------
+// Prepare for writing files.
+void
+pylith::meshio::DataWriterVTU::open(const topology::Mesh& mesh,
+				    const int numTimeSteps,
+				    const char* label,
+				    const int labelId)
+{ // open
+  PYLITH_METHOD_BEGIN;
+
+  DataWriter::open(mesh, numTimeSteps, label, labelId);
+
+  PetscErrorCode err = 0;
+  err = MPI_Comm_rank(mesh.comm(), &_commRank);PYLITH_CHECK_ERROR(err);
+  err = MPI_Comm_size(mesh.comm(), &_commSize);PYLITH_CHECK_ERROR(err);
+
+  _setupPiece(mesh, label, labelId);
+  _timeSeries.clear();
+  _fiberDims.clear();
+
+  // Fields on empty pieces need the number of values per point from
+  // other processes, so determine once whether any piece is empty.
+  int isEmptyLocal = _pieceCells.empty() ? 1 : 0;
+  int isEmpty = 0;
+  err = MPI_Allreduce(&isEmptyLocal, &isEmpty, 1, MPI_INT, MPI_LOR, mesh.comm());PYLITH_CHECK_ERROR(err);
+  _hasEmptyPiece = isEmpty ? true : false;
+
+  _isOpen = true;
+
+  PYLITH_METHOD_END;
+} // open
+
+// ----------------------------------------------------------------------
+// Close output files.
+void
+pylith::meshio::DataWriterVTU::close(void)
+{ // close
+  PYLITH_METHOD_BEGIN;
+
+  _pieceVertices.clear();
+  _pieceCells.clear();
+  _coordinates.clear();
+  _connectivity.clear();
+  _offsets.clear();
+  _cellTypes.clear();
+  _timeSeries.clear();
+  _fiberDims.clear();
+
+  DataWriter::close();
+
+  _isOpen = false;
+
+  PYLITH_METHOD_END;
+} // close
+
+// ----------------------------------------------------------------------
+// Prepare file for data at a new time step.
+void
+pylith::meshio::DataWriterVTU::openTimeStep(const PylithScalar t,
+					    const topology::Mesh& mesh,
+					    const char* label,
+					    const int labelId)
+{ // openTimeStep
+  PYLITH_METHOD_BEGIN;
+
+  assert(_isOpen && !_isOpenTimeStep);
+
+  // Cells in the piece were selected using the label in open().
+  _t = t;
+  _vertexFields.clear();
+  _cellFields.clear();
+
+  _isOpenTimeStep = true;
+
+  PYLITH_METHOD_END;
+} // openTimeStep
+
+// ----------------------------------------------------------------------
+// Write files for time step.
+void
+pylith::meshio::DataWriterVTU::closeTimeStep(void)
+{ // closeTimeStep
+  PYLITH_METHOD_BEGIN;
+
+  if (!_isOpenTimeStep) {
+    PYLITH_METHOD_END;
+  } // if
+
+  // Do not create files without fields, consistent with DataWriterVTK.
+  if (_vertexFields.size() > 0 || _cellFields.size() > 0) {
+    _writePiece();
+    if (DataWriter::_numTimeSteps > 0) {
+      _timeSeries.push_back(std::make_pair(_t*DataWriter::_timeScale, _vtuFilename(_t, -1)));
+    } // if
+    if (!_commRank) {
+      _writeParallelFile();
+      if (DataWriter::_numTimeSteps > 0) {
+	_writeCollection();
+      } // if
+    } // if
+  } // if
+
+  _vertexFields.clear();
+  _cellFields.clear();
+  _isOpenTimeStep = false;
+
+  PYLITH_METHOD_END;
+} // closeTimeStep
+
+// ----------------------------------------------------------------------
+// Write field over vertices to file.
+void
+pylith::meshio::DataWriterVTU::writeVertexField(const PylithScalar t,
+						topology::Field& field,
+						const topology::Mesh& mesh)
+{ // writeVertexField
+  PYLITH_METHOD_BEGIN;
+
+  assert(_isOpen && _isOpenTimeStep);
+
+  _vertexFields.push_back(FieldData());
+  _copyField(&_vertexFields.back(), field, _pieceVertices);
+
+  PYLITH_METHOD_END;
+} // writeVertexField
+
+// ----------------------------------------------------------------------
+// Write field over cells to file.
+void
+pylith::meshio::DataWriterVTU::writeCellField(const PylithScalar t,
+					      topology::Field& field,
+					      const char* label,
+					      const int labelId)
+{ // writeCellField
+  PYLITH_METHOD_BEGIN;
+
+  assert(_isOpen && _isOpenTimeStep);
+
+  _cellFields.push_back(FieldData());
+  _copyField(&_cellFields.back(), field, _pieceCells);
+
+  PYLITH_METHOD_END;
+} // writeCellField
+
+// ----------------------------------------------------------------------
+// Generate filename for VTU files.
+std::string
+pylith::meshio::DataWriterVTU::_vtuFilename(const PylithScalar t,
+					    const int rank) const
+{ // _vtuFilename
+  PYLITH_METHOD_BEGIN;
+
+  std::ostringstream filename;
+  const size_t indexExt = _filename.find(".vtu");
+  filename << std::string(_filename, 0, indexExt);
+  if (DataWriter::_numTimeSteps > 0) {
+    // If data with multiple time steps, then add time stamp to filename
+    char sbuffer[256];
+    sprintf(sbuffer, _timeFormat.c_str(), t/_timeConstant);
+    std::string timestamp(sbuffer);
+    const size_t pos = timestamp.find(".");
+    if (pos != std::string::npos) {
+      timestamp.erase(pos, 1);
+    } // if
+    filename << "_t" << timestamp;
+  } else {
+    filename << "_info";
+  } // if/else
+  if (rank >= 0) {
+    filename << "_p" << rank << ".vtu";
+  } else {
+    filename << ".pvtu";
+  } // if/else
+
+  PYLITH_METHOD_RETURN(std::string(filename.str()));
+} // _vtuFilename
+
+// ----------------------------------------------------------------------
+// Generate filename for PVD (time series) file.
+std::string
+pylith::meshio::DataWriterVTU::_pvdFilename(void) const
+{ // _pvdFilename
+  PYLITH_METHOD_BEGIN;
+
+  const size_t indexExt = _filename.find(".vtu");
+
+  PYLITH_METHOD_RETURN(std::string(_filename, 0, indexExt) + ".pvd");
+} // _pvdFilename
+
+// ----------------------------------------------------------------------
+// Compute topology and geometry of local piece.
+void
+pylith::meshio::DataWriterVTU::_setupPiece(const topology::Mesh& mesh,
+					   const char* label,
+					   const int labelId)
+{ // _setupPiece
+  PYLITH_METHOD_BEGIN;
+
+  _pieceVertices.clear();
+  _pieceCells.clear();
+  _coordinates.clear();
+  _connectivity.clear();
+  _offsets.clear();
+  _cellTypes.clear();
+
+  PetscDM dmMesh = mesh.dmMesh();assert(dmMesh);
+  PetscErrorCode err = 0;
+
+  PetscInt cellHeight, cStart, cEnd, cMax, vStart, vEnd;
+  err = DMPlexGetVTKCellHeight(dmMesh, &cellHeight);PYLITH_CHECK_ERROR(err);
+  err = DMPlexGetHeightStratum(dmMesh, cellHeight, &cStart, &cEnd);PYLITH_CHECK_ERROR(err);
+  err = DMPlexGetHybridBounds(dmMesh, &cMax, PETSC_NULL, PETSC_NULL, PETSC_NULL);PYLITH_CHECK_ERROR(err);
+  if (cMax >= 0) {
+    cEnd = PetscMin(cEnd, cMax);
+  } // if
+  err = DMPlexGetDepthStratum(dmMesh, 0, &vStart, &vEnd);PYLITH_CHECK_ERROR(err);
+
+  DMLabel dmLabel = NULL;
+  if (label) {
+    err = DMGetLabel(dmMesh, label, &dmLabel);PYLITH_CHECK_ERROR(err);
+    if (!dmLabel) {
+      std::ostringstream msg;
+      msg << "Could not find label '" << label << "' in mesh for VTU output.";
+      throw std::runtime_error(msg.str());
+    } // if
+  } // if
+
+  // Vertices are numbered in the order they are first encountered in
+  // the cells of the piece.
+  const int cellDim = mesh.dimension();
+  std::vector<int> vertexIndex(vEnd-vStart, -1);
+  for (PetscInt cell = cStart; cell < cEnd; ++cell) {
+    if (dmLabel) {
+      PetscInt value;
+      err = DMLabelGetValue(dmLabel, cell, &value);PYLITH_CHECK_ERROR(err);
+      if (value != labelId) continue;
+    } // if
+
+    PetscInt *closure = NULL;
+    PetscInt closureSize, nC = 0;
+    err = DMPlexGetTransitiveClosure(dmMesh, cell, PETSC_TRUE, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
+    for (PetscInt p = 0; p < closureSize*2; p += 2) {
+      if ((closure[p] >= vStart) && (closure[p] < vEnd)) {
+	closure[nC++] = closure[p];
+      } // if
+    } // for
+    err = DMPlexInvertCell(cellDim, nC, closure);PYLITH_CHECK_ERROR(err);
+    for (PetscInt p = 0; p < nC; ++p) {
+      const PetscInt v = closure[p] - vStart;
+      if (vertexIndex[v] < 0) {
+	vertexIndex[v] = _pieceVertices.size();
+	_pieceVertices.push_back(closure[p]);
+      } // if
+      _connectivity.push_back(vertexIndex[v]);
+    } // for
+    err = DMPlexRestoreTransitiveClosure(dmMesh, cell, PETSC_TRUE, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
+
+    _pieceCells.push_back(cell);
+    _offsets.push_back(_connectivity.size());
+    _cellTypes.push_back(_vtkCellType(cellDim, nC));
+  } // for
+
+  // Coordinates (dimensioned), padded to 3 components.
+  PetscSection coordSection = NULL;
+  PetscVec coordVec = NULL;
+  const PetscScalar* coordArray = NULL;
+  PetscReal lengthScale = 1.0;
+  err = DMPlexGetScale(dmMesh, PETSC_UNIT_LENGTH, &lengthScale);PYLITH_CHECK_ERROR(err);
+  err = DMGetCoordinateSection(dmMesh, &coordSection);PYLITH_CHECK_ERROR(err);assert(coordSection);
+  err = DMGetCoordinatesLocal(dmMesh, &coordVec);PYLITH_CHECK_ERROR(err);assert(coordVec);
+  err = VecGetArrayRead(coordVec, &coordArray);PYLITH_CHECK_ERROR(err);
+  const size_t numVertices = _pieceVertices.size();
+  _coordinates.resize(3*numVertices, 0.0);
+  for (size_t iV = 0; iV < numVertices; ++iV) {
+    PetscInt dof, off;
+    err = PetscSectionGetDof(coordSection, _pieceVertices[iV], &dof);PYLITH_CHECK_ERROR(err);
+    err = PetscSectionGetOffset(coordSection, _pieceVertices[iV], &off);PYLITH_CHECK_ERROR(err);
+    assert(dof <= 3);
+    for (PetscInt d = 0; d < dof; ++d) {
+      _coordinates[3*iV+d] = lengthScale*coordArray[off+d];
+    } // for
+  } // for
+  err = VecRestoreArrayRead(coordVec, &coordArray);PYLITH_CHECK_ERROR(err);
+
+  PYLITH_METHOD_END;
+} // _setupPiece
+
+// ----------------------------------------------------------------------
+// Copy values of field over points in local piece.
+void
+pylith::meshio::DataWriterVTU::_copyField(FieldData* data,
+					  topology::Field& field,
+					  const std::vector<PetscInt>& points)
+{ // _copyField
+  PYLITH_METHOD_BEGIN;
+
+  assert(data);
+
+  PetscSection section = field.localSection();assert(section);
+  PetscVec vec = field.localVector();assert(vec);
+  PetscErrorCode err = 0;
+
+  const size_t numPoints = points.size();
+  const int fiberDim = _fiberDim(field, points);
+
+  // VTK vectors have 3 components.
+  const int numComponents = (topology::FieldBase::VECTOR == field.vectorFieldType() && fiberDim < 3) ? 3 : fiberDim;
+
+  data->name = field.label();
+  data->numComponents = numComponents;
+  data->values.resize(numPoints*numComponents);
+  std::fill(data->values.begin(), data->values.end(), 0.0);
+
+  const PetscScalar* array = NULL;
+  err = VecGetArrayRead(vec, &array);PYLITH_CHECK_ERROR(err);
+  for (size_t iP = 0; iP < numPoints; ++iP) {
+    PetscInt dof, off;
+    err = PetscSectionGetDof(section, points[iP], &dof);PYLITH_CHECK_ERROR(err);
+    err = PetscSectionGetOffset(section, points[iP], &off);PYLITH_CHECK_ERROR(err);
+    assert(dof <= numComponents);
+    for (PetscInt d = 0; d < dof; ++d) {
+      data->values[iP*numComponents+d] = array[off+d];
+    } // for
+  } // for
+  err = VecRestoreArrayRead(vec, &array);PYLITH_CHECK_ERROR(err);
+
+  PYLITH_METHOD_END;
+} // _copyField
+
+// ----------------------------------------------------------------------
+// Get number of values per point of field.
+int
+pylith::meshio::DataWriterVTU::_fiberDim(const topology::Field& field,
+					 const std::vector<PetscInt>& points)
+{ // _fiberDim
+  PYLITH_METHOD_BEGIN;
+
+  PetscInt fiberDimLocal = 0;
+  if (points.size() > 0) {
+    PetscSection section = field.localSection();assert(section);
+    PetscErrorCode err = PetscSectionGetDof(section, points[0], &fiberDimLocal);PYLITH_CHECK_ERROR(err);
+  } // if
+  if (!_hasEmptyPiece) {
+    PYLITH_METHOD_RETURN(fiberDimLocal);
+  } // if
+
+  const std::string name = field.label();
+  const std::map<std::string, int>::const_iterator iter = _fiberDims.find(name);
+  if (iter != _fiberDims.end()) {
+    PYLITH_METHOD_RETURN(iter->second);
+  } // if
+
+  PetscInt fiberDim = 0;
+  PetscErrorCode err = MPI_Allreduce(&fiberDimLocal, &fiberDim, 1, MPIU_INT, MPI_MAX, field.mesh().comm());PYLITH_CHECK_ERROR(err);
+  _fiberDims[name] = fiberDim;
+
+  PYLITH_METHOD_RETURN(fiberDim);
+} // _fiberDim
+
+// ----------------------------------------------------------------------
+// Get VTK cell type.
+unsigned char
+pylith::meshio::DataWriterVTU::_vtkCellType(const int cellDim,
+					    const int numCorners)
+{ // _vtkCellType
+  // Values from vtkCellType.h.
+  unsigned char cellType = 0; // VTK_EMPTY_CELL
+  switch (cellDim) {
+  case 0 :
+    cellType = 1; // VTK_VERTEX
+    break;
+  case 1 :
+    cellType = 3; // VTK_LINE
+    break;
+  case 2 :
+    if (3 == numCorners) {
+      cellType = 5; // VTK_TRIANGLE
+    } else if (4 == numCorners) {
+      cellType = 9; // VTK_QUAD
+    } // if/else
+    break;
+  case 3 :
+    if (4 == numCorners) {
+      cellType = 10; // VTK_TETRA
+    } else if (8 == numCorners) {
+      cellType = 12; // VTK_HEXAHEDRON
+    } // if/else
+    break;
+  default :
+    break;
+  } // switch
+  if (!cellType) {
+    std::ostringstream msg;
+    msg << "Unknown VTK cell type for cell with dimension " << cellDim
+	<< " and " << numCorners << " vertices.";
+    throw std::logic_error(msg.str());
+  } // if
+
+  return cellType;
+} // _vtkCellType
+
+// ----------------------------------------------------------------------
+// Write VTU file with local piece.
+void
+pylith::meshio::DataWriterVTU::_writePiece(void) const
+{ // _writePiece
+  PYLITH_METHOD_BEGIN;
+
+  const std::string& filename = _vtuFilename(_t, _commRank);
+  std::ofstream fout(filename.c_str(), std::ios::out | std::ios::binary);
+  if (!fout.is_open() || !fout.good()) {
+    std::ostringstream msg;
+    msg << "Could not open VTU file '" << filename << "' for writing.";
+    throw std::runtime_error(msg.str());
+  } // if
+
+  const int one = 1;
+  const bool isLittleEndian = 1 == *((const char*)&one);
+  const char* scalarType = (sizeof(double) == sizeof(PylithScalar)) ? "Float64" : "Float32";
+  assert(4 == sizeof(int));
+
+  const size_t numVertices = _pieceVertices.size();
+  const size_t numCells = _pieceCells.size();
+  size_t offset = 0;
+
+  fout << "<?xml version=\"1.0\"?>\n"
+       << "<VTKFile type=\"UnstructuredGrid\" version=\"1.0\" byte_order=\""
+       << (isLittleEndian ? "LittleEndian" : "BigEndian")
+       << "\" header_type=\"UInt64\">\n"
+       << "  <UnstructuredGrid>\n"
+       << "    <Piece NumberOfPoints=\"" << numVertices << "\" NumberOfCells=\"" << numCells << "\">\n";
+
+  fout << "      <PointData>\n";
+  for (size_t i = 0; i < _vertexFields.size(); ++i) {
+    const FieldData& data = _vertexFields[i];
+    _writeDataArrayHeader(fout, scalarType, data.name.c_str(), data.numComponents, &offset, data.values.size()*sizeof(PylithScalar));
+  } // for
+  fout << "      </PointData>\n";
+
+  fout << "      <CellData>\n";
+  for (size_t i = 0; i < _cellFields.size(); ++i) {
+    const FieldData& data = _cellFields[i];
+    _writeDataArrayHeader(fout, scalarType, data.name.c_str(), data.numComponents, &offset, data.values.size()*sizeof(PylithScalar));
+  } // for
+  fout << "      </CellData>\n";
+
+  fout << "      <Points>\n";
+  _writeDataArrayHeader(fout, scalarType, "Points", 3, &offset, _coordinates.size()*sizeof(PylithScalar));
+  fout << "      </Points>\n";
+
+  fout << "      <Cells>\n";
+  _writeDataArrayHeader(fout, "Int32", "connectivity", 1, &offset, _connectivity.size()*sizeof(int));
+  _writeDataArrayHeader(fout, "Int32", "offsets", 1, &offset, _offsets.size()*sizeof(int));
+  _writeDataArrayHeader(fout, "UInt8", "types", 1, &offset, _cellTypes.size()*sizeof(unsigned char));
+  fout << "      </Cells>\n";
+
+  fout << "    </Piece>\n"
+       << "  </UnstructuredGrid>\n"
+       << "  <AppendedData encoding=\"raw\">\n"
+       << "_";
+
+  // Data blocks must be in the same order as the headers.
+  for (size_t i = 0; i < _vertexFields.size(); ++i) {
+    const FieldData& data = _vertexFields[i];
+    _writeAppendedBlock(fout, data.values.size() ? &data.values[0] : NULL, data.values.size()*sizeof(PylithScalar));
+  } // for
+  for (size_t i = 0; i < _cellFields.size(); ++i) {
+    const FieldData& data = _cellFields[i];
+    _writeAppendedBlock(fout, data.values.size() ? &data.values[0] : NULL, data.values.size()*sizeof(PylithScalar));
+  } // for
+  _writeAppendedBlock(fout, _coordinates.size() ? &_coordinates[0] : NULL, _coordinates.size()*sizeof(PylithScalar));
+  _writeAppendedBlock(fout, _connectivity.size() ? &_connectivity[0] : NULL, _connectivity.size()*sizeof(int));
+  _writeAppendedBlock(fout, _offsets.size() ? &_offsets[0] : NULL, _offsets.size()*sizeof(int));
+  _writeAppendedBlock(fout, _cellTypes.size() ? &_cellTypes[0] : NULL, _cellTypes.size()*sizeof(unsigned char));
+
+  fout << "\n  </AppendedData>\n"
+       << "</VTKFile>\n";
+
+  if (!fout.good()) {
+    std::ostringstream msg;
+    msg << "Error while writing VTU file '" << filename << "'.";
+    throw std::runtime_error(msg.str());
+  } // if
+  fout.close();
+
+  PYLITH_METHOD_END;
+} // _writePiece
+
+// ----------------------------------------------------------------------
+// Write PVTU file referencing pieces on all processes.
+void
+pylith::meshio::DataWriterVTU::_writeParallelFile(void) const
+{ // _writeParallelFile
+  PYLITH_METHOD_BEGIN;
+
+  const std::string& filename = _vtuFilename(_t, -1);
+  std::ofstream fout(filename.c_str());
+  if (!fout.is_open() || !fout.good()) {
+    std::ostringstream msg;
+    msg << "Could not open PVTU file '" << filename << "' for writing.";
+    throw std::runtime_error(msg.str());
+  } // if
+
+  const int one = 1;
+  const bool isLittleEndian = 1 == *((const char*)&one);
+  const char* scalarType = (sizeof(double) == sizeof(PylithScalar)) ? "Float64" : "Float32";
+
+  fout << "<?xml version=\"1.0\"?>\n"
+       << "<VTKFile type=\"PUnstructuredGrid\" version=\"1.0\" byte_order=\""
+       << (isLittleEndian ? "LittleEndian" : "BigEndian")
+       << "\" header_type=\"UInt64\">\n"
+       << "  <PUnstructuredGrid GhostLevel=\"0\">\n";
+
+  fout << "    <PPointData>\n";
+  for (size_t i = 0; i < _vertexFields.size(); ++i) {
+    fout << "      <PDataArray type=\"" << scalarType << "\" Name=\"" << _vertexFields[i].name
+	 << "\" NumberOfComponents=\"" << _vertexFields[i].numComponents << "\"/>\n";
+  } // for
+  fout << "    </PPointData>\n";
+
+  fout << "    <PCellData>\n";
+  for (size_t i = 0; i < _cellFields.size(); ++i) {
+    fout << "      <PDataArray type=\"" << scalarType << "\" Name=\"" << _cellFields[i].name
+	 << "\" NumberOfComponents=\"" << _cellFields[i].numComponents << "\"/>\n";
+  } // for
+  fout << "    </PCellData>\n";
+
+  fout << "    <PPoints>\n"
+       << "      <PDataArray type=\"" << scalarType << "\" Name=\"Points\" NumberOfComponents=\"3\"/>\n"
+       << "    </PPoints>\n";
+
+  // Piece filenames are relative to the directory of the PVTU file.
+  for (int rank = 0; rank < _commSize; ++rank) {
+    const std::string& pieceFilename = _vtuFilename(_t, rank);
+    fout << "    <Piece Source=\"" << pieceFilename.substr(pieceFilename.find_last_of('/')+1) << "\"/>\n";
+  } // for
+
+  fout << "  </PUnstructuredGrid>\n"
+       << "</VTKFile>\n";
+  fout.close();
+
+  PYLITH_METHOD_END;
+} // _writeParallelFile
+
+// ----------------------------------------------------------------------
+// Write PVD file with time series of PVTU files.
+void
+pylith::meshio::DataWriterVTU::_writeCollection(void) const
+{ // _writeCollection
+  PYLITH_METHOD_BEGIN;
+
+  const std::string& filename = _pvdFilename();
+  std::ofstream fout(filename.c_str());
+  if (!fout.is_open() || !fout.good()) {
+    std::ostringstream msg;
+    msg << "Could not open PVD file '" << filename << "' for writing.";
+    throw std::runtime_error(msg.str());
+  } // if
+
+  fout << "<?xml version=\"1.0\"?>\n"
+       << "<VTKFile type=\"Collection\" version=\"0.1\">\n"
+       << "  <Collection>\n";
+  fout.precision(16);
+  for (size_t i = 0; i < _timeSeries.size(); ++i) {
+    const std::string& stepFilename = _timeSeries[i].second;
+    fout << "    <DataSet timestep=\"" << _timeSeries[i].first << "\" group=\"\" part=\"0\" file=\""
+	 << stepFilename.substr(stepFilename.find_last_of('/')+1) << "\"/>\n";
+  } // for
+  fout << "  </Collection>\n"
+       << "</VTKFile>\n";
+  fout.close();
+
+  PYLITH_METHOD_END;
+} // _writeCollection
+
+// ----------------------------------------------------------------------
+// Write XML element describing data array in appended section.
+void
+pylith::meshio::DataWriterVTU::_writeDataArrayHeader(std::ostream& sout,
+						     const char* type,
+						     const char* name,
+						     const int numComponents,
+						     size_t* offset,
+						     const size_t nbytes)
+{ // _writeDataArrayHeader
+  assert(offset);
+
+  sout << "        <DataArray type=\"" << type << "\" Name=\"" << name
+       << "\" NumberOfComponents=\"" << numComponents
+       << "\" format=\"appended\" offset=\"" << *offset << "\"/>\n";
+
+  // Each block has a header with the number of bytes.
+  *offset += sizeof(unsigned long long) + nbytes;
+} // _writeDataArrayHeader
+
+// ----------------------------------------------------------------------
+// Write block of data in appended section.
+void
+pylith::meshio::DataWriterVTU::_writeAppendedBlock(std::ostream& sout,
+						   const void* data,
+						   const size_t nbytes)
+{ // _writeAppendedBlock
+  assert(8 == sizeof(unsigned long long));
+
+  const unsigned long long header = nbytes;
+  sout.write((const char*)&header, sizeof(header));
+  if (nbytes > 0) {
+    assert(data);
+    sout.write((const char*)data, nbytes);
+  } // if
+} // _writeAppendedBlock
+
+
+// End of file
@@ -0,0 +1,307 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file libsrc/meshio/DataWriterVTU.hh
+ *
+ * @brief Object for writing finite-element data to VTK XML
+ * unstructured grid (VTU) files with binary appended data.
+ *
+ * Each process writes its own piece (one VTU file per process per
+ * time step) and process 0 writes a small parallel VTU (PVTU) file
+ * referencing the pieces and a ParaView data (PVD) file with the time
+ * series. No data is gathered to a single process.
+ *
+ * The topology and geometry of each piece are computed once in open()
+ * and reused for every time step. Fields are copied into local
+ * buffers when they are written, so the output manager can reuse
+ * fields as buffers.
+ */
+
+#if !defined(pylith_meshio_datawritervtu_hh)
+#define pylith_meshio_datawritervtu_hh
+
+// Include directives ---------------------------------------------------
+#include "DataWriter.hh" // ISA DataWriter
+
+#include "pylith/topology/topologyfwd.hh" // USES Mesh, Field
+
+#include <vector> // HASA std::vector
+#include <utility> // HASA std::pair
+#include <map> // HASA std::map
+#include <iosfwd> // USES std::ostream
+
+// DataWriterVTU --------------------------------------------------------
+/// Object for writing finite-element data to VTU files.
+class pylith::meshio::DataWriterVTU : public DataWriter
+{ // DataWriterVTU
+  friend class TestDataWriterVTU; // unit testing
+  friend class TestDataWriterVTUMesh; // unit testing
+
+// PUBLIC METHODS ///////////////////////////////////////////////////////
+public :
+
+  /// Constructor
+  DataWriterVTU(void);
+
+  /// Destructor
+  ~DataWriterVTU(void);
+
+  /** Make copy of this object.
+   *
+   * @returns Copy of this.
+   */
+  DataWriter* clone(void) const;
+
+  /// Deallocate PETSc and local data structures.
+  void deallocate(void);
+
+  /** Set filename for VTU files.
+   *
+   * @param filename Name of VTU file.
+   */
+  void filename(const char* filename);
+
+  /** Set time format for time stamp in name of VTU files.
+   *
+   * @param format C style time format for filename.
+   */
+  void timeFormat(const char* format);
+
+  /** Set value used to normalize time stamp in name of VTU files.
+   *
+   * Time stamp is divided by this value (time in seconds).
+   *
+   * @param value Value (time in seconds) used to normalize time stamp in
+   * filename.
+   */
+  void timeConstant(const PylithScalar value);
+
+  /** Prepare for writing files.
+   *
+   * @param mesh Finite-element mesh.
+   * @param numTimeSteps Expected number of time steps for fields.
+   * @param label Name of label defining cells to include in output
+   *   (=0 means use all cells in mesh).
+   * @param labelId Value of label defining which cells to include.
+   */
+  void open(const topology::Mesh& mesh,
+	    const int numTimeSteps,
+	    const char* label =0,
+	    const int labelId =0);
+
+  /// Close output files.
+  void close(void);
+
+  /** Prepare file for data at a new time step.
+   *
+   * @param t Time stamp for new data
+   * @param mesh Finite-element mesh.
+   * @param label Name of label defining cells to include in output
+   *   (=0 means use all cells in mesh).
+   * @param labelId Value of label defining which cells to include.
+   */
+  void openTimeStep(const PylithScalar t,
+		    const topology::Mesh& mesh,
+		    const char* label =0,
+		    const int labelId =0);
+
+  /// Write files for time step.
+  void closeTimeStep(void);
+
+  /** Write field over vertices to file.
+   *
+   * @param t Time associated with field.
+   * @param field Field over vertices.
+   * @param mesh Mesh associated with output.
+   */
+  void writeVertexField(const PylithScalar t,
+			topology::Field& field,
+			const topology::Mesh& mesh);
+
+  /** Write field over cells to file.
+   *
+   * @param t Time associated with field.
+   * @param field Field over cells.
+   * @param label Name of label defining cells to include in output
+   *   (=0 means use all cells in mesh).
+   * @param labelId Value of label defining which cells to include.
+   */
+  void writeCellField(const PylithScalar t,
+		      topology::Field& field,
+		      const char* label =0,
+		      const int labelId =0);
+
+// PRIVATE STRUCTS //////////////////////////////////////////////////////
+private :
+
+  /// Values of a field over the points in the local piece.
+  struct FieldData {
+    std::string name; ///< Name of field.
+    int numComponents; ///< Number of components per point.
+    std::vector<PylithScalar> values; ///< Values of field.
+  }; // FieldData
+
+// PRIVATE METHODS //////////////////////////////////////////////////////
+private :
+
+  /** Copy constructor.
+   *
+   * @param w Object to copy.
+   */
+  DataWriterVTU(const DataWriterVTU& w);
+
+  /** Generate filename for VTU files.
+   *
+   * @param t Time in seconds.
+   * @param rank Process for piece (-1 for PVTU file).
+   */
+  std::string _vtuFilename(const PylithScalar t,
+			   const int rank) const;
+
+  /// Generate filename for PVD (time series) file.
+  std::string _pvdFilename(void) const;
+
+  /** Compute topology and geometry of local piece.
+   *
+   * @param mesh Finite-element mesh.
+   * @param label Name of label defining cells to include in output
+   *   (=0 means use all cells in mesh).
+   * @param labelId Value of label defining which cells to include.
+   */
+  void _setupPiece(const topology::Mesh& mesh,
+		   const char* label,
+		   const int labelId);
+
+  /** Copy values of field over points in local piece.
+   *
+   * @param data Field data [output].
+   * @param field Field to copy.
+   * @param points Points in local piece.
+   */
+  void _copyField(FieldData* data,
+		  topology::Field& field,
+		  const std::vector<PetscInt>& points);
+
+  /** Get number of values per point of field, which must be
+   * consistent across pieces, including pieces without any points.
+   *
+   * Communication is needed only if a piece is empty, and then only
+   * the first time a field with a given name is written.
+   *
+   * @param field Field to write.
+   * @param points Points in local piece.
+   * @returns Number of values per point.
+   */
+  int _fiberDim(const topology::Field& field,
+		const std::vector<PetscInt>& points);
+
+  /** Get VTK cell type.
+   *
+   * @param cellDim Dimension of cell.
+   * @param numCorners Number of vertices in cell.
+   * @returns VTK cell type.
+   */
+  static
+  unsigned char _vtkCellType(const int cellDim,
+			     const int numCorners);
+
+  /// Write VTU file with local piece.
+  void _writePiece(void) const;
+
+  /// Write PVTU file referencing pieces on all processes.
+  void _writeParallelFile(void) const;
+
+  /// Write PVD file with time series of PVTU files.
+  void _writeCollection(void) const;
+
+  /** Write XML element describing data array in appended section.
+   *
+   * @param sout Output stream.
+   * @param type VTK type of values.
+   * @param name Name of data array.
+   * @param numComponents Number of components.
+   * @param offset Offset of data in appended section [input/output].
+   * @param nbytes Number of bytes of data.
+   */
+  static
+  void _writeDataArrayHeader(std::ostream& sout,
+			     const char* type,
+			     const char* name,
+			     const int numComponents,
+			     size_t* offset,
+			     const size_t nbytes);
+
+  /** Write block of data in appended section.
+   *
+   * @param sout Output stream.
+   * @param data Pointer to data.
+   * @param nbytes Number of bytes of data.
+   */
+  static
+  void _writeAppendedBlock(std::ostream& sout,
+			   const void* data,
+			   const size_t nbytes);
+
+// NOT IMPLEMENTED //////////////////////////////////////////////////////
+private :
+
+  const DataWriterVTU& operator=(const DataWriterVTU&); ///< Not implemented
+
+// PRIVATE MEMBERS //////////////////////////////////////////////////////
+private :
+
+  /// Time value (in seconds) used to normalize time stamp.
+  PylithScalar _timeConstant;
+
+  PylithScalar _t; ///< Time of current time step.
+
+  std::string _filename; ///< Name of VTU file.
+  std::string _timeFormat; ///< C style time format for time stamp.
+
+  std::vector<PetscInt> _pieceVertices; ///< Vertices in local piece.
+  std::vector<PetscInt> _pieceCells; ///< Cells in local piece.
+  std::vector<PylithScalar> _coordinates; ///< Coordinates of vertices in local piece.
+  std::vector<int> _connectivity; ///< Vertices of cells (indices into local piece).
+  std::vector<int> _offsets; ///< Offsets of end of cells in connectivity.
+  std::vector<unsigned char> _cellTypes; ///< VTK cell types.
+
+  std::vector<FieldData> _vertexFields; ///< Vertex fields for current time step.
+  std::vector<FieldData> _cellFields; ///< Cell fields for current time step.
+
+  /// Time (dimensional) and name of PVTU file for each time step.
+  std::vector<std::pair<PylithScalar, std::string> > _timeSeries;
+
+  /// Number of values per point for each field name (if a piece is empty).
+  std::map<std::string, int> _fiberDims;
+
+  int _commRank; ///< Rank of this process.
+  int _commSize; ///< Number of processes.
+
+  bool _hasEmptyPiece; ///< True if piece on any process has no cells.
+  bool _isOpen; ///< True if called open().
+  bool _isOpenTimeStep; ///< true if called openTimeStep().
+
+}; // DataWriterVTU
+
+#include "DataWriterVTU.icc" // inline methods
+
+#endif // pylith_meshio_datawritervtu_hh
+
+
+// End of file
@@ -31,6 +31,7 @@
 #include <cassert> // USES assert()
 #include <stdexcept> // USES std::runtime_error
 #include <sstream> // USES std::ostringstream
+#include <vector> // USES std::vector
 
 // ----------------------------------------------------------------------
 // Constructor
@@ -368,6 +369,119 @@ pylith::meshio::ExodusII::getVar(int* values,
   PYLITH_METHOD_END;
 } // getVar
 
+// ----------------------------------------------------------------------
+// Get hyperslab of values for variable as an array of PylithScalars.
+void
+pylith::meshio::ExodusII::getVar(PylithScalar* values,
+				 const int* start,
+				 const int* count,
+				 int ndims,
+				 const char* name) const
+{ // getVar
+  PYLITH_METHOD_BEGIN;
+
+  assert(_file);
+  assert(start);
+  assert(count);
+
+  int vid = -1;
+  if (!hasVar(name, &vid)) {
+    std::ostringstream msg;
+    msg << "Missing real variable '" << name << "'.";
+    throw std::runtime_error(msg.str());
+  } // if
+
+  int vndims = 0;
+  int err = nc_inq_varndims(_file, vid, &vndims);
+  if (ndims != vndims) {
+    std::ostringstream msg;
+    msg << "Expecting " << ndims << " dimensions for variable '" << name
+	<< "' but variable only has " << vndims << " dimensions.";
+    throw std::runtime_error(msg.str());
+  } // if
+
+  size_t sizeSlab = 1;
+  std::vector<size_t> startSlab(ndims);
+  std::vector<size_t> countSlab(ndims);
+  for (int iDim=0; iDim < ndims; ++iDim) {
+    startSlab[iDim] = start[iDim];
+    countSlab[iDim] = count[iDim];
+    sizeSlab *= count[iDim];
+  } // for
+  if (!sizeSlab) {
+    PYLITH_METHOD_END;
+  } // if
+  assert(values);
+
+  if (sizeof(PylithScalar) == sizeof(double)) {
+    err = nc_get_vara_double(_file, vid, &startSlab[0], &countSlab[0], values);
+  } else {
+    assert(0);
+    throw std::logic_error("Unknown size of PylithScalar in ExodusII::getVar().");
+  } // if/else
+  if (err != NC_NOERR) {
+    std::ostringstream msg;
+    msg << "Could not get hyperslab of values for variable '" << name << "'.";
+    throw std::runtime_error(msg.str());
+  } // if
+
+  PYLITH_METHOD_END;
+} // getVar
+
+// ----------------------------------------------------------------------
+// Get hyperslab of values for variable as an array of ints.
+void
+pylith::meshio::ExodusII::getVar(int* values,
+				 const int* start,
+				 const int* count,
+				 int ndims,
+				 const char* name) const
+{ // getVar
+  PYLITH_METHOD_BEGIN;
+
+  assert(_file);
+  assert(start);
+  assert(count);
+
+  int vid = -1;
+  if (!hasVar(name, &vid)) {
+    std::ostringstream msg;
+    msg << "Missing integer variable '" << name << "'.";
+    throw std::runtime_error(msg.str());
+  } // if
+
+  int vndims = 0;
+  int err = nc_inq_varndims(_file, vid, &vndims);
+  if (ndims != vndims) {
+    std::ostringstream msg;
+    msg << "Expecting " << ndims << " dimensions for variable '" << name
+	<< "' but variable only has " << vndims << " dimensions.";
+    throw std::runtime_error(msg.str());
+  } // if
+
+  size_t sizeSlab = 1;
+  std::vector<size_t> startSlab(ndims);
+  std::vector<size_t> countSlab(ndims);
+  for (int iDim=0; iDim < ndims; ++iDim) {
+    startSlab[iDim] = start[iDim];
+    countSlab[iDim] = count[iDim];
+    sizeSlab *= count[iDim];
+  } // for
+  if (!sizeSlab) {
+    PYLITH_METHOD_END;
+  } // if
+  assert(values);
+
+  err = nc_get_vara_int(_file, vid, &startSlab[0], &countSlab[0], values);
+  if (err != NC_NOERR) {
+    std::ostringstream msg;
+    msg << "Could not get hyperslab of values for variable '" << name << "'.";
+    throw std::runtime_error(msg.str());
+  } // if
+
+  PYLITH_METHOD_END;
+} // getVar
+
 // ----------------------------------------------------------------------
 // Get values for variable as an array of strings.
 void
@@ -133,6 +133,34 @@ public :
 	      int ndims,
 	      const char* name) const;
 
+  /** Get hyperslab of values for variable as an array of PylithScalars.
+   *
+   * @param values Array of values.
+   * @param start Index of first value along each dimension.
+   * @param count Number of values along each dimension.
+   * @param ndims Number of dimension for variable.
+   * @param name Name of variable.
+   */
+  void getVar(PylithScalar* values,
+	      const int* start,
+	      const int* count,
+	      int ndims,
+	      const char* name) const;
+
+  /** Get hyperslab of values for variable as an array of ints.
+   *
+   * @param values Array of values.
+   * @param start Index of first value along each dimension.
+   * @param count Number of values along each dimension.
+   * @param ndims Number of dimension for variable.
+   * @param name Name of variable.
+   */
+  void getVar(int* values,
+	      const int* start,
+	      const int* count,
+	      int ndims,
+	      const char* name) const;
+
   /** Get values for variable as an array of strings.
    *
    * @param values Array of values.
@@ -0,0 +1,319 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ======================================================================
+//
+
+#include <portinfo>
+
+#include "MappedLineParser.hh" // implementation of class methods
+
+#include <sys/types.h> // USES off_t
+#include <sys/stat.h> // USES fstat()
+#include <sys/mman.h> // USES mmap(), munmap(), madvise()
+#include <fcntl.h> // USES open()
+#include <unistd.h> // USES read(), close()
+
+#include <cstring> // USES memchr(), strncmp(), memcpy()
+#include <cstdlib> // USES strtod()
+#include <climits> // USES LONG_MAX
+#include <cassert> // USES assert()
+
+// ----------------------------------------------------------------------
+namespace pylith {
+  namespace meshio {
+    namespace _MappedLineParser {
+      /// Check whether character is whitespace.
+      inline
+      bool isWhitespace(const char c) {
+	return ' ' == c || '\t' == c || '\r' == c || '\v' == c || '\f' == c;
+      } // isWhitespace
+    } // _MappedLineParser
+  } // meshio
+} // pylith
+
+// ----------------------------------------------------------------------
+// Constructor
+pylith::meshio::MappedLineParser::MappedLineParser(const char* delimiter) :
+  _delimiter(delimiter),
+  _buffer(""),
+  _data(0),
+  _end(0),
+  _next(0),
+  _pos(0),
+  _lineEnd(0),
+  _mapped(0),
+  _mappedSize(0),
+  _lineNumber(0)
+{ // constructor
+} // constructor
+
+// ----------------------------------------------------------------------
+// Destructor
+pylith::meshio::MappedLineParser::~MappedLineParser(void)
+{ // destructor
+  close();
+} // destructor
+
+// ----------------------------------------------------------------------
+// Open file.
+bool
+pylith::meshio::MappedLineParser::open(const char* filename)
+{ // open
+  assert(filename);
+
+  close();
+
+  const int fd = ::open(filename, O_RDONLY);
+  if (fd < 0)
+    return false;
+
+  struct stat info;
+  if (0 == fstat(fd, &info) && S_ISREG(info.st_mode) && info.st_size > 0) {
+    void* addr = mmap(0, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (MAP_FAILED != addr) {
+      madvise(addr, info.st_size, MADV_SEQUENTIAL);
+      _mapped = addr;
+      _mappedSize = info.st_size;
+    } // if
+  } // if
+
+  if (!_mapped) {
+    // Fall back to reading file into buffer.
+    const size_t chunkSize = 1048576;
+    size_t size = 0;
+    ssize_t nbytes = 0;
+    do {
+      _contents.resize(size + chunkSize);
+      nbytes = ::read(fd, &_contents[size], chunkSize);
+      if (nbytes > 0)
+	size += nbytes;
+    } while (nbytes > 0);
+    _contents.resize(size);
+    if (nbytes < 0) {
+      ::close(fd);
+      _contents.clear();
+      return false;
+    } // if
+  } // if
+  ::close(fd);
+
+  if (_mapped)
+    buffer((const char*)_mapped, _mappedSize);
+  else
+    buffer(_contents.size() ? &_contents[0] : 0, _contents.size());
+
+  return true;
+} // open
+
+// ----------------------------------------------------------------------
+// Use contents of buffer instead of a file.
+void
+pylith::meshio::MappedLineParser::buffer(const char* data,
+					 const size_t size)
+{ // buffer
+  assert(data || 0 == size);
+
+  _data = data;
+  _end = data + size;
+  _next = _data;
+  _pos = _data;
+  _lineEnd = _data;
+  _lineNumber = 0;
+  _buffer = "";
+} // buffer
+
+// ----------------------------------------------------------------------
+// Close file.
+void
+pylith::meshio::MappedLineParser::close(void)
+{ // close
+  if (_mapped) {
+    munmap(_mapped, _mappedSize);
+    _mapped = 0;
+    _mappedSize = 0;
+  } // if
+  std::vector<char>().swap(_contents);
+
+  _data = 0;
+  _end = 0;
+  _next = 0;
+  _pos = 0;
+  _lineEnd = 0;
+  _lineNumber = 0;
+} // close
+
+// ----------------------------------------------------------------------
+// Get next line with leading whitespace and comments removed.
+const std::string&
+pylith::meshio::MappedLineParser::next(void)
+{ // next
+  if (nextLine()) {
+    _buffer.assign(_pos, _lineEnd);
+    _pos = _lineEnd;
+  } else
+    _buffer = "";
+
+  return _buffer;
+} // next
+
+// ----------------------------------------------------------------------
+// Skip characters up to and including delimiter.
+void
+pylith::meshio::MappedLineParser::ignore(const char delimiter)
+{ // ignore
+  const char* found = (const char*) memchr(_next, delimiter, _end - _next);
+  const char* stop = found ? found : _end;
+  for (const char* p=_next; p < stop; ++p)
+    if ('\n' == *p)
+      ++_lineNumber;
+  _next = found ? found + 1 : _end;
+  _pos = _next;
+  _lineEnd = _next;
+} // ignore
+
+// ----------------------------------------------------------------------
+// Advance to next non-empty line without copying it.
+bool
+pylith::meshio::MappedLineParser::nextLine(void)
+{ // nextLine
+  const size_t delimiterLen = _delimiter.length();
+  const char* delimiter = _delimiter.c_str();
+
+  while (_next < _end) {
+    const char* begin = _next;
+    const char* newline = (const char*) memchr(begin, '\n', _end - begin);
+    const char* end = newline ? newline : _end;
+    _next = newline ? newline + 1 : _end;
+    ++_lineNumber;
+
+    // Remove comment.
+    if (delimiterLen > 0) {
+      for (const char* p = (const char*) memchr(begin, delimiter[0], end - begin);
+	   p;
+	   p = (const char*) memchr(p+1, delimiter[0], end - (p+1))) {
+	if (size_t(end - p) >= delimiterLen &&
+	    0 == strncmp(p, delimiter, delimiterLen)) {
+	  end = p;
+	  break;
+	} // if
+      } // for
+    } // if
+
+    _pos = begin;
+    _lineEnd = end;
+    _skipWhitespace();
+    if (_pos < _lineEnd)
+      return true;
+  } // while
+
+  _pos = _end;
+  _lineEnd = _end;
+  return false;
+} // nextLine
+
+// ----------------------------------------------------------------------
+// Read integer from current line.
+bool
+pylith::meshio::MappedLineParser::readInt(long* value)
+{ // readInt
+  assert(value);
+
+  _skipWhitespace();
+  const char* p = _pos;
+  bool negative = false;
+  if (p < _lineEnd && ('-' == *p || '+' == *p)) {
+    negative = '-' == *p;
+    ++p;
+  } // if
+  const char* digits = p;
+  unsigned long magnitude = 0;
+  const unsigned long limit = negative ?
+    (unsigned long)(LONG_MAX) + 1 : (unsigned long)(LONG_MAX);
+  for (; p < _lineEnd && *p >= '0' && *p <= '9'; ++p) {
+    const unsigned long digit = *p - '0';
+    if (magnitude > (limit - digit) / 10)
+      return false; // overflow
+    magnitude = 10*magnitude + digit;
+  } // for
+  if (p == digits || (p < _lineEnd && !_MappedLineParser::isWhitespace(*p)))
+    return false;
+
+  *value = negative ? -(long)(magnitude - 1) - 1 : (long) magnitude;
+  _pos = p;
+
+  return true;
+} // readInt
+
+// ----------------------------------------------------------------------
+// Read floating point number from current line.
+bool
+pylith::meshio::MappedLineParser::readDouble(double* value)
+{ // readDouble
+  assert(value);
+
+  _skipWhitespace();
+  const char* p = _pos;
+  while (p < _lineEnd && !_MappedLineParser::isWhitespace(*p))
+    ++p;
+  const size_t length = p - _pos;
+
+  // Mapped file is not null terminated, so copy token to local buffer.
+  const size_t maxLength = 64;
+  char token[maxLength];
+  if (0 == length || length >= maxLength)
+    return false;
+  memcpy(token, _pos, length);
+  token[length] = '\0';
+
+  char* tokenEnd = 0;
+  const double v = strtod(token, &tokenEnd);
+  if (tokenEnd != token + length)
+    return false;
+
+  *value = v;
+  _pos = p;
+
+  return true;
+} // readDouble
+
+// ----------------------------------------------------------------------
+// Check whether current line has any remaining characters.
+bool
+pylith::meshio::MappedLineParser::endOfLine(void)
+{ // endOfLine
+  _skipWhitespace();
+  return _pos >= _lineEnd;
+} // endOfLine
+
+// ----------------------------------------------------------------------
+// Get line number of current line.
+int
+pylith::meshio::MappedLineParser::lineNumber(void) const
+{ // lineNumber
+  return _lineNumber;
+} // lineNumber
+
+// ----------------------------------------------------------------------
+// Skip whitespace in current line.
+void
+pylith::meshio::MappedLineParser::_skipWhitespace(void)
+{ // _skipWhitespace
+  while (_pos < _lineEnd && _MappedLineParser::isWhitespace(*_pos))
+    ++_pos;
+} // _skipWhitespace
+
+
+// End of file
@@ -0,0 +1,158 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file libsrc/meshio/MappedLineParser.hh
+ *
+ * @brief C++ object for parsing lines of a memory-mapped ASCII file.
+ *
+ * The interface mirrors spatialdata::utils::LineParser (next() and
+ * ignore()) for the header lines of a file and adds methods for
+ * parsing numbers directly from the mapped file without copying
+ * lines into strings or streams. Comments start with a delimiter and
+ * continue to the end of the line; blank lines are skipped.
+ */
+
+#if !defined(pylith_meshio_mappedlineparser_hh)
+#define pylith_meshio_mappedlineparser_hh
+
+// Include directives ---------------------------------------------------
+#include "meshiofwd.hh" // forward declarations
+
+#include <string> // HASA std::string
+#include <vector> // HASA std::vector
+
+// MappedLineParser -----------------------------------------------------
+/// Object for parsing lines of a memory-mapped ASCII file.
+class pylith::meshio::MappedLineParser
+{ // MappedLineParser
+  friend class TestMappedLineParser; // unit testing
+
+// PUBLIC METHODS ///////////////////////////////////////////////////////
+public :
+
+  /** Constructor
+   *
+   * @param delimiter Delimiter that starts a comment.
+   */
+  MappedLineParser(const char* delimiter ="//");
+
+  /// Destructor
+  ~MappedLineParser(void);
+
+  /** Open file.
+   *
+   * The file is memory-mapped if possible, otherwise it is read into
+   * a buffer.
+   *
+   * @param filename Name of file.
+   * @returns True if file was opened, false otherwise.
+   */
+  bool open(const char* filename);
+
+  /** Use contents of buffer instead of a file.
+   *
+   * @param data Contents of file (caller retains ownership).
+   * @param size Number of characters in buffer.
+   */
+  void buffer(const char* data,
+	      const size_t size);
+
+  /// Close file.
+  void close(void);
+
+  /** Get next line with leading whitespace and comments removed.
+   *
+   * @returns Next non-empty line (empty if at end of file).
+   */
+  const std::string& next(void);
+
+  /** Skip characters up to and including delimiter.
+   *
+   * @param delimiter Delimiter.
+   */
+  void ignore(const char delimiter);
+
+  /** Advance to next non-empty line without copying it.
+   *
+   * @returns True if a line was found, false if at end of file.
+   */
+  bool nextLine(void);
+
+  /** Read integer from current line.
+   *
+   * @param value Value [output].
+   * @returns True if an integer was read, false otherwise.
+   */
+  bool readInt(long* value);
+
+  /** Read floating point number from current line.
+   *
+   * @param value Value [output].
+   * @returns True if a number was read, false otherwise.
+   */
+  bool readDouble(double* value);
+
+  /** Check whether current line has any remaining characters that are
+   * not whitespace.
+   *
+   * @returns True if at end of current line.
+   */
+  bool endOfLine(void);
+
+  /** Get line number of current line.
+   *
+   * @returns Line number (starting at 1).
+   */
+  int lineNumber(void) const;
+
+// PRIVATE METHODS //////////////////////////////////////////////////////
+private :
+
+  /// Skip whitespace in current line.
+  void _skipWhitespace(void);
+
+// NOT IMPLEMENTED //////////////////////////////////////////////////////
+private :
+
+  MappedLineParser(const MappedLineParser&); ///< Not implemented
+  const MappedLineParser& operator=(const MappedLineParser&); ///< Not implemented
+
+// PRIVATE MEMBERS //////////////////////////////////////////////////////
+private :
+
+  std::string _delimiter; ///< Delimiter that starts comment.
+  std::string _buffer; ///< Copy of current line returned by next().
+  std::vector<char> _contents; ///< Contents of file if not mapped.
+
+  const char* _data; ///< Start of file contents.
+  const char* _end; ///< End of file contents.
+  const char* _next; ///< Start of next line.
+  const char* _pos; ///< Current position in current line.
+  const char* _lineEnd; ///< End of current line (excluding comment).
+
+  void* _mapped; ///< Address of memory-mapped file (NULL if not mapped).
+  size_t _mappedSize; ///< Size of memory-mapped region.
+  int _lineNumber; ///< Line number of current line.
+
+}; // MappedLineParser
+
+#endif // pylith_meshio_mappedlineparser_hh
+
+
+// End of file
@@ -85,4 +85,67 @@ pylith::meshio::MeshBuilder::buildMesh(topology::Mesh* mesh,
   PYLITH_METHOD_END;
 } // buildMesh
 
+// ----------------------------------------------------------------------
+// Build distributed mesh topology and set vertex coordinates.
+void
+pylith::meshio::MeshBuilder::buildMeshParallel(topology::Mesh* mesh,
+					       scalar_array* coordinates,
+					       const int numVertices,
+					       int spaceDim,
+					       int_array* cells,
+					       const int numCells,
+					       const int numCorners,
+					       const int meshDim,
+					       int_array* vertexGlobalIds)
+{ // buildMeshParallel
+  PYLITH_METHOD_BEGIN;
+
+  assert(mesh);
+  assert(coordinates);
+  assert(cells);
+  assert(vertexGlobalIds);
+  assert(cells->size() == size_t(numCells*numCorners));
+  MPI_Comm comm  = mesh->comm();
+  PetscErrorCode err;
+
+  const PetscInt bound = numCells*numCorners;
+  for (PetscInt coff = 0; coff < bound; coff += numCorners) {
+    err = DMPlexInvertCell(meshDim, numCorners, (int *) &(*cells)[coff]);PYLITH_CHECK_ERROR(err);
+  } // for
+
+  PetscDM dmMesh = NULL;
+  PetscSF vertexSF = NULL;
+  const PetscBool pInterpolate = PETSC_TRUE; // Match buildMesh().
+  err = DMPlexCreateFromCellListParallel(comm, meshDim, numCells, numVertices, numCorners, pInterpolate,
+					 numCells > 0 ? &(*cells)[0] : NULL, spaceDim,
+					 numVertices > 0 ? &(*coordinates)[0] : NULL, &vertexSF, &dmMesh);PYLITH_CHECK_ERROR(err);
+  mesh->dmMesh(dmMesh);
+
+  // Leaves of the vertex SF are the local vertices and the roots are
+  // the vertices owned by each process in the global numbering.
+  PetscMPIInt commSize = 0;
+  err = MPI_Comm_size(comm, &commSize);PYLITH_CHECK_ERROR(err);
+  int_array vertexOffsets(commSize+1);
+  int numVerticesOwned = numVertices;
+  vertexOffsets[0] = 0;
+  err = MPI_Allgather(&numVerticesOwned, 1, MPI_INT, &vertexOffsets[1], 1, MPI_INT, comm);PYLITH_CHECK_ERROR(err);
+  for (int i = 1; i <= commSize; ++i) {
+    vertexOffsets[i] += vertexOffsets[i-1];
+  } // for
+
+  PetscInt numRoots = 0, numLeaves = 0;
+  const PetscInt* leaves = NULL;
+  const PetscSFNode* remotes = NULL;
+  err = PetscSFGetGraph(vertexSF, &numRoots, &numLeaves, &leaves, &remotes);PYLITH_CHECK_ERROR(err);
+  vertexGlobalIds->resize(numLeaves);
+  for (PetscInt i = 0; i < numLeaves; ++i) {
+    const PetscInt v = leaves ? leaves[i] : i;
+    assert(v >= 0 && v < numLeaves);
+    (*vertexGlobalIds)[v] = vertexOffsets[remotes[i].rank] + remotes[i].index;
+  } // for
+  err = PetscSFDestroy(&vertexSF);PYLITH_CHECK_ERROR(err);
+
+  PYLITH_METHOD_END;
+} // buildMeshParallel
+
 // End of file 
@@ -74,6 +74,36 @@ public :
 		 const int meshDim,
 		 const bool interpolate,
 		 const bool isParallel =false);
+
+  /** Build distributed mesh topology and set vertex coordinates.
+   *
+   * Each process supplies a disjoint subset of the cells and the
+   * coordinates of a contiguous block of vertices in the global
+   * numbering (block for process 0 comes first, etc). Cells
+   * reference vertices using zero based global indices. As in
+   * buildMesh(), the mesh is always interpolated.
+   *
+   * @param mesh PyLith finite-element mesh.
+   * @param coordinates Array of coordinates of vertices owned by this process.
+   * @param numVertices Number of vertices owned by this process.
+   * @param spaceDim Dimension of vector space for vertex coordinates.
+   * @param cells Array of global indices of vertices in local cells.
+   * @param numCells Number of local cells.
+   * @param numCorners Number of vertices per cell.
+   * @param meshDim Dimension of cells in mesh.
+   * @param vertexGlobalIds Global index of each local vertex in
+   *   mesh (local vertex i is point numCells+i) [output].
+   */
+  static
+  void buildMeshParallel(topology::Mesh* mesh,
+			 scalar_array* coordinates,
+			 const int numVertices,
+			 int spaceDim,
+			 int_array* cells,
+			 const int numCells,
+			 const int numCorners,
+			 const int meshDim,
+			 int_array* vertexGlobalIds);
 }; // MeshBuilder
 
 #endif // pylith_meshio_meshbuilder_hh
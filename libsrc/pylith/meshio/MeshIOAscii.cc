@@ -21,6 +21,7 @@
 #include "MeshIOAscii.hh" // implementation of class methods
 
 #include "MeshBuilder.hh" // USES MeshBuilder
+#include "MappedLineParser.hh" // USES MappedLineParser
 #include "pylith/topology/Mesh.hh" // USES Mesh
 
 #include "pylith/utils/array.hh" // USES scalar_array, int_array, string_vector
@@ -45,7 +46,8 @@ const char* pylith::meshio::MeshIOAscii::groupTypeNames[2] = {
 // Constructor
 pylith::meshio::MeshIOAscii::MeshIOAscii(void) :
   _filename(""),
-  _useIndexZero(true)
+  _useIndexZero(true),
+  _useFastParser(true)
 { // constructor
 } // constructor
 
@@ -76,6 +78,57 @@ pylith::meshio::MeshIOAscii::_read(void)
   PYLITH_METHOD_BEGIN;
 
   const int commRank = _mesh->commRank();
+  if (0 == commRank) {
+    if (_useFastParser) {
+      MappedLineParser parser("//");
+      if (!parser.open(_filename.c_str())) {
+	std::ostringstream msg;
+	msg << "Could not open mesh file '" << _filename
+	    << "' for reading.\n";
+	throw std::runtime_error(msg.str());
+      } // if
+      _parse(parser);
+      parser.close();
+    } else {
+      std::ifstream filein(_filename.c_str());
+      if (!filein.is_open() || !filein.good()) {
+	std::ostringstream msg;
+	msg << "Could not open mesh file '" << _filename
+	    << "' for reading.\n";
+	throw std::runtime_error(msg.str());
+      } // if
+
+      spatialdata::utils::LineParser parser(filein, "//");
+      parser.eatwhitespace(true);
+      _parse(parser);
+      filein.close();
+    } // if/else
+  } else {
+    int meshDim = 0;
+    int spaceDim = 0;
+    int numVertices = 0;
+    int numCells = 0;
+    int numCorners = 0;
+    scalar_array coordinates;
+    int_array cells;
+    int_array materialIds;
+
+    MeshBuilder::buildMesh(_mesh, &coordinates, numVertices, spaceDim, cells, numCells, numCorners, meshDim, _interpolate);
+    _setMaterials(materialIds);
+  } // if/else
+  _distributeGroups();
+
+  PYLITH_METHOD_END;
+} // read
+
+// ----------------------------------------------------------------------
+// Parse mesh file, build mesh, and set groups.
+template<typename parser_type>
+void
+pylith::meshio::MeshIOAscii::_parse(parser_type& parser)
+{ // _parse
+  PYLITH_METHOD_BEGIN;
+
   int meshDim = 0;
   int spaceDim = 0;
   int numVertices = 0;
@@ -85,110 +138,92 @@ pylith::meshio::MeshIOAscii::_read(void)
   int_array cells;
   int_array materialIds;
 
-  if (0 == commRank) {
-    std::ifstream filein(_filename.c_str());
-    if (!filein.is_open() || !filein.good()) {
-      std::ostringstream msg;
-      msg << "Could not open mesh file '" << _filename
-          << "' for reading.\n";
-      throw std::runtime_error(msg.str());
-    } // if
-
-    spatialdata::utils::LineParser parser(filein, "//");
-    parser.eatwhitespace(true);
-    
-    std::string token;
-    std::istringstream buffer;
-    const int maxIgnore = 1024;
+  std::string token;
+  std::istringstream buffer;
+  const int maxIgnore = 1024;
     
+  buffer.str(parser.next());
+  buffer >> token;
+  if (strcasecmp(token.c_str(), "mesh")) {
+    std::ostringstream msg;
+    msg << "Expected 'mesh' token but encountered '" << token << "'\n";
+    throw std::runtime_error(msg.str());
+  } // if
+
+  bool readDim = false;
+  bool readCells = false;
+  bool readVertices = false;
+  bool builtMesh = false;
+
+  try {
     buffer.str(parser.next());
+    buffer.clear();
     buffer >> token;
-    if (strcasecmp(token.c_str(), "mesh")) {
-      std::ostringstream msg;
-      msg << "Expected 'mesh' token but encountered '" << token << "'\n";
-      throw std::runtime_error(msg.str());
-    } // if
+    while (buffer.good() && token != "}") {
+      if (0 == strcasecmp(token.c_str(), "dimension")) {
+	buffer.ignore(maxIgnore, '=');
+	buffer >> meshDim;
+	readDim = true;
+      } else if (0 == strcasecmp(token.c_str(), "use-index-zero")) {
+	buffer.ignore(maxIgnore, '=');
+	std::string flag = "";
+	buffer >> flag;
+	if (0 == strcasecmp(flag.c_str(), "true"))
+	  _useIndexZero = true;
+	else
+	  _useIndexZero = false;
+      } else if (0 == strcasecmp(token.c_str(), "vertices")) {
+	_readVertices(parser, &coordinates, &numVertices, &spaceDim);
+	readVertices = true;
+      } else if (0 == strcasecmp(token.c_str(), "cells")) {
+	_readCells(parser, &cells, &materialIds, &numCells, &numCorners);
+	readCells = true;
+      } else if (0 == strcasecmp(token.c_str(), "group")) {
+	std::string name;
+	GroupPtType type;
+	int_array points;
+
+	if (!builtMesh)
+	  throw std::runtime_error("Both 'vertices' and 'cells' must "
+				   "precede any groups in mesh file.");
+	_readGroup(parser, &points, &type, &name);
+	_setGroup(name, type, points);
+      } else {
+	std::ostringstream msg;
+	msg << "Could not parse '" << token << "' into a mesh setting.";
+	throw std::runtime_error(msg.str());  
+      } // else
 
-    bool readDim = false;
-    bool readCells = false;
-    bool readVertices = false;
-    bool builtMesh = false;
+      if (readDim && readCells && readVertices && !builtMesh) {
+	// Can now build mesh
+	MeshBuilder::buildMesh(_mesh, &coordinates, numVertices, spaceDim,
+			       cells, numCells, numCorners, meshDim,
+			       _interpolate);
+	_setMaterials(materialIds);
+	builtMesh = true;
+      } // if
 
-    try {
       buffer.str(parser.next());
       buffer.clear();
       buffer >> token;
-      while (buffer.good() && token != "}") {
-	if (0 == strcasecmp(token.c_str(), "dimension")) {
-	  buffer.ignore(maxIgnore, '=');
-	  buffer >> meshDim;
-	  readDim = true;
-	} else if (0 == strcasecmp(token.c_str(), "use-index-zero")) {
-	  buffer.ignore(maxIgnore, '=');
-	  std::string flag = "";
-	  buffer >> flag;
-	  if (0 == strcasecmp(flag.c_str(), "true"))
-	    _useIndexZero = true;
-	  else
-	    _useIndexZero = false;
-	} else if (0 == strcasecmp(token.c_str(), "vertices")) {
-	  _readVertices(parser, &coordinates, &numVertices, &spaceDim);
-	  readVertices = true;
-	} else if (0 == strcasecmp(token.c_str(), "cells")) {
-	  _readCells(parser, &cells, &materialIds, &numCells, &numCorners);
-	  readCells = true;
-	} else if (0 == strcasecmp(token.c_str(), "group")) {
-	  std::string name;
-	  GroupPtType type;
-	  int_array points;
-
-	  if (!builtMesh)
-	    throw std::runtime_error("Both 'vertices' and 'cells' must "
-				     "precede any groups in mesh file.");
-	  _readGroup(parser, &points, &type, &name);
-	  _setGroup(name, type, points);
-	} else {
-	  std::ostringstream msg;
-	  msg << "Could not parse '" << token << "' into a mesh setting.";
-	  throw std::runtime_error(msg.str());  
-	} // else
-
-	if (readDim && readCells && readVertices && !builtMesh) {
-	  // Can now build mesh
-	  MeshBuilder::buildMesh(_mesh, &coordinates, numVertices, spaceDim,
-				 cells, numCells, numCorners, meshDim,
-				 _interpolate);
-	  _setMaterials(materialIds);
-	  builtMesh = true;
-	} // if
-
-	buffer.str(parser.next());
-	buffer.clear();
-	buffer >> token;
-      } // while
-      if (token != "}")
-	throw std::runtime_error("I/O error occurred while parsing mesh tokens.");
-    } catch (const std::exception& err) {
-      std::ostringstream msg;
-      msg << "Error occurred while reading PyLith mesh ASCII file '"
-	  << _filename << "'.\n"
-	  << err.what();
-      throw std::runtime_error(msg.str());
-    } catch (...) {
-      std::ostringstream msg;      
-      msg << "Unknown I/O error while reading PyLith mesh ASCII file '"
-	  << _filename << "'.\n";
-      throw std::runtime_error(msg.str());
-    } // catch
-    filein.close();
-  } else {
-    MeshBuilder::buildMesh(_mesh, &coordinates, numVertices, spaceDim, cells, numCells, numCorners, meshDim, _interpolate);
-    _setMaterials(materialIds);
-  } // if/else
-  _distributeGroups();
+    } // while
+    if (token != "}")
+      throw std::runtime_error("I/O error occurred while parsing mesh tokens.");
+  } catch (const std::exception& err) {
+    std::ostringstream msg;
+    msg << "Error occurred while reading PyLith mesh ASCII file '"
+	<< _filename << "'.\n"
+	<< err.what();
+    throw std::runtime_error(msg.str());
+  } catch (...) {
+    std::ostringstream msg;      
+    msg << "Unknown I/O error while reading PyLith mesh ASCII file '"
+	<< _filename << "'.\n";
+    throw std::runtime_error(msg.str());
+  } // catch
 
   PYLITH_METHOD_END;
-} // read
+} // _parse
 
 // ----------------------------------------------------------------------
 // Write mesh to file.
@@ -227,8 +262,9 @@ pylith::meshio::MeshIOAscii::_write(void) const
 
 // ----------------------------------------------------------------------
 // Read mesh vertices.
+template<typename parser_type>
 void
-pylith::meshio::MeshIOAscii::_readVertices(spatialdata::utils::LineParser& parser,
+pylith::meshio::MeshIOAscii::_readVertices(parser_type& parser,
 					   scalar_array* coordinates,
 					   int* numVertices, 
 					   int* numDims) const
@@ -260,14 +296,7 @@ pylith::meshio::MeshIOAscii::_readVertices(spatialdata::utils::LineParser& parse
 	throw std::runtime_error(msg);
       } // if
       coordinates->resize(size);
-      int label;
-      for (int iVertex=0, i=0; iVertex < *numVertices; ++iVertex) {
-	buffer.str(parser.next());
-	buffer.clear();
-	buffer >> label;
-	for (int iDim=0; iDim < *numDims; ++iDim)
-	  buffer >> (*coordinates)[i++];
-      } // for
+      _readCoordinates(parser, coordinates, *numVertices, *numDims);
       parser.ignore('}');
     } else {
       std::ostringstream msg;
@@ -320,8 +349,9 @@ pylith::meshio::MeshIOAscii::_writeVertices(std::ostream& fileout) const
   
 // ----------------------------------------------------------------------
 // Read mesh cells.
+template<typename parser_type>
 void
-pylith::meshio::MeshIOAscii::_readCells(spatialdata::utils::LineParser& parser,
+pylith::meshio::MeshIOAscii::_readCells(parser_type& parser,
 					int_array* cells,
 					int_array* materialIds,
 					int* numCells, 
@@ -355,14 +385,7 @@ pylith::meshio::MeshIOAscii::_readCells(spatialdata::utils::LineParser& parser,
 	throw std::runtime_error(msg);
       } // if
       cells->resize(size);
-      int label;
-      for (int iCell=0, i=0; iCell < *numCells; ++iCell) {
-	buffer.str(parser.next());
-	buffer.clear();
-	buffer >> label;
-	for (int iCorner=0; iCorner < *numCorners; ++iCorner)
-	  buffer >> (*cells)[i++];
-      } // for
+      _readCellValues(parser, cells, *numCells, *numCorners, "cells");
       if (!_useIndexZero) {
 	// if files begins with index 1, then decrement to index 0
 	// for compatibility with PETSc
@@ -378,13 +401,7 @@ pylith::meshio::MeshIOAscii::_readCells(spatialdata::utils::LineParser& parser,
       } // if
       const int size = *numCells;
       materialIds->resize(size);
-      int label = 0;
-      for (int iCell=0; iCell < *numCells; ++iCell) {
-	buffer.str(parser.next());
-	buffer.clear();
-	buffer >> label;
-	buffer >> (*materialIds)[iCell];
-      } // for
+      _readCellValues(parser, materialIds, *numCells, 1, "material-ids");
       parser.ignore('}');
     } else {
       std::ostringstream msg;
@@ -453,8 +470,9 @@ pylith::meshio::MeshIOAscii::_writeCells(std::ostream& fileout) const
 
 // ----------------------------------------------------------------------
 // Read mesh group.
+template<typename parser_type>
 void
-pylith::meshio::MeshIOAscii::_readGroup(spatialdata::utils::LineParser& parser,
+pylith::meshio::MeshIOAscii::_readGroup(parser_type& parser,
 					int_array* points,
 					GroupPtType* type,
 					std::string* name) const
@@ -502,17 +520,7 @@ pylith::meshio::MeshIOAscii::_readGroup(spatialdata::utils::LineParser& parser,
         throw std::runtime_error(msg.str());
       } // if
       points->resize(numPoints);
-      buffer.str(parser.next());
-      buffer.clear();
-      int i = 0;
-      while (buffer.good() && i < numPoints) {
-	buffer >> (*points)[i++];
-	buffer >> std::ws;
-	if (!buffer.good() && i < numPoints) {
-	  buffer.str(parser.next());
-	  buffer.clear();
-	} // if
-      } // while
+      _readIndices(parser, points);
       parser.ignore('}');
     } else {
       std::ostringstream msg;
@@ -565,5 +573,159 @@ pylith::meshio::MeshIOAscii::_writeGroup(std::ostream& fileout,
 
   PYLITH_METHOD_END;
 } // _writeGroup
+
+// ----------------------------------------------------------------------
+// Read lines with label and coordinates of vertices using istream.
+void
+pylith::meshio::MeshIOAscii::_readCoordinates(spatialdata::utils::LineParser& parser,
+					      scalar_array* coordinates,
+					      const int numVertices,
+					      const int spaceDim)
+{ // _readCoordinates
+  assert(coordinates);
+  assert(coordinates->size() == size_t(numVertices*spaceDim));
+
+  std::istringstream buffer;
+  int label;
+  for (int iVertex=0, i=0; iVertex < numVertices; ++iVertex) {
+    buffer.str(parser.next());
+    buffer.clear();
+    buffer >> label;
+    for (int iDim=0; iDim < spaceDim; ++iDim)
+      buffer >> (*coordinates)[i++];
+  } // for
+} // _readCoordinates
+
+// ----------------------------------------------------------------------
+// Read lines with label and coordinates of vertices from mapped file.
+void
+pylith::meshio::MeshIOAscii::_readCoordinates(MappedLineParser& parser,
+					      scalar_array* coordinates,
+					      const int numVertices,
+					      const int spaceDim)
+{ // _readCoordinates
+  assert(coordinates);
+  assert(coordinates->size() == size_t(numVertices*spaceDim));
+
+  PylithScalar* coordsArray = &(*coordinates)[0];
+  long label = 0;
+  double value = 0.0;
+  for (int iVertex=0, i=0; iVertex < numVertices; ++iVertex) {
+    bool ok = parser.nextLine() && parser.readInt(&label);
+    for (int iDim=0; ok && iDim < spaceDim; ++iDim) {
+      ok = parser.readDouble(&value);
+      coordsArray[i++] = value;
+    } // for
+    if (!ok) {
+      std::ostringstream msg;
+      msg << "Could not parse coordinates of vertex " << iVertex
+	  << " on line " << parser.lineNumber() << ".";
+      throw std::runtime_error(msg.str());
+    } // if
+  } // for
+} // _readCoordinates
+
+// ----------------------------------------------------------------------
+// Read lines with label and values for cells using istream.
+void
+pylith::meshio::MeshIOAscii::_readCellValues(spatialdata::utils::LineParser& parser,
+					     int_array* values,
+					     const int numCells,
+					     const int numValues,
+					     const char* description)
+{ // _readCellValues
+  assert(values);
+  assert(values->size() == size_t(numCells*numValues));
+
+  std::istringstream buffer;
+  int label;
+  for (int iCell=0, i=0; iCell < numCells; ++iCell) {
+    buffer.str(parser.next());
+    buffer.clear();
+    buffer >> label;
+    for (int iValue=0; iValue < numValues; ++iValue)
+      buffer >> (*values)[i++];
+  } // for
+} // _readCellValues
+
+// ----------------------------------------------------------------------
+// Read lines with label and values for cells from mapped file.
+void
+pylith::meshio::MeshIOAscii::_readCellValues(MappedLineParser& parser,
+					     int_array* values,
+					     const int numCells,
+					     const int numValues,
+					     const char* description)
+{ // _readCellValues
+  assert(values);
+  assert(values->size() == size_t(numCells*numValues));
+
+  PylithInt* valuesArray = &(*values)[0];
+  long label = 0;
+  long value = 0;
+  for (int iCell=0, i=0; iCell < numCells; ++iCell) {
+    bool ok = parser.nextLine() && parser.readInt(&label);
+    for (int iValue=0; ok && iValue < numValues; ++iValue) {
+      ok = parser.readInt(&value);
+      valuesArray[i++] = value;
+    } // for
+    if (!ok) {
+      std::ostringstream msg;
+      msg << "Could not parse " << description << " of cell " << iCell
+	  << " on line " << parser.lineNumber() << ".";
+      throw std::runtime_error(msg.str());
+    } // if
+  } // for
+} // _readCellValues
+
+// ----------------------------------------------------------------------
+// Read list of indices using istream.
+void
+pylith::meshio::MeshIOAscii::_readIndices(spatialdata::utils::LineParser& parser,
+					  int_array* indices)
+{ // _readIndices
+  assert(indices);
+
+  const int numIndices = indices->size();
+  std::istringstream buffer;
+  buffer.str(parser.next());
+  buffer.clear();
+  int i = 0;
+  while (buffer.good() && i < numIndices) {
+    buffer >> (*indices)[i++];
+    buffer >> std::ws;
+    if (!buffer.good() && i < numIndices) {
+      buffer.str(parser.next());
+      buffer.clear();
+    } // if
+  } // while
+} // _readIndices
+
+// ----------------------------------------------------------------------
+// Read list of indices from mapped file.
+void
+pylith::meshio::MeshIOAscii::_readIndices(MappedLineParser& parser,
+					  int_array* indices)
+{ // _readIndices
+  assert(indices);
+
+  const int numIndices = indices->size();
+  long value = 0;
+  for (int i=0; i < numIndices; ++i) {
+    if (parser.endOfLine() && !parser.nextLine()) {
+      std::ostringstream msg;
+      msg << "Expected " << numIndices << " indices but found only " << i
+	  << " before end of file.";
+      throw std::runtime_error(msg.str());
+    } // if
+    if (!parser.readInt(&value)) {
+      std::ostringstream msg;
+      msg << "Could not parse index " << i << " on line "
+	  << parser.lineNumber() << ".";
+      throw std::runtime_error(msg.str());
+    } // if
+    (*indices)[i] = value;
+  } // for
+} // _readIndices
   
 // End of file 
@@ -63,6 +63,22 @@ public :
    */
   const char* filename(void) const;
 
+  /** Set flag for using fast parser when reading mesh.
+   *
+   * The fast parser memory-maps the file and parses numbers directly
+   * from the mapped file into the mesh arrays. Otherwise each line is
+   * parsed using std::istream extraction.
+   *
+   * @param flag True to use fast parser, false otherwise.
+   */
+  void useFastParser(const bool flag);
+
+  /** Get flag for using fast parser when reading mesh.
+   *
+   * @returns True if using fast parser, false otherwise.
+   */
+  bool useFastParser(void) const;
+
 // PROTECTED METHODS ////////////////////////////////////////////////////
 protected :
 
@@ -75,6 +91,13 @@ protected :
 // PRIVATE METHODS //////////////////////////////////////////////////////
 private :
 
+  /** Parse mesh file, build mesh, and set groups.
+   *
+   * @param parser Input parser.
+   */
+  template<typename parser_type>
+  void _parse(parser_type& parser);
+
   /** Read mesh vertices.
    *
    * @param parser Input parser.
@@ -82,7 +105,8 @@ private :
    * @param numVertices Pointer to number of vertices
    * @param spaceDim Pointer to dimension of coordinates vector space
    */
-  void _readVertices(spatialdata::utils::LineParser& parser,
+  template<typename parser_type>
+  void _readVertices(parser_type& parser,
 		     scalar_array* coordinates,
 		     int* numVertices,
 		     int* spaceDim) const;
@@ -101,7 +125,8 @@ private :
    * @param pNumCells Pointer to number of cells
    * @param pNumCorners Pointer to number of corners
    */
-  void _readCells(spatialdata::utils::LineParser& parser,
+  template<typename parser_type>
+  void _readCells(parser_type& parser,
 		  int_array* pCells,
 		  int_array* pMaterialIds,
 		  int* numCells,
@@ -121,7 +146,8 @@ private :
    * @param parser Input parser.
    * @param mesh The mesh
    */
-  void _readGroup(spatialdata::utils::LineParser& parser,
+  template<typename parser_type>
+  void _readGroup(parser_type& parser,
 		  int_array* points,
                   GroupPtType* type,
                   std::string* name) const;
@@ -134,11 +160,86 @@ private :
   void _writeGroup(std::ostream& fileout,
 		   const char* name) const;
 
+  /** Read lines with label and coordinates of vertices.
+   *
+   * @param parser Input parser.
+   * @param coordinates Array of vertex coordinates (preallocated).
+   * @param numVertices Number of vertices.
+   * @param spaceDim Dimension of coordinates vector space.
+   */
+  static
+  void _readCoordinates(spatialdata::utils::LineParser& parser,
+			scalar_array* coordinates,
+			const int numVertices,
+			const int spaceDim);
+
+  /** Read lines with label and coordinates of vertices.
+   *
+   * @param parser Input parser.
+   * @param coordinates Array of vertex coordinates (preallocated).
+   * @param numVertices Number of vertices.
+   * @param spaceDim Dimension of coordinates vector space.
+   */
+  static
+  void _readCoordinates(MappedLineParser& parser,
+			scalar_array* coordinates,
+			const int numVertices,
+			const int spaceDim);
+
+  /** Read lines with label and values for cells.
+   *
+   * @param parser Input parser.
+   * @param values Array of values (preallocated).
+   * @param numCells Number of cells.
+   * @param numValues Number of values per cell.
+   * @param description Description of values for error messages.
+   */
+  static
+  void _readCellValues(spatialdata::utils::LineParser& parser,
+		       int_array* values,
+		       const int numCells,
+		       const int numValues,
+		       const char* description);
+
+  /** Read lines with label and values for cells.
+   *
+   * @param parser Input parser.
+   * @param values Array of values (preallocated).
+   * @param numCells Number of cells.
+   * @param numValues Number of values per cell.
+   * @param description Description of values for error messages.
+   */
+  static
+  void _readCellValues(MappedLineParser& parser,
+		       int_array* values,
+		       const int numCells,
+		       const int numValues,
+		       const char* description);
+
+  /** Read list of indices that may span multiple lines.
+   *
+   * @param parser Input parser.
+   * @param indices Array of indices (preallocated).
+   */
+  static
+  void _readIndices(spatialdata::utils::LineParser& parser,
+		    int_array* indices);
+
+  /** Read list of indices that may span multiple lines.
+   *
+   * @param parser Input parser.
+   * @param indices Array of indices (preallocated).
+   */
+  static
+  void _readIndices(MappedLineParser& parser,
+		    int_array* indices);
+
 // PRIVATE MEMBERS //////////////////////////////////////////////////////
 private :
 
   std::string _filename; ///< Name of file
   bool _useIndexZero; ///< Flag indicating if indicates start at 0 (T) or 1 (F)
+  bool _useFastParser; ///< Use memory-mapped parser when reading mesh.
 
   static
   const char *groupTypeNames[]; ///< Types of mesh groups.
@@ -28,15 +28,19 @@
 #include "petsc.h" // USES MPI_Comm
 #include "journal/info.h" // USES journal::info_t
 
+#include <algorithm> // USES std::min(), std::max(), std::lower_bound()
 #include <cassert> // USES assert()
 #include <stdexcept> // USES std::runtime_error
 #include <sstream> // USES std::ostringstream
+#include <vector> // USES std::vector
+#include <utility> // USES std::pair
 
 // ----------------------------------------------------------------------
 // Constructor
 pylith::meshio::MeshIOCubit::MeshIOCubit(void) :
   _filename(""),
-  _useNodesetNames(true)
+  _useNodesetNames(true),
+  _useParallelRead(false)
 { // constructor
 } // constructor
 
@@ -68,6 +72,11 @@ pylith::meshio::MeshIOCubit::_read(void)
 
   assert(_mesh);
 
+  if (_useParallelRead) {
+    _readParallel();
+    PYLITH_METHOD_END;
+  } // if
+
   const int commRank = _mesh->commRank();
   int meshDim = 0;
   int spaceDim = 0;
@@ -328,6 +337,284 @@ pylith::meshio::MeshIOCubit::_readGroups(ExodusII& exofile)
   PYLITH_METHOD_END;
 } // _readGroups
 
+// ----------------------------------------------------------------------
+// Read mesh with each process reading its own portion.
+void
+pylith::meshio::MeshIOCubit::_readParallel(void)
+{ // _readParallel
+  PYLITH_METHOD_BEGIN;
+
+  assert(_mesh);
+
+  journal::info_t info("meshiocubit");
+
+  const int commRank = _mesh->commRank();
+  int commSize = 0;
+  PetscErrorCode err = MPI_Comm_size(_mesh->comm(), &commSize);PYLITH_CHECK_ERROR(err);
+
+  try {
+    ExodusII exofile(_filename.c_str());
+
+    const int meshDim = exofile.getDim("num_dim");
+    const int spaceDim = meshDim;
+    const int numVerticesGlobal = exofile.getDim("num_nodes");
+    const int numCellsGlobal = exofile.getDim("num_elem");
+
+    if (0 == commRank) {
+      info << journal::at(__HERE__)
+	   << "Reading " << numVerticesGlobal << " vertices and " << numCellsGlobal
+	   << " cells on " << commSize << " processes." << journal::endl;
+    } // if
+
+    // Each process reads a contiguous block of cells and a contiguous
+    // block of vertices. The partitioner redistributes the cells later.
+    const int cellStart = commRank*(numCellsGlobal/commSize) + std::min(commRank, numCellsGlobal % commSize);
+    const int cellEnd = cellStart + numCellsGlobal/commSize + ((commRank < numCellsGlobal % commSize) ? 1 : 0);
+    const int vertexStart = commRank*(numVerticesGlobal/commSize) + std::min(commRank, numVerticesGlobal % commSize);
+    const int vertexEnd = vertexStart + numVerticesGlobal/commSize + ((commRank < numVerticesGlobal % commSize) ? 1 : 0);
+
+    scalar_array coordinates;
+    _readVerticesSlab(exofile, &coordinates, vertexStart, vertexEnd, spaceDim);
+
+    int_array cells;
+    int_array materialIds;
+    int numCorners = 0;
+    const int numCells = cellEnd - cellStart;
+    _readCellsSlab(exofile, &cells, &materialIds, &numCorners, cellStart, cellEnd);
+    _orientCells(&cells, numCells, numCorners, meshDim);
+
+    int_array vertexGlobalIds;
+    MeshBuilder::buildMeshParallel(_mesh, &coordinates, vertexEnd-vertexStart, spaceDim,
+				   &cells, numCells, numCorners, meshDim, &vertexGlobalIds);
+
+    // Local cells are points [0, numCells) in the same order as read.
+    PetscDM dmMesh = _mesh->dmMesh();assert(dmMesh);
+    DMLabel materialsLabel = NULL;
+    err = DMCreateLabel(dmMesh, "material-id");PYLITH_CHECK_ERROR(err);
+    err = DMGetLabel(dmMesh, "material-id", &materialsLabel);PYLITH_CHECK_ERROR(err);
+    for (int c = 0; c < numCells; ++c) {
+      err = DMLabelSetValue(materialsLabel, c, materialIds[c]);PYLITH_CHECK_ERROR(err);
+    } // for
+
+    _readGroupsLocal(exofile, vertexGlobalIds);
+  } catch (std::exception& err) {
+    std::ostringstream msg;
+    msg << "Error while reading Cubit Exodus file '" << _filename << "'.\n"
+	<< err.what();
+    throw std::runtime_error(msg.str());
+  } catch (...) {
+    std::ostringstream msg;
+    msg << "Unknown error while reading Cubit Exodus file '" << _filename << "'.";
+    throw std::runtime_error(msg.str());
+  } // try/catch
+
+  PYLITH_METHOD_END;
+} // _readParallel
+
+// ----------------------------------------------------------------------
+// Read coordinates of block of vertices.
+void
+pylith::meshio::MeshIOCubit::_readVerticesSlab(ExodusII& exofile,
+					       scalar_array* coordinates,
+					       const int vertexStart,
+					       const int vertexEnd,
+					       const int spaceDim) const
+{ // _readVerticesSlab
+  PYLITH_METHOD_BEGIN;
+
+  assert(coordinates);
+  assert(vertexEnd >= vertexStart);
+
+  const int numVertices = vertexEnd - vertexStart;
+  coordinates->resize(numVertices*spaceDim);
+  if (!numVertices) {
+    PYLITH_METHOD_END;
+  } // if
+
+  scalar_array buffer(numVertices);
+  const bool hasCoord = exofile.hasVar("coord", NULL);
+  const char* coordNames[3] = { "coordx", "coordy", "coordz" };
+  for (int iDim=0; iDim < spaceDim; ++iDim) {
+    if (hasCoord) {
+      const int ndims = 2;
+      const int start[2] = { iDim, vertexStart };
+      const int count[2] = { 1, numVertices };
+      exofile.getVar(&buffer[0], start, count, ndims, "coord");
+    } else {
+      const int ndims = 1;
+      const int start[1] = { vertexStart };
+      const int count[1] = { numVertices };
+      exofile.getVar(&buffer[0], start, count, ndims, coordNames[iDim]);
+    } // if/else
+
+    for (int iVertex=0; iVertex < numVertices; ++iVertex)
+      (*coordinates)[iVertex*spaceDim+iDim] = buffer[iVertex];
+  } // for
+
+  PYLITH_METHOD_END;
+} // _readVerticesSlab
+
+// ----------------------------------------------------------------------
+// Read block of cells, which may span several element blocks.
+void
+pylith::meshio::MeshIOCubit::_readCellsSlab(ExodusII& exofile,
+					    int_array* cells,
+					    int_array* materialIds,
+					    int* numCorners,
+					    const int cellStart,
+					    const int cellEnd) const
+{ // _readCellsSlab
+  PYLITH_METHOD_BEGIN;
+
+  assert(cells);
+  assert(materialIds);
+  assert(numCorners);
+  assert(cellEnd >= cellStart);
+
+  const int numMaterials = exofile.getDim("num_el_blk");
+  const int numCells = cellEnd - cellStart;
+
+  int_array blockIds(numMaterials);
+  int ndims = 1;
+  int dims[2];
+  dims[0] = numMaterials;
+  dims[1] = 0;
+  exofile.getVar(&blockIds[0], dims, ndims, "eb_prop1");
+
+  // Check number of corners in all blocks, so that processes without
+  // any cells get the same value.
+  materialIds->resize(numCells);
+  *numCorners = 0;
+  for (int iMaterial=0, blockOffset=0; iMaterial < numMaterials; ++iMaterial) {
+    std::ostringstream varname;
+    varname << "num_nod_per_el" << iMaterial+1;
+    if (0 == *numCorners) {
+      *numCorners = exofile.getDim(varname.str().c_str());
+      cells->resize(numCells * (*numCorners));
+    } else if (exofile.getDim(varname.str().c_str()) != *numCorners) {
+      std::ostringstream msg;
+      msg << "All materials must have the same number of vertices per cell.\n"
+	  << "Expected " << *numCorners << " vertices per cell, but block "
+	  << blockIds[iMaterial] << " has " 
+	  << exofile.getDim(varname.str().c_str())
+	  << " vertices.";
+      throw std::runtime_error(msg.str());
+    } // if
+
+    varname.str("");
+    varname << "num_el_in_blk" << iMaterial+1;
+    const int blockSize = exofile.getDim(varname.str().c_str());
+
+    // Portion of element block in [cellStart, cellEnd).
+    const int readStart = std::max(cellStart, blockOffset);
+    const int readEnd = std::min(cellEnd, blockOffset+blockSize);
+    if (readStart < readEnd) {
+      varname.str("");
+      varname << "connect" << iMaterial+1;
+      ndims = 2;
+      const int start[2] = { readStart-blockOffset, 0 };
+      const int count[2] = { readEnd-readStart, *numCorners };
+      exofile.getVar(&(*cells)[(readStart-cellStart)*(*numCorners)], start, count, ndims,
+		     varname.str().c_str());
+
+      for (int i=readStart; i < readEnd; ++i)
+	(*materialIds)[i-cellStart] = blockIds[iMaterial];
+    } // if
+
+    blockOffset += blockSize;
+  } // for
+
+  *cells -= 1; // use zero index
+
+  PYLITH_METHOD_END;
+} // _readCellsSlab
+
+// ----------------------------------------------------------------------
+// Read point groups and keep vertices in local mesh.
+void
+pylith::meshio::MeshIOCubit::_readGroupsLocal(ExodusII& exofile,
+					      const int_array& vertexGlobalIds)
+{ // _readGroupsLocal
+  PYLITH_METHOD_BEGIN;
+
+  journal::info_t info("meshiocubit");
+
+  const int numGroups = exofile.getDim("num_node_sets");
+
+  if (0 == _mesh->commRank()) {
+    info << journal::at(__HERE__)
+	 << "Found " << numGroups << " node sets." << journal::endl;
+  } // if
+
+  int_array ids(numGroups);
+  int ndims = 1;
+  int dims[2];
+  dims[0] = numGroups;
+  dims[1] = 0;
+  exofile.getVar(&ids[0], dims, ndims, "ns_prop1");
+      
+  string_vector groupNames(numGroups);
+
+  if (_useNodesetNames) {
+    exofile.getVar(&groupNames, numGroups, "ns_names");
+  } // if
+
+  // Sorted global indices of local vertices for lookup.
+  const int numVerticesLocal = vertexGlobalIds.size();
+  std::vector<std::pair<int,int> > globalToLocal(numVerticesLocal);
+  for (int iVertex=0; iVertex < numVerticesLocal; ++iVertex) {
+    globalToLocal[iVertex] = std::make_pair(int(vertexGlobalIds[iVertex]), iVertex);
+  } // for
+  std::sort(globalToLocal.begin(), globalToLocal.end());
+
+  for (int iGroup=0; iGroup < numGroups; ++iGroup) {
+	
+    std::ostringstream varname;
+    varname << "num_nod_ns" << iGroup+1;
+    const int nodesetSize = exofile.getDim(varname.str().c_str());
+    int_array points(nodesetSize);
+
+    varname.str("");
+    varname << "node_ns" << iGroup+1;
+    ndims = 1;
+    dims[0] = nodesetSize;
+
+    if (0 == _mesh->commRank()) {
+      info << journal::at(__HERE__)
+	   << "Reading node set '" << groupNames[iGroup] << "' with id "
+	   << ids[iGroup] << " containing " << nodesetSize << " nodes."
+	   << journal::endl;
+    } // if
+    exofile.getVar(&points[0], dims, ndims, varname.str().c_str());
+
+    // Keep only vertices in local mesh, converting to local indices.
+    std::vector<int> localPoints;
+    for (int i=0; i < nodesetSize; ++i) {
+      const std::pair<int,int> key(points[i]-1, -1); // use zero index
+      const std::vector<std::pair<int,int> >::const_iterator iter = std::lower_bound(globalToLocal.begin(), globalToLocal.end(), key);
+      if (iter != globalToLocal.end() && iter->first == key.first) {
+	localPoints.push_back(iter->second);
+      } // if
+    } // for
+    std::sort(localPoints.begin(), localPoints.end());
+    int_array groupPoints(localPoints.size());
+    for (size_t i=0; i < localPoints.size(); ++i) {
+      groupPoints[i] = localPoints[i];
+    } // for
+
+    GroupPtType type = VERTEX;
+    if (_useNodesetNames)
+      _setGroup(groupNames[iGroup], type, groupPoints);
+    else {
+      std::ostringstream name;
+      name << ids[iGroup];
+      _setGroup(name.str().c_str(), type, groupPoints);
+    } // if/else
+  } // for  
+
+  PYLITH_METHOD_END;
+} // _readGroupsLocal
+
 // ----------------------------------------------------------------------
 // Write mesh dimensions.
 void
@@ -65,6 +65,17 @@ public :
    */
   void useNodesetNames(const bool flag);
 
+  /** Set flag on whether each process reads its own portion of the mesh.
+   *
+   * If true, each process reads a contiguous block of cells and
+   * vertices from the file and the resulting mesh is distributed
+   * (but not partitioned). If false, process 0 reads the entire
+   * mesh.
+   *
+   * @param flag True to read mesh in parallel.
+   */
+  void useParallelRead(const bool flag);
+
 // PROTECTED METHODS ////////////////////////////////////////////////////
 protected :
 
@@ -108,6 +119,47 @@ private :
    * @param ncfile Cubit Exodus file.
    */
   void _readGroups(ExodusII& filein);
+
+  /// Read mesh with each process reading its own portion.
+  void _readParallel(void);
+
+  /** Read coordinates of block of vertices.
+   *
+   * @param ncfile Cubit Exodus file.
+   * @param coordinates Array of vertex coordinates [output].
+   * @param vertexStart Global index of first vertex in block.
+   * @param vertexEnd Global index of vertex after last vertex in block.
+   * @param spaceDim Dimension of coordinates vector space.
+   */
+  void _readVerticesSlab(ExodusII& filein,
+			 scalar_array* coordinates,
+			 const int vertexStart,
+			 const int vertexEnd,
+			 const int spaceDim) const;
+
+  /** Read block of cells, which may span several element blocks.
+   *
+   * @param ncfile Cubit Exodus file.
+   * @param cells Array of indices of cell vertices [output].
+   * @param materialIds Array of material identifiers [output].
+   * @param numCorners Number of corners [output].
+   * @param cellStart Global index of first cell in block.
+   * @param cellEnd Global index of cell after last cell in block.
+   */
+  void _readCellsSlab(ExodusII& filein,
+		      int_array* cells,
+		      int_array* materialIds,
+		      int* numCorners,
+		      const int cellStart,
+		      const int cellEnd) const;
+
+  /** Read point groups and keep vertices in local mesh.
+   *
+   * @param ncfile Cubit Exodus file.
+   * @param vertexGlobalIds Global index of each local vertex.
+   */
+  void _readGroupsLocal(ExodusII& filein,
+			const int_array& vertexGlobalIds);
   
   /** Write mesh dimensions.
    *
@@ -145,6 +197,7 @@ private :
 
   std::string _filename; ///< Name of file
   bool _useNodesetNames; ///< True to use node set names instead of ids.
+  bool _useParallelRead; ///< True if each process reads its own portion of the mesh.
 
 }; // MeshIOCubit
 
@@ -35,6 +35,7 @@ namespace pylith {
     class MeshIO;
     class MeshBuilder;
     class MeshIOAscii;
+    class MappedLineParser;
     class MeshIOCubit;
     class MeshIOLagrit;
 
@@ -49,6 +50,7 @@ namespace pylith {
     class OutputManager;
     class DataWriter;
     class DataWriterVTK;
+    class DataWriterVTU;
     class DataWriterHDF5;
     class DataWriterHDF5Ext;
     class CellFilter;
@@ -40,7 +40,9 @@ pylith::problems::Formulation::Formulation(void) :
   _jacobianLumped(0),
   _fields(0),
   _isJacobianSymmetric(false),
-  _splitFields(false)
+  _splitFields(false),
+  _storeResidualState(false),
+  _residualSolnVec(0)
 { // constructor
 } // constructor
 
@@ -62,8 +64,9 @@ pylith::problems::Formulation::deallocate(void)
   _jacobianLumped = 0; // :TODO: Use shared pointer.
   _fields = 0; // :TODO: Use shared pointer.
 
+  PetscErrorCode err = VecDestroy(&_residualSolnVec);PYLITH_CHECK_ERROR(err);
+
 #if 0   // :KLUDGE: Assume Solver deallocates matrix.
-  PetscErrorCode err = 0;
   if (_customConstraintPCMat) {
     err = PetscObjectDereference((PetscObject) _customConstraintPCMat);PYLITH_CHECK_ERROR(err);
     _customConstraintPCMat = 0;
@@ -107,6 +110,19 @@ pylith::problems::Formulation::useCustomConstraintPC(void) const
   return _useCustomConstraintPC;
 } // useCustomConstraintPC
 
+// ----------------------------------------------------------------------
+// Set flag for integrators storing quantities from residual evaluation.
+void
+pylith::problems::Formulation::storeResidualState(const bool flag)
+{ // storeResidualState
+  _storeResidualState = flag;
+
+  const int numIntegrators = _integrators.size();
+  for (int i=0; i < numIntegrators; ++i) {
+    _integrators[i]->storeResidualState(flag);
+  } // for
+} // storeResidualState
+
 // ----------------------------------------------------------------------
 // Return the fields
 const pylith::topology::SolutionFields&
@@ -115,6 +131,15 @@ pylith::problems::Formulation::fields(void) const
   return *this->_fields;
 } // fields
 
+// ----------------------------------------------------------------------
+// Return the fields
+pylith::topology::SolutionFields&
+pylith::problems::Formulation::fields(void)
+{ // fields
+  assert(_fields);
+  return *this->_fields;
+} // fields
+
 // ----------------------------------------------------------------------
 // Get flag indicating whether we need to compute velocity at time t.
 bool
@@ -197,29 +222,55 @@ pylith::problems::Formulation::reformResidual(const PetscVec* tmpResidualVec,
 
   assert(_fields);
 
-  // Update section view of field.
+  // Update section view of field, setting residual to zero while
+  // values are communicated.
+  topology::Field& residual = _fields->get("residual");
   if (tmpSolutionVec) {
     topology::Field& solution = _fields->solution();
-    solution.scatterGlobalToLocal(*tmpSolutionVec);
+    solution.scatterGlobalToLocalBegin(*tmpSolutionVec);
+    residual.zeroAll();
+    solution.scatterGlobalToLocalEnd(*tmpSolutionVec);
+  } else {
+    residual.zeroAll();
+  } // if/else
+
+  // Remember solution used to compute residual.
+  if (_storeResidualState) {
+    const PetscVec solutionVec = _fields->solution().localVector();
+    PetscErrorCode err = 0;
+    if (!_residualSolnVec) {
+      err = VecDuplicate(solutionVec, &_residualSolnVec);PYLITH_CHECK_ERROR(err);
+    } // if
+    err = VecCopy(solutionVec, _residualSolnVec);PYLITH_CHECK_ERROR(err);
   } // if
 
   // Update rate fields (must be consistent with current solution).
   calcRateFields();  
 
-  // Set residual to zero.
-  topology::Field& residual = _fields->get("residual");
-  residual.zeroAll();
-
-  // Add in contributions that require assembly.
+  // Add in contributions that require assembly. Integrators add
+  // contributions from cells with points owned by other processors
+  // first, so that the remaining cells are integrated while the
+  // contributions at those points are communicated.
   const int numIntegrators = _integrators.size();
   assert(numIntegrators > 0); // must have at least 1 integrator
   for (int i=0; i < numIntegrators; ++i) {
     _integrators[i]->timeStep(_dt);
+    if (_integrators[i]->splitsCells()) {
+      _integrators[i]->cellSubset(feassemble::Integrator::BOUNDARY_CELLS);
+    } // if
     _integrators[i]->integrateResidual(residual, _t, _fields);
   } // for
 
   // Assemble residual.
-  residual.complete();
+  residual.completeBegin();
+  for (int i=0; i < numIntegrators; ++i) {
+    if (_integrators[i]->splitsCells()) {
+      _integrators[i]->cellSubset(feassemble::Integrator::INTERIOR_CELLS);
+      _integrators[i]->integrateResidual(residual, _t, _fields);
+      _integrators[i]->cellSubset(feassemble::Integrator::ALL_CELLS);
+    } // if
+  } // for
+  residual.completeEnd();
 
   // Update PETSc view of residual
   if (tmpResidualVec)
@@ -234,6 +285,28 @@ pylith::problems::Formulation::reformResidual(const PetscVec* tmpResidualVec,
   PYLITH_METHOD_END;
 } // reformResidual
 
+// ----------------------------------------------------------------------
+// Check whether most recent residual evaluation used current solution.
+void
+pylith::problems::Formulation::checkResidualState(void)
+{ // checkResidualState
+  PYLITH_METHOD_BEGIN;
+
+  assert(_fields);
+
+  PetscBool atSolution = PETSC_FALSE;
+  if (_storeResidualState && _residualSolnVec) {
+    PetscErrorCode err = VecEqual(_fields->solution().localVector(), _residualSolnVec, &atSolution);PYLITH_CHECK_ERROR(err);
+  } // if
+
+  const int numIntegrators = _integrators.size();
+  for (int i=0; i < numIntegrators; ++i) {
+    _integrators[i]->residualAtSolution(atSolution);
+  } // for
+
+  PYLITH_METHOD_END;
+} // checkResidualState
+
 // ----------------------------------------------------------------------
 // Reform system Jacobian.
 void
@@ -42,6 +42,7 @@
 class pylith::problems::Formulation
 { // Formulation
   friend class TestFormulation; // unit testing
+  friend class TimeStepper; // USES integrators
 
 // PUBLIC MEMBERS ///////////////////////////////////////////////////////
 public :
@@ -79,12 +80,25 @@ public :
    */
   bool useCustomConstraintPC(void) const;
 
+  /** Set flag for integrators storing quantities computed during
+   * residual evaluation for reuse when updating state variables.
+   *
+   * @param flag True to store quantities, false otherwise.
+   */
+  void storeResidualState(const bool flag);
+
   /** Get solution fields.
    *
    * @returns solution fields.
    */
   const topology::SolutionFields& fields(void) const;
 
+  /** Get solution fields.
+   *
+   * @returns solution fields.
+   */
+  topology::SolutionFields& fields(void);
+
   /** Get flag indicating whether Jacobian is symmetric.
    *
    * @returns True if Jacobian is symmetric, otherwise false.
@@ -138,6 +152,13 @@ public :
    */
   void reformResidual(const PetscVec* tmpResidualVec =0,
 		      const PetscVec* tmpSolutionVec =0);
+
+  /** Check whether the most recent residual evaluation used the
+   * current solution and notify the integrators, so they can reuse
+   * quantities from the residual evaluation when updating state
+   * variables.
+   */
+  void checkResidualState(void);
   
   /* Reform system Jacobian.
    *
@@ -187,6 +208,9 @@ protected :
 
   bool _useCustomConstraintPC; ///< True if using custom preconditioner for Lagrange constraints.
 
+  bool _storeResidualState; ///< True if integrators store quantities from residual evaluation.
+  PetscVec _residualSolnVec; ///< Local solution vector used in most recent residual evaluation.
+
 // NOT IMPLEMENTED //////////////////////////////////////////////////////
 private :
 
@@ -26,13 +26,18 @@
 #include "pylith/topology/Field.hh" // USES Field
 #include "pylith/topology/SolutionFields.hh" // USES SolutionFields
 #include "pylith/topology/Jacobian.hh" // USES Jacobian
+#include "pylith/topology/RefineInterpolator.hh" // USES RefineInterpolator
 
+#include "pylith/utils/array.hh" // USES scalar_array
 #include "pylith/utils/EventLogger.hh" // USES EventLogger
 #include "pylith/utils/error.h" // USES PYLITH_CHECK_ERROR
 
 #include "spatialdata/geocoords/CoordSys.hh" // USES CoordSys
 
+#include <algorithm> // USES std::min()
 #include <cassert> // USES assert()
+#include <cmath> // USES sqrt()
+#include <stdexcept> // USES std::logic_error
 
 
 // ----------------------------------------------------------------------
@@ -73,7 +78,12 @@ pylith::problems::Solver::Solver(void) :
     _logger(0),
     _jacobianPC(0),
     _jacobianPCFault(0),
-    _skipNullSpaceCreation(false)
+    _skipNullSpaceCreation(false),
+    _useGeometricMultigrid(false),
+    _interpolator(0),
+    _initialGuessType(INITIAL_GUESS_ZERO),
+    _initialGuessNumVectors(3),
+    _initialGuessReduction(-1.0)
 { // constructor
 } // constructor
 
@@ -93,11 +103,18 @@ pylith::problems::Solver::deallocate(void)
 
     _formulation = 0; // Handle only, do not manage memory.
     delete _logger; _logger = 0;
+    delete _interpolator; _interpolator = 0;
 
     PetscErrorCode err = 0;
     err = MatDestroy(&_jacobianPC); PYLITH_CHECK_ERROR(err);
     err = MatDestroy(&_jacobianPCFault); PYLITH_CHECK_ERROR(err);
 
+    const size_t numWork = _initialGuessWork.size();
+    for (size_t i = 0; i < numWork; ++i) {
+        err = VecDestroy(&_initialGuessWork[i]); PYLITH_CHECK_ERROR(err);
+    } // for
+    _initialGuessWork.clear();
+
     _ctx.pc = 0; // KSP PC (managed separately)
     _ctx.A = 0; // Jacobian (managed separately)
     _ctx.faultA  = 0; // Handle to _jacobianPCFault
@@ -119,6 +136,51 @@ pylith::problems::Solver::skipNullSpaceCreation(const bool value)
 } // skipNullSpaceCreation
 
 
+// ----------------------------------------------------------------------
+// Set strategy for initial guess of solution.
+void
+pylith::problems::Solver::initialGuessType(const InitialGuessEnum value)
+{ // initialGuessType
+    _initialGuessType = value;
+} // initialGuessType
+
+
+// ----------------------------------------------------------------------
+// Get strategy for initial guess of solution.
+pylith::problems::Solver::InitialGuessEnum
+pylith::problems::Solver::initialGuessType(void) const
+{ // initialGuessType
+    return _initialGuessType;
+} // initialGuessType
+
+
+// ----------------------------------------------------------------------
+// Set number of previous solutions used in projection for initial guess.
+void
+pylith::problems::Solver::initialGuessNumVectors(const int value)
+{ // initialGuessNumVectors
+    PYLITH_METHOD_BEGIN;
+
+    if (value < 1) {
+        std::ostringstream msg;
+        msg << "Number of previous solutions used in initial guess (" << value << ") must be positive.";
+        throw std::runtime_error(msg.str());
+    } // if
+    _initialGuessNumVectors = value;
+
+    PYLITH_METHOD_END;
+} // initialGuessNumVectors
+
+
+// ----------------------------------------------------------------------
+// Set flag for using geometric multigrid preconditioner.
+void
+pylith::problems::Solver::useGeometricMultigrid(const bool value)
+{ // useGeometricMultigrid
+    _useGeometricMultigrid = value;
+} // useGeometricMultigrid
+
+
 // ----------------------------------------------------------------------
 // Initialize solver.
 void
@@ -131,6 +193,10 @@ pylith::problems::Solver::initialize(const topology::SolutionFields& fields,
     assert(formulation);
     _formulation = formulation;
 
+    if (_useGeometricMultigrid && formulation->splitFields()) {
+        throw std::logic_error("Geometric multigrid preconditioner is not supported with split fields.");
+    } // if
+
     // Make global preconditioner matrix
     PetscMat jacobianMat = jacobian.matrix();
 
@@ -354,6 +420,264 @@ pylith::problems::Solver::_setupFieldSplit(PetscPC* const pc,
     PYLITH_METHOD_END;
 } // _setupFieldSplit
 
+// ----------------------------------------------------------------------
+// Setup geometric multigrid preconditioner.
+void
+pylith::problems::Solver::_setupMultigrid(PetscPC* const pc,
+                                          const topology::SolutionFields& fields)
+{ // _setupMultigrid
+    PYLITH_METHOD_BEGIN;
+
+    assert(pc);
+
+    if (!_interpolator) {
+        _interpolator = new topology::RefineInterpolator;
+    } // if
+    _interpolator->initialize(fields.solution());
+
+    const int numLevels = _interpolator->numLevels();
+    if (numLevels < 2) {
+        throw std::runtime_error("Geometric multigrid requires a mesh refinement hierarchy. "
+                                 "Use uniform refinement (RefineUniform) with at least one level "
+                                 "and set the refiner property 'retain_hierarchy' to True.");
+    } // if
+
+    // Coarse operators are Galerkin projections of the Jacobian, so
+    // they include the cohesive cells and do not require
+    // reassembling the integrators on the coarse meshes.
+    PetscErrorCode err = 0;
+    err = PCSetType(*pc, PCMG); PYLITH_CHECK_ERROR(err);
+    err = PCMGSetLevels(*pc, numLevels, NULL); PYLITH_CHECK_ERROR(err);
+    err = PCMGSetGalerkin(*pc, PC_MG_GALERKIN_BOTH); PYLITH_CHECK_ERROR(err);
+    for (int level = 1; level < numLevels; ++level) {
+        err = PCMGSetInterpolation(*pc, level, _interpolator->interpolation(level)); PYLITH_CHECK_ERROR(err);
+    } // for
+
+    // The Lagrange multiplier block has a zero diagonal, which breaks
+    // the default point smoothers (Chebyshev/SOR) and the coarse LU
+    // solve. Use a Schur complement field split on every level
+    // instead; the Schur complement preconditioner (selfp) only
+    // requires the diagonal of the displacement block.
+    if (_interpolator->hasEdgeDof()) {
+        for (int level = 0; level < numLevels; ++level) {
+            PetscKSP kspLevel = 0;
+            PetscPC pcLevel = 0;
+            PetscIS isDisp = 0, isLagrange = 0;
+            err = PCMGGetSmoother(*pc, level, &kspLevel); PYLITH_CHECK_ERROR(err);
+            err = KSPSetType(kspLevel, KSPGMRES); PYLITH_CHECK_ERROR(err);
+            err = KSPGetPC(kspLevel, &pcLevel); PYLITH_CHECK_ERROR(err);
+            err = PCSetType(pcLevel, PCFIELDSPLIT); PYLITH_CHECK_ERROR(err);
+            _interpolator->createFieldIS(&isDisp, &isLagrange, level);
+            err = PCFieldSplitSetIS(pcLevel, "displacement", isDisp); PYLITH_CHECK_ERROR(err);
+            err = PCFieldSplitSetIS(pcLevel, "lagrange_multiplier", isLagrange); PYLITH_CHECK_ERROR(err);
+            err = ISDestroy(&isDisp); PYLITH_CHECK_ERROR(err);
+            err = ISDestroy(&isLagrange); PYLITH_CHECK_ERROR(err);
+            err = PCFieldSplitSetType(pcLevel, PC_COMPOSITE_SCHUR); PYLITH_CHECK_ERROR(err);
+            err = PCFieldSplitSetSchurFactType(pcLevel, PC_FIELDSPLIT_SCHUR_FACT_FULL); PYLITH_CHECK_ERROR(err);
+            err = PCFieldSplitSetSchurPre(pcLevel, PC_FIELDSPLIT_SCHUR_PRE_SELFP, NULL); PYLITH_CHECK_ERROR(err);
+        } // for
+    } // if
+    err = PCSetFromOptions(*pc); PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // _setupMultigrid
+
+// ----------------------------------------------------------------------
+// Compute initial guess of solution from solution history.
+bool
+pylith::problems::Solver::_computeInitialGuess(PetscVec guessVec,
+                                               PetscMat jacobianMat,
+                                               PetscVec rhsVec)
+{ // _computeInitialGuess
+    PYLITH_METHOD_BEGIN;
+
+    assert(guessVec);
+    assert(_formulation);
+
+    PetscErrorCode err = 0;
+    _initialGuessReduction = -1.0;
+
+    const topology::SolutionFields& fields = _formulation->fields();
+    const int numPrevious = fields.historyLength();
+
+    InitialGuessEnum guessType = _initialGuessType;
+    if (INITIAL_GUESS_PROJECTION == guessType && (!jacobianMat || !rhsVec)) {
+        guessType = INITIAL_GUESS_QUADRATIC;
+    } // if
+    if (INITIAL_GUESS_QUADRATIC == guessType && numPrevious < 2) {
+        guessType = INITIAL_GUESS_PREVIOUS;
+    } // if
+    if (numPrevious < 1) {
+        guessType = INITIAL_GUESS_ZERO;
+    } // if
+
+    switch (guessType) {
+    case INITIAL_GUESS_ZERO:
+        err = VecSet(guessVec, 0.0); PYLITH_CHECK_ERROR(err);
+        PYLITH_METHOD_RETURN(false);
+        break;
+    case INITIAL_GUESS_PREVIOUS:
+        // du(t) = du(t-dt)
+        err = VecCopy(fields.historyVector(0), guessVec); PYLITH_CHECK_ERROR(err);
+        break;
+    case INITIAL_GUESS_QUADRATIC:
+        // du(t) = 2*du(t-dt) - du(t-2dt)
+        err = VecAXPBYPCZ(guessVec, 2.0, -1.0, 0.0, fields.historyVector(0), fields.historyVector(1)); PYLITH_CHECK_ERROR(err);
+        break;
+    case INITIAL_GUESS_PROJECTION: {
+        // Minimize || rhs - J V c || over the span V of the previous
+        // increments using the normal equations for the orthonormalized
+        // basis W of V.
+        const int numVectors = std::min(numPrevious, _initialGuessNumVectors);
+        if (int(_initialGuessWork.size()) < 2*numVectors) {
+            const size_t numOld = _initialGuessWork.size();
+            _initialGuessWork.resize(2*numVectors);
+            for (size_t i = numOld; i < _initialGuessWork.size(); ++i) {
+                err = VecDuplicate(guessVec, &_initialGuessWork[i]); PYLITH_CHECK_ERROR(err);
+            } // for
+        } // if
+        PetscVec* basis = &_initialGuessWork[0];
+        PetscVec* jacBasis = &_initialGuessWork[numVectors];
+
+        // Modified Gram-Schmidt, dropping nearly dependent increments.
+        const PylithScalar dropTolerance = 1.0e-8;
+        int numBasis = 0;
+        for (int i = 0; i < numVectors; ++i) {
+            PetscReal normOrig = 0.0, norm = 0.0;
+            err = VecCopy(fields.historyVector(i), basis[numBasis]); PYLITH_CHECK_ERROR(err);
+            err = VecNorm(basis[numBasis], NORM_2, &normOrig); PYLITH_CHECK_ERROR(err);
+            for (int j = 0; j < numBasis; ++j) {
+                PetscScalar dot = 0.0;
+                err = VecDot(basis[numBasis], basis[j], &dot); PYLITH_CHECK_ERROR(err);
+                err = VecAXPY(basis[numBasis], -dot, basis[j]); PYLITH_CHECK_ERROR(err);
+            } // for
+            err = VecNorm(basis[numBasis], NORM_2, &norm); PYLITH_CHECK_ERROR(err);
+            if (norm > dropTolerance*normOrig && norm > 0.0) {
+                err = VecScale(basis[numBasis], 1.0/norm); PYLITH_CHECK_ERROR(err);
+                ++numBasis;
+            } // if
+        } // for
+        if (!numBasis) {
+            err = VecSet(guessVec, 0.0); PYLITH_CHECK_ERROR(err);
+            PYLITH_METHOD_RETURN(false);
+        } // if
+
+        scalar_array normalMat(numBasis*numBasis);
+        scalar_array normalRhs(numBasis);
+        for (int i = 0; i < numBasis; ++i) {
+            err = MatMult(jacobianMat, basis[i], jacBasis[i]); PYLITH_CHECK_ERROR(err);
+        } // for
+        for (int i = 0; i < numBasis; ++i) {
+            err = VecMDot(jacBasis[i], i+1, jacBasis, &normalMat[i*numBasis]); PYLITH_CHECK_ERROR(err);
+            for (int j = 0; j < i; ++j) {
+                normalMat[j*numBasis+i] = normalMat[i*numBasis+j];
+            } // for
+        } // for
+        err = VecMDot(rhsVec, numBasis, jacBasis, &normalRhs[0]); PYLITH_CHECK_ERROR(err);
+
+        // Cholesky factorization of the (small) normal equations.
+        const int stride = numBasis;
+        for (int j = 0; j < numBasis; ++j) {
+            PylithScalar diag = normalMat[j*stride+j];
+            for (int k = 0; k < j; ++k) {
+                diag -= normalMat[j*stride+k]*normalMat[j*stride+k];
+            } // for
+            if (diag <= 0.0) { // J V is rank deficient; use only leading vectors.
+                numBasis = j;
+                break;
+            } // if
+            normalMat[j*stride+j] = sqrt(diag);
+            for (int i = j+1; i < numBasis; ++i) {
+                PylithScalar value = normalMat[i*stride+j];
+                for (int k = 0; k < j; ++k) {
+                    value -= normalMat[i*stride+k]*normalMat[j*stride+k];
+                } // for
+                normalMat[i*stride+j] = value / normalMat[j*stride+j];
+            } // for
+        } // for
+        if (!numBasis) {
+            err = VecSet(guessVec, 0.0); PYLITH_CHECK_ERROR(err);
+            PYLITH_METHOD_RETURN(false);
+        } // if
+        for (int i = 0; i < numBasis; ++i) { // Forward substitution
+            for (int k = 0; k < i; ++k) {
+                normalRhs[i] -= normalMat[i*stride+k]*normalRhs[k];
+            } // for
+            normalRhs[i] /= normalMat[i*stride+i];
+        } // for
+        for (int i = numBasis-1; i >= 0; --i) { // Backward substitution
+            for (int k = i+1; k < numBasis; ++k) {
+                normalRhs[i] -= normalMat[k*stride+i]*normalRhs[k];
+            } // for
+            normalRhs[i] /= normalMat[i*stride+i];
+        } // for
+
+        err = VecSet(guessVec, 0.0); PYLITH_CHECK_ERROR(err);
+        err = VecMAXPY(guessVec, numBasis, &normalRhs[0], basis); PYLITH_CHECK_ERROR(err);
+        break;
+    } // INITIAL_GUESS_PROJECTION
+    default:
+        PYLITH_METHOD_RETURN(false);
+    } // switch
+
+    if (jacobianMat && rhsVec) {
+        // Residual reduction by initial guess, || rhs - J g || / || rhs ||.
+        if (!_initialGuessWork.size()) {
+            _initialGuessWork.resize(1);
+            err = VecDuplicate(guessVec, &_initialGuessWork[0]); PYLITH_CHECK_ERROR(err);
+        } // if
+        PetscVec workVec = _initialGuessWork[0];
+        PetscReal rhsNorm = 0.0, guessNorm = 0.0;
+        err = MatMult(jacobianMat, guessVec, workVec); PYLITH_CHECK_ERROR(err);
+        err = VecAYPX(workVec, -1.0, rhsVec); PYLITH_CHECK_ERROR(err);
+        err = VecNorm(rhsVec, NORM_2, &rhsNorm); PYLITH_CHECK_ERROR(err);
+        err = VecNorm(workVec, NORM_2, &guessNorm); PYLITH_CHECK_ERROR(err);
+        _initialGuessReduction = (rhsNorm > 0.0) ? guessNorm / rhsNorm : -1.0;
+    } // if
+
+    PYLITH_METHOD_RETURN(true);
+} // _computeInitialGuess
+
+// ----------------------------------------------------------------------
+// Add current solution to solution history.
+void
+pylith::problems::Solver::_updateSolutionHistory(void)
+{ // _updateSolutionHistory
+    PYLITH_METHOD_BEGIN;
+
+    assert(_formulation);
+
+    int historySize = 0;
+    switch (_initialGuessType) {
+    case INITIAL_GUESS_ZERO:
+        historySize = 0;
+        break;
+    case INITIAL_GUESS_PREVIOUS:
+        historySize = 1;
+        break;
+    case INITIAL_GUESS_QUADRATIC:
+        historySize = 2;
+        break;
+    case INITIAL_GUESS_PROJECTION:
+        historySize = _initialGuessNumVectors;
+        break;
+    default:
+        assert(0);
+        throw std::logic_error("Unknown initial guess type.");
+    } // switch
+    if (!historySize) {
+        PYLITH_METHOD_END;
+    } // if
+
+    topology::SolutionFields& fields = _formulation->fields();
+    if (fields.historySize() != historySize) {
+        fields.createHistory(historySize);
+    } // if
+    fields.shiftHistory();
+
+    PYLITH_METHOD_END;
+} // _updateSolutionHistory
+
 // ----------------------------------------------------------------------
 int
 pylith::problems::Solver::_epsilon(int i,
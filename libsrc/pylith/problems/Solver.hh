@@ -32,6 +32,9 @@
 #include "pylith/topology/topologyfwd.hh" // USES SolutionFields
 #include "pylith/utils/utilsfwd.hh" // USES EventLogger
 #include "pylith/utils/petscfwd.h" // USES PetscMat
+#include "pylith/utils/types.hh" // USES PylithScalar
+
+#include <vector> // HASA std::vector
 
 typedef struct {
   PetscPC pc;
@@ -49,6 +52,22 @@ class pylith::problems::Solver
 { // Solver
   friend class TestSolver; // unit testing
 
+// PUBLIC ENUMS /////////////////////////////////////////////////////////
+public :
+
+  /** Strategy for initial guess of the solution (increment) at the
+   * beginning of a solve.
+   *
+   * Extrapolation assumes a uniform time step; the increments from
+   * previous solves are held in the solution history of SolutionFields.
+   */
+  enum InitialGuessEnum {
+    INITIAL_GUESS_ZERO=0, ///< Zero increment.
+    INITIAL_GUESS_PREVIOUS=1, ///< Increment from previous solve (linear extrapolation of solution).
+    INITIAL_GUESS_QUADRATIC=2, ///< Quadratic extrapolation of solution from previous two increments.
+    INITIAL_GUESS_PROJECTION=3, ///< Minimum residual over span of previous increments.
+  }; // InitialGuessEnum
+
 // PUBLIC MEMBERS ///////////////////////////////////////////////////////
 public :
 
@@ -73,6 +92,37 @@ public :
    */
   void skipNullSpaceCreation(const bool value);
 
+  /** Set strategy for initial guess of solution.
+   *
+   * @param[in] value Strategy for initial guess.
+   */
+  void initialGuessType(const InitialGuessEnum value);
+
+  /** Get strategy for initial guess of solution.
+   *
+   * @returns Strategy for initial guess.
+   */
+  InitialGuessEnum initialGuessType(void) const;
+
+  /** Set number of previous solutions used in projection for initial
+   * guess of solution.
+   *
+   * @param[in] value Number of previous solutions (>= 1).
+   */
+  void initialGuessNumVectors(const int value);
+
+  /** Set flag for using geometric multigrid preconditioner.
+   *
+   * The multigrid levels are the meshes in the hierarchy retained
+   * by uniform refinement of the mesh (RefineUniform). Coarse
+   * operators are formed from the Jacobian via Galerkin projection.
+   * With fault Lagrange multipliers, the smoothers are GMRES with a
+   * Schur complement field split, so the outer Krylov solver must be
+   * flexible (e.g., -ksp_type fgmres).
+   *
+   * @param[in] value True to use geometric multigrid.
+   */
+  void useGeometricMultigrid(const bool value);
 
   /** Initialize solver.
    *
@@ -106,6 +156,33 @@ protected :
 			const topology::Jacobian& jacobian,
 			const topology::SolutionFields& fields);
   
+  /** Setup geometric multigrid preconditioner using refinement
+   * hierarchy of mesh.
+   *
+   * @param pc PETSc preconditioner.
+   * @param fields Solution fields.
+   */
+  void _setupMultigrid(PetscPC* const pc,
+		       const topology::SolutionFields& fields);
+
+  /** Compute initial guess of solution from solution history.
+   *
+   * If the history does not contain enough previous solutions for
+   * the current strategy, we fall back to a lower-order strategy.
+   *
+   * @param guessVec Global PETSc vector for initial guess [output].
+   * @param jacobianMat System Jacobian (may be NULL if rhsVec is NULL).
+   * @param rhsVec Right-hand side for zero initial guess (may be NULL).
+   * @returns True if initial guess is nonzero, false otherwise.
+   */
+  bool _computeInitialGuess(PetscVec guessVec,
+			    PetscMat jacobianMat,
+			    PetscVec rhsVec);
+
+  /// Add current solution to solution history, if needed by strategy
+  /// for initial guess.
+  void _updateSolutionHistory(void);
+
   /** :MATT: :TODO: DOCUMENT THIS.
    */
   static
@@ -122,6 +199,13 @@ protected :
   PetscMat _jacobianPCFault; ///< Preconditioning matrix for Lagrange constraints.
   FaultPreconCtx _ctx; ///< Context for preconditioning matrix for Lagrange constraints.
   bool _skipNullSpaceCreation; ///< Skip creating the null space (useful for very small problems with no null space).
+  bool _useGeometricMultigrid; ///< Use geometric multigrid preconditioner.
+  topology::RefineInterpolator* _interpolator; ///< Interpolation between levels of refinement hierarchy.
+
+  InitialGuessEnum _initialGuessType; ///< Strategy for initial guess of solution.
+  int _initialGuessNumVectors; ///< Number of previous solutions used in projection.
+  PylithScalar _initialGuessReduction; ///< Ratio of residual norm with initial guess to residual norm with zero guess (negative if unknown).
+  std::vector<PetscVec> _initialGuessWork; ///< Work vectors for computing initial guess.
 
 // NOT IMPLEMENTED //////////////////////////////////////////////////////
 private :
@@ -29,8 +29,12 @@
 
 #include "pylith/utils/EventLogger.hh" // USES EventLogger
 
+#include "journal/info.h" // USES journal::info_t
+
 #include <petscksp.h> // USES PetscKSP
 
+#include <cmath> // USES log()
+
 #include "pylith/utils/error.h" // USES PYLITH_CHECK_ERROR
 
 // ----------------------------------------------------------------------
@@ -78,14 +82,19 @@ pylith::problems::SolverLinear::initialize(const topology::SolutionFields& field
   PetscErrorCode err = 0;
   err = KSPDestroy(&_ksp);PYLITH_CHECK_ERROR(err);
   err = KSPCreate(fields.mesh().comm(), &_ksp);PYLITH_CHECK_ERROR(err);
-  err = KSPSetInitialGuessNonzero(_ksp, PETSC_FALSE);PYLITH_CHECK_ERROR(err);
+  const PetscBool guessNonzero = (INITIAL_GUESS_ZERO == _initialGuessType) ? PETSC_FALSE : PETSC_TRUE;
+  err = KSPSetInitialGuessNonzero(_ksp, guessNonzero);PYLITH_CHECK_ERROR(err);
   err = KSPSetFromOptions(_ksp);PYLITH_CHECK_ERROR(err);
 
   if (formulation->splitFields()) {
     PetscPC pc = 0;
     err = KSPGetPC(_ksp, &pc);PYLITH_CHECK_ERROR(err);
     _setupFieldSplit(&pc, formulation, jacobian, fields);
-  } // if
+  } else if (_useGeometricMultigrid) {
+    PetscPC pc = 0;
+    err = KSPGetPC(_ksp, &pc);PYLITH_CHECK_ERROR(err);
+    _setupMultigrid(&pc, fields);
+  } // if/else
 
   if (!_skipNullSpaceCreation) {
     _createNullSpace(fields);
@@ -126,12 +135,21 @@ pylith::problems::SolverLinear::solve(topology::Field* solution,
   const PetscVec residualVec = residual.globalVector();
   const PetscVec solutionVec = solution->globalVector();
 
+  if (INITIAL_GUESS_ZERO != _initialGuessType) {
+    _computeInitialGuess(solutionVec, jacobianMat, residualVec);
+  } // if
+
   _logger->eventEnd(setupEvent);
   _logger->eventBegin(solveEvent);
 
   err = KSPSolve(_ksp, residualVec, solutionVec); PYLITH_CHECK_ERROR(err);
 
   _logger->eventEnd(solveEvent);
+
+  if (INITIAL_GUESS_ZERO != _initialGuessType) {
+    _updateSolutionHistory();
+    _logIterations();
+  } // if
   _logger->eventBegin(scatterEvent);
 
   // Update section view of field.
@@ -145,6 +163,43 @@ pylith::problems::SolverLinear::solve(topology::Field* solution,
   PYLITH_METHOD_END;
 } // solve
 
+// ----------------------------------------------------------------------
+// Report number of iterations and savings from initial guess.
+void
+pylith::problems::SolverLinear::_logIterations(void)
+{ // _logIterations
+  PYLITH_METHOD_BEGIN;
+
+  journal::info_t info("solverlinear");
+  if (!info.state()) {
+    PYLITH_METHOD_END;
+  } // if
+
+  PetscErrorCode err = 0;
+  PetscInt numIterations = 0;
+  PetscReal residualNorm = 0.0;
+  err = KSPGetIterationNumber(_ksp, &numIterations);PYLITH_CHECK_ERROR(err);
+  err = KSPGetResidualNorm(_ksp, &residualNorm);PYLITH_CHECK_ERROR(err);
+
+  info << journal::at(__HERE__)
+       << "Linear solve converged in " << numIterations << " iterations.";
+  if (_initialGuessReduction > 0.0 && _initialGuessReduction < 1.0 && numIterations > 0) {
+    // Estimate iterations saved assuming a constant convergence rate
+    // over the solve, starting from the residual of the initial guess.
+    const topology::Field& residual = _formulation->fields().get("residual");
+    PetscReal rhsNorm = 0.0;
+    err = VecNorm(residual.globalVector(), NORM_2, &rhsNorm);PYLITH_CHECK_ERROR(err);
+    const PylithScalar solveReduction = (rhsNorm > 0.0) ? residualNorm / (_initialGuessReduction*rhsNorm) : 0.0;
+    const PylithScalar numSaved = (solveReduction > 0.0 && solveReduction < 1.0) ?
+      numIterations * log(_initialGuessReduction) / log(solveReduction) : 0.0;
+    info << " Initial guess reduced residual by factor " << _initialGuessReduction
+	 << ", saving about " << int(numSaved+0.5) << " iterations.";
+  } // if
+  info << journal::endl;
+
+  PYLITH_METHOD_END;
+} // _logIterations
+
 // ----------------------------------------------------------------------
 // Initialize logger.
 void
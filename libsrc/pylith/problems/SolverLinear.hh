@@ -81,6 +81,9 @@ private :
   /// Initialize logger.
   void _initializeLogger(void);
 
+  /// Report number of iterations and savings from initial guess.
+  void _logIterations(void);
+
 // PRIVATE MEMBERS //////////////////////////////////////////////////////
 private :
 
@@ -31,8 +31,13 @@
 #include "pylith/utils/EventLogger.hh" // USES EventLogger
 #include "pylith/utils/error.h" // USES PYLITH_CHECK_ERROR
 
+#include "journal/info.h" // USES journal::info_t
+
 #include <petscsnes.h> // USES PetscSNES
 
+#include <sstream> // USES std::ostringstream
+#include <stdexcept> // USES std::runtime_error
+
 // KLUDGE, Fixes issue with PetscIsInfOrNanReal and include cmath
 // instead of math.h.
 #define isnan std::isnan // TEMPORARY
@@ -52,7 +57,16 @@ struct PetscSNESLineSearch_BT {
 // ----------------------------------------------------------------------
 // Constructor
 pylith::problems::SolverNonlinear::SolverNonlinear(void) :
-  _snes(0)
+  _snes(0),
+  _lineSearchReuseResidual(false),
+  _lineSearchAcceptRatio(0.5),
+  _solverType(SOLVER_NEWTON),
+  _adaptiveLinearTolerance(false),
+  _lagJacobian(1),
+  _lagPreconditioner(1),
+  _numJacobians(0),
+  _numPCSetups(0),
+  _fuseStateVarsUpdate(false)
 { // constructor
 } // constructor
 
@@ -76,6 +90,90 @@ pylith::problems::SolverNonlinear::deallocate(void)
 
   PYLITH_METHOD_END;
 } // deallocate
+
+// ----------------------------------------------------------------------
+// Set flag for reusing residual from last trial step of line search.
+void
+pylith::problems::SolverNonlinear::lineSearchReuseResidual(const bool value)
+{ // lineSearchReuseResidual
+  _lineSearchReuseResidual = value;
+} // lineSearchReuseResidual
+
+// ----------------------------------------------------------------------
+// Set minimum ratio of actual to predicted decrease for reusing residual.
+void
+pylith::problems::SolverNonlinear::lineSearchAcceptRatio(const PylithScalar value)
+{ // lineSearchAcceptRatio
+  PYLITH_METHOD_BEGIN;
+
+  if (value < 0.0 || value > 1.0) {
+    std::ostringstream msg;
+    msg << "Ratio of actual to predicted decrease (" << value << ") for reusing residual in line search must be in [0, 1].";
+    throw std::runtime_error(msg.str());
+  } // if
+  _lineSearchAcceptRatio = value;
+
+  PYLITH_METHOD_END;
+} // lineSearchAcceptRatio
+
+// ----------------------------------------------------------------------
+// Set type of nonlinear solver.
+void
+pylith::problems::SolverNonlinear::solverType(const SolverTypeEnum value)
+{ // solverType
+  _solverType = value;
+} // solverType
+
+// ----------------------------------------------------------------------
+// Set flag for adaptive tolerance of linear solve.
+void
+pylith::problems::SolverNonlinear::adaptiveLinearTolerance(const bool value)
+{ // adaptiveLinearTolerance
+  _adaptiveLinearTolerance = value;
+} // adaptiveLinearTolerance
+
+// ----------------------------------------------------------------------
+// Set number of nonlinear iterations between reforming the Jacobian.
+void
+pylith::problems::SolverNonlinear::lagJacobian(const int value)
+{ // lagJacobian
+  PYLITH_METHOD_BEGIN;
+
+  if (value < 1) {
+    std::ostringstream msg;
+    msg << "Number of iterations between reforming the Jacobian (" << value << ") must be positive.";
+    throw std::runtime_error(msg.str());
+  } // if
+  _lagJacobian = value;
+
+  PYLITH_METHOD_END;
+} // lagJacobian
+
+// ----------------------------------------------------------------------
+// Set number of Jacobian reforms between rebuilding the preconditioner.
+void
+pylith::problems::SolverNonlinear::lagPreconditioner(const int value)
+{ // lagPreconditioner
+  PYLITH_METHOD_BEGIN;
+
+  if (value < 1) {
+    std::ostringstream msg;
+    msg << "Number of iterations between rebuilding the preconditioner (" << value << ") must be positive.";
+    throw std::runtime_error(msg.str());
+  } // if
+  _lagPreconditioner = value;
+
+  PYLITH_METHOD_END;
+} // lagPreconditioner
+
+// ----------------------------------------------------------------------
+// Set flag for updating state variables using strain from final
+// residual evaluation.
+void
+pylith::problems::SolverNonlinear::fuseStateVarsUpdate(const bool value)
+{ // fuseStateVarsUpdate
+  _fuseStateVarsUpdate = value;
+} // fuseStateVarsUpdate
   
 // ----------------------------------------------------------------------
 // Initialize solver.
@@ -91,6 +189,8 @@ pylith::problems::SolverNonlinear::initialize(const topology::SolutionFields& fi
   _initializeLogger();
   Solver::initialize(fields, jacobian, formulation);
 
+  formulation->storeResidualState(_fuseStateVarsUpdate);
+
   PetscErrorCode err = 0;
   if (_snes) {
     err = SNESDestroy(&_snes); _snes = 0;
@@ -103,18 +203,42 @@ pylith::problems::SolverNonlinear::initialize(const topology::SolutionFields& fi
   err = SNESSetFunction(_snes, residualVec, reformResidual, (void*) formulation);
   PYLITH_CHECK_ERROR(err);
 
-  err = SNESSetJacobian(_snes, jacobian.matrix(), _jacobianPC, reformJacobian, (void*) formulation);PYLITH_CHECK_ERROR(err);
-
-  // Set default line search type to SNESSHELL and use our custom line search
-  PetscSNESLineSearch ls;
-  err = SNESGetLineSearch(_snes, &ls);PYLITH_CHECK_ERROR(err);
-  err = SNESLineSearchSetType(ls, SNESSHELL);PYLITH_CHECK_ERROR(err);
-  err = SNESLineSearchSetOrder(ls, SNES_LINESEARCH_ORDER_CUBIC);PYLITH_CHECK_ERROR(err);
-  err = SNESLineSearchShellSetUserFunc(ls, lineSearch, (void*) formulation);PYLITH_CHECK_ERROR(err);
+  err = SNESSetJacobian(_snes, jacobian.matrix(), _jacobianPC, reformJacobian, (void*) this);PYLITH_CHECK_ERROR(err);
+
+  switch (_solverType) {
+  case SOLVER_NEWTON: {
+    err = SNESSetType(_snes, SNESNEWTONLS);PYLITH_CHECK_ERROR(err);
+
+    // Set default line search type to SNESSHELL and use our custom line search
+    PetscSNESLineSearch ls;
+    err = SNESGetLineSearch(_snes, &ls);PYLITH_CHECK_ERROR(err);
+    err = SNESLineSearchSetType(ls, SNESSHELL);PYLITH_CHECK_ERROR(err);
+    err = SNESLineSearchSetOrder(ls, SNES_LINESEARCH_ORDER_CUBIC);PYLITH_CHECK_ERROR(err);
+    err = SNESLineSearchShellSetUserFunc(ls, lineSearch, (void*) this);PYLITH_CHECK_ERROR(err);
+    break;
+  } // SOLVER_NEWTON
+  case SOLVER_NRICHARDSON:
+    // Our line search requires the Jacobian, so use the PETSc default.
+    err = SNESSetType(_snes, SNESNRICHARDSON);PYLITH_CHECK_ERROR(err);
+    break;
+  case SOLVER_QUASI_NEWTON:
+    // Jacobian (consistent tangent) provides initial Hessian.
+    err = SNESSetType(_snes, SNESQN);PYLITH_CHECK_ERROR(err);
+    err = SNESQNSetType(_snes, SNES_QN_LBFGS);PYLITH_CHECK_ERROR(err);
+    err = SNESQNSetScaleType(_snes, SNES_QN_SCALE_JACOBIAN);PYLITH_CHECK_ERROR(err);
+    break;
+  default:
+    assert(0);
+    throw std::logic_error("Unknown nonlinear solver type.");
+  } // switch
+
+  err = SNESKSPSetUseEW(_snes, _adaptiveLinearTolerance ? PETSC_TRUE : PETSC_FALSE);PYLITH_CHECK_ERROR(err);
+  err = SNESSetLagJacobian(_snes, _lagJacobian);PYLITH_CHECK_ERROR(err);
+  err = SNESSetLagPreconditioner(_snes, _lagPreconditioner);PYLITH_CHECK_ERROR(err);
 
   // Get SNES options and allow the user to override the line search type
   err = SNESSetFromOptions(_snes);PYLITH_CHECK_ERROR(err);
-  err = SNESSetComputeInitialGuess(_snes, initialGuess, (void*) formulation);PYLITH_CHECK_ERROR(err);
+  err = SNESSetComputeInitialGuess(_snes, initialGuess, (void*) this);PYLITH_CHECK_ERROR(err);
 
   if (formulation->splitFields()) {
     PetscKSP ksp = 0;
@@ -122,7 +246,13 @@ pylith::problems::SolverNonlinear::initialize(const topology::SolutionFields& fi
     err = SNESGetKSP(_snes, &ksp); PYLITH_CHECK_ERROR(err);
     err = KSPGetPC(ksp, &pc); PYLITH_CHECK_ERROR(err);
     _setupFieldSplit(&pc, formulation, jacobian, fields);
-  } // if
+  } else if (_useGeometricMultigrid) {
+    PetscKSP ksp = 0;
+    PetscPC pc = 0;
+    err = SNESGetKSP(_snes, &ksp); PYLITH_CHECK_ERROR(err);
+    err = KSPGetPC(ksp, &pc); PYLITH_CHECK_ERROR(err);
+    _setupMultigrid(&pc, fields);
+  } // if/else
 
   if (!_skipNullSpaceCreation) {
     _createNullSpace(fields);
@@ -149,9 +279,17 @@ pylith::problems::SolverNonlinear::solve(topology::Field* solution,
   PetscErrorCode err = 0;
   const PetscVec solutionVec = solution->globalVector();
 
+  _numJacobians = 0;
+  _numPCSetups = 0;
   err = SNESSolve(_snes, PETSC_NULL, solutionVec); PYLITH_CHECK_ERROR(err);
   
   _logger->eventEnd(solveEvent);
+
+  if (INITIAL_GUESS_ZERO != _initialGuessType) {
+    _updateSolutionHistory();
+  } // if
+  _logIterations();
+
   _logger->eventBegin(scatterEvent);
 
   // Update section view of field.
@@ -159,6 +297,13 @@ pylith::problems::SolverNonlinear::solve(topology::Field* solution,
 
   _logger->eventEnd(scatterEvent);
 
+  // Strain from the final residual evaluation can be used to update
+  // state variables if that evaluation used the converged solution.
+  if (_fuseStateVarsUpdate) {
+    assert(_formulation);
+    _formulation->checkResidualState();
+  } // if
+
   // Update rate fields to be consistent with current solution.
   _formulation->calcRateFields();
 
@@ -204,11 +349,24 @@ pylith::problems::SolverNonlinear::reformJacobian(PetscSNES snes,
   PYLITH_METHOD_BEGIN;
 
   assert(context);
-  Formulation* formulation = (Formulation*) context;
+  SolverNonlinear* solver = (SolverNonlinear*) context;
+  Formulation* formulation = solver->_formulation;
   assert(formulation);
 
   formulation->reformJacobian(&tmpSolutionVec);
 
+  // Track reforms for reporting. PETSc rebuilds the preconditioner
+  // along with the Jacobian, except on lagged iterations.
+  PetscErrorCode err = 0;
+  PetscInt iteration = 0;
+  PetscInt lagPC = 1;
+  err = SNESGetIterationNumber(snes, &iteration);PYLITH_CHECK_ERROR(err);
+  err = SNESGetLagPreconditioner(snes, &lagPC);PYLITH_CHECK_ERROR(err);
+  ++solver->_numJacobians;
+  if (!solver->_numPCSetups || 1 == lagPC || -2 == lagPC || (lagPC > 1 && 0 == iteration % lagPC)) {
+    ++solver->_numPCSetups;
+  } // if
+
   PYLITH_METHOD_RETURN(0);
 } // reformJacobian
 
@@ -234,6 +392,8 @@ pylith::problems::SolverNonlinear::lineSearch(PetscSNESLineSearch linesearch,
   PetscReal         t1,t2,a,b,d;
   PetscReal         f;
   PetscReal         g,gprev;
+  PetscReal         fjy = 0.0, jynorm2 = 0.0; /* F.JY and ||JY||^2 for linear prediction of merit function */
+  PetscBool         residualCurrent = PETSC_FALSE; /* G holds residual at W */
   PetscViewer       monitor;
   PetscInt          max_its,count;
   PetscSNESLineSearch_BT *bt;
@@ -251,6 +411,9 @@ pylith::problems::SolverNonlinear::lineSearch(PetscSNESLineSearch linesearch,
   ierr = SNESGetObjective(snes,&objective,NULL);CHKERRQ(ierr);
   bt   = (PetscSNESLineSearch_BT*)linesearch->data;
 
+  assert(lsctx);
+  SolverNonlinear* solver = (SolverNonlinear*) lsctx;
+
   alpha = bt->alpha;
 
   ierr = SNESGetJacobian(snes, &jac, NULL, NULL, NULL);CHKERRQ(ierr);
@@ -303,6 +466,11 @@ pylith::problems::SolverNonlinear::lineSearch(PetscSNESLineSearch linesearch,
     /* slope comes from the normal equations */
     ierr = MatMult(jac,Y,W);CHKERRQ(ierr);
     ierr = VecDotRealPart(F,W,&initslope);CHKERRQ(ierr);
+    if (solver->_lineSearchReuseResidual) {
+      /* Cache terms for linear prediction of merit function, ||F - lambda JY||^2. */
+      fjy  = initslope;
+      ierr = VecDotRealPart(W,W,&jynorm2);CHKERRQ(ierr);
+    }
     if (initslope > 0.0)  initslope = -initslope;
     if (initslope == 0.0) initslope = -1.0;
   }
@@ -329,6 +497,7 @@ pylith::problems::SolverNonlinear::lineSearch(PetscSNESLineSearch linesearch,
       ierr = VecNorm(G,NORM_2,&gnorm);CHKERRQ(ierr);
     }
     g = PetscSqr(gnorm);
+    residualCurrent = PETSC_TRUE;
   }
 
   if (PetscIsInfOrNanReal(g)) {
@@ -390,6 +559,7 @@ pylith::problems::SolverNonlinear::lineSearch(PetscSNESLineSearch linesearch,
         ierr = VecNorm(G,NORM_2,&gnorm);CHKERRQ(ierr);
       }
       g = PetscSqr(gnorm);
+      residualCurrent = PETSC_TRUE;
     }
     if (PetscIsInfOrNanReal(g)) {
       ierr = SNESLineSearchSetReason(linesearch, SNES_LINESEARCH_FAILED_NANORINF);CHKERRQ(ierr);
@@ -431,8 +601,7 @@ pylith::problems::SolverNonlinear::lineSearch(PetscSNESLineSearch linesearch,
           }
 #if defined(PYLITH_CUSTOM_LINESEARCH)
 #if 0 // DEBUGGING
-	  assert(lsctx);
-	  Formulation* formulation = (Formulation*) lsctx;
+	  Formulation* formulation = solver->_formulation;
 	  assert(formulation);
 	  formulation->printState(&w, &g, &x, &y);
 	  std::cerr << "WARNING: Line search diverged ... continuing nonlinear iterations anyway in hopes that solution will converge anyway."
@@ -487,6 +656,7 @@ pylith::problems::SolverNonlinear::lineSearch(PetscSNESLineSearch linesearch,
             ierr = VecNorm(G,NORM_2,&gnorm);CHKERRQ(ierr);
           }
           g = PetscSqr(gnorm);
+          residualCurrent = PETSC_TRUE;
         }
         if (PetscIsInfOrNanReal(gnorm)) {
           ierr = SNESLineSearchSetReason(linesearch, SNES_LINESEARCH_FAILED_NANORINF);CHKERRQ(ierr);
@@ -544,7 +714,23 @@ pylith::problems::SolverNonlinear::lineSearch(PetscSNESLineSearch linesearch,
     }
   }
 #if defined(PYLITH_CUSTOM_LINESEARCH)
-  if (true) {
+  /* The residual evaluation adjusts the fault constraints in W, so G
+   * is consistent with W after any trial evaluation. Reuse it if the
+   * step was not changed and the actual decrease in the merit
+   * function agrees with the decrease predicted by the linearized
+   * residual; otherwise reform the residual at the accepted step. */
+  PetscBool reuseResidual = PETSC_FALSE;
+  if (solver->_lineSearchReuseResidual && !objective && residualCurrent && !changed_y && !changed_w) {
+    const PetscReal gpredicted = f - 2.0*lambda*fjy + lambda*lambda*jynorm2;
+    const PetscReal decreasePredicted = f - gpredicted;
+    const PetscReal decreaseActual = f - g;
+    if (decreasePredicted > 0.0 && decreaseActual >= solver->_lineSearchAcceptRatio*decreasePredicted) {
+      reuseResidual = PETSC_TRUE;
+      ierr = PetscInfo3(snes,"Reusing residual from trial step, lambda=%18.16e, actual decrease %14.12e, predicted decrease %14.12e\n",
+                        (double)lambda,(double)decreaseActual,(double)decreasePredicted);CHKERRQ(ierr);
+    }
+  }
+  if (!reuseResidual) {
 #else // ORIGINAL
   if (changed_y || changed_w || objective) { /* recompute the function norm if the step has changed or the objective isn't the norm */
 #endif
@@ -582,11 +768,70 @@ pylith::problems::SolverNonlinear::initialGuess(PetscSNES snes,
 { // initialGuess
   PYLITH_METHOD_BEGIN;
 
-  PetscErrorCode err = VecSet(initialGuessVec, 0.0);PYLITH_CHECK_ERROR(err);
+  assert(lsctx);
+  SolverNonlinear* solver = (SolverNonlinear*) lsctx;
+
+  PetscErrorCode err = 0;
+  switch (solver->_initialGuessType) {
+  case INITIAL_GUESS_ZERO:
+    err = VecSet(initialGuessVec, 0.0);PYLITH_CHECK_ERROR(err);
+    break;
+  case INITIAL_GUESS_PREVIOUS:
+  case INITIAL_GUESS_QUADRATIC:
+    solver->_computeInitialGuess(initialGuessVec, PETSC_NULL, PETSC_NULL);
+    break;
+  case INITIAL_GUESS_PROJECTION: {
+    // Projection requires the residual for a zero increment, which
+    // costs one additional residual evaluation per time step.
+    PetscMat jacobianMat = 0;
+    PetscVec rhsVec = 0;
+    err = SNESGetJacobian(snes, &jacobianMat, PETSC_NULL, PETSC_NULL, PETSC_NULL);PYLITH_CHECK_ERROR(err);
+    err = SNESGetFunction(snes, &rhsVec, PETSC_NULL, PETSC_NULL);PYLITH_CHECK_ERROR(err);
+    err = VecSet(initialGuessVec, 0.0);PYLITH_CHECK_ERROR(err);
+    err = SNESComputeFunction(snes, initialGuessVec, rhsVec);PYLITH_CHECK_ERROR(err);
+    err = VecScale(rhsVec, -1.0);PYLITH_CHECK_ERROR(err);
+    solver->_computeInitialGuess(initialGuessVec, jacobianMat, rhsVec);
+    break;
+  } // INITIAL_GUESS_PROJECTION
+  default:
+    assert(0);
+    throw std::logic_error("Unknown initial guess type.");
+  } // switch
 
   PYLITH_METHOD_RETURN(0);
 } // initialGuess
 
+// ----------------------------------------------------------------------
+// Report number of iterations and savings from initial guess.
+void
+pylith::problems::SolverNonlinear::_logIterations(void)
+{ // _logIterations
+  PYLITH_METHOD_BEGIN;
+
+  journal::info_t info("solvernonlinear");
+  if (!info.state()) {
+    PYLITH_METHOD_END;
+  } // if
+
+  PetscErrorCode err = 0;
+  PetscInt numIterations = 0;
+  PetscInt numLinearIterations = 0;
+  err = SNESGetIterationNumber(_snes, &numIterations);PYLITH_CHECK_ERROR(err);
+  err = SNESGetLinearSolveIterations(_snes, &numLinearIterations);PYLITH_CHECK_ERROR(err);
+
+  info << journal::at(__HERE__)
+       << "Nonlinear solve converged in " << numIterations << " iterations ("
+       << numLinearIterations << " linear iterations, "
+       << _numJacobians << " Jacobian reforms, "
+       << _numPCSetups << " preconditioner setups).";
+  if (_initialGuessReduction > 0.0) {
+    info << " Initial guess reduced linearized residual by factor " << _initialGuessReduction << ".";
+  } // if
+  info << journal::endl;
+
+  PYLITH_METHOD_END;
+} // _logIterations
+
 // ----------------------------------------------------------------------
 // Initialize logger.
 void
@@ -43,6 +43,16 @@ class pylith::problems::SolverNonlinear : public Solver
 { // SolverNonlinear
   friend class TestSolverNonlinear; // unit testing
 
+// PUBLIC ENUMS /////////////////////////////////////////////////////////
+public :
+
+  /// Type of nonlinear solver.
+  enum SolverTypeEnum {
+    SOLVER_NEWTON=0, ///< Newton with custom backtracking line search.
+    SOLVER_NRICHARDSON=1, ///< Nonlinear Richardson (no Jacobian).
+    SOLVER_QUASI_NEWTON=2, ///< L-BFGS quasi-Newton using Jacobian as initial Hessian.
+  }; // SolverTypeEnum
+
 // PUBLIC MEMBERS ///////////////////////////////////////////////////////
 public :
 
@@ -55,6 +65,61 @@ public :
   /// Deallocate PETSc and local data structures.
   void deallocate(void);
   
+  /** Set flag for reusing residual from last trial step of line
+   * search rather than reforming the residual at the accepted step.
+   *
+   * @param[in] value True to reuse residual.
+   */
+  void lineSearchReuseResidual(const bool value);
+
+  /** Set minimum ratio of actual to predicted decrease in the merit
+   * function for reusing the residual from the last trial step.
+   *
+   * The predicted decrease comes from the linearized residual, F -
+   * lambda J Y, which is available from the computation of the
+   * initial slope. A small ratio indicates the adjustment of the
+   * fault constraints during the residual evaluation changed the
+   * trial solution significantly, so we reform the residual.
+   *
+   * @param[in] value Minimum ratio (0 to always reuse residual).
+   */
+  void lineSearchAcceptRatio(const PylithScalar value);
+
+  /** Set type of nonlinear solver.
+   *
+   * @param[in] value Type of nonlinear solver.
+   */
+  void solverType(const SolverTypeEnum value);
+
+  /** Set flag for adapting tolerance of linear solve in each Newton
+   * step (Eisenstat-Walker).
+   *
+   * @param[in] value True to use adaptive linear tolerance.
+   */
+  void adaptiveLinearTolerance(const bool value);
+
+  /** Set number of nonlinear iterations between reforming the
+   * Jacobian.
+   *
+   * @param[in] value Number of iterations (1 reforms the Jacobian every iteration).
+   */
+  void lagJacobian(const int value);
+
+  /** Set number of Jacobian reforms between rebuilding the
+   * preconditioner.
+   *
+   * @param[in] value Number of iterations (1 rebuilds the preconditioner every Jacobian reform).
+   */
+  void lagPreconditioner(const int value);
+
+  /** Set flag for updating state variables using the strain from
+   * the residual evaluation at the converged solution, rather than
+   * recomputing the strain in a separate pass over the cells.
+   *
+   * @param[in] value True to reuse strain from residual evaluation.
+   */
+  void fuseStateVarsUpdate(const bool value);
+
   /** Initialize solver.
    *
    * @param fields Solution fields.
@@ -98,7 +163,7 @@ public :
    * @param tmpSolveSolnVec Temporary PETSc vector for solution.
    * @param jacobianMat PETSc sparse matrix for system Jacobian.
    * @param preconditionerMat PETSc sparse matrix for preconditioner.
-   * @param context ArgsJacobian structure with arguments.
+   * @param context Context for Jacobian (SolverNonlinear).
    * @returns PETSc error code.
    */
   static
@@ -111,7 +176,7 @@ public :
   /** Generic C interface for customized PETSc line search.
    *
    * @param linesearch PETSc line search.
-   * @param lsctx Optional context for line search (not used here).
+   * @param lsctx Context for line search (SolverNonlinear).
    * @returns PETSc error code.
    */
   static
@@ -122,7 +187,7 @@ public :
    *
    * @param snes PETSc SNES solver.
    * @param initialGuessVec PETSc vector for initial guess.
-   * @param lsctx Optional context for line search (not used here).
+   * @param lsctx Context for initial guess (SolverNonlinear).
    * @returns PETSc error code.
    */
   static
@@ -136,10 +201,23 @@ private :
   /// Initialize logger.
   void _initializeLogger(void);
 
+  /// Report number of iterations, Jacobian and preconditioner
+  /// evaluations, and savings from initial guess.
+  void _logIterations(void);
+
 // PRIVATE MEMBERS //////////////////////////////////////////////////////
 private :
 
   PetscSNES _snes; ///< PETSc SNES nonlinear solver.
+  bool _lineSearchReuseResidual; ///< Reuse residual from last trial step in line search.
+  PylithScalar _lineSearchAcceptRatio; ///< Minimum ratio of actual to predicted decrease for reusing residual.
+  SolverTypeEnum _solverType; ///< Type of nonlinear solver.
+  bool _adaptiveLinearTolerance; ///< Use Eisenstat-Walker adaptive linear tolerance.
+  int _lagJacobian; ///< Number of nonlinear iterations between Jacobian reforms.
+  int _lagPreconditioner; ///< Number of Jacobian reforms between preconditioner rebuilds.
+  int _numJacobians; ///< Number of Jacobian reforms in current solve.
+  int _numPCSetups; ///< Number of preconditioner rebuilds in current solve.
+  bool _fuseStateVarsUpdate; ///< Update state variables using strain from final residual evaluation.
 
 // NOT IMPLEMENTED //////////////////////////////////////////////////////
 private :
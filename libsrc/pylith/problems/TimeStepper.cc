@@ -0,0 +1,264 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ======================================================================
+//
+
+#include <portinfo>
+
+#include "TimeStepper.hh" // implementation of class methods
+
+#include "Formulation.hh" // USES Formulation
+#include "SolverLumped.hh" // USES SolverLumped
+
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/Field.hh" // USES Field
+#include "pylith/topology/SolutionFields.hh" // USES SolutionFields
+#include "pylith/feassemble/Integrator.hh" // USES Integrator
+#include "pylith/feassemble/Constraint.hh" // USES Constraint
+
+#include "pylith/utils/EventLogger.hh" // USES EventLogger
+#include "pylith/utils/error.h" // USES PYLITH_CHECK_ERROR
+
+#include <cassert> // USES assert()
+
+// ----------------------------------------------------------------------
+// Constructor
+pylith::problems::TimeStepper::TimeStepper(void) :
+  _formulation(0),
+  _solver(0),
+  _jacobian(0),
+  _fields(0),
+  _logger(0),
+  _stageLogger(0)
+{ // constructor
+} // constructor
+
+// ----------------------------------------------------------------------
+// Destructor
+pylith::problems::TimeStepper::~TimeStepper(void)
+{ // destructor
+  deallocate();
+} // destructor
+
+// ----------------------------------------------------------------------
+// Deallocate PETSc and local data structures.
+void
+pylith::problems::TimeStepper::deallocate(void)
+{ // deallocate
+  PYLITH_METHOD_BEGIN;
+
+  _formulation = 0; // :TODO: Use shared pointer.
+  _solver = 0; // :TODO: Use shared pointer.
+  _jacobian = 0; // :TODO: Use shared pointer.
+  _fields = 0; // :TODO: Use shared pointer.
+  _constraints.clear(); // :TODO: Use shared pointers.
+  delete _logger; _logger = 0;
+  _stageLogger = 0; // :TODO: Use shared pointer.
+
+  PYLITH_METHOD_END;
+} // deallocate
+
+// ----------------------------------------------------------------------
+// Set handles to formulation, solver, and fields.
+void
+pylith::problems::TimeStepper::initialize(Formulation* const formulation,
+					  SolverLumped* const solver,
+					  topology::Field* const jacobian,
+					  topology::SolutionFields* const fields)
+{ // initialize
+  PYLITH_METHOD_BEGIN;
+
+  assert(formulation);
+  assert(solver);
+  assert(jacobian);
+  assert(fields);
+
+  _formulation = formulation;
+  _solver = solver;
+  _jacobian = jacobian;
+  _fields = fields;
+
+  _initializeLogger();
+
+  PYLITH_METHOD_END;
+} // initialize
+
+// ----------------------------------------------------------------------
+// Set logger with stages of the formulation.
+void
+pylith::problems::TimeStepper::stageLogger(utils::EventLogger* const logger)
+{ // stageLogger
+  _stageLogger = logger;
+} // stageLogger
+
+// ----------------------------------------------------------------------
+// Set handles to constraints.
+void
+pylith::problems::TimeStepper::constraints(feassemble::Constraint* constraintArray[],
+					   const int numConstraints)
+{ // constraints
+  assert( (!constraintArray && 0 == numConstraints) ||
+	  (constraintArray && 0 < numConstraints) );
+
+  _constraints.resize(numConstraints);
+  for (int i=0; i < numConstraints; ++i)
+    _constraints[i] = constraintArray[i];
+} // constraints
+
+// ----------------------------------------------------------------------
+// Set constrained DOF in the increment and time step of integrators.
+bool
+pylith::problems::TimeStepper::prestep(const PylithScalar t,
+				       const PylithScalar dt)
+{ // prestep
+  PYLITH_METHOD_BEGIN;
+
+  assert(_formulation);
+  assert(_fields);
+  assert(_logger);
+
+  const int prestepEvent = _logger->eventId("TSt prestep");
+  _logger->eventBegin(prestepEvent);
+
+  const topology::Field& dispIncr = _fields->get("dispIncr(t->t+dt)");
+  const size_t numConstraints = _constraints.size();
+  for (size_t i=0; i < numConstraints; ++i) {
+    assert(_constraints[i]);
+    _constraints[i]->setFieldIncr(t, t+dt, dispIncr);
+  } // for
+
+  int needNewJacobianLocal = 0;
+  const size_t numIntegrators = _formulation->_integrators.size();
+  for (size_t i=0; i < numIntegrators; ++i) {
+    assert(_formulation->_integrators[i]);
+    _formulation->_integrators[i]->timeStep(dt);
+    if (_formulation->_integrators[i]->needNewJacobian())
+      needNewJacobianLocal = 1;
+  } // for
+
+  int needNewJacobian = 0;
+  PetscErrorCode err = MPI_Allreduce(&needNewJacobianLocal, &needNewJacobian, 1, MPI_INT, MPI_MAX,
+				     dispIncr.mesh().comm());PYLITH_CHECK_ERROR(err);
+
+  _logger->eventEnd(prestepEvent);
+
+  PYLITH_METHOD_RETURN(needNewJacobian > 0);
+} // prestep
+
+// ----------------------------------------------------------------------
+// Reform the residual and solve for the increment in the solution.
+void
+pylith::problems::TimeStepper::step(const PylithScalar t,
+				    const PylithScalar dt)
+{ // step
+  PYLITH_METHOD_BEGIN;
+
+  assert(_formulation);
+  assert(_solver);
+  assert(_jacobian);
+  assert(_fields);
+  assert(_logger);
+
+  const int stepEvent = _logger->eventId("TSt step");
+  _logger->eventBegin(stepEvent);
+
+  if (_stageLogger) {
+    _stageLogger->stagePush(_stageLogger->stageId("Reform Residual"));
+  } // if
+  _formulation->updateSettings(_jacobian, _fields, t, dt);
+  _formulation->reformResidual();
+  if (_stageLogger) {
+    _stageLogger->stagePop();
+  } // if
+
+  topology::Field& dispIncr = _fields->get("dispIncr(t->t+dt)");
+  const topology::Field& residual = _fields->get("residual");
+  _solver->solve(&dispIncr, *_jacobian, residual);
+
+  _logger->eventEnd(stepEvent);
+
+  PYLITH_METHOD_END;
+} // step
+
+// ----------------------------------------------------------------------
+// Advance displacement fields and update state variables.
+void
+pylith::problems::TimeStepper::poststep(const PylithScalar t,
+					const PylithScalar dt)
+{ // poststep
+  PYLITH_METHOD_BEGIN;
+
+  assert(_formulation);
+  assert(_fields);
+  assert(_logger);
+
+  const int poststepEvent = _logger->eventId("TSt poststep");
+  _logger->eventBegin(poststepEvent);
+
+  advanceDisp(_fields);
+
+  const size_t numIntegrators = _formulation->_integrators.size();
+  for (size_t i=0; i < numIntegrators; ++i) {
+    assert(_formulation->_integrators[i]);
+    _formulation->_integrators[i]->updateStateVars(t, _fields);
+  } // for
+
+  _logger->eventEnd(poststepEvent);
+
+  PYLITH_METHOD_END;
+} // poststep
+
+// ----------------------------------------------------------------------
+// Advance the displacement fields from time t to time t+dt.
+void
+pylith::problems::TimeStepper::advanceDisp(topology::SolutionFields* fields)
+{ // advanceDisp
+  PYLITH_METHOD_BEGIN;
+
+  assert(fields);
+
+  topology::Field& dispIncr = fields->get("dispIncr(t->t+dt)");
+  topology::Field& dispT = fields->get("disp(t)");
+  topology::Field& dispTmdt = fields->get("disp(t-dt)");
+
+  // disp(t-dt) holds disp(t) after the swap, so disp(t+dt) is
+  // computed from disp(t-dt) and the increment.
+  dispTmdt.swapValues(dispT);
+  PetscErrorCode err = VecWAXPY(dispT.localVector(), 1.0, dispIncr.localVector(), dispTmdt.localVector());PYLITH_CHECK_ERROR(err);
+  dispIncr.zeroAll();
+
+  PYLITH_METHOD_END;
+} // advanceDisp
+
+// ----------------------------------------------------------------------
+// Initialize logger.
+void
+pylith::problems::TimeStepper::_initializeLogger(void)
+{ // initializeLogger
+  PYLITH_METHOD_BEGIN;
+
+  delete _logger; _logger = new utils::EventLogger;assert(_logger);
+  _logger->className("TimeStepper");
+  _logger->initialize();
+  _logger->registerEvent("TSt prestep");
+  _logger->registerEvent("TSt step");
+  _logger->registerEvent("TSt poststep");
+
+  PYLITH_METHOD_END;
+} // initializeLogger
+
+
+// End of file 
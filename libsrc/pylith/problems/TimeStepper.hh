@@ -0,0 +1,168 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file libsrc/problems/TimeStepper.hh
+ *
+ * @brief Object for advancing an explicit formulation in time.
+ *
+ * Each phase of a time step (prestep, step, and poststep) is a single
+ * call that loops over the constraints and integrators in C++, rather
+ * than a sequence of calls from Python for each constraint and
+ * integrator. The displacement fields are advanced from time t to
+ * time t+dt by exchanging the vectors of disp(t-dt) and disp(t)
+ * instead of copying disp(t) into disp(t-dt).
+ *
+ * The time loop itself remains in Python (TimeDependent.run()),
+ * because selecting the time step, writing output, checkpointing, and
+ * monitoring progress are done by Python components between the
+ * phases. TimeStepper only replaces the per-constraint and
+ * per-integrator calls within each phase.
+ */
+
+#if !defined(pylith_problems_timestepper_hh)
+#define pylith_problems_timestepper_hh
+
+// Include directives ---------------------------------------------------
+#include "problemsfwd.hh" // forward declarations
+
+#include "pylith/feassemble/feassemblefwd.hh" // USES Constraint
+#include "pylith/topology/topologyfwd.hh" // USES Field, SolutionFields
+#include "pylith/utils/utilsfwd.hh" // HOLDSA EventLogger, USES EventLogger
+#include "pylith/utils/types.hh" // USES PylithScalar
+
+#include <vector> // HASA std::vector
+
+// TimeStepper ----------------------------------------------------------
+/// Object for advancing an explicit formulation in time.
+class pylith::problems::TimeStepper
+{ // TimeStepper
+  friend class TestTimeStepper; // unit testing
+
+// PUBLIC MEMBERS ///////////////////////////////////////////////////////
+public :
+
+  /// Constructor
+  TimeStepper(void);
+
+  /// Destructor
+  ~TimeStepper(void);
+
+  /// Deallocate PETSc and local data structures.
+  void deallocate(void);
+
+  /** Set handles to formulation, solver, and fields.
+   *
+   * @param formulation Formulation of system of equations.
+   * @param solver Solver for system with lumped Jacobian.
+   * @param jacobian Lumped Jacobian of system.
+   * @param fields Solution fields.
+   */
+  void initialize(Formulation* const formulation,
+		  SolverLumped* const solver,
+		  topology::Field* const jacobian,
+		  topology::SolutionFields* const fields);
+
+  /** Set logger with stages of the formulation.
+   *
+   * The residual is reformed within the 'Reform Residual' stage
+   * registered by the logger, as in Formulation._reformResidual() on
+   * the Python side.
+   *
+   * @param logger Event logger of formulation.
+   */
+  void stageLogger(utils::EventLogger* const logger);
+
+  /** Set handles to constraints.
+   *
+   * @param constraintArray Array of constraints.
+   * @param numConstraints Number of constraints.
+   */
+  void constraints(feassemble::Constraint* constraintArray[],
+		   const int numConstraints);
+
+  /** Set values of constrained DOF in the increment in the solution
+   * and set the time step of the integrators.
+   *
+   * @param t Current time (nondimensional).
+   * @param dt Time step (nondimensional).
+   * @returns True if any integrator on any process needs a new
+   *   Jacobian, false otherwise.
+   */
+  bool prestep(const PylithScalar t,
+	       const PylithScalar dt);
+
+  /** Reform the residual and solve for the increment in the solution.
+   *
+   * @param t Current time (nondimensional).
+   * @param dt Time step (nondimensional).
+   */
+  void step(const PylithScalar t,
+	    const PylithScalar dt);
+
+  /** Advance the displacement fields from time t to time t+dt and
+   * update the state variables of the integrators.
+   *
+   * @param t Current time (nondimensional).
+   * @param dt Time step (nondimensional).
+   */
+  void poststep(const PylithScalar t,
+		const PylithScalar dt);
+
+  /** Advance the displacement fields from time t to time t+dt.
+   *
+   * disp(t-dt) = disp(t), disp(t) = disp(t) + dispIncr(t->t+dt), and
+   * dispIncr(t->t+dt) = 0. The values of disp(t) become the values
+   * of disp(t-dt) by exchanging the vectors of the two fields, so
+   * only the update of disp(t) and zeroing the increment pass over
+   * the values.
+   *
+   * @param fields Solution fields.
+   */
+  static
+  void advanceDisp(topology::SolutionFields* fields);
+
+// PRIVATE METHODS //////////////////////////////////////////////////////
+private :
+
+  /// Initialize logger.
+  void _initializeLogger(void);
+
+// PRIVATE MEMBERS //////////////////////////////////////////////////////
+private :
+
+  Formulation* _formulation; ///< Handle to formulation.
+  SolverLumped* _solver; ///< Handle to solver.
+  topology::Field* _jacobian; ///< Handle to lumped Jacobian.
+  topology::SolutionFields* _fields; ///< Handle to solution fields.
+  std::vector<feassemble::Constraint*> _constraints; ///< Array of constraints.
+  utils::EventLogger* _logger; ///< Event logger.
+  utils::EventLogger* _stageLogger; ///< Handle to event logger with stages of formulation.
+
+// NOT IMPLEMENTED //////////////////////////////////////////////////////
+private :
+
+  TimeStepper(const TimeStepper&); ///< Not implemented
+  const TimeStepper& operator=(const TimeStepper&); ///< Not implemented
+
+}; // TimeStepper
+
+#endif // pylith_problems_timestepper_hh
+
+
+// End of file 
@@ -39,6 +39,8 @@ namespace pylith {
     class SolverNonlinear;
     class SolverLumped;
 
+    class TimeStepper;
+
   } // problems
 } // pylith
 
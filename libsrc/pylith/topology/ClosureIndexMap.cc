@@ -0,0 +1,240 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ======================================================================
+//
+
+#include <portinfo>
+
+#include "ClosureIndexMap.hh" // implementation of class methods
+
+#include "pylith/utils/error.h" // USES PYLITH_CHECK_ERROR
+
+#include <algorithm> // USES std::find(), std::min_element(), std::max_element()
+#include <cassert> // USES assert()
+
+// ----------------------------------------------------------------------
+// Default constructor.
+pylith::topology::ClosureIndexMap::ClosureIndexMap(void) :
+  _cStart(0),
+  _cEnd(0)
+{ // constructor
+} // constructor
+
+// ----------------------------------------------------------------------
+// Destructor.
+pylith::topology::ClosureIndexMap::~ClosureIndexMap(void)
+{ // destructor
+  deallocate();
+} // destructor
+
+// ----------------------------------------------------------------------
+// Deallocate PETSc and local data structures.
+void
+pylith::topology::ClosureIndexMap::deallocate(void)
+{ // deallocate
+  PYLITH_METHOD_BEGIN;
+
+  PetscErrorCode err = 0;
+  for (size_t i=0; i < _sections.size(); ++i) {
+    err = PetscSectionDestroy(&_sections[i]);PYLITH_CHECK_ERROR(err);
+  } // for
+  _sections.clear();
+  for (size_t i=0; i < _incompatible.size(); ++i) {
+    err = PetscSectionDestroy(&_incompatible[i]);PYLITH_CHECK_ERROR(err);
+  } // for
+  _incompatible.clear();
+
+  _cellIndex.clear();
+  _offsets.clear();
+  _indices.clear();
+  _cStart = 0;
+  _cEnd = 0;
+
+  PYLITH_METHOD_END;
+} // deallocate
+
+// ----------------------------------------------------------------------
+// Compute offsets for closures of cells.
+void
+pylith::topology::ClosureIndexMap::initialize(PetscDM dm,
+					      PetscSection section,
+					      const PetscInt* cells,
+					      const PetscInt numCells)
+{ // initialize
+  PYLITH_METHOD_BEGIN;
+
+  assert(dm);
+  assert(section);
+  assert(cells || 0 == numCells);
+
+  deallocate();
+
+  PetscErrorCode err = 0;
+  err = PetscObjectReference((PetscObject) section);PYLITH_CHECK_ERROR(err);
+  _sections.push_back(section);
+
+  if (numCells <= 0) {
+    PYLITH_METHOD_END;
+  } // if
+
+  _cStart = *std::min_element(cells, cells+numCells);
+  _cEnd = *std::max_element(cells, cells+numCells) + 1;
+  _cellIndex.assign(_cEnd-_cStart, -1);
+  _offsets.resize(numCells+1);
+  _offsets[0] = 0;
+
+  PetscInt pStart = 0, pEnd = 0, numFields = 0;
+  err = PetscSectionGetChart(section, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+  err = PetscSectionGetNumFields(section, &numFields);PYLITH_CHECK_ERROR(err);
+
+  // Follow the ordering in DMPlexVecGetClosure(): points in the
+  // closure that are in the chart of the section and, for sections
+  // with fields, all points for a field before the next field.
+  PetscInt* closure = NULL;
+  PetscInt closureSize = 0;
+  for (PetscInt c=0; c < numCells; ++c) {
+    const PetscInt cell = cells[c];
+    err = DMPlexGetTransitiveClosure(dm, cell, PETSC_TRUE, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
+    const PetscInt numPasses = (numFields > 0) ? numFields : 1;
+    for (PetscInt f=0; f < numPasses; ++f) {
+      for (PetscInt p=0; p < closureSize*2; p += 2) {
+	const PetscInt point = closure[p];
+	if (point < pStart || point >= pEnd) {
+	  continue;
+	} // if
+
+	PetscInt dof = 0, off = 0, cdof = 0;
+	const PetscInt* cdofs = NULL;
+	if (numFields > 0) {
+	  err = PetscSectionGetFieldDof(section, point, f, &dof);PYLITH_CHECK_ERROR(err);
+	  err = PetscSectionGetFieldOffset(section, point, f, &off);PYLITH_CHECK_ERROR(err);
+	  err = PetscSectionGetFieldConstraintDof(section, point, f, &cdof);PYLITH_CHECK_ERROR(err);
+	  if (cdof > 0) {
+	    err = PetscSectionGetFieldConstraintIndices(section, point, f, &cdofs);PYLITH_CHECK_ERROR(err);
+	  } // if
+	} else {
+	  err = PetscSectionGetDof(section, point, &dof);PYLITH_CHECK_ERROR(err);
+	  err = PetscSectionGetOffset(section, point, &off);PYLITH_CHECK_ERROR(err);
+	  err = PetscSectionGetConstraintDof(section, point, &cdof);PYLITH_CHECK_ERROR(err);
+	  if (cdof > 0) {
+	    err = PetscSectionGetConstraintIndices(section, point, &cdofs);PYLITH_CHECK_ERROR(err);
+	  } // if
+	} // if/else
+
+	for (PetscInt d=0; d < dof; ++d) {
+	  const bool isConstrained = cdof > 0 && std::find(cdofs, cdofs+cdof, d) != cdofs+cdof;
+	  _indices.push_back(isConstrained ? -(off+d+1) : off+d);
+	} // for
+      } // for
+    } // for
+    err = DMPlexRestoreTransitiveClosure(dm, cell, PETSC_TRUE, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
+
+    _offsets[c+1] = _indices.size();
+    _cellIndex[cell-_cStart] = c;
+  } // for
+
+  PYLITH_METHOD_END;
+} // initialize
+
+// ----------------------------------------------------------------------
+// Check whether a section has the same layout as the section used to
+// create the map.
+bool
+pylith::topology::ClosureIndexMap::isCompatible(PetscSection section)
+{ // isCompatible
+  PYLITH_METHOD_BEGIN;
+
+  if (!section || _sections.empty()) {
+    PYLITH_METHOD_RETURN(false);
+  } // if
+  if (std::find(_sections.begin(), _sections.end(), section) != _sections.end()) {
+    PYLITH_METHOD_RETURN(true);
+  } // if
+  if (std::find(_incompatible.begin(), _incompatible.end(), section) != _incompatible.end()) {
+    PYLITH_METHOD_RETURN(false);
+  } // if
+
+  // Hold a reference, so that a new section cannot reuse the address.
+  PetscErrorCode err = PetscObjectReference((PetscObject) section);PYLITH_CHECK_ERROR(err);
+  const bool isSame = _sameLayout(_sections[0], section);
+  if (isSame) {
+    _sections.push_back(section);
+  } else {
+    _incompatible.push_back(section);
+  } // if/else
+
+  PYLITH_METHOD_RETURN(isSame);
+} // isCompatible
+
+// ----------------------------------------------------------------------
+// Check whether two sections have the same layout.
+bool
+pylith::topology::ClosureIndexMap::_sameLayout(PetscSection sectionA,
+					       PetscSection sectionB)
+{ // _sameLayout
+  PYLITH_METHOD_BEGIN;
+
+  assert(sectionA);
+  assert(sectionB);
+
+  PetscErrorCode err = 0;
+  PetscInt pStartA = 0, pEndA = 0, pStartB = 0, pEndB = 0;
+  err = PetscSectionGetChart(sectionA, &pStartA, &pEndA);PYLITH_CHECK_ERROR(err);
+  err = PetscSectionGetChart(sectionB, &pStartB, &pEndB);PYLITH_CHECK_ERROR(err);
+  PetscInt numFieldsA = 0, numFieldsB = 0;
+  err = PetscSectionGetNumFields(sectionA, &numFieldsA);PYLITH_CHECK_ERROR(err);
+  err = PetscSectionGetNumFields(sectionB, &numFieldsB);PYLITH_CHECK_ERROR(err);
+  if (pStartA != pStartB || pEndA != pEndB || numFieldsA != numFieldsB) {
+    PYLITH_METHOD_RETURN(false);
+  } // if
+
+  for (PetscInt point=pStartA; point < pEndA; ++point) {
+    PetscInt dofA = 0, dofB = 0, offA = 0, offB = 0, cdofA = 0, cdofB = 0;
+    err = PetscSectionGetDof(sectionA, point, &dofA);PYLITH_CHECK_ERROR(err);
+    err = PetscSectionGetDof(sectionB, point, &dofB);PYLITH_CHECK_ERROR(err);
+    err = PetscSectionGetOffset(sectionA, point, &offA);PYLITH_CHECK_ERROR(err);
+    err = PetscSectionGetOffset(sectionB, point, &offB);PYLITH_CHECK_ERROR(err);
+    err = PetscSectionGetConstraintDof(sectionA, point, &cdofA);PYLITH_CHECK_ERROR(err);
+    err = PetscSectionGetConstraintDof(sectionB, point, &cdofB);PYLITH_CHECK_ERROR(err);
+    if (dofA != dofB || offA != offB || cdofA != cdofB) {
+      PYLITH_METHOD_RETURN(false);
+    } // if
+    if (cdofA > 0) {
+      const PetscInt* cdofsA = NULL;
+      const PetscInt* cdofsB = NULL;
+      err = PetscSectionGetConstraintIndices(sectionA, point, &cdofsA);PYLITH_CHECK_ERROR(err);
+      err = PetscSectionGetConstraintIndices(sectionB, point, &cdofsB);PYLITH_CHECK_ERROR(err);
+      if (!std::equal(cdofsA, cdofsA+cdofA, cdofsB)) {
+	PYLITH_METHOD_RETURN(false);
+      } // if
+    } // if
+
+    for (PetscInt f=0; f < numFieldsA; ++f) {
+      err = PetscSectionGetFieldDof(sectionA, point, f, &dofA);PYLITH_CHECK_ERROR(err);
+      err = PetscSectionGetFieldDof(sectionB, point, f, &dofB);PYLITH_CHECK_ERROR(err);
+      err = PetscSectionGetFieldOffset(sectionA, point, f, &offA);PYLITH_CHECK_ERROR(err);
+      err = PetscSectionGetFieldOffset(sectionB, point, f, &offB);PYLITH_CHECK_ERROR(err);
+      if (dofA != dofB || offA != offB) {
+	PYLITH_METHOD_RETURN(false);
+      } // if
+    } // for
+  } // for
+
+  PYLITH_METHOD_RETURN(true);
+} // _sameLayout
+
+
+// End of file
@@ -0,0 +1,182 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file libsrc/topology/ClosureIndexMap.hh
+ *
+ * @brief Table of offsets into a local vector for the closures of a
+ * set of cells.
+ *
+ * The table is computed once from the layout of a PETSc section, so
+ * that restricting a field to a cell and adding values from a cell
+ * become indexed gathers and scatters without traversing the
+ * closure or querying the section. The table can be used with any
+ * section that has the same layout as the section used to create it,
+ * such as the sections of fields created with Field::cloneSection().
+ */
+
+#if !defined(pylith_topology_closureindexmap_hh)
+#define pylith_topology_closureindexmap_hh
+
+// Include directives ---------------------------------------------------
+#include "topologyfwd.hh" // forward declarations
+
+#include "pylith/utils/petscfwd.h" // USES PetscDM
+
+#include <vector> // HASA std::vector
+
+// ClosureIndexMap ------------------------------------------------------
+/// Table of offsets into a local vector for the closures of cells.
+class pylith::topology::ClosureIndexMap
+{ // ClosureIndexMap
+  friend class TestClosureIndexMap; // unit testing
+
+// PUBLIC METHODS ///////////////////////////////////////////////////////
+public :
+
+  /// Default constructor.
+  ClosureIndexMap(void);
+
+  /// Destructor.
+  ~ClosureIndexMap(void);
+
+  /// Deallocate PETSc and local data structures.
+  void deallocate(void);
+
+  /** Compute offsets for closures of cells.
+   *
+   * @param dm PETSc DM for mesh.
+   * @param section Local section for field.
+   * @param cells Array of cells.
+   * @param numCells Number of cells.
+   */
+  void initialize(PetscDM dm,
+		  PetscSection section,
+		  const PetscInt* cells,
+		  const PetscInt numCells);
+
+  /** Check whether a section has the same layout as the section used
+   * to create the map.
+   *
+   * The result is cached for each section, so the layout of a
+   * section is compared only the first time.
+   *
+   * @param section Local section for field.
+   * @returns True if map can be used with section, false otherwise.
+   */
+  bool isCompatible(PetscSection section);
+
+  /** Check whether map contains cell.
+   *
+   * @param cell Finite-element cell.
+   * @returns True if cell is in map, false otherwise.
+   */
+  bool hasCell(const PetscInt cell) const;
+
+  /** Get number of values in closure of cell.
+   *
+   * @param cell Finite-element cell.
+   * @returns Number of values in closure.
+   */
+  PetscInt closureSize(const PetscInt cell) const;
+
+  /** Get values associated with closure of cell.
+   *
+   * @param values Array of values for cell.
+   * @param valuesSize Size of values array.
+   * @param array Array of values for local vector.
+   * @param cell Finite-element cell.
+   */
+  void getClosure(PetscScalar* values,
+		  const PetscInt valuesSize,
+		  const PetscScalar* array,
+		  const PetscInt cell) const;
+
+  /** Set values associated with closure of cell.
+   *
+   * Supports INSERT_VALUES and ADD_VALUES, which skip constrained
+   * degrees of freedom, and INSERT_ALL_VALUES and ADD_ALL_VALUES.
+   *
+   * @param array Array of values for local vector.
+   * @param values Array of values for cell.
+   * @param valuesSize Size of values array.
+   * @param cell Finite-element cell.
+   * @param mode Mode for inserting values.
+   */
+  void setClosure(PetscScalar* array,
+		  const PetscScalar* values,
+		  const PetscInt valuesSize,
+		  const PetscInt cell,
+		  const InsertMode mode) const;
+
+  /** Check whether mode is supported by setClosure().
+   *
+   * @param mode Mode for inserting values.
+   * @returns True if mode is supported, false otherwise.
+   */
+  static
+  bool isSupported(const InsertMode mode);
+
+// PRIVATE METHODS //////////////////////////////////////////////////////
+private :
+
+  /** Check whether two sections have the same layout.
+   *
+   * @param sectionA Section to compare.
+   * @param sectionB Section to compare.
+   * @returns True if sections have same layout, false otherwise.
+   */
+  static
+  bool _sameLayout(PetscSection sectionA,
+		   PetscSection sectionB);
+
+// PRIVATE MEMBERS //////////////////////////////////////////////////////
+private :
+
+  /// Sections with the same layout as the map (referenced).
+  std::vector<PetscSection> _sections;
+
+  /// Sections with a different layout than the map (referenced).
+  std::vector<PetscSection> _incompatible;
+
+  /// Index of cell in table (-1 if cell is not in map) for cells in [_cStart, _cEnd).
+  std::vector<PetscInt> _cellIndex;
+
+  /// Offset into _indices for closure of each cell in table.
+  std::vector<PetscInt> _offsets;
+
+  /// Offsets into local vector for closures (-(offset+1) for constrained dof).
+  std::vector<PetscInt> _indices;
+
+  PetscInt _cStart; ///< First cell in range of cells in map.
+  PetscInt _cEnd; ///< One past last cell in range of cells in map.
+
+// NOT IMPLEMENTED //////////////////////////////////////////////////////
+private :
+
+  ClosureIndexMap(const ClosureIndexMap&); ///< Not implemented
+  const ClosureIndexMap& operator=(const ClosureIndexMap&); ///< Not implemented
+
+}; // ClosureIndexMap
+
+#include "ClosureIndexMap.icc" // inline methods
+
+#endif // pylith_topology_closureindexmap_hh
+
+
+// End of file
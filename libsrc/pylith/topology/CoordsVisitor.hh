@@ -108,6 +108,15 @@ public :
 		      PetscInt* coordsSize,
 		      const PetscInt cell) const;
 
+  /** Use table of offsets for closures in getClosure().
+   *
+   * The table is used only if the coordinates section has the same
+   * layout as the table; otherwise, getClosure() uses DMPlex.
+   *
+   * @param map Table of offsets for closures (NULL to not use table).
+   */
+  void closureIndexMap(ClosureIndexMap* map);
+
   /** Optimize the closure operator by creating index for closures.
    *
    * @param dmMesh PETSc DM to optimize closure on coordinates field.
@@ -122,6 +131,7 @@ private :
   PetscSection _section; ///< Cached PETSc section.
   PetscVec _localVec; ///< Cached local PETSc Vec.
   PetscScalar* _localArray; ///< Cached local array.
+  const ClosureIndexMap* _closureMap; ///< Table of offsets for closures (NULL if not used).
 
 // NOT IMPLEMENTED //////////////////////////////////////////////////////
 private :
@@ -29,6 +29,7 @@
 
 #include "pylith/utils/error.h" // USES PYLITH_CHECK_ERROR
 #include <iostream> // USES std::cout
+#include <algorithm> // USES std::swap(), std::find()
 
 // ----------------------------------------------------------------------
 // Default constructor.
@@ -36,7 +37,8 @@ pylith::topology::Field::Field(const Mesh& mesh) :
   _mesh(mesh),
   _dm(NULL),
   _globalVec(NULL),
-  _localVec(NULL)
+  _localVec(NULL),
+  _ghostSF(NULL)
 { // constructor
   PYLITH_METHOD_BEGIN;
 
@@ -68,7 +70,8 @@ pylith::topology::Field::Field(const Mesh& mesh,
   _mesh(mesh),
   _dm(dm),
   _globalVec(NULL),
-  _localVec(NULL)
+  _localVec(NULL),
+  _ghostSF(NULL)
 { // constructor
   PYLITH_METHOD_BEGIN;
 
@@ -93,7 +96,8 @@ pylith::topology::Field::Field(const Mesh& mesh,
   _mesh(mesh),
   _dm(dm),
   _globalVec(NULL),
-  _localVec(NULL)
+  _localVec(NULL),
+  _ghostSF(NULL)
 { // constructor
   PYLITH_METHOD_BEGIN;
 
@@ -586,6 +590,7 @@ pylith::topology::Field::clear(void)
 
   err = VecDestroy(&_globalVec);PYLITH_CHECK_ERROR(err);
   err = VecDestroy(&_localVec);PYLITH_CHECK_ERROR(err);
+  err = PetscSFDestroy(&_ghostSF);PYLITH_CHECK_ERROR(err);
 
   const subfields_type::const_iterator subfieldsEnd = _subfields.end();
   for (subfields_type::iterator s_iter=_subfields.begin(); s_iter != subfieldsEnd; ++s_iter) {
@@ -614,6 +619,7 @@ pylith::topology::Field::allocate(void)
   } // if
   assert(s);
   err = PetscSectionSetUp(s);PYLITH_CHECK_ERROR(err);
+  err = PetscSFDestroy(&_ghostSF);PYLITH_CHECK_ERROR(err);
 
   err = VecDestroy(&_globalVec);PYLITH_CHECK_ERROR(err);
   err = DMCreateGlobalVector(_dm, &_globalVec);PYLITH_CHECK_ERROR(err);
@@ -687,18 +693,60 @@ pylith::topology::Field::complete(void)
 { // complete
   PYLITH_METHOD_BEGIN;
 
+  completeBegin();
+  completeEnd();
+
+  PYLITH_METHOD_END;
+} // complete
+
+// ----------------------------------------------------------------------
+// Begin completing section by assembling across processors.
+void
+pylith::topology::Field::completeBegin(void)
+{ // completeBegin
+  PYLITH_METHOD_BEGIN;
+
   assert(_dm);
-  // Not sure if DMLocalToLocal() would work
+  assert(_localVec);
+
+  if (!_ghostSF) {
+    _createGhostSF();
+  } // if
+
+  // Add values at ghost points to values at owned points. The values
+  // at ghost points are packed here, so only they must remain fixed
+  // until completeEnd().
   PetscErrorCode err;
+  PetscScalar* localArray = NULL;
+  err = VecGetArray(_localVec, &localArray);PYLITH_CHECK_ERROR(err);
+  err = PetscSFReduceBegin(_ghostSF, MPIU_SCALAR, localArray, localArray, MPI_SUM);PYLITH_CHECK_ERROR(err);
+  err = VecRestoreArray(_localVec, &localArray);PYLITH_CHECK_ERROR(err);
+
+  PYLITH_METHOD_END;
+} // completeBegin
+
+// ----------------------------------------------------------------------
+// End completing section by assembling across processors.
+void
+pylith::topology::Field::completeEnd(void)
+{ // completeEnd
+  PYLITH_METHOD_BEGIN;
 
-  err = VecSet(_globalVec, 0.0);PYLITH_CHECK_ERROR(err);
-  err = DMLocalToGlobalBegin(_dm, _localVec, ADD_VALUES, _globalVec);PYLITH_CHECK_ERROR(err);
-  err = DMLocalToGlobalEnd(_dm, _localVec, ADD_VALUES, _globalVec);PYLITH_CHECK_ERROR(err);
-  err = DMGlobalToLocalBegin(_dm, _globalVec, INSERT_VALUES, _localVec);PYLITH_CHECK_ERROR(err);
-  err = DMGlobalToLocalEnd(_dm, _globalVec, INSERT_VALUES, _localVec);PYLITH_CHECK_ERROR(err);
+  assert(_ghostSF);
+  assert(_localVec);
+
+  // Finish adding values at ghost points to values at owned points,
+  // and then copy the assembled values back to the ghost points.
+  PetscErrorCode err;
+  PetscScalar* localArray = NULL;
+  err = VecGetArray(_localVec, &localArray);PYLITH_CHECK_ERROR(err);
+  err = PetscSFReduceEnd(_ghostSF, MPIU_SCALAR, localArray, localArray, MPI_SUM);PYLITH_CHECK_ERROR(err);
+  err = PetscSFBcastBegin(_ghostSF, MPIU_SCALAR, localArray, localArray);PYLITH_CHECK_ERROR(err);
+  err = PetscSFBcastEnd(_ghostSF, MPIU_SCALAR, localArray, localArray);PYLITH_CHECK_ERROR(err);
+  err = VecRestoreArray(_localVec, &localArray);PYLITH_CHECK_ERROR(err);
 
   PYLITH_METHOD_END;
-} // complete
+} // completeEnd
 
 // ----------------------------------------------------------------------
 // Copy field values and metadata.
@@ -741,6 +789,65 @@ pylith::topology::Field::copy(const Field& field)
   PYLITH_METHOD_END;
 } // copy
 
+// ----------------------------------------------------------------------
+// Swap values with another field with the same layout.
+void
+pylith::topology::Field::swapValues(Field& field)
+{ // swapValues
+  PYLITH_METHOD_BEGIN;
+
+  // Check compatibility of sections
+  const int srcSize = field.chartSize();
+  const int dstSize = chartSize();
+  PetscInt srcStorageSize = 0, dstStorageSize = 0;
+  PetscErrorCode err;
+  if (field._localVec) {
+    err = VecGetLocalSize(field._localVec, &srcStorageSize);PYLITH_CHECK_ERROR(err);
+  } // if
+  if (_localVec) {
+    err = VecGetLocalSize(_localVec, &dstStorageSize);PYLITH_CHECK_ERROR(err);
+  } // if
+  if (field.spaceDim() != spaceDim() ||
+      srcSize != dstSize ||
+      srcStorageSize != dstStorageSize) {
+    std::ostringstream msg;
+
+    msg << "Cannot swap values of section '" << field._metadata.label 
+	<< "' and section '" << _metadata.label
+	<< "'. Sections are incompatible.\n"
+	<< "  Section '" << field._metadata.label << "':\n"
+	<< "    space dim: " << field.spaceDim() << "\n"
+	<< "    chart size: " << srcSize << "\n"
+	<< "    storage size: " << srcStorageSize << "\n"
+	<< "  Section '" << _metadata.label << "':\n"
+	<< "    space dim: " << spaceDim() << "\n"
+	<< "    chart size: " << dstSize << "\n"
+	<< "    storage size: " << dstStorageSize;
+    throw std::runtime_error(msg.str());
+  } // if
+  assert(_localVec && field._localVec);
+
+  // Advance states so that neither vector returns to a state that
+  // was observed for the other field.
+  PetscObjectState stateA = 0, stateB = 0;
+  err = PetscObjectStateGet((PetscObject) _localVec, &stateA);PYLITH_CHECK_ERROR(err);
+  err = PetscObjectStateGet((PetscObject) field._localVec, &stateB);PYLITH_CHECK_ERROR(err);
+  const PetscObjectState state = ((stateA > stateB) ? stateA : stateB) + 1;
+
+  // Only the local vectors hold the values of the field. The global
+  // vectors may be shared with scatters, so they stay with the fields.
+  std::swap(_localVec, field._localVec);
+
+  err = PetscObjectStateSet((PetscObject) _localVec, state);PYLITH_CHECK_ERROR(err);
+  err = PetscObjectStateSet((PetscObject) field._localVec, state);PYLITH_CHECK_ERROR(err);
+
+  // Keep names of vectors consistent with labels of fields.
+  label(_metadata.label.c_str());
+  field.label(field._metadata.label.c_str());
+
+  PYLITH_METHOD_END;
+} // swapValues
+
 // ----------------------------------------------------------------------
 // Add two fields, storing the result in one of the fields.
 pylith::topology::Field&
@@ -1107,17 +1214,79 @@ pylith::topology::Field::scatterLocalToGlobal(const PetscVec vector,
 { // scatterLocalToGlobal
   PYLITH_METHOD_BEGIN;
 
+  scatterLocalToGlobalBegin(vector, context);
+  scatterLocalToGlobalEnd(vector, context);
+  
+  PYLITH_METHOD_END;
+} // scatterLocalToGlobal
+
+// ----------------------------------------------------------------------
+// Begin scattering section information across processors to update
+// the PETSc vector view of the field.
+void
+pylith::topology::Field::scatterLocalToGlobalBegin(const char* context) const
+{ // scatterLocalToGlobalBegin
+  PYLITH_METHOD_BEGIN;
+
+  assert(context);
+  const ScatterInfo& sinfo = _getScatter(context);
+  scatterLocalToGlobalBegin(sinfo.vector, context);
+
+  PYLITH_METHOD_END;
+} // scatterLocalToGlobalBegin
+
+// ----------------------------------------------------------------------
+// Begin scattering section information across processors to update
+// the PETSc vector view of the field.
+void
+pylith::topology::Field::scatterLocalToGlobalBegin(const PetscVec vector,
+						     const char* context) const
+{ // scatterLocalToGlobalBegin
+  PYLITH_METHOD_BEGIN;
+
   assert(vector);
   assert(context);
   const ScatterInfo& sinfo = _getScatter(context);
-  PetscErrorCode err = 0;
   if (sinfo.dm) {
-    err = DMLocalToGlobalBegin(sinfo.dm, _localVec, INSERT_VALUES, vector);PYLITH_CHECK_ERROR(err);
-    err = DMLocalToGlobalEnd(sinfo.dm, _localVec, INSERT_VALUES, vector);PYLITH_CHECK_ERROR(err);
+    PetscErrorCode err = DMLocalToGlobalBegin(sinfo.dm, _localVec, INSERT_VALUES, vector);PYLITH_CHECK_ERROR(err);
   } // if
-  
+
   PYLITH_METHOD_END;
-} // scatterLocalToGlobal
+} // scatterLocalToGlobalBegin
+
+// ----------------------------------------------------------------------
+// End scattering section information across processors to update the
+// PETSc vector view of the field.
+void
+pylith::topology::Field::scatterLocalToGlobalEnd(const char* context) const
+{ // scatterLocalToGlobalEnd
+  PYLITH_METHOD_BEGIN;
+
+  assert(context);
+  const ScatterInfo& sinfo = _getScatter(context);
+  scatterLocalToGlobalEnd(sinfo.vector, context);
+
+  PYLITH_METHOD_END;
+} // scatterLocalToGlobalEnd
+
+// ----------------------------------------------------------------------
+// End scattering section information across processors to update the
+// PETSc vector view of the field.
+void
+pylith::topology::Field::scatterLocalToGlobalEnd(const PetscVec vector,
+						   const char* context) const
+{ // scatterLocalToGlobalEnd
+  PYLITH_METHOD_BEGIN;
+
+  assert(vector);
+  assert(context);
+  const ScatterInfo& sinfo = _getScatter(context);
+  if (sinfo.dm) {
+    PetscErrorCode err = DMLocalToGlobalEnd(sinfo.dm, _localVec, INSERT_VALUES, vector);PYLITH_CHECK_ERROR(err);
+  } // if
+
+  PYLITH_METHOD_END;
+} // scatterLocalToGlobalEnd
 
 // ----------------------------------------------------------------------
 // Scatter PETSc vector information across processors to update the
@@ -1144,18 +1313,79 @@ pylith::topology::Field::scatterGlobalToLocal(const PetscVec vector,
 { // scatterGlobalToLocal
   PYLITH_METHOD_BEGIN;
 
+  scatterGlobalToLocalBegin(vector, context);
+  scatterGlobalToLocalEnd(vector, context);
+
+  PYLITH_METHOD_END;
+} // scatterGlobalToLocal
+
+// ----------------------------------------------------------------------
+// Begin scattering PETSc vector information across processors to
+// update the section view of the field.
+void
+pylith::topology::Field::scatterGlobalToLocalBegin(const char* context) const
+{ // scatterGlobalToLocalBegin
+  PYLITH_METHOD_BEGIN;
+
+  assert(context);
+  const ScatterInfo& sinfo = _getScatter(context);
+  scatterGlobalToLocalBegin(sinfo.vector, context);
+
+  PYLITH_METHOD_END;
+} // scatterGlobalToLocalBegin
+
+// ----------------------------------------------------------------------
+// Begin scattering PETSc vector information across processors to
+// update the section view of the field.
+void
+pylith::topology::Field::scatterGlobalToLocalBegin(const PetscVec vector,
+						     const char* context) const
+{ // scatterGlobalToLocalBegin
+  PYLITH_METHOD_BEGIN;
+
   assert(vector);
   assert(context);
   const ScatterInfo& sinfo = _getScatter(context);
-  PetscErrorCode err = 0;
+  if (sinfo.dm) {
+    PetscErrorCode err = DMGlobalToLocalBegin(sinfo.dm, vector, INSERT_VALUES, _localVec);PYLITH_CHECK_ERROR(err);
+  } // if
+
+  PYLITH_METHOD_END;
+} // scatterGlobalToLocalBegin
+
+// ----------------------------------------------------------------------
+// End scattering PETSc vector information across processors to update
+// the section view of the field.
+void
+pylith::topology::Field::scatterGlobalToLocalEnd(const char* context) const
+{ // scatterGlobalToLocalEnd
+  PYLITH_METHOD_BEGIN;
+
+  assert(context);
+  const ScatterInfo& sinfo = _getScatter(context);
+  scatterGlobalToLocalEnd(sinfo.vector, context);
+
+  PYLITH_METHOD_END;
+} // scatterGlobalToLocalEnd
+
+// ----------------------------------------------------------------------
+// End scattering PETSc vector information across processors to update
+// the section view of the field.
+void
+pylith::topology::Field::scatterGlobalToLocalEnd(const PetscVec vector,
+						   const char* context) const
+{ // scatterGlobalToLocalEnd
+  PYLITH_METHOD_BEGIN;
 
+  assert(vector);
+  assert(context);
+  const ScatterInfo& sinfo = _getScatter(context);
   if (sinfo.dm) {
-    err = DMGlobalToLocalBegin(sinfo.dm, vector, INSERT_VALUES, _localVec);PYLITH_CHECK_ERROR(err);
-    err = DMGlobalToLocalEnd(sinfo.dm, vector, INSERT_VALUES, _localVec);PYLITH_CHECK_ERROR(err);
+    PetscErrorCode err = DMGlobalToLocalEnd(sinfo.dm, vector, INSERT_VALUES, _localVec);PYLITH_CHECK_ERROR(err);
   } // if
 
   PYLITH_METHOD_END;
-} // scatterGlobalToLocal
+} // scatterGlobalToLocalEnd
 
 // ----------------------------------------------------------------------
 // Get scatter for given context.
@@ -1221,6 +1451,92 @@ pylith::topology::Field::_getScatter(const char* context) const
   PYLITH_METHOD_RETURN(s_iter->second);
 } // _getScatter
 
+// ----------------------------------------------------------------------
+// Create star forest for DOF at points shared with other processors.
+void
+pylith::topology::Field::_createGhostSF(void)
+{ // _createGhostSF
+  PYLITH_METHOD_BEGIN;
+
+  assert(_dm);
+  assert(!_ghostSF);
+
+  PetscErrorCode err;
+  PetscSection section = NULL;
+  PetscSF pointSF = NULL;
+  err = DMGetDefaultSection(_dm, &section);PYLITH_CHECK_ERROR(err);assert(section);
+  err = DMGetPointSF(_dm, &pointSF);PYLITH_CHECK_ERROR(err);assert(pointSF);
+
+  PetscInt numRoots = 0, numLeaves = 0;
+  const PetscInt* leaves = NULL;
+  const PetscSFNode* remotePoints = NULL;
+  err = PetscSFGetGraph(pointSF, &numRoots, &numLeaves, &leaves, &remotePoints);PYLITH_CHECK_ERROR(err);
+
+  PetscInt storageSize = 0;
+  err = PetscSectionGetStorageSize(section, &storageSize);PYLITH_CHECK_ERROR(err);
+  err = PetscSFCreate(PetscObjectComm((PetscObject) _dm), &_ghostSF);PYLITH_CHECK_ERROR(err);
+  if (numRoots < 0) {
+    // Point SF has no graph (serial mesh), so nothing to communicate.
+    err = PetscSFSetGraph(_ghostSF, storageSize, 0, NULL, PETSC_OWN_POINTER, NULL, PETSC_OWN_POINTER);PYLITH_CHECK_ERROR(err);
+    PYLITH_METHOD_END;
+  } // if
+
+  // Offsets of the points on the owning processors. This is
+  // collective over the point SF, so it must be called on all
+  // processors, including those without any leaves.
+  PetscInt* remoteOffsets = NULL;
+  err = PetscSFCreateRemoteOffsets(pointSF, section, section, &remoteOffsets);PYLITH_CHECK_ERROR(err);
+  PetscInt pStart = 0, pEnd = 0;
+  err = PetscSectionGetChart(section, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+
+  PetscInt numDofLeaves = 0;
+  for (PetscInt i=0; i < numLeaves; ++i) {
+    const PetscInt point = leaves ? leaves[i] : i;
+    if (point < pStart || point >= pEnd) {
+      continue;
+    } // if
+    PetscInt dof = 0, cdof = 0;
+    err = PetscSectionGetDof(section, point, &dof);PYLITH_CHECK_ERROR(err);
+    err = PetscSectionGetConstraintDof(section, point, &cdof);PYLITH_CHECK_ERROR(err);
+    numDofLeaves += dof - cdof;
+  } // for
+
+  PetscInt* dofLeaves = NULL;
+  PetscSFNode* dofRemotes = NULL;
+  err = PetscMalloc1(numDofLeaves, &dofLeaves);PYLITH_CHECK_ERROR(err);
+  err = PetscMalloc1(numDofLeaves, &dofRemotes);PYLITH_CHECK_ERROR(err);
+  PetscInt index = 0;
+  for (PetscInt i=0; i < numLeaves; ++i) {
+    const PetscInt point = leaves ? leaves[i] : i;
+    if (point < pStart || point >= pEnd) {
+      continue;
+    } // if
+    PetscInt dof = 0, off = 0, cdof = 0;
+    const PetscInt* cdofs = NULL;
+    err = PetscSectionGetDof(section, point, &dof);PYLITH_CHECK_ERROR(err);
+    err = PetscSectionGetOffset(section, point, &off);PYLITH_CHECK_ERROR(err);
+    err = PetscSectionGetConstraintDof(section, point, &cdof);PYLITH_CHECK_ERROR(err);
+    if (cdof > 0) {
+      err = PetscSectionGetConstraintIndices(section, point, &cdofs);PYLITH_CHECK_ERROR(err);
+    } // if
+    for (PetscInt d=0; d < dof; ++d) {
+      if (cdof > 0 && std::find(cdofs, cdofs+cdof, d) != cdofs+cdof) {
+	continue;
+      } // if
+      dofLeaves[index] = off + d;
+      dofRemotes[index].rank = remotePoints[i].rank;
+      dofRemotes[index].index = remoteOffsets[point-pStart] + d;
+      ++index;
+    } // for
+  } // for
+  assert(index == numDofLeaves);
+  err = PetscFree(remoteOffsets);PYLITH_CHECK_ERROR(err);
+
+  err = PetscSFSetGraph(_ghostSF, storageSize, numDofLeaves, dofLeaves, PETSC_OWN_POINTER, dofRemotes, PETSC_OWN_POINTER);PYLITH_CHECK_ERROR(err);
+
+  PYLITH_METHOD_END;
+} // _createGhostSF
+
 // ----------------------------------------------------------------------
 // Experimental
 void
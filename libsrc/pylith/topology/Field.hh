@@ -353,12 +353,39 @@ public :
   /// Complete section by assembling across processors.
   void complete(void);
 
+  /** Begin completing section by assembling across processors.
+   *
+   * Only values at points shared with other processors are
+   * communicated. Values at points owned by other processors (ghost
+   * points) must not change until completeEnd(); values at other
+   * points may be updated in the meantime and are included in the
+   * assembled values.
+   */
+  void completeBegin(void);
+
+  /// End completing section by assembling across processors.
+  void completeEnd(void);
+
   /** Copy field values and metadata.
    *
    * @param field Field to copy.
    */
   void copy(const Field& field);
 
+  /** Swap values with another field with the same layout by
+   * exchanging the local PETSc vectors (no values are copied). The
+   * labels, scales, and global vectors of the fields are not
+   * changed, so the values in the global vectors are valid only after
+   * the next scatter from the local vectors.
+   *
+   * The state of both PETSc vectors is advanced past the states of
+   * the vectors before the swap, so caches keyed on the state of the
+   * local vector of a field remain valid.
+   *
+   * @param field Field to swap values with.
+   */
+  void swapValues(Field& field);
+
   /** Copy subfield values and its metadata to field;
    *
    * @param field Field to copy from.
@@ -462,6 +489,38 @@ public :
   void scatterLocalToGlobal(const PetscVec vector,
 			    const char* context ="") const;
 
+  /** Begin scattering section information across processors to
+   * update the global view of the field.
+   *
+   * @param context Label for context associated with vector.
+   */
+  void scatterLocalToGlobalBegin(const char* context ="") const;
+
+  /** Begin scattering section information across processors to
+   * update the global view of the field.
+   *
+   * @param vector PETSc vector to update.
+   * @param context Label for context associated with vector.
+   */
+  void scatterLocalToGlobalBegin(const PetscVec vector,
+				 const char* context ="") const;
+
+  /** End scattering section information across processors to update
+   * the global view of the field.
+   *
+   * @param context Label for context associated with vector.
+   */
+  void scatterLocalToGlobalEnd(const char* context ="") const;
+
+  /** End scattering section information across processors to update
+   * the global view of the field.
+   *
+   * @param vector PETSc vector to update.
+   * @param context Label for context associated with vector.
+   */
+  void scatterLocalToGlobalEnd(const PetscVec vector,
+			       const char* context ="") const;
+
   /** Scatter global information across processors to update the local
    * view of the field.
    *
@@ -478,6 +537,38 @@ public :
   void scatterGlobalToLocal(const PetscVec vector,
 			    const char* context ="") const;
 
+  /** Begin scattering global information across processors to update
+   * the local view of the field.
+   *
+   * @param context Label for context associated with vector.
+   */
+  void scatterGlobalToLocalBegin(const char* context ="") const;
+
+  /** Begin scattering global information across processors to update
+   * the local view of the field.
+   *
+   * @param vector PETSc vector used in update.
+   * @param context Label for context associated with vector.
+   */
+  void scatterGlobalToLocalBegin(const PetscVec vector,
+				 const char* context ="") const;
+
+  /** End scattering global information across processors to update
+   * the local view of the field.
+   *
+   * @param context Label for context associated with vector.
+   */
+  void scatterGlobalToLocalEnd(const char* context ="") const;
+
+  /** End scattering global information across processors to update
+   * the local view of the field.
+   *
+   * @param vector PETSc vector used in update.
+   * @param context Label for context associated with vector.
+   */
+  void scatterGlobalToLocalEnd(const PetscVec vector,
+			       const char* context ="") const;
+
 // PRIVATE STRUCTS //////////////////////////////////////////////////////
 private :
 
@@ -521,6 +612,12 @@ private :
    */
   const ScatterInfo& _getScatter(const char* context) const;
 
+  /** Create star forest mapping degrees of freedom at points owned by
+   * other processors to the degrees of freedom at the owning
+   * points. Constrained degrees of freedom are omitted.
+   */
+  void _createGhostSF(void);
+
 // PRIVATE MEMBERS //////////////////////////////////////////////////////
 private :
 
@@ -532,6 +629,7 @@ private :
   PetscDM _dm; ///< Manages the PetscSection
   PetscVec _globalVec; ///< Global PETSc vector
   PetscVec _localVec; ///< Local PETSc vector
+  PetscSF _ghostSF; ///< Star forest for DOF at points shared with other processors.
   subfields_type _subfields; ///< Map of subfields bundled together.
 
 // NOT IMPLEMENTED //////////////////////////////////////////////////////
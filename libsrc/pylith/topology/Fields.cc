@@ -24,6 +24,7 @@
 
 #include <pylith/utils/error.h> // USES PYLITH_CHECK_ERROR
 
+#include <algorithm> // USES std::find()
 #include <sstream> // USES std::ostringstream
 #include <stdexcept> // USES std::runtime_error
 
@@ -54,6 +55,7 @@ pylith::topology::Fields::deallocate(void)
     delete iter->second; iter->second = 0;
   } // for
   _fields.clear();
+  _handles.clear();
 
   PYLITH_METHOD_END;
 } // deallocate
@@ -86,6 +88,7 @@ pylith::topology::Fields::add(const char* name,
   
   _fields[name] = new Field(_mesh);
   _fields[name]->label(label);
+  _handles.push_back(_fields[name]);
 
   PYLITH_METHOD_END;
 } // add
@@ -108,6 +111,7 @@ pylith::topology::Fields::add(const char* name,
   
   _fields[name] = new Field(_mesh);
   _fields[name]->label(label);
+  _handles.push_back(_fields[name]);
   _fields[name]->newSection(domain, fiberDim);
 
   PYLITH_METHOD_END;
@@ -126,6 +130,9 @@ pylith::topology::Fields::del(const char* name)
     msg << "Could not find field '" << name << "' in fields manager to delete.";
     throw std::runtime_error(msg.str());
   } // if
+  std::vector<Field*>::iterator hiter = std::find(_handles.begin(), _handles.end(), iter->second);
+  assert(hiter != _handles.end());
+  *hiter = 0;
   delete iter->second; iter->second = 0;
   _fields.erase(name);
 
@@ -174,6 +181,57 @@ pylith::topology::Fields::get(const char* name)
   PYLITH_METHOD_RETURN(*iter->second);
 } // get
 
+// ----------------------------------------------------------------------
+// Get handle for field.
+int
+pylith::topology::Fields::handle(const char* name) const
+{ // handle
+  PYLITH_METHOD_BEGIN;
+
+  map_type::const_iterator iter = _fields.find(name);
+  if (iter == _fields.end()) {
+    std::ostringstream msg;
+    msg << "Could not find field '" << name << "' in fields manager for handle.";
+    throw std::runtime_error(msg.str());
+  } // if
+  const std::vector<Field*>::const_iterator hiter = std::find(_handles.begin(), _handles.end(), iter->second);
+  assert(hiter != _handles.end());
+
+  PYLITH_METHOD_RETURN(int(hiter - _handles.begin()));
+} // handle
+
+// ----------------------------------------------------------------------
+// Get field using handle.
+const pylith::topology::Field&
+pylith::topology::Fields::get(const int handle) const
+{ // get
+  PYLITH_METHOD_BEGIN;
+
+  if (handle < 0 || size_t(handle) >= _handles.size() || !_handles[handle]) {
+    std::ostringstream msg;
+    msg << "Could not find field with handle " << handle << " in fields manager for retrieval.";
+    throw std::runtime_error(msg.str());
+  } // if
+
+  PYLITH_METHOD_RETURN(*_handles[handle]);
+} // get
+	   
+// ----------------------------------------------------------------------
+// Get field using handle.
+pylith::topology::Field&
+pylith::topology::Fields::get(const int handle)
+{ // get
+  PYLITH_METHOD_BEGIN;
+
+  if (handle < 0 || size_t(handle) >= _handles.size() || !_handles[handle]) {
+    std::ostringstream msg;
+    msg << "Could not find field with handle " << handle << " in fields manager for retrieval.";
+    throw std::runtime_error(msg.str());
+  } // if
+
+  PYLITH_METHOD_RETURN(*_handles[handle]);
+} // get
+
 // ----------------------------------------------------------------------
 // Copy layout to other fields.
 void
@@ -33,6 +33,7 @@
 
 #include <string> // USES std::string
 #include <map> // USES std::map
+#include <vector> // USES std::vector
 
 // Fields ---------------------------------------------------------------
 /// Container for managing multiple fields over a finite-element mesh.
@@ -109,6 +110,29 @@ public :
    */
   Field& get(const char* name);
 	   
+  /** Get handle for field.
+   *
+   * The handle is an index that remains valid until the field is
+   * deleted, so it can be resolved once during initialization and
+   * used in place of the name when retrieving the field in loops.
+   *
+   * @param name Name of field.
+   * @returns Handle for field.
+   */
+  int handle(const char* name) const;
+
+  /** Get field using handle.
+   *
+   * @param handle Handle for field from handle().
+   */
+  const Field& get(const int handle) const;
+	   
+  /** Get field using handle.
+   *
+   * @param handle Handle for field from handle().
+   */
+  Field& get(const int handle);
+	   
   /** Copy layout to other fields.
    *
    * @param name Name of field to use as template for layout.
@@ -138,6 +162,7 @@ protected :
 protected :
 
   map_type _fields;
+  std::vector<Field*> _handles; ///< Fields indexed by handle (NULL if deleted).
   const Mesh& _mesh;
 
 // NOT IMPLEMENTED //////////////////////////////////////////////////////
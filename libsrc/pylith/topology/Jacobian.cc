@@ -32,7 +32,10 @@ pylith::topology::Jacobian::Jacobian(const Field& field,
                                      const char* matrixType,
                                      const bool blockOkay) :
   _matrix(0),
-  _valuesChanged(true)
+  _diagGlobalVec(0),
+  _diagLocalVec(0),
+  _valuesChanged(true),
+  _diagIsCurrent(false)
 { // constructor
   PYLITH_METHOD_BEGIN;
 
@@ -61,6 +64,9 @@ pylith::topology::Jacobian::deallocate(void)
   PYLITH_METHOD_BEGIN;
 
   PetscErrorCode err = MatDestroy(&_matrix);PYLITH_CHECK_ERROR(err);
+  err = VecDestroy(&_diagGlobalVec);PYLITH_CHECK_ERROR(err);
+  err = VecDestroy(&_diagLocalVec);PYLITH_CHECK_ERROR(err);
+  _diagIsCurrent = false;
 
   PYLITH_METHOD_END;
 } // deallocate
@@ -136,6 +142,7 @@ pylith::topology::Jacobian::assemble(const char* mode)
 			     "associated with system Jacobian.");
 
   _valuesChanged = true;
+  _diagIsCurrent = false;
 
   PYLITH_METHOD_END;
 } // assemble
@@ -149,6 +156,7 @@ pylith::topology::Jacobian::zero(void)
 
   PetscErrorCode err = MatZeroEntries(_matrix);PYLITH_CHECK_ERROR(err);
   _valuesChanged = true;
+  _diagIsCurrent = false;
 
   PYLITH_METHOD_END;
 } // zero
@@ -260,5 +268,32 @@ pylith::topology::Jacobian::resetValuesChanged(void)
   _valuesChanged = false;
 } // resteValuesChanged
 
+// ----------------------------------------------------------------------
+// Get diagonal of matrix as a local vector.
+const PetscVec
+pylith::topology::Jacobian::localDiagonal(const Field& field)
+{ // localDiagonal
+  PYLITH_METHOD_BEGIN;
+
+  PetscErrorCode err = 0;
+  if (!_diagLocalVec) {
+    err = VecDuplicate(field.globalVector(), &_diagGlobalVec);PYLITH_CHECK_ERROR(err);
+    err = VecDuplicate(field.localVector(), &_diagLocalVec);PYLITH_CHECK_ERROR(err);
+    // Constrained DOF are not in the global vector and keep a zero diagonal.
+    err = VecSet(_diagLocalVec, 0.0);PYLITH_CHECK_ERROR(err);
+    _diagIsCurrent = false;
+  } // if
+
+  if (!_diagIsCurrent) {
+    PetscDM dmMesh = field.dmMesh();assert(dmMesh);
+    err = MatGetDiagonal(_matrix, _diagGlobalVec);PYLITH_CHECK_ERROR(err);
+    err = DMGlobalToLocalBegin(dmMesh, _diagGlobalVec, INSERT_VALUES, _diagLocalVec);PYLITH_CHECK_ERROR(err);
+    err = DMGlobalToLocalEnd(dmMesh, _diagGlobalVec, INSERT_VALUES, _diagLocalVec);PYLITH_CHECK_ERROR(err);
+    _diagIsCurrent = true;
+  } // if
+
+  PYLITH_METHOD_RETURN(_diagLocalVec);
+} // localDiagonal
+
 
 // End of file 
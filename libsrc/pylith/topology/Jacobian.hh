@@ -29,7 +29,7 @@
 // Include directives ---------------------------------------------------
 #include "topologyfwd.hh" // forward declarations
 
-#include "pylith/utils/petscfwd.h" // HOLDSA PetscMat
+#include "pylith/utils/petscfwd.h" // HOLDSA PetscMat, PetscVec
 
 #include <string> // USES std::string
 
@@ -111,12 +111,28 @@ public :
   /// Reset flag indicating if sparse matrix values have been updated.
   void resetValuesChanged(void);
 
+  /** Get diagonal of matrix as a local vector with the layout of the
+   * solution field (includes ghosted DOF).
+   *
+   * The diagonal is extracted once after each assembly and shared by
+   * all callers until the matrix is zeroed or assembled again.
+   * Constrained DOF are not in the global vector, so their entries in
+   * the local vector are zero.
+   *
+   * @param field Solution field associated with the matrix.
+   * @returns Local PETSc vector with diagonal of matrix.
+   */
+  const PetscVec localDiagonal(const Field& field);
+
 // PRIVATE MEMBERS //////////////////////////////////////////////////////
 private :
 
   PetscMat _matrix; ///< Sparse matrix for Jacobian of problem.
+  PetscVec _diagGlobalVec; ///< Global vector for diagonal of matrix.
+  PetscVec _diagLocalVec; ///< Local vector for diagonal of matrix.
 
   bool _valuesChanged; ///< Sparse matrix values have been updated.
+  bool _diagIsCurrent; ///< Diagonal vectors match matrix values.
 
   std::string _type; ///< String associated with matrix type.
 
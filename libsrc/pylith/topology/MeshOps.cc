@@ -30,8 +30,9 @@
 #include <sstream> // USES std::ostringstream
 #include <cassert> // USES assert()
 
-#include <algorithm> // USES std::sort, std::find
+#include <algorithm> // USES std::sort, std::find, std::copy
 #include <map> // USES std::map
+#include <vector> // USES std::vector
 
 
 // ----------------------------------------------------------------------
@@ -192,5 +193,60 @@ pylith::topology::MeshOps::numMaterialCells(const Mesh& mesh,
   PYLITH_METHOD_RETURN(ncells);
 } // numMaterialCells
 
+// ----------------------------------------------------------------------
+// Order cells so that cells with a ghost point in their closure come
+// first.
+PetscInt
+pylith::topology::MeshOps::orderBoundaryCells(PetscInt* orderedCells,
+					      const Mesh& mesh,
+					      const PetscInt* cells,
+					      const PetscInt numCells)
+{ // orderBoundaryCells
+  PYLITH_METHOD_BEGIN;
+
+  assert(orderedCells || 0 == numCells);
+  assert(cells || 0 == numCells);
+
+  PetscDM dmMesh = mesh.dmMesh();assert(dmMesh);
+  PetscSF pointSF = NULL;
+  PetscInt numRoots = 0, numLeaves = 0;
+  const PetscInt* leaves = NULL;
+  PetscErrorCode err;
+  err = DMGetPointSF(dmMesh, &pointSF);PYLITH_CHECK_ERROR(err);
+  err = PetscSFGetGraph(pointSF, &numRoots, &numLeaves, &leaves, NULL);PYLITH_CHECK_ERROR(err);
+  if (numRoots < 0 || numLeaves <= 0) {
+    std::copy(cells, cells+numCells, orderedCells);
+    PYLITH_METHOD_RETURN(0);
+  } // if
+
+  PetscInt pStart = 0, pEnd = 0;
+  err = DMPlexGetChart(dmMesh, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+  std::vector<bool> isGhost(pEnd-pStart, false);
+  for (PetscInt i=0; i < numLeaves; ++i) {
+    isGhost[(leaves ? leaves[i] : i)-pStart] = true;
+  } // for
+
+  std::vector<PetscInt> interiorCells;
+  PetscInt numBoundary = 0;
+  PetscInt* closure = NULL;
+  PetscInt closureSize = 0;
+  for (PetscInt c=0; c < numCells; ++c) {
+    err = DMPlexGetTransitiveClosure(dmMesh, cells[c], PETSC_TRUE, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
+    bool onBoundary = false;
+    for (PetscInt p=0; p < closureSize*2 && !onBoundary; p += 2) {
+      onBoundary = isGhost[closure[p]-pStart];
+    } // for
+    err = DMPlexRestoreTransitiveClosure(dmMesh, cells[c], PETSC_TRUE, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
+    if (onBoundary) {
+      orderedCells[numBoundary++] = cells[c];
+    } else {
+      interiorCells.push_back(cells[c]);
+    } // if/else
+  } // for
+  std::copy(interiorCells.begin(), interiorCells.end(), orderedCells+numBoundary);
+
+  PYLITH_METHOD_RETURN(numBoundary);
+} // orderBoundaryCells
+
 
 // End of file 
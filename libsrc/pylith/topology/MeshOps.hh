@@ -90,6 +90,23 @@ public :
   static
   int numMaterialCells(const Mesh& mesh,
 		       int materialId);
+
+  /** Order cells so that cells with a point owned by another
+   * processor (ghost point) in their closure come before the other
+   * cells. Values at the other cells can be computed while values at
+   * ghost points are being communicated.
+   *
+   * @param orderedCells Array of ordered cells (output, size numCells).
+   * @param mesh Finite-element mesh.
+   * @param cells Array of cells.
+   * @param numCells Number of cells.
+   * @returns Number of cells with a ghost point in their closure.
+   */
+  static
+  PetscInt orderBoundaryCells(PetscInt* orderedCells,
+			      const Mesh& mesh,
+			      const PetscInt* cells,
+			      const PetscInt numCells);
   
 
 // NOT IMPLEMENTED //////////////////////////////////////////////////////
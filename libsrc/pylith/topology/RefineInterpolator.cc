@@ -0,0 +1,740 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ======================================================================
+//
+
+#include <portinfo>
+
+#include "RefineInterpolator.hh" // implementation of class methods
+
+#include "Mesh.hh" // USES Mesh
+#include "Field.hh" // USES Field
+
+#include "pylith/utils/error.h" // USES PYLITH_CHECK_ERROR
+
+#include <map> // USES std::map
+#include <utility> // USES std::pair
+#include <algorithm> // USES std::reverse()
+#include <cmath> // USES fabs()
+#include <cassert> // USES assert()
+#include <sstream> // USES std::ostringstream
+#include <stdexcept> // USES std::runtime_error
+
+// ----------------------------------------------------------------------
+namespace pylith {
+  namespace topology {
+    namespace _RefineInterpolator {
+      /// Interpolation weights of coarse points for a fine point.
+      typedef std::map<PetscInt, PylithScalar> WeightMap;
+
+      /// Relative tolerance for matching midpoints of vertices.
+      const PylithScalar midpointTolerance = 1.0e-6;
+
+      /// Hybrid edge for a vertex on a given fault, keyed by (vertex, fault id).
+      typedef std::map<std::pair<PetscInt, int>, PetscInt> HybridEdgeMap;
+
+      /** Get id of fault (material id of cohesive cells) associated
+       * with hybrid edge.
+       *
+       * @param dm PETSc DM for mesh.
+       * @param edge Hybrid edge.
+       * @param cMax First hybrid cell.
+       * @param cEnd End of cells.
+       * @returns Material id of cohesive cells containing edge.
+       */
+      int faultId(PetscDM dm,
+		  const PetscInt edge,
+		  const PetscInt cMax,
+		  const PetscInt cEnd);
+    } // _RefineInterpolator
+  } // topology
+} // pylith
+
+// ----------------------------------------------------------------------
+// Get id of fault associated with hybrid edge.
+int
+pylith::topology::_RefineInterpolator::faultId(PetscDM dm,
+					       const PetscInt edge,
+					       const PetscInt cMax,
+					       const PetscInt cEnd)
+{ // faultId
+  PYLITH_METHOD_BEGIN;
+
+  PetscErrorCode err = 0;
+  PetscInt starSize = 0;
+  PetscInt* star = NULL;
+  PetscInt id = -1;
+  err = DMPlexGetTransitiveClosure(dm, edge, PETSC_FALSE, &starSize, &star);PYLITH_CHECK_ERROR(err);
+  for (PetscInt i=0; i < 2*starSize; i+=2) {
+    if (star[i] >= cMax && star[i] < cEnd) {
+      err = DMGetLabelValue(dm, "material-id", star[i], &id);PYLITH_CHECK_ERROR(err);
+      break;
+    } // if
+  } // for
+  err = DMPlexRestoreTransitiveClosure(dm, edge, PETSC_FALSE, &starSize, &star);PYLITH_CHECK_ERROR(err);
+  if (id < 0) {
+    std::ostringstream msg;
+    msg << "Could not find cohesive cell with material id for hybrid edge " << edge << ".";
+    throw std::logic_error(msg.str());
+  } // if
+
+  PYLITH_METHOD_RETURN(id);
+} // faultId
+
+// ----------------------------------------------------------------------
+// Constructor
+pylith::topology::RefineInterpolator::RefineInterpolator(void) :
+  _hasEdgeDof(false)
+{ // constructor
+} // constructor
+
+// ----------------------------------------------------------------------
+// Destructor
+pylith::topology::RefineInterpolator::~RefineInterpolator(void)
+{ // destructor
+  deallocate();
+} // destructor
+
+// ----------------------------------------------------------------------
+// Deallocate data structures.
+void
+pylith::topology::RefineInterpolator::deallocate(void)
+{ // deallocate
+  PYLITH_METHOD_BEGIN;
+
+  PetscErrorCode err = 0;
+  const size_t numLevels = _dms.size();
+  for (size_t i=0; i < numLevels; ++i) {
+    err = DMDestroy(&_dms[i]);PYLITH_CHECK_ERROR(err);
+    err = PetscSectionDestroy(&_localSections[i]);PYLITH_CHECK_ERROR(err);
+    err = PetscSectionDestroy(&_globalSections[i]);PYLITH_CHECK_ERROR(err);
+    err = MatDestroy(&_interpolation[i]);PYLITH_CHECK_ERROR(err);
+  } // for
+  _dms.clear();
+  _localSections.clear();
+  _globalSections.clear();
+  _interpolation.clear();
+  _hasEdgeDof = false;
+
+  PYLITH_METHOD_END;
+} // deallocate
+
+// ----------------------------------------------------------------------
+// Create layout of coarse levels and interpolation operators.
+void
+pylith::topology::RefineInterpolator::initialize(const Field& field)
+{ // initialize
+  PYLITH_METHOD_BEGIN;
+
+  deallocate();
+
+  PetscErrorCode err = 0;
+
+  // Collect hierarchy from finest to coarsest. The field DM is a
+  // clone of the mesh DM, so use the mesh DM, which holds the
+  // references to the coarser levels.
+  PetscDM dmFine = field.mesh().dmMesh();assert(dmFine);
+  for (PetscDM dm = dmFine; dm; ) {
+    err = PetscObjectReference((PetscObject) dm);PYLITH_CHECK_ERROR(err);
+    _dms.push_back(dm);
+    PetscDM dmCoarse = NULL;
+    err = DMGetCoarseDM(dm, &dmCoarse);PYLITH_CHECK_ERROR(err);
+    dm = dmCoarse;
+  } // for
+  std::reverse(_dms.begin(), _dms.end());
+
+  const size_t numLevels = _dms.size();
+  _localSections.resize(numLevels, NULL);
+  _globalSections.resize(numLevels, NULL);
+  _interpolation.resize(numLevels, NULL);
+
+  // Finest level uses layout of field.
+  _localSections[numLevels-1] = field.localSection();
+  _globalSections[numLevels-1] = field.globalSection();
+  err = PetscObjectReference((PetscObject) _localSections[numLevels-1]);PYLITH_CHECK_ERROR(err);
+  err = PetscObjectReference((PetscObject) _globalSections[numLevels-1]);PYLITH_CHECK_ERROR(err);
+
+  // Number of DOF on vertices and hybrid edges from layout of finest
+  // level. A process may not have any hybrid edges, so use the
+  // maximum over all processes.
+  PetscInt numDof[2] = { 0, 0 }; // vertices, hybrid edges
+  PetscInt vStart = -1, vEnd = -1, eEnd = -1, eMax = -1;
+  err = DMPlexGetDepthStratum(dmFine, 0, &vStart, &vEnd);PYLITH_CHECK_ERROR(err);
+  err = DMPlexGetDepthStratum(dmFine, 1, NULL, &eEnd);PYLITH_CHECK_ERROR(err);
+  err = DMPlexGetHybridBounds(dmFine, NULL, NULL, &eMax, NULL);PYLITH_CHECK_ERROR(err);
+  PetscInt pStart = 0, pEnd = 0;
+  err = PetscSectionGetChart(_localSections[numLevels-1], &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+  for (PetscInt p = pStart; p < pEnd; ++p) {
+    PetscInt dof = 0;
+    err = PetscSectionGetDof(_localSections[numLevels-1], p, &dof);PYLITH_CHECK_ERROR(err);
+    if (p >= vStart && p < vEnd) {
+      numDof[0] = std::max(numDof[0], dof);
+    } else if (eMax >= 0 && p >= eMax && p < eEnd) {
+      numDof[1] = std::max(numDof[1], dof);
+    } // if/else
+  } // for
+  PetscInt numDofGlobal[2] = { 0, 0 };
+  err = MPI_Allreduce(numDof, numDofGlobal, 2, MPIU_INT, MPI_MAX, field.mesh().comm());PYLITH_CHECK_ERROR(err);
+  _hasEdgeDof = numDofGlobal[1] > 0;
+
+  for (size_t i=numLevels-1; i > 0; --i) {
+    _checkVertexNumbering(_dms[i-1], _dms[i]);
+    _createSections(&_localSections[i-1], &_globalSections[i-1], _dms[i-1], numDofGlobal[0], numDofGlobal[1],
+		    _dms[i], _localSections[i]);
+    _createInterpolation(&_interpolation[i],
+			 _dms[i-1], _localSections[i-1], _globalSections[i-1],
+			 _dms[i], _localSections[i], _globalSections[i]);
+  } // for
+
+  PYLITH_METHOD_END;
+} // initialize
+
+// ----------------------------------------------------------------------
+// Get number of levels in hierarchy.
+int
+pylith::topology::RefineInterpolator::numLevels(void) const
+{ // numLevels
+  return _dms.size();
+} // numLevels
+
+// ----------------------------------------------------------------------
+// Get interpolation operator from level-1 to level.
+PetscMat
+pylith::topology::RefineInterpolator::interpolation(const int level) const
+{ // interpolation
+  if (level < 1 || level >= int(_interpolation.size())) {
+    std::ostringstream msg;
+    msg << "Level (" << level << ") for interpolation operator must be in range [1, " << _interpolation.size() << ").";
+    throw std::runtime_error(msg.str());
+  } // if
+
+  return _interpolation[level];
+} // interpolation
+
+// ----------------------------------------------------------------------
+// Get local section for layout of level.
+PetscSection
+pylith::topology::RefineInterpolator::localSection(const int level) const
+{ // localSection
+  if (level < 0 || level >= int(_localSections.size())) {
+    std::ostringstream msg;
+    msg << "Level (" << level << ") must be in range [0, " << _localSections.size() << ").";
+    throw std::runtime_error(msg.str());
+  } // if
+
+  return _localSections[level];
+} // localSection
+
+// ----------------------------------------------------------------------
+// Get global section for layout of level.
+PetscSection
+pylith::topology::RefineInterpolator::globalSection(const int level) const
+{ // globalSection
+  if (level < 0 || level >= int(_globalSections.size())) {
+    std::ostringstream msg;
+    msg << "Level (" << level << ") must be in range [0, " << _globalSections.size() << ").";
+    throw std::runtime_error(msg.str());
+  } // if
+
+  return _globalSections[level];
+} // globalSection
+
+// ----------------------------------------------------------------------
+// Does layout include DOF on hybrid edges (Lagrange multipliers)?
+bool
+pylith::topology::RefineInterpolator::hasEdgeDof(void) const
+{ // hasEdgeDof
+  return _hasEdgeDof;
+} // hasEdgeDof
+
+// ----------------------------------------------------------------------
+// Create index sets for DOF on vertices and hybrid edges of level.
+void
+pylith::topology::RefineInterpolator::createFieldIS(PetscIS* isVertices,
+						    PetscIS* isEdges,
+						    const int level) const
+{ // createFieldIS
+  PYLITH_METHOD_BEGIN;
+
+  assert(isVertices);
+  assert(isEdges);
+
+  if (level < 0 || level >= int(_dms.size())) {
+    std::ostringstream msg;
+    msg << "Level (" << level << ") must be in range [0, " << _dms.size() << ").";
+    throw std::runtime_error(msg.str());
+  } // if
+
+  PetscErrorCode err = 0;
+  PetscInt vStart = -1, vEnd = -1;
+  err = DMPlexGetDepthStratum(_dms[level], 0, &vStart, &vEnd);PYLITH_CHECK_ERROR(err);
+
+  std::vector<PetscInt> indices[2]; // vertices, hybrid edges
+  PetscInt pStart = 0, pEnd = 0;
+  err = PetscSectionGetChart(_localSections[level], &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+  for (PetscInt p = pStart; p < pEnd; ++p) {
+    PetscInt dof = 0, cdof = 0, goff = 0;
+    err = PetscSectionGetDof(_localSections[level], p, &dof);PYLITH_CHECK_ERROR(err);
+    err = PetscSectionGetConstraintDof(_localSections[level], p, &cdof);PYLITH_CHECK_ERROR(err);
+    err = PetscSectionGetOffset(_globalSections[level], p, &goff);PYLITH_CHECK_ERROR(err);
+    if (goff < 0) {
+      continue;
+    } // if
+    std::vector<PetscInt>& pIndices = (p >= vStart && p < vEnd) ? indices[0] : indices[1];
+    for (PetscInt d=0; d < dof-cdof; ++d) {
+      pIndices.push_back(goff+d);
+    } // for
+  } // for
+
+  MPI_Comm comm;
+  err = PetscObjectGetComm((PetscObject) _dms[level], &comm);PYLITH_CHECK_ERROR(err);
+  err = ISCreateGeneral(comm, indices[0].size(), indices[0].size() ? &indices[0][0] : NULL, PETSC_COPY_VALUES, isVertices);PYLITH_CHECK_ERROR(err);
+  err = ISCreateGeneral(comm, indices[1].size(), indices[1].size() ? &indices[1][0] : NULL, PETSC_COPY_VALUES, isEdges);PYLITH_CHECK_ERROR(err);
+
+  PYLITH_METHOD_END;
+} // createFieldIS
+
+// ----------------------------------------------------------------------
+// Check that vertices of coarse level are the first vertices of fine level.
+void
+pylith::topology::RefineInterpolator::_checkVertexNumbering(PetscDM dmCoarse,
+							    PetscDM dmFine)
+{ // _checkVertexNumbering
+  PYLITH_METHOD_BEGIN;
+
+  assert(dmCoarse);
+  assert(dmFine);
+
+  PetscErrorCode err = 0;
+  PetscInt vStartC = -1, vEndC = -1, vStartF = -1, vEndF = -1;
+  err = DMPlexGetDepthStratum(dmCoarse, 0, &vStartC, &vEndC);PYLITH_CHECK_ERROR(err);
+  err = DMPlexGetDepthStratum(dmFine, 0, &vStartF, &vEndF);PYLITH_CHECK_ERROR(err);
+
+  PetscInt spaceDim = 0;
+  err = DMGetCoordinateDim(dmFine, &spaceDim);PYLITH_CHECK_ERROR(err);
+
+  PetscSection coordSectionC = NULL, coordSectionF = NULL;
+  PetscVec coordVecC = NULL, coordVecF = NULL;
+  const PetscScalar* coordArrayC = NULL;
+  const PetscScalar* coordArrayF = NULL;
+  err = DMGetCoordinateSection(dmCoarse, &coordSectionC);PYLITH_CHECK_ERROR(err);
+  err = DMGetCoordinatesLocal(dmCoarse, &coordVecC);PYLITH_CHECK_ERROR(err);
+  err = DMGetCoordinateSection(dmFine, &coordSectionF);PYLITH_CHECK_ERROR(err);
+  err = DMGetCoordinatesLocal(dmFine, &coordVecF);PYLITH_CHECK_ERROR(err);
+  err = VecGetArrayRead(coordVecC, &coordArrayC);PYLITH_CHECK_ERROR(err);
+  err = VecGetArrayRead(coordVecF, &coordArrayF);PYLITH_CHECK_ERROR(err);
+
+  // Compare relative to the size of the coarse mesh.
+  PylithScalar scale = 0.0;
+  PetscInt coordSize = 0;
+  err = VecGetLocalSize(coordVecC, &coordSize);PYLITH_CHECK_ERROR(err);
+  for (PetscInt i=0; i < coordSize; ++i) {
+    scale = std::max(scale, PylithScalar(fabs(coordArrayC[i])));
+  } // for
+  const PylithScalar tolerance = _RefineInterpolator::midpointTolerance * (scale > 0.0 ? scale : 1.0);
+
+  bool isConsistent = (vEndF - vStartF) >= (vEndC - vStartC);
+  for (PetscInt vC = vStartC; vC < vEndC && isConsistent; ++vC) {
+    const PetscInt vF = vStartF + (vC - vStartC);
+    PetscInt offC = 0, offF = 0;
+    err = PetscSectionGetOffset(coordSectionC, vC, &offC);PYLITH_CHECK_ERROR(err);
+    err = PetscSectionGetOffset(coordSectionF, vF, &offF);PYLITH_CHECK_ERROR(err);
+    for (int d=0; d < spaceDim; ++d) {
+      if (fabs(coordArrayC[offC+d] - coordArrayF[offF+d]) > tolerance) {
+	isConsistent = false;
+      } // if
+    } // for
+  } // for
+  err = VecRestoreArrayRead(coordVecC, &coordArrayC);PYLITH_CHECK_ERROR(err);
+  err = VecRestoreArrayRead(coordVecF, &coordArrayF);PYLITH_CHECK_ERROR(err);
+
+  if (!isConsistent) {
+    throw std::runtime_error("Vertices of coarse mesh are not the first vertices of the refined mesh. "
+			     "Geometric multigrid requires a hierarchy created by uniform refinement.");
+  } // if
+
+  PYLITH_METHOD_END;
+} // _checkVertexNumbering
+
+// ----------------------------------------------------------------------
+// Create layout for coarse level.
+void
+pylith::topology::RefineInterpolator::_createSections(PetscSection* localSection,
+						      PetscSection* globalSection,
+						      PetscDM dm,
+						      const int vertexDof,
+						      const int edgeDof,
+						      PetscDM dmFine,
+						      PetscSection fineLocal)
+{ // _createSections
+  PYLITH_METHOD_BEGIN;
+
+  assert(localSection);
+  assert(globalSection);
+  assert(dm);
+  assert(dmFine);
+  assert(fineLocal);
+
+  PetscErrorCode err = 0;
+  PetscInt vStart = -1, vEnd = -1, eEnd = -1, eMax = -1;
+  err = DMPlexGetDepthStratum(dm, 0, &vStart, &vEnd);PYLITH_CHECK_ERROR(err);
+  err = DMPlexGetDepthStratum(dm, 1, NULL, &eEnd);PYLITH_CHECK_ERROR(err);
+  err = DMPlexGetHybridBounds(dm, NULL, NULL, &eMax, NULL);PYLITH_CHECK_ERROR(err);
+  const PetscInt pEnd = (edgeDof > 0 && eMax >= 0 && eEnd > eMax) ? eEnd : vEnd;
+
+  PetscInt vStartF = -1;
+  err = DMPlexGetDepthStratum(dmFine, 0, &vStartF, NULL);PYLITH_CHECK_ERROR(err);
+
+  MPI_Comm comm;
+  err = PetscObjectGetComm((PetscObject) dm, &comm);PYLITH_CHECK_ERROR(err);
+  err = PetscSectionCreate(comm, localSection);PYLITH_CHECK_ERROR(err);
+  err = PetscSectionSetChart(*localSection, vStart, pEnd);PYLITH_CHECK_ERROR(err);
+  for (PetscInt v = vStart; v < vEnd; ++v) {
+    err = PetscSectionSetDof(*localSection, v, vertexDof);PYLITH_CHECK_ERROR(err);
+
+    // Coarse vertices keep the Dirichlet constraints of the
+    // corresponding vertices in the refined mesh.
+    PetscInt cdof = 0;
+    err = PetscSectionGetConstraintDof(fineLocal, vStartF + (v - vStart), &cdof);PYLITH_CHECK_ERROR(err);
+    err = PetscSectionSetConstraintDof(*localSection, v, cdof);PYLITH_CHECK_ERROR(err);
+  } // for
+  if (pEnd > vEnd) {
+    for (PetscInt e = eMax; e < eEnd; ++e) {
+      err = PetscSectionSetDof(*localSection, e, edgeDof);PYLITH_CHECK_ERROR(err);
+    } // for
+  } // if
+  err = PetscSectionSetUp(*localSection);PYLITH_CHECK_ERROR(err);
+  for (PetscInt v = vStart; v < vEnd; ++v) {
+    PetscInt cdof = 0;
+    const PetscInt* cind = NULL;
+    err = PetscSectionGetConstraintDof(*localSection, v, &cdof);PYLITH_CHECK_ERROR(err);
+    if (cdof > 0) {
+      err = PetscSectionGetConstraintIndices(fineLocal, vStartF + (v - vStart), &cind);PYLITH_CHECK_ERROR(err);
+      err = PetscSectionSetConstraintIndices(*localSection, v, cind);PYLITH_CHECK_ERROR(err);
+    } // if
+  } // for
+
+  PetscSF sf = NULL;
+  err = DMGetPointSF(dm, &sf);PYLITH_CHECK_ERROR(err);
+  err = PetscSectionCreateGlobalSection(*localSection, sf, PETSC_FALSE, PETSC_FALSE, globalSection);PYLITH_CHECK_ERROR(err);
+
+  PYLITH_METHOD_END;
+} // _createSections
+
+// ----------------------------------------------------------------------
+// Create interpolation operator from coarse level to fine level.
+void
+pylith::topology::RefineInterpolator::_createInterpolation(PetscMat* interp,
+							   PetscDM dmCoarse,
+							   PetscSection coarseLocal,
+							   PetscSection coarseGlobal,
+							   PetscDM dmFine,
+							   PetscSection fineLocal,
+							   PetscSection fineGlobal)
+{ // _createInterpolation
+  PYLITH_METHOD_BEGIN;
+
+  typedef _RefineInterpolator::WeightMap WeightMap;
+
+  assert(interp);
+  assert(dmCoarse);
+  assert(coarseLocal);
+  assert(coarseGlobal);
+  assert(dmFine);
+  assert(fineLocal);
+  assert(fineGlobal);
+
+  PetscErrorCode err = 0;
+  PetscInt vStartC = -1, vEndC = -1, eEndC = -1, eMaxC = -1;
+  err = DMPlexGetDepthStratum(dmCoarse, 0, &vStartC, &vEndC);PYLITH_CHECK_ERROR(err);
+  err = DMPlexGetDepthStratum(dmCoarse, 1, NULL, &eEndC);PYLITH_CHECK_ERROR(err);
+  err = DMPlexGetHybridBounds(dmCoarse, NULL, NULL, &eMaxC, NULL);PYLITH_CHECK_ERROR(err);
+
+  PetscInt vStartF = -1, vEndF = -1, eEndF = -1, eMaxF = -1;
+  err = DMPlexGetDepthStratum(dmFine, 0, &vStartF, &vEndF);PYLITH_CHECK_ERROR(err);
+  err = DMPlexGetDepthStratum(dmFine, 1, NULL, &eEndF);PYLITH_CHECK_ERROR(err);
+  err = DMPlexGetHybridBounds(dmFine, NULL, NULL, &eMaxF, NULL);PYLITH_CHECK_ERROR(err);
+
+  const PetscInt numVerticesC = vEndC - vStartC;
+  const PetscInt numVerticesF = vEndF - vStartF;
+  if (numVerticesF < numVerticesC) {
+    std::ostringstream msg;
+    msg << "Fine mesh has fewer vertices (" << numVerticesF << ") than coarse mesh (" << numVerticesC << ").";
+    throw std::logic_error(msg.str());
+  } // if
+
+  PetscInt cMaxC = -1, cEndC = -1, cMaxF = -1, cEndF = -1;
+  err = DMPlexGetHeightStratum(dmCoarse, 0, NULL, &cEndC);PYLITH_CHECK_ERROR(err);
+  err = DMPlexGetHybridBounds(dmCoarse, &cMaxC, NULL, NULL, NULL);PYLITH_CHECK_ERROR(err);
+  err = DMPlexGetHeightStratum(dmFine, 0, NULL, &cEndF);PYLITH_CHECK_ERROR(err);
+  err = DMPlexGetHybridBounds(dmFine, &cMaxF, NULL, NULL, NULL);PYLITH_CHECK_ERROR(err);
+
+  // Map coarse vertices to the coarse hybrid edges containing them. A
+  // vertex on the intersection of faults is in one hybrid edge for
+  // each fault, so key the map by the vertex and the fault.
+  _RefineInterpolator::HybridEdgeMap hybridEdgesC;
+  PetscInt qStart = 0, qEnd = 0;
+  err = PetscSectionGetChart(coarseLocal, &qStart, &qEnd);PYLITH_CHECK_ERROR(err);
+  if (eMaxC >= 0 && qEnd > vEndC) {
+    for (PetscInt e = eMaxC; e < eEndC; ++e) {
+      const int id = _RefineInterpolator::faultId(dmCoarse, e, cMaxC, cEndC);
+      const PetscInt* cone = NULL;
+      err = DMPlexGetCone(dmCoarse, e, &cone);PYLITH_CHECK_ERROR(err);
+      hybridEdgesC[std::make_pair(cone[0], id)] = e;
+      hybridEdgesC[std::make_pair(cone[1], id)] = e;
+    } // for
+  } // if
+
+  // Coordinates of fine vertices.
+  PetscInt spaceDim = 0;
+  PetscSection coordSection = NULL;
+  PetscVec coordVec = NULL;
+  const PetscScalar* coordArray = NULL;
+  err = DMGetCoordinateDim(dmFine, &spaceDim);PYLITH_CHECK_ERROR(err);
+  err = DMGetCoordinateSection(dmFine, &coordSection);PYLITH_CHECK_ERROR(err);
+  err = DMGetCoordinatesLocal(dmFine, &coordVec);PYLITH_CHECK_ERROR(err);
+  err = VecGetArrayRead(coordVec, &coordArray);PYLITH_CHECK_ERROR(err);
+
+  // Uniform refinement in PETSc numbers the vertices of the coarse
+  // mesh first in the fine mesh, in the same order (checked in
+  // _checkVertexNumbering()).
+  std::vector<WeightMap> weights(numVerticesF);
+  std::vector<int> generation(numVerticesF, -1);
+  for (PetscInt v = vStartC; v < vEndC; ++v) {
+    const PetscInt iV = v - vStartC;
+    weights[iV][v] = 1.0;
+    generation[iV] = 0;
+  } // for
+
+  // New vertices lie at the midpoints of edges (generation 1), faces
+  // (generation 2, hex/quad faces), and cells (generation 3, hex
+  // cells). Each new vertex is the midpoint of at least one pair of
+  // neighboring vertices from earlier generations, connected through
+  // edges that are not hybrid (so we never interpolate across a
+  // fault). Averaging the weights over such pairs reproduces linear
+  // (and bilinear/trilinear) interpolation.
+  const int maxGenerations = 4;
+  PetscInt numRemaining = numVerticesF - numVerticesC;
+  std::vector<PetscInt> neighbors;
+  for (int gen=1; gen < maxGenerations && numRemaining > 0; ++gen) {
+    for (PetscInt v = vStartF; v < vEndF; ++v) {
+      const PetscInt iV = v - vStartF;
+      if (generation[iV] >= 0) {
+	continue;
+      } // if
+
+      neighbors.clear();
+      PetscInt supportSize = 0;
+      const PetscInt* support = NULL;
+      err = DMPlexGetSupportSize(dmFine, v, &supportSize);PYLITH_CHECK_ERROR(err);
+      err = DMPlexGetSupport(dmFine, v, &support);PYLITH_CHECK_ERROR(err);
+      for (PetscInt s=0; s < supportSize; ++s) {
+	const PetscInt e = support[s];
+	if (eMaxF >= 0 && e >= eMaxF) {
+	  continue;
+	} // if
+	const PetscInt* cone = NULL;
+	err = DMPlexGetCone(dmFine, e, &cone);PYLITH_CHECK_ERROR(err);
+	const PetscInt vOther = (cone[0] == v) ? cone[1] : cone[0];
+	const int genOther = generation[vOther-vStartF];
+	if (genOther >= 0 && genOther < gen) {
+	  neighbors.push_back(vOther);
+	} // if
+      } // for
+
+      PetscInt off = 0;
+      err = PetscSectionGetOffset(coordSection, v, &off);PYLITH_CHECK_ERROR(err);
+      const PetscScalar* coordsV = &coordArray[off];
+
+      WeightMap vWeights;
+      int numPairs = 0;
+      const size_t numNeighbors = neighbors.size();
+      for (size_t i=0; i < numNeighbors; ++i) {
+	PetscInt offA = 0;
+	err = PetscSectionGetOffset(coordSection, neighbors[i], &offA);PYLITH_CHECK_ERROR(err);
+	for (size_t j=i+1; j < numNeighbors; ++j) {
+	  PetscInt offB = 0;
+	  err = PetscSectionGetOffset(coordSection, neighbors[j], &offB);PYLITH_CHECK_ERROR(err);
+	  PylithScalar distMid2 = 0.0;
+	  PylithScalar distAB2 = 0.0;
+	  for (int d=0; d < spaceDim; ++d) {
+	    const PylithScalar dMid = coordArray[offA+d] + coordArray[offB+d] - 2.0*coordsV[d];
+	    const PylithScalar dAB = coordArray[offA+d] - coordArray[offB+d];
+	    distMid2 += dMid*dMid;
+	    distAB2 += dAB*dAB;
+	  } // for
+	  const PylithScalar tolerance = _RefineInterpolator::midpointTolerance;
+	  if (distMid2 > tolerance*tolerance*distAB2) {
+	    continue;
+	  } // if
+
+	  const WeightMap& weightsA = weights[neighbors[i]-vStartF];
+	  for (WeightMap::const_iterator w_iter=weightsA.begin(); w_iter != weightsA.end(); ++w_iter) {
+	    vWeights[w_iter->first] += 0.5*w_iter->second;
+	  } // for
+	  const WeightMap& weightsB = weights[neighbors[j]-vStartF];
+	  for (WeightMap::const_iterator w_iter=weightsB.begin(); w_iter != weightsB.end(); ++w_iter) {
+	    vWeights[w_iter->first] += 0.5*w_iter->second;
+	  } // for
+	  ++numPairs;
+	} // for
+      } // for
+
+      if (numPairs > 0) {
+	for (WeightMap::iterator w_iter=vWeights.begin(); w_iter != vWeights.end(); ++w_iter) {
+	  w_iter->second /= numPairs;
+	} // for
+	weights[iV].swap(vWeights);
+	generation[iV] = gen;
+	--numRemaining;
+      } // if
+    } // for
+  } // for
+  err = VecRestoreArrayRead(coordVec, &coordArray);PYLITH_CHECK_ERROR(err);
+
+  if (numRemaining > 0) {
+    std::ostringstream msg;
+    msg << "Could not determine interpolation from coarse mesh for " << numRemaining
+	<< " vertices in refined mesh. Geometric multigrid requires a hierarchy created by uniform refinement.";
+    throw std::runtime_error(msg.str());
+  } // if
+
+  // Weights for hybrid edges (Lagrange multipliers) follow from the
+  // weights of the first vertex in the cone, applied to the coarse
+  // hybrid edges of the same fault.
+  PetscInt pStartF = 0, pEndF = 0;
+  err = PetscSectionGetChart(fineLocal, &pStartF, &pEndF);PYLITH_CHECK_ERROR(err);
+  const PetscInt numHybridEdgesF = (eMaxF >= 0 && pEndF > vEndF) ? eEndF - eMaxF : 0;
+  std::vector<WeightMap> edgeWeights(numHybridEdgesF);
+  for (PetscInt e = eMaxF; e < eMaxF+numHybridEdgesF; ++e) {
+    const int id = _RefineInterpolator::faultId(dmFine, e, cMaxF, cEndF);
+    const PetscInt* cone = NULL;
+    err = DMPlexGetCone(dmFine, e, &cone);PYLITH_CHECK_ERROR(err);
+    const WeightMap& vWeights = weights[cone[0]-vStartF];
+    WeightMap& eWeights = edgeWeights[e-eMaxF];
+    for (WeightMap::const_iterator w_iter=vWeights.begin(); w_iter != vWeights.end(); ++w_iter) {
+      const _RefineInterpolator::HybridEdgeMap::const_iterator h_iter = hybridEdgesC.find(std::make_pair(w_iter->first, id));
+      if (h_iter == hybridEdgesC.end()) {
+	std::ostringstream msg;
+	msg << "Could not find hybrid edge for fault " << id << " in coarse mesh for vertex " << w_iter->first
+	    << " in interpolation of hybrid edge " << e << " in refined mesh.";
+	throw std::logic_error(msg.str());
+      } // if
+      eWeights[h_iter->second] += w_iter->second;
+    } // for
+  } // for
+
+  // Create matrix.
+  PetscInt numRows = 0, numCols = 0;
+  err = PetscSectionGetConstrainedStorageSize(fineGlobal, &numRows);PYLITH_CHECK_ERROR(err);
+  err = PetscSectionGetConstrainedStorageSize(coarseGlobal, &numCols);PYLITH_CHECK_ERROR(err);
+  size_t maxWeights = 1;
+  for (PetscInt i=0; i < numVerticesF; ++i) {
+    maxWeights = std::max(maxWeights, weights[i].size());
+  } // for
+  const PetscInt maxNonzeros = maxWeights;
+
+  MPI_Comm comm;
+  err = PetscObjectGetComm((PetscObject) dmFine, &comm);PYLITH_CHECK_ERROR(err);
+  err = MatCreate(comm, interp);PYLITH_CHECK_ERROR(err);
+  err = MatSetSizes(*interp, numRows, numCols, PETSC_DETERMINE, PETSC_DETERMINE);PYLITH_CHECK_ERROR(err);
+  err = MatSetType(*interp, MATAIJ);PYLITH_CHECK_ERROR(err);
+  err = MatSeqAIJSetPreallocation(*interp, maxNonzeros, NULL);PYLITH_CHECK_ERROR(err);
+  err = MatMPIAIJSetPreallocation(*interp, maxNonzeros, NULL, maxNonzeros, NULL);PYLITH_CHECK_ERROR(err);
+
+  // Set values for unconstrained DOF of fine points owned by this process.
+  std::vector<PetscInt> cols;
+  std::vector<PetscScalar> values;
+  PetscInt pStart = 0, pEnd = 0;
+  err = PetscSectionGetChart(fineLocal, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+  for (PetscInt p = pStart; p < pEnd; ++p) {
+    PetscInt dof = 0, goff = 0;
+    err = PetscSectionGetDof(fineLocal, p, &dof);PYLITH_CHECK_ERROR(err);
+    err = PetscSectionGetOffset(fineGlobal, p, &goff);PYLITH_CHECK_ERROR(err);
+    if (!dof || goff < 0) {
+      continue;
+    } // if
+
+    const WeightMap* pWeights = NULL;
+    if (p >= vStartF && p < vEndF) {
+      pWeights = &weights[p-vStartF];
+    } else if (p >= eMaxF && p < eMaxF+numHybridEdgesF) {
+      pWeights = &edgeWeights[p-eMaxF];
+    } else {
+      std::ostringstream msg;
+      msg << "Interpolation of DOF on point " << p << " in refined mesh not supported. Only DOF on vertices and hybrid edges are supported.";
+      throw std::logic_error(msg.str());
+    } // if/else
+    assert(pWeights);
+
+    PetscInt cdof = 0;
+    const PetscInt* cind = NULL;
+    err = PetscSectionGetConstraintDof(fineLocal, p, &cdof);PYLITH_CHECK_ERROR(err);
+    err = PetscSectionGetConstraintIndices(fineLocal, p, &cind);PYLITH_CHECK_ERROR(err);
+
+    for (PetscInt d=0, dc=0, row=goff; d < dof; ++d) {
+      if (dc < cdof && cind[dc] == d) {
+	++dc;
+	continue;
+      } // if
+
+      // Skip constrained DOF of coarse points (homogeneous Dirichlet
+      // values) and account for them in the column numbering.
+      cols.clear();
+      values.clear();
+      for (WeightMap::const_iterator w_iter=pWeights->begin(); w_iter != pWeights->end(); ++w_iter) {
+	const PetscInt q = w_iter->first;
+	PetscInt qdof = 0, qoff = 0, qcdof = 0;
+	const PetscInt* qcind = NULL;
+	err = PetscSectionGetDof(coarseLocal, q, &qdof);PYLITH_CHECK_ERROR(err);
+	err = PetscSectionGetOffset(coarseGlobal, q, &qoff);PYLITH_CHECK_ERROR(err);
+	if (qdof != dof) {
+	  std::ostringstream msg;
+	  msg << "Number of DOF (" << qdof << ") for point " << q << " in coarse mesh does not match number of DOF ("
+	      << dof << ") for point " << p << " in refined mesh.";
+	  throw std::logic_error(msg.str());
+	} // if
+	err = PetscSectionGetConstraintDof(coarseLocal, q, &qcdof);PYLITH_CHECK_ERROR(err);
+	err = PetscSectionGetConstraintIndices(coarseLocal, q, &qcind);PYLITH_CHECK_ERROR(err);
+	PetscInt numConstrainedBefore = 0;
+	bool isConstrained = false;
+	for (PetscInt i=0; i < qcdof; ++i) {
+	  if (qcind[i] < d) {
+	    ++numConstrainedBefore;
+	  } else if (qcind[i] == d) {
+	    isConstrained = true;
+	  } // if/else
+	} // for
+	if (isConstrained) {
+	  continue;
+	} // if
+	cols.push_back((qoff < 0 ? -(qoff+1) : qoff) + d - numConstrainedBefore);
+	values.push_back(w_iter->second);
+      } // for
+      if (cols.size() > 0) {
+	err = MatSetValues(*interp, 1, &row, cols.size(), &cols[0], &values[0], INSERT_VALUES);PYLITH_CHECK_ERROR(err);
+      } // if
+      ++row;
+    } // for
+  } // for
+  err = MatAssemblyBegin(*interp, MAT_FINAL_ASSEMBLY);PYLITH_CHECK_ERROR(err);
+  err = MatAssemblyEnd(*interp, MAT_FINAL_ASSEMBLY);PYLITH_CHECK_ERROR(err);
+
+  PYLITH_METHOD_END;
+} // _createInterpolation
+
+
+// End of file
@@ -0,0 +1,189 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file libsrc/topology/RefineInterpolator.hh
+ *
+ * @brief Object for managing interpolation between levels of a mesh
+ * refinement hierarchy.
+ *
+ * The hierarchy is the one retained by RefineUniform. Interpolation
+ * is linear (P1) for DOF on vertices. DOF on hybrid edges (Lagrange
+ * multipliers for faults) use the weights of the first vertex in the
+ * cone of the edge, applied to the hybrid edges of the same fault in
+ * the coarse mesh. Coarse levels inherit the Dirichlet constraints of
+ * the corresponding vertices in the refined mesh.
+ */
+
+#if !defined(pylith_topology_refineinterpolator_hh)
+#define pylith_topology_refineinterpolator_hh
+
+// Include directives ---------------------------------------------------
+#include "topologyfwd.hh" // forward declarations
+
+#include "pylith/utils/petscfwd.h" // HASA PetscDM, PetscMat, PetscIS
+
+#include <vector> // HASA std::vector
+
+// RefineInterpolator ---------------------------------------------------
+/// Object for managing interpolation between levels of a mesh refinement hierarchy.
+class pylith::topology::RefineInterpolator
+{ // RefineInterpolator
+  friend class TestRefineInterpolator; // unit testing
+
+// PUBLIC MEMBERS ///////////////////////////////////////////////////////
+public :
+
+  /// Constructor
+  RefineInterpolator(void);
+
+  /// Destructor
+  ~RefineInterpolator(void);
+
+  /// Deallocate data structures.
+  void deallocate(void);
+
+  /** Create layout of coarse levels and interpolation operators for
+   * refinement hierarchy of the mesh associated with a field.
+   *
+   * @param field Field on finest mesh (defines layout of finest level).
+   */
+  void initialize(const Field& field);
+
+  /** Get number of levels in hierarchy, including finest level.
+   *
+   * @returns Number of levels.
+   */
+  int numLevels(void) const;
+
+  /** Get interpolation operator from level-1 to level.
+   *
+   * Level 0 is the coarsest level, consistent with PCMG.
+   *
+   * @param level Level of fine side of interpolation (>= 1).
+   * @returns PETSc matrix for interpolation.
+   */
+  PetscMat interpolation(const int level) const;
+
+  /** Get local section for layout of level.
+   *
+   * @param level Level in hierarchy.
+   * @returns Local PETSc section.
+   */
+  PetscSection localSection(const int level) const;
+
+  /** Get global section for layout of level.
+   *
+   * @param level Level in hierarchy.
+   * @returns Global PETSc section.
+   */
+  PetscSection globalSection(const int level) const;
+
+  /** Does layout include DOF on hybrid edges (Lagrange multipliers)
+   * on any process?
+   *
+   * @returns True if layout includes DOF on hybrid edges.
+   */
+  bool hasEdgeDof(void) const;
+
+  /** Create index sets for global DOF on vertices and on hybrid
+   * edges of a level. Caller is responsible for destroying the index
+   * sets.
+   *
+   * @param isVertices Index set for DOF on vertices [output].
+   * @param isEdges Index set for DOF on hybrid edges [output].
+   * @param level Level in hierarchy.
+   */
+  void createFieldIS(PetscIS* isVertices,
+		     PetscIS* isEdges,
+		     const int level) const;
+
+// PRIVATE METHODS //////////////////////////////////////////////////////
+private :
+
+  /** Check that the vertices of the coarse level are the first
+   * vertices of the fine level, in the same order, as created by
+   * uniform refinement.
+   *
+   * @param dmCoarse PETSc DM for coarse level.
+   * @param dmFine PETSc DM for fine level.
+   */
+  static
+  void _checkVertexNumbering(PetscDM dmCoarse,
+			     PetscDM dmFine);
+
+  /** Create layout for a coarse level with DOF on vertices and
+   * hybrid edges.
+   *
+   * @param localSection Local section [output].
+   * @param globalSection Global section [output].
+   * @param dm PETSc DM for coarse level.
+   * @param vertexDof Number of DOF per vertex.
+   * @param edgeDof Number of DOF per hybrid edge (0 if none).
+   * @param dmFine PETSc DM for next finer level.
+   * @param fineLocal Local section for next finer level (source of constraints).
+   */
+  static
+  void _createSections(PetscSection* localSection,
+		       PetscSection* globalSection,
+		       PetscDM dm,
+		       const int vertexDof,
+		       const int edgeDof,
+		       PetscDM dmFine,
+		       PetscSection fineLocal);
+
+  /** Create interpolation operator from coarse level to fine level.
+   *
+   * @param interp Interpolation matrix [output].
+   * @param dmCoarse PETSc DM for coarse level.
+   * @param coarseLocal Local section for coarse level.
+   * @param coarseGlobal Global section for coarse level.
+   * @param dmFine PETSc DM for fine level.
+   * @param fineLocal Local section for fine level.
+   * @param fineGlobal Global section for fine level.
+   */
+  static
+  void _createInterpolation(PetscMat* interp,
+			    PetscDM dmCoarse,
+			    PetscSection coarseLocal,
+			    PetscSection coarseGlobal,
+			    PetscDM dmFine,
+			    PetscSection fineLocal,
+			    PetscSection fineGlobal);
+
+// PRIVATE MEMBERS //////////////////////////////////////////////////////
+private :
+
+  std::vector<PetscDM> _dms; ///< DM for each level (coarse to fine).
+  std::vector<PetscSection> _localSections; ///< Local section for each level.
+  std::vector<PetscSection> _globalSections; ///< Global section for each level.
+  std::vector<PetscMat> _interpolation; ///< Interpolation into each level (NULL for coarsest).
+  bool _hasEdgeDof; ///< True if layout includes DOF on hybrid edges.
+
+// NOT IMPLEMENTED //////////////////////////////////////////////////////
+private :
+
+  RefineInterpolator(const RefineInterpolator&); ///< Not implemented
+  const RefineInterpolator& operator=(const RefineInterpolator&); ///< Not implemented
+
+}; // RefineInterpolator
+
+#endif // pylith_topology_refineinterpolator_hh
+
+
+// End of file
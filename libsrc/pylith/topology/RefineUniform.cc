@@ -29,7 +29,8 @@
 
 // ----------------------------------------------------------------------
 // Constructor
-pylith::topology::RefineUniform::RefineUniform(void)
+pylith::topology::RefineUniform::RefineUniform(void) :
+  _retainHierarchy(false)
 { // constructor
 } // constructor
  
@@ -47,6 +48,14 @@ pylith::topology::RefineUniform::deallocate(void)
 { // deallocate
 } // deallocate
 
+// ----------------------------------------------------------------------
+// Set flag for retaining the coarser meshes in the refined mesh.
+void
+pylith::topology::RefineUniform::retainHierarchy(const bool value)
+{ // retainHierarchy
+  _retainHierarchy = value;
+} // retainHierarchy
+
 // ----------------------------------------------------------------------
 // Refine mesh.
 void
@@ -76,15 +85,24 @@ pylith::topology::RefineUniform::refine(Mesh* const newMesh,
     throw std::runtime_error(msg.str());
   } // if
 
-  // Refine, keeping original mesh intact.
+  // Refine, keeping original mesh intact. If requested, each refined
+  // mesh holds a reference to the mesh it was refined from, so the
+  // hierarchy remains available for geometric multigrid (see
+  // RefineInterpolator) after the coarser meshes are released.
   PetscDM dmNew = NULL;
   err = DMPlexSetRefinementUniform(dmOrig, PETSC_TRUE);PYLITH_CHECK_ERROR(err);
   err = DMRefine(dmOrig, mesh.comm(), &dmNew);PYLITH_CHECK_ERROR(err);
+  if (_retainHierarchy) {
+    err = DMSetCoarseDM(dmNew, dmOrig);PYLITH_CHECK_ERROR(err);
+  } // if
 
   for (int i=1; i < levels; ++i) {
     PetscDM dmCur = dmNew; dmNew = NULL;
     err = DMPlexSetRefinementUniform(dmCur, PETSC_TRUE);PYLITH_CHECK_ERROR(err);
     err = DMRefine(dmCur, mesh.comm(), &dmNew);PYLITH_CHECK_ERROR(err);
+    if (_retainHierarchy) {
+      err = DMSetCoarseDM(dmNew, dmCur);PYLITH_CHECK_ERROR(err);
+    } // if
 
     err = DMDestroy(&dmCur);PYLITH_CHECK_ERROR(err);
   } // for
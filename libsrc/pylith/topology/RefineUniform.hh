@@ -46,6 +46,16 @@ public :
   /// Deallocate data structures.
   void deallocate(void);
 
+  /** Set flag for retaining the coarser meshes in the refined mesh.
+   *
+   * The coarser meshes are accessible via DMGetCoarseDM() for use in
+   * geometric multigrid. They remain in memory for the lifetime of
+   * the refined mesh, so only retain them when needed.
+   *
+   * @param value True to retain coarser meshes, false otherwise.
+   */
+  void retainHierarchy(const bool value);
+
   /** Refine mesh.
    *
    * @param newMesh Refined mesh (result).
@@ -56,6 +66,11 @@ public :
 	      const Mesh& mesh,
 	      const int levels =1);
 
+// PRIVATE MEMBERS //////////////////////////////////////////////////////
+private :
+
+  bool _retainHierarchy; ///< Retain coarser meshes in refined mesh.
+
 // NOT IMPLEMENTED //////////////////////////////////////////////////////
 private :
 
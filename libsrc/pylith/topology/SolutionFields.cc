@@ -20,13 +20,21 @@
 
 #include "SolutionFields.hh" // implementation of class methods
 
+#include "Field.hh" // USES Field
+
 #include "pylith/utils/error.h" // USES PYLITH_CHECK_ERROR
 
+#include <petscvec.h> // USES PetscVec
+
+#include <algorithm> // USES std::rotate()
+#include <cassert> // USES assert()
+
 // ----------------------------------------------------------------------
 // Default constructor.
 pylith::topology::SolutionFields::SolutionFields(const Mesh& mesh) :
   Fields(mesh),
-  _solutionName("")
+  _solutionName(""),
+  _historyLength(0)
 { // constructor
 } // constructor
 
@@ -42,7 +50,19 @@ pylith::topology::SolutionFields::~SolutionFields(void)
 void
 pylith::topology::SolutionFields::deallocate(void)
 { // deallocate
+  PYLITH_METHOD_BEGIN;
+
   Fields::deallocate();
+
+  PetscErrorCode err = 0;
+  const size_t size = _history.size();
+  for (size_t i=0; i < size; ++i) {
+    err = VecDestroy(&_history[i]);PYLITH_CHECK_ERROR(err);
+  } // for
+  _history.clear();
+  _historyLength = 0;
+
+  PYLITH_METHOD_END;
 } // deallocate
   
 // ----------------------------------------------------------------------
@@ -81,5 +101,103 @@ pylith::topology::SolutionFields::solution(void)
   return get(_solutionName.c_str());
 } // solution
 
+// ----------------------------------------------------------------------
+// Create history of previous solutions.
+void
+pylith::topology::SolutionFields::createHistory(const int size)
+{ // createHistory
+  PYLITH_METHOD_BEGIN;
+
+  if (size < 0) {
+    std::ostringstream msg;
+    msg << "Size of solution history (" << size << ") must be nonnegative.";
+    throw std::runtime_error(msg.str());
+  } // if
+
+  PetscErrorCode err = 0;
+  const size_t oldSize = _history.size();
+  for (size_t i=0; i < oldSize; ++i) {
+    err = VecDestroy(&_history[i]);PYLITH_CHECK_ERROR(err);
+  } // for
+  _history.clear();
+  _historyLength = 0;
+
+  if (size > 0) {
+    const PetscVec solutionVec = solution().globalVector();
+    if (!solutionVec) {
+      throw std::runtime_error("Cannot create solution history. Solution field does not have a global vector.");
+    } // if
+    _history.resize(size);
+    for (int i=0; i < size; ++i) {
+      err = VecDuplicate(solutionVec, &_history[i]);PYLITH_CHECK_ERROR(err);
+      err = VecSet(_history[i], 0.0);PYLITH_CHECK_ERROR(err);
+    } // for
+  } // if
+
+  PYLITH_METHOD_END;
+} // createHistory
+
+// ----------------------------------------------------------------------
+// Get maximum number of previous solutions retained in history.
+int
+pylith::topology::SolutionFields::historySize(void) const
+{ // historySize
+  return _history.size();
+} // historySize
+
+// ----------------------------------------------------------------------
+// Get number of previous solutions currently stored in history.
+int
+pylith::topology::SolutionFields::historyLength(void) const
+{ // historyLength
+  return _historyLength;
+} // historyLength
+
+// ----------------------------------------------------------------------
+// Copy current solution into history.
+void
+pylith::topology::SolutionFields::shiftHistory(void)
+{ // shiftHistory
+  PYLITH_METHOD_BEGIN;
+
+  const int size = _history.size();
+  if (!size) {
+    PYLITH_METHOD_END;
+  } // if
+
+  // Reuse the oldest vector for the newest solution by rotating the
+  // handles, so no vectors are allocated here.
+  std::rotate(_history.begin(), _history.end()-1, _history.end());
+  const PetscVec solutionVec = solution().globalVector();assert(solutionVec);
+  PetscErrorCode err = VecCopy(solutionVec, _history[0]);PYLITH_CHECK_ERROR(err);
+  if (_historyLength < size) {
+    ++_historyLength;
+  } // if
+
+  PYLITH_METHOD_END;
+} // shiftHistory
+
+// ----------------------------------------------------------------------
+// Discard all solutions stored in history.
+void
+pylith::topology::SolutionFields::clearHistory(void)
+{ // clearHistory
+  _historyLength = 0;
+} // clearHistory
+
+// ----------------------------------------------------------------------
+// Get global PETSc vector for previous solution.
+PetscVec
+pylith::topology::SolutionFields::historyVector(const int index) const
+{ // historyVector
+  if (index < 0 || index >= _historyLength) {
+    std::ostringstream msg;
+    msg << "Index (" << index << ") of solution history is out of range [0, " << _historyLength << ").";
+    throw std::runtime_error(msg.str());
+  } // if
+
+  return _history[index];
+} // historyVector
+
 
 // End of file 
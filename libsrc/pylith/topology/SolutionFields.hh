@@ -31,6 +31,8 @@
 
 #include "Fields.hh" // ISA Fields
 
+#include "pylith/utils/petscfwd.h" // HASA PetscVec
+
 #include <vector> // HASA std::vector
 
 // SolutionFields -------------------------------------------------------
@@ -74,6 +76,44 @@ public :
    */
   Field& solution(void);
 
+  /** Create history of previous solutions.
+   *
+   * The history holds copies of the global PETSc vector of the
+   * solution field from previous solves (e.g., increments in
+   * displacement for previous time steps). The solution field must
+   * have a global vector when the history is created.
+   *
+   * @param size Maximum number of previous solutions to retain.
+   */
+  void createHistory(const int size);
+
+  /** Get maximum number of previous solutions retained in history.
+   *
+   * @returns Size of history.
+   */
+  int historySize(void) const;
+
+  /** Get number of previous solutions currently stored in history.
+   *
+   * @returns Number of previous solutions (<= history size).
+   */
+  int historyLength(void) const;
+
+  /** Copy current solution (global PETSc vector) into history. The
+   * oldest solution is discarded when the history is full.
+   */
+  void shiftHistory(void);
+
+  /// Discard all solutions stored in history (retains storage).
+  void clearHistory(void);
+
+  /** Get global PETSc vector for previous solution.
+   *
+   * @param index Index of solution in history (0 is most recent).
+   * @returns PETSc vector for previous solution.
+   */
+  PetscVec historyVector(const int index) const;
+
 // PRIVATE MEMBERS //////////////////////////////////////////////////////
 private :
 
@@ -81,6 +121,13 @@ private :
   /// problem.
   std::string _solutionName;
 
+  /// Global PETSc vectors holding previous solutions, ordered from
+  /// most recent to oldest.
+  std::vector<PetscVec> _history;
+
+  /// Number of previous solutions stored in history.
+  int _historyLength;
+
 // NOT IMPLEMENTED //////////////////////////////////////////////////////
 private :
 
@@ -0,0 +1,209 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ======================================================================
+//
+
+#include <portinfo>
+
+#include "SpaceFillingCurve.hh" // implementation of class methods
+
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/Stratum.hh" // USES Stratum
+#include "pylith/topology/CoordsVisitor.hh" // USES CoordsVisitor
+#include "pylith/utils/BatchQuery.hh" // USES BatchQuery::mortonOrder()
+#include "pylith/utils/error.h" // USES PYLITH_CHECK_ERROR
+
+#include <vector> // USES std::vector
+#include <algorithm> // USES std::stable_sort()
+#include <stdexcept> // USES std::logic_error
+#include <cassert> // USES assert()
+
+// ----------------------------------------------------------------------
+namespace pylith {
+  namespace topology {
+    class _SpaceFillingCurve {
+    public :
+      /// Compare cells by material identifier.
+      class MaterialLess {
+      public :
+	MaterialLess(const std::vector<PetscInt>& materialIds) :
+	  _materialIds(materialIds)
+	{}
+	bool operator()(const int a,
+			const int b) const {
+	  return _materialIds[a] < _materialIds[b];
+	}
+      private :
+	const std::vector<PetscInt>& _materialIds;
+      }; // MaterialLess
+    }; // _SpaceFillingCurve
+  } // topology
+} // pylith
+
+// ----------------------------------------------------------------------
+// Reorder vertices and cells in mesh.
+void
+pylith::topology::SpaceFillingCurve::reorder(topology::Mesh* mesh)
+{ // reorder
+  PYLITH_METHOD_BEGIN;
+
+  assert(mesh);
+  PetscDM dmOrig = mesh->dmMesh();assert(dmOrig);
+  PetscErrorCode err = 0;
+
+  PetscInt cMax = -1;
+  err = DMPlexGetHybridBounds(dmOrig, &cMax, NULL, NULL, NULL);PYLITH_CHECK_ERROR(err);
+  if (cMax >= 0) {
+    throw std::logic_error("Space-filling curve reordering must be done before inserting cohesive cells.");
+  } // if
+
+  Stratum cellsStratum(dmOrig, Stratum::HEIGHT, 0);
+  const PetscInt cStart = cellsStratum.begin();
+  const PetscInt cEnd = cellsStratum.end();
+  const PetscInt numCells = cellsStratum.size();
+  PetscInt spaceDim = 0;
+  err = DMGetCoordinateDim(dmOrig, &spaceDim);PYLITH_CHECK_ERROR(err);
+
+  // Compute centroids of cells.
+  std::vector<double> centroids(numCells*spaceDim, 0.0);
+  CoordsVisitor coordsVisitor(dmOrig);
+  for (PetscInt c=cStart; c < cEnd; ++c) {
+    PetscScalar* coordsCell = NULL;
+    PetscInt coordsSize = 0;
+    coordsVisitor.getClosure(&coordsCell, &coordsSize, c);
+    const PetscInt numVertices = coordsSize / spaceDim;
+    for (PetscInt iV=0; iV < numVertices; ++iV) {
+      for (PetscInt iDim=0; iDim < spaceDim; ++iDim) {
+	centroids[(c-cStart)*spaceDim+iDim] += coordsCell[iV*spaceDim+iDim] / numVertices;
+      } // for
+    } // for
+    coordsVisitor.restoreClosure(&coordsCell, &coordsSize, c);
+  } // for
+
+  // Order cells along curve, then group by material while preserving
+  // the order along the curve within each material.
+  std::vector<int> order;
+  utils::BatchQuery::mortonOrder(&order, numCells ? &centroids[0] : NULL, numCells, spaceDim);
+  std::vector<PetscInt> materialIds(numCells, 0);
+  DMLabel materialsLabel = NULL;
+  err = DMGetLabel(dmOrig, "material-id", &materialsLabel);PYLITH_CHECK_ERROR(err);
+  if (materialsLabel) {
+    for (PetscInt c=cStart; c < cEnd; ++c) {
+      err = DMLabelGetValue(materialsLabel, c, &materialIds[c-cStart]);PYLITH_CHECK_ERROR(err);
+    } // for
+  } // if
+  std::stable_sort(order.begin(), order.end(), _SpaceFillingCurve::MaterialLess(materialIds));
+
+  // Number points in the order they are first reached by the
+  // closures of the reordered cells, keeping each depth stratum in
+  // its original range of points.
+  PetscInt pStart = 0, pEnd = 0, depth = 0;
+  err = DMPlexGetChart(dmOrig, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+  err = DMPlexGetDepth(dmOrig, &depth);PYLITH_CHECK_ERROR(err);
+  DMLabel depthLabel = NULL;
+  err = DMPlexGetDepthLabel(dmOrig, &depthLabel);PYLITH_CHECK_ERROR(err);
+  std::vector<PetscInt> nextPoint(depth+1, 0);
+  for (PetscInt d=0; d <= depth; ++d) {
+    Stratum stratum(dmOrig, Stratum::DEPTH, d);
+    nextPoint[d] = stratum.begin();
+  } // for
+
+  std::vector<PetscInt> perm(pEnd-pStart, -1);
+  PetscInt* closure = NULL;
+  PetscInt closureSize = 0;
+  for (PetscInt i=0; i < numCells; ++i) {
+    const PetscInt cell = cStart + order[i];
+    err = DMPlexGetTransitiveClosure(dmOrig, cell, PETSC_TRUE, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
+    for (PetscInt p=0; p < closureSize*2; p += 2) {
+      const PetscInt point = closure[p];
+      if (perm[point-pStart] < 0) {
+	PetscInt pointDepth = 0;
+	err = DMLabelGetValue(depthLabel, point, &pointDepth);PYLITH_CHECK_ERROR(err);
+	perm[point-pStart] = nextPoint[pointDepth]++;
+      } // if
+    } // for
+    err = DMPlexRestoreTransitiveClosure(dmOrig, cell, PETSC_TRUE, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
+  } // for
+  // Points not in the closure of any cell keep their relative order.
+  for (PetscInt point=pStart; point < pEnd; ++point) {
+    if (perm[point-pStart] < 0) {
+      PetscInt pointDepth = 0;
+      err = DMLabelGetValue(depthLabel, point, &pointDepth);PYLITH_CHECK_ERROR(err);
+      perm[point-pStart] = nextPoint[pointDepth]++;
+    } // if
+  } // for
+
+  PetscIS permutation = NULL;
+  PetscDM dmNew = NULL;
+  err = ISCreateGeneral(PETSC_COMM_SELF, perm.size(), perm.size() ? &perm[0] : NULL, PETSC_COPY_VALUES, &permutation);PYLITH_CHECK_ERROR(err);
+  err = ISSetPermutation(permutation);PYLITH_CHECK_ERROR(err);
+  err = DMPlexPermute(dmOrig, permutation, &dmNew);PYLITH_CHECK_ERROR(err);
+  err = ISDestroy(&permutation);PYLITH_CHECK_ERROR(err);
+  mesh->dmMesh(dmNew);
+
+  PYLITH_METHOD_END;
+} // reorder
+
+// ----------------------------------------------------------------------
+// Get mean and maximum span of vertex numbers in closure of cells.
+void
+pylith::topology::SpaceFillingCurve::closureSpan(double* meanSpan,
+						 int* maxSpan,
+						 const topology::Mesh& mesh)
+{ // closureSpan
+  PYLITH_METHOD_BEGIN;
+
+  assert(meanSpan);
+  assert(maxSpan);
+
+  PetscDM dmMesh = mesh.dmMesh();assert(dmMesh);
+  Stratum cellsStratum(dmMesh, Stratum::HEIGHT, 0);
+  const PetscInt cStart = cellsStratum.begin();
+  const PetscInt cEnd = cellsStratum.end();
+  Stratum verticesStratum(dmMesh, Stratum::DEPTH, 0);
+  const PetscInt vStart = verticesStratum.begin();
+  const PetscInt vEnd = verticesStratum.end();
+
+  PetscErrorCode err = 0;
+  double spanSum = 0.0;
+  PetscInt spanMax = 0;
+  PetscInt* closure = NULL;
+  PetscInt closureSize = 0;
+  for (PetscInt c=cStart; c < cEnd; ++c) {
+    err = DMPlexGetTransitiveClosure(dmMesh, c, PETSC_TRUE, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
+    PetscInt vMin = vEnd, vMax = vStart-1;
+    for (PetscInt p=0; p < closureSize*2; p += 2) {
+      const PetscInt point = closure[p];
+      if (point >= vStart && point < vEnd) {
+	vMin = std::min(vMin, point);
+	vMax = std::max(vMax, point);
+      } // if
+    } // for
+    err = DMPlexRestoreTransitiveClosure(dmMesh, c, PETSC_TRUE, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
+    const PetscInt span = (vMax >= vMin) ? vMax - vMin : 0;
+    spanSum += span;
+    spanMax = std::max(spanMax, span);
+  } // for
+
+  const PetscInt numCells = cEnd - cStart;
+  *meanSpan = (numCells > 0) ? spanSum / numCells : 0.0;
+  *maxSpan = spanMax;
+
+  PYLITH_METHOD_END;
+} // closureSpan
+
+
+// End of file 
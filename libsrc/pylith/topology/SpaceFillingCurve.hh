@@ -0,0 +1,78 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file libsrc/topology/SpaceFillingCurve.hh
+ *
+ * @brief Reordering of cells and vertices of a mesh along a
+ * space-filling curve.
+ *
+ * Cells are grouped by material and ordered along a Morton
+ * (Z-order) curve through their centroids within each
+ * material. Vertices, edges, and faces are numbered in the order
+ * they are first reached by the reordered cells, so that the
+ * closure of consecutive cells covers a compact range of points.
+ */
+
+#if !defined(pylith_topology_spacefillingcurve_hh)
+#define pylith_topology_spacefillingcurve_hh
+
+// Include directives ---------------------------------------------------
+#include "topologyfwd.hh" // forward declarations
+
+// SpaceFillingCurve ----------------------------------------------------
+/// Reordering of cells and vertices along a space-filling curve.
+class pylith::topology::SpaceFillingCurve
+{ // SpaceFillingCurve
+
+// PUBLIC MEMBERS ///////////////////////////////////////////////////////
+public :
+
+  /** Reorder vertices and cells of mesh along a space-filling curve
+   * within each material.
+   *
+   * @pre Mesh must not contain cohesive cells.
+   *
+   * @param mesh PyLith finite-element mesh.
+   */
+  static
+  void reorder(topology::Mesh* mesh);
+
+  /** Get mean and maximum over cells of the span of vertex numbers
+   * in the closure of a cell.
+   *
+   * The span is a proxy for the spread of offsets into a field over
+   * vertices when restricting the field to a cell, and the maximum
+   * span bounds the bandwidth of the Jacobian for a field over
+   * vertices. Both are computed in a single traversal of the cells.
+   *
+   * @param meanSpan Mean span of vertices in closure of cells (output).
+   * @param maxSpan Maximum span of vertices in closure of cells (output).
+   * @param mesh PyLith finite-element mesh.
+   */
+  static
+  void closureSpan(double* meanSpan,
+		   int* maxSpan,
+		   const topology::Mesh& mesh);
+
+}; // SpaceFillingCurve
+
+#endif // pylith_topology_spacefillingcurve_hh
+
+
+// End of file 
@@ -55,6 +55,16 @@ public :
   VecVisitorMesh(const Field& field,
 		 const char* subfield =0);
 
+  /** Constructor with field in a fields manager.
+   *
+   * @param fields Fields manager.
+   * @param handle Handle for field from Fields::handle().
+   * @param subfield Name of subfield section to use instead of field section.
+   */
+  VecVisitorMesh(const Fields& fields,
+		 const int handle,
+		 const char* subfield =0);
+
   /// Default destructor
   ~VecVisitorMesh(void);
 
@@ -156,6 +166,16 @@ public :
 		  const PetscInt cell,
 		  const InsertMode mode) const;
 
+  /** Use table of offsets for closures in getClosure() and setClosure().
+   *
+   * The table is used only if the section of the field has the same
+   * layout as the table; otherwise, the closure operations use
+   * DMPlex.
+   *
+   * @param map Table of offsets for closures (NULL to not use table).
+   */
+  void closureIndexMap(ClosureIndexMap* map);
+
   /** Optimize the closure operator by creating index for closures.
    *
    * :TODO: Remove this method. Call static version when setting up fields.
@@ -176,6 +196,7 @@ private :
   PetscVec _localVec; ///< Cached local PETSc Vec.
   PetscSection _section; ///< Cached PETSc section.
   PetscScalar* _localArray; ///< Cached local array
+  const ClosureIndexMap* _closureMap; ///< Table of offsets for closures (NULL if not used).
 
 // NOT IMPLEMENTED //////////////////////////////////////////////////////
 private :
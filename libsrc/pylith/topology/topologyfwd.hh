@@ -50,12 +50,15 @@ namespace pylith {
     class Jacobian;
     class MatVisitorMesh;
     class MatVisitorSubMesh;
+    class ClosureIndexMap;
 
     class Distributor;
 
     class RefineUniform;
+    class RefineInterpolator;
 
     class ReverseCuthillMcKee;
+    class SpaceFillingCurve;
 
   } // topology
 } // pylith
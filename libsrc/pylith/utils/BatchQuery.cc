@@ -0,0 +1,228 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ======================================================================
+//
+
+#include <portinfo>
+
+#include "BatchQuery.hh" // implementation of class methods
+
+#include "BulkQueryDB.hh" // USES BulkQueryDB
+
+#include "spatialdata/spatialdb/SpatialDB.hh" // USES SpatialDB
+
+#include <algorithm> // USES std::sort(), std::min()
+#include <utility> // USES std::pair
+#include <cassert> // USES assert()
+
+// ----------------------------------------------------------------------
+namespace pylith {
+  namespace utils {
+    namespace _BatchQuery {
+      /// Key and index of point for sorting.
+      typedef std::pair<unsigned long long, int> KeyIndex;
+
+      /** Interleave bits of quantized coordinates.
+       *
+       * @param q Quantized coordinates [spaceDim].
+       * @param spaceDim Spatial dimension.
+       * @param numBits Number of bits per coordinate.
+       * @returns Morton key.
+       */
+      unsigned long long mortonKey(const unsigned long long* q,
+				   const int spaceDim,
+				   const int numBits) {
+	unsigned long long key = 0;
+	for (int iBit=numBits-1; iBit >= 0; --iBit)
+	  for (int iDim=0; iDim < spaceDim; ++iDim)
+	    key = (key << 1) | ((q[iDim] >> iBit) & 1ULL);
+	return key;
+      } // mortonKey
+    } // _BatchQuery
+  } // utils
+} // pylith
+
+// ----------------------------------------------------------------------
+// Constructor
+pylith::utils::BatchQuery::BatchQuery(void) :
+  _numPoints(0),
+  _spaceDim(0),
+  _isSorted(false)
+{ // constructor
+} // constructor
+
+// ----------------------------------------------------------------------
+// Destructor
+pylith::utils::BatchQuery::~BatchQuery(void)
+{ // destructor
+} // destructor
+
+// ----------------------------------------------------------------------
+// Set number of points and allocate storage for coordinates.
+void
+pylith::utils::BatchQuery::resize(const int numPoints,
+				  const int spaceDim)
+{ // resize
+  assert(numPoints >= 0);
+  assert(spaceDim > 0);
+
+  _numPoints = numPoints;
+  _spaceDim = spaceDim;
+  _coords.resize(numPoints*spaceDim);
+  _isSorted = false;
+} // resize
+
+// ----------------------------------------------------------------------
+// Get number of points.
+int
+pylith::utils::BatchQuery::numPoints(void) const
+{ // numPoints
+  return _numPoints;
+} // numPoints
+
+// ----------------------------------------------------------------------
+// Set coordinates of point.
+void
+pylith::utils::BatchQuery::point(const int index,
+				 const PylithScalar* coords)
+{ // point
+  assert(0 <= index && index < _numPoints);
+  assert(coords);
+
+  for (int i=0; i < _spaceDim; ++i)
+    _coords[index*_spaceDim+i] = coords[i];
+  _isSorted = false;
+} // point
+
+// ----------------------------------------------------------------------
+// Get coordinates of point.
+const double*
+pylith::utils::BatchQuery::point(const int index) const
+{ // point
+  assert(0 <= index && index < _numPoints);
+
+  return &_coords[index*_spaceDim];
+} // point
+
+// ----------------------------------------------------------------------
+// Query database at all points.
+int
+pylith::utils::BatchQuery::query(PylithScalar* values,
+				 const int numValues,
+				 spatialdata::spatialdb::SpatialDB* db,
+				 const spatialdata::geocoords::CoordSys* cs)
+{ // query
+  assert(values || 0 == _numPoints);
+  assert(numValues > 0);
+  assert(db);
+
+  if (!_isSorted) {
+    mortonOrder(&_order, _numPoints ? &_coords[0] : 0, _numPoints, _spaceDim);
+    _isSorted = true;
+  } // if
+
+  if (!_numPoints)
+    return -1;
+
+  int errIndex = -1;
+  BulkQueryDB* bulkDB = dynamic_cast<BulkQueryDB*>(db);
+  if (bulkDB) {
+    // Query all points in Morton order in one call and return values
+    // in the original order.
+    std::vector<double> coordsSorted(_numPoints*_spaceDim);
+    for (int iPt=0; iPt < _numPoints; ++iPt) {
+      const int index = _order[iPt];
+      for (int iDim=0; iDim < _spaceDim; ++iDim)
+	coordsSorted[iPt*_spaceDim+iDim] = _coords[index*_spaceDim+iDim];
+    } // for
+    std::vector<PylithScalar> valuesSorted(_numPoints*numValues);
+    const int errSorted = bulkDB->queryBulk(&valuesSorted[0], numValues, &coordsSorted[0], _numPoints, _spaceDim, cs);
+    for (int iPt=0; iPt < _numPoints; ++iPt) {
+      const int index = _order[iPt];
+      for (int i=0; i < numValues; ++i)
+	values[index*numValues+i] = valuesSorted[iPt*numValues+i];
+    } // for
+    if (errSorted >= 0) {
+      assert(errSorted < _numPoints);
+      errIndex = _order[errSorted];
+    } // if
+  } else {
+    for (int iPt=0; iPt < _numPoints; ++iPt) {
+      const int index = _order[iPt];
+      const int err = db->query(&values[index*numValues], numValues,
+				&_coords[index*_spaceDim], _spaceDim, cs);
+      if (err && (errIndex < 0 || index < errIndex))
+	errIndex = index;
+    } // for
+  } // if/else
+
+  return errIndex;
+} // query
+
+// ----------------------------------------------------------------------
+// Compute permutation that sorts points in Morton order.
+void
+pylith::utils::BatchQuery::mortonOrder(std::vector<int>* order,
+				       const double* coords,
+				       const int numPoints,
+				       const int spaceDim)
+{ // mortonOrder
+  assert(order);
+  assert(coords || 0 == numPoints);
+  assert(0 < spaceDim && spaceDim <= 3);
+
+  order->resize(numPoints);
+  if (!numPoints)
+    return;
+
+  // Bounding box of points.
+  double minCoords[3];
+  double maxCoords[3];
+  for (int iDim=0; iDim < spaceDim; ++iDim) {
+    minCoords[iDim] = coords[iDim];
+    maxCoords[iDim] = coords[iDim];
+  } // for
+  for (int iPt=1; iPt < numPoints; ++iPt)
+    for (int iDim=0; iDim < spaceDim; ++iDim) {
+      const double x = coords[iPt*spaceDim+iDim];
+      minCoords[iDim] = std::min(minCoords[iDim], x);
+      maxCoords[iDim] = std::max(maxCoords[iDim], x);
+    } // for
+
+  // Quantize coordinates so the key for all dimensions fits in 63 bits.
+  const int numBits = std::min(63 / spaceDim, 31);
+  const double maxInt = double((1ULL << numBits) - 1);
+  double scale[3];
+  for (int iDim=0; iDim < spaceDim; ++iDim) {
+    const double range = maxCoords[iDim] - minCoords[iDim];
+    scale[iDim] = (range > 0.0) ? maxInt / range : 0.0;
+  } // for
+
+  std::vector<_BatchQuery::KeyIndex> keys(numPoints);
+  unsigned long long q[3];
+  for (int iPt=0; iPt < numPoints; ++iPt) {
+    for (int iDim=0; iDim < spaceDim; ++iDim)
+      q[iDim] = (unsigned long long)((coords[iPt*spaceDim+iDim] - minCoords[iDim]) * scale[iDim]);
+    keys[iPt] = _BatchQuery::KeyIndex(_BatchQuery::mortonKey(q, spaceDim, numBits), iPt);
+  } // for
+  std::sort(keys.begin(), keys.end());
+
+  for (int iPt=0; iPt < numPoints; ++iPt)
+    (*order)[iPt] = keys[iPt].second;
+} // mortonOrder
+
+
+// End of file 
@@ -0,0 +1,142 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file libsrc/utils/BatchQuery.hh
+ *
+ * @brief C++ object for querying a spatial database at many points
+ * in a batch.
+ *
+ * The caller sets the coordinates of all of the points first, so the
+ * points can be sorted along a space-filling curve (Morton order)
+ * before querying. Databases that implement BulkQueryDB are queried
+ * at all points in one call to BulkQueryDB::queryBulk(); other
+ * databases are queried one point at a time with SpatialDB::query(),
+ * with consecutive points close together in space. The values are
+ * returned in the original order of the points.
+ */
+
+#if !defined(pylith_utils_batchquery_hh)
+#define pylith_utils_batchquery_hh
+
+// Include directives ---------------------------------------------------
+#include "utilsfwd.hh" // forward declarations
+
+#include "pylith/utils/types.hh" // USES PylithScalar
+
+#include "spatialdata/spatialdb/spatialdbfwd.hh" // USES SpatialDB
+#include "spatialdata/geocoords/geocoordsfwd.hh" // USES CoordSys
+
+#include <vector> // HASA std::vector
+
+// BatchQuery -----------------------------------------------------------
+/// C++ object for querying a spatial database at many points in a batch.
+class pylith::utils::BatchQuery
+{ // BatchQuery
+  friend class TestBatchQuery; // unit testing
+
+// PUBLIC METHODS ///////////////////////////////////////////////////////
+public :
+
+  /// Constructor
+  BatchQuery(void);
+
+  /// Destructor
+  ~BatchQuery(void);
+
+  /** Set number of points and allocate storage for coordinates.
+   *
+   * @param numPoints Number of points.
+   * @param spaceDim Spatial dimension of coordinates.
+   */
+  void resize(const int numPoints,
+	      const int spaceDim);
+
+  /** Get number of points.
+   *
+   * @returns Number of points.
+   */
+  int numPoints(void) const;
+
+  /** Set coordinates of point.
+   *
+   * @param index Index of point.
+   * @param coords Coordinates of point (dimensional) [spaceDim].
+   */
+  void point(const int index,
+	     const PylithScalar* coords);
+
+  /** Get coordinates of point.
+   *
+   * @param index Index of point.
+   * @returns Coordinates of point (dimensional) [spaceDim].
+   */
+  const double* point(const int index) const;
+
+  /** Query database at all points.
+   *
+   * The database must be open and the values to query must be set
+   * before calling query().
+   *
+   * @param values Array of values [numPoints*numValues] (output).
+   * @param numValues Number of values per point.
+   * @param db Spatial database.
+   * @param cs Coordinate system of points.
+   * @returns Index of a point where the query failed (-1 if all
+   *   queries were successful). When querying one point at a time,
+   *   this is the first failed point in the original order.
+   */
+  int query(PylithScalar* values,
+	    const int numValues,
+	    spatialdata::spatialdb::SpatialDB* db,
+	    const spatialdata::geocoords::CoordSys* cs);
+
+  /** Compute permutation that sorts points in Morton order.
+   *
+   * @param order Indices of points in Morton order (output).
+   * @param coords Coordinates of points [numPoints*spaceDim].
+   * @param numPoints Number of points.
+   * @param spaceDim Spatial dimension of coordinates.
+   */
+  static
+  void mortonOrder(std::vector<int>* order,
+		   const double* coords,
+		   const int numPoints,
+		   const int spaceDim);
+
+// NOT IMPLEMENTED //////////////////////////////////////////////////////
+private :
+
+  BatchQuery(const BatchQuery&); ///< Not implemented
+  const BatchQuery& operator=(const BatchQuery&); ///< Not implemented
+
+// PRIVATE MEMBERS //////////////////////////////////////////////////////
+private :
+
+  std::vector<double> _coords; ///< Coordinates of points in original order.
+  std::vector<int> _order; ///< Indices of points in Morton order.
+  int _numPoints; ///< Number of points.
+  int _spaceDim; ///< Spatial dimension of coordinates.
+  bool _isSorted; ///< True if order is current.
+
+}; // BatchQuery
+
+#endif // pylith_utils_batchquery_hh
+
+
+// End of file 
@@ -0,0 +1,30 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ======================================================================
+//
+
+#include <portinfo>
+
+#include "BulkQueryDB.hh" // implementation of class methods
+
+// ----------------------------------------------------------------------
+// Destructor
+pylith::utils::BulkQueryDB::~BulkQueryDB(void)
+{ // destructor
+} // destructor
+
+
+// End of file 
@@ -0,0 +1,80 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file libsrc/utils/BulkQueryDB.hh
+ *
+ * @brief Interface for spatial databases that can query many points
+ * in a single call.
+ *
+ * A spatial database derived from spatialdata::spatialdb::SpatialDB
+ * that also derives from BulkQueryDB is queried by BatchQuery with one
+ * call to queryBulk() for all points, in Morton order, instead of one
+ * call to SpatialDB::query() per point.
+ */
+
+#if !defined(pylith_utils_bulkquerydb_hh)
+#define pylith_utils_bulkquerydb_hh
+
+// Include directives ---------------------------------------------------
+#include "utilsfwd.hh" // forward declarations
+
+#include "pylith/utils/types.hh" // USES PylithScalar
+
+#include "spatialdata/geocoords/geocoordsfwd.hh" // USES CoordSys
+
+// BulkQueryDB ----------------------------------------------------------
+/// Interface for spatial databases that can query many points in a single call.
+class pylith::utils::BulkQueryDB
+{ // BulkQueryDB
+
+// PUBLIC METHODS ///////////////////////////////////////////////////////
+public :
+
+  /// Destructor
+  virtual
+  ~BulkQueryDB(void);
+
+  /** Query database at points.
+   *
+   * The database must be open and the values to query must be set
+   * before calling queryBulk().
+   *
+   * @param values Array of values [numPoints*numValues] (output).
+   * @param numValues Number of values per point.
+   * @param coords Coordinates of points [numPoints*spaceDim].
+   * @param numPoints Number of points.
+   * @param spaceDim Spatial dimension of coordinates.
+   * @param cs Coordinate system of points.
+   * @returns Index of first point where the query failed (-1 if all
+   *   queries were successful).
+   */
+  virtual
+  int queryBulk(PylithScalar* values,
+		const int numValues,
+		const double* coords,
+		const int numPoints,
+		const int spaceDim,
+		const spatialdata::geocoords::CoordSys* cs) = 0;
+
+}; // BulkQueryDB
+
+#endif // pylith_utils_bulkquerydb_hh
+
+
+// End of file 
@@ -34,6 +34,8 @@ namespace pylith {
     class PylithVersion;
     class PetscVersion;
     class DependenciesVersion;
+    class BatchQuery;
+    class BulkQueryDB;
     
     class TestArray;
 
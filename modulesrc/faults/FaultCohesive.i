@@ -71,6 +71,20 @@ namespace pylith {
                           int *firstLagrangeVertex,
                           int *firstFaultCell);
       %clear int *firstFaultVertex, int *firstLagrangeVertex, int *firstFaultCell;
+
+      /** Adjust mesh topology for several faults.
+       *
+       * Cohesive cells for faults that do not intersect are created
+       * with a single construction of the mesh topology.
+       *
+       * @param mesh PETSc mesh.
+       * @param faults Array of faults.
+       * @param numFaults Number of faults.
+       */
+      static
+      void adjustTopologyAll(pylith::topology::Mesh* const mesh,
+			     pylith::faults::FaultCohesive** faults,
+			     const int numFaults);
       
       /** Cohesive cells use Lagrange multiplier constraints?
        *
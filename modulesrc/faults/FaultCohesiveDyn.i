@@ -75,6 +75,28 @@ namespace pylith {
        */
       void openFreeSurf(const bool value);
 
+      /** Set spatial database with density and Vs for computing rupture
+       * statistics during the simulation.
+       *
+       * Rupture statistics are computed only if the database is set.
+       *
+       * @param db Spatial database with density and Vs.
+       */
+      void statsProperties(spatialdata::spatialdb::SpatialDB* db);
+
+      /** Set slip rate threshold for detecting events in rupture statistics.
+       *
+       * @param value Slip rate threshold (m/s); events are not detected
+       *   if value is zero.
+       */
+      void statsSlipRateThreshold(const PylithScalar value);
+
+      /** Set filename for tables of rupture statistics.
+       *
+       * @param filename Name of file.
+       */
+      void statsFilename(const char* filename);
+
       /** Initialize fault. Determine orientation and setup boundary
        * condition parameters.
        *
@@ -51,6 +51,7 @@
 %include "../include/scalartypemaps.i"
 %include "../include/chararray.i"
 %include "../include/eqkinsrcarray.i"
+%include "../include/faultcohesivearray.i"
 
 // Numpy interface stuff
 %{
@@ -27,6 +27,15 @@ namespace pylith {
     class Material
     { // class Material
 
+      // PUBLIC ENUMS ///////////////////////////////////////////////////
+    public :
+
+      enum PropertiesLayoutEnum {
+	PROPERTIES_QUADPTS=0,
+	PROPERTIES_CELLS=1,
+	PROPERTIES_UNIFORM=2,
+      }; // PropertiesLayoutEnum
+
       // PUBLIC METHODS /////////////////////////////////////////////////
     public :
       
@@ -132,6 +141,40 @@ namespace pylith {
        */
       bool isJacobianSymmetric(void) const;
 
+      /** Set flag for storing physical properties in single precision.
+       *
+       * @pre Must be called before initialize().
+       *
+       * @param flag True to store properties in single precision.
+       */
+      void singlePrecisionProperties(const bool flag);
+
+      /** Get flag for storing physical properties in single precision.
+       *
+       * @returns True if properties are stored in single precision.
+       */
+      bool singlePrecisionProperties(void) const;
+
+      /** Set flag for storing physical properties in compressed form.
+       *
+       * @pre Must be called before initialize().
+       *
+       * @param flag True to compress properties, false otherwise.
+       */
+      void compressProperties(const bool flag);
+
+      /** Get layout of stored physical properties.
+       *
+       * @returns Layout of properties.
+       */
+      PropertiesLayoutEnum propertiesLayout(void) const;
+
+      /** Get number of values stored for physical properties.
+       *
+       * @returns Number of values stored on this process.
+       */
+      int propertiesStorageSize(void) const;
+
       /** Get physical property or state variable field. Data is returned
        * via the argument.
        *
@@ -51,6 +51,13 @@ namespace pylith {
        * @param filename Name of HDF5Ext file.
        */
       void filename(const char* filename);
+
+      /** Set flag for sharing vertices and cells datasets with other
+       * writers for the same mesh.
+       *
+       * @param flag True to share datasets, false otherwise.
+       */
+      void shareTopology(const bool flag);
       
       /** Generate filename for HDF5 file.
        *
@@ -52,6 +52,18 @@ namespace pylith {
        */
       const char* filename(void) const;
 
+      /** Set flag for using fast parser when reading mesh.
+       *
+       * @param flag True to use fast parser, false otherwise.
+       */
+      void useFastParser(const bool flag);
+
+      /** Get flag for using fast parser when reading mesh.
+       *
+       * @returns True if using fast parser, false otherwise.
+       */
+      bool useFastParser(void) const;
+
       // PROTECTED METHODS //////////////////////////////////////////////
     protected :
 
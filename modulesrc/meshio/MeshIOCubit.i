@@ -58,6 +58,17 @@ namespace pylith {
        */
       void useNodesetNames(const bool flag);
 
+      /** Set flag on whether each process reads its own portion of the mesh.
+       *
+       * If true, each process reads a contiguous block of cells and
+       * vertices from the file and the resulting mesh is distributed
+       * (but not partitioned). If false, process 0 reads the entire
+       * mesh.
+       *
+       * @param flag True to read mesh in parallel.
+       */
+      void useParallelRead(const bool flag);
+
       // PROTECTED METHODS ////////////////////////////////////////////////////
     protected :
       
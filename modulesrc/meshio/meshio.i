@@ -34,6 +34,7 @@
 #include "pylith/meshio/CellFilterAvg.hh"
 #include "pylith/meshio/DataWriter.hh"
 #include "pylith/meshio/DataWriterVTK.hh"
+#include "pylith/meshio/DataWriterVTU.hh"
 #include "pylith/meshio/OutputManager.hh"
 #include "pylith/meshio/OutputSolnSubset.hh"
 #include "pylith/meshio/OutputSolnPoints.hh"
@@ -82,6 +83,7 @@ import_array();
 %include "CellFilterAvg.i"
 %include "DataWriter.i"
 %include "DataWriterVTK.i"
+%include "DataWriterVTU.i"
 %include "OutputManager.i"
 %include "OutputSolnSubset.i"
 %include "OutputSolnPoints.i"
@@ -28,6 +28,16 @@ namespace pylith {
     class Solver
     { // Solver
 
+      // PUBLIC ENUMS ///////////////////////////////////////////////////
+    public :
+
+      enum InitialGuessEnum {
+	INITIAL_GUESS_ZERO=0,
+	INITIAL_GUESS_PREVIOUS=1,
+	INITIAL_GUESS_QUADRATIC=2,
+	INITIAL_GUESS_PROJECTION=3,
+      }; // InitialGuessEnum
+
       // PUBLIC MEMBERS /////////////////////////////////////////////////
     public :
 
@@ -52,6 +62,31 @@ namespace pylith {
        */
       void skipNullSpaceCreation(const bool value);
 
+      /** Set strategy for initial guess of solution.
+       *
+       * @param[in] value Strategy for initial guess.
+       */
+      void initialGuessType(const InitialGuessEnum value);
+
+      /** Get strategy for initial guess of solution.
+       *
+       * @returns Strategy for initial guess.
+       */
+      InitialGuessEnum initialGuessType(void) const;
+
+      /** Set number of previous solutions used in projection for
+       * initial guess of solution.
+       *
+       * @param[in] value Number of previous solutions (>= 1).
+       */
+      void initialGuessNumVectors(const int value);
+
+      /** Set flag for using geometric multigrid preconditioner.
+       *
+       * @param[in] value True to use geometric multigrid.
+       */
+      void useGeometricMultigrid(const bool value);
+
       /** Initialize solver.
        *
        * @param fields Solution fields.
@@ -28,6 +28,15 @@ namespace pylith {
     class SolverNonlinear : public Solver
     { // SolverNonlinear
 
+      // PUBLIC ENUMS ///////////////////////////////////////////////////
+    public :
+
+      enum SolverTypeEnum {
+	SOLVER_NEWTON=0,
+	SOLVER_NRICHARDSON=1,
+	SOLVER_QUASI_NEWTON=2,
+      }; // SolverTypeEnum
+
       // PUBLIC MEMBERS /////////////////////////////////////////////////
     public :
 
@@ -40,6 +49,55 @@ namespace pylith {
       /// Deallocate PETSc and local data structures.
       void deallocate(void);
 
+      /** Set flag for reusing residual from last trial step of line
+       * search rather than reforming the residual at the accepted step.
+       *
+       * @param[in] value True to reuse residual.
+       */
+      void lineSearchReuseResidual(const bool value);
+
+      /** Set minimum ratio of actual to predicted decrease in the
+       * merit function for reusing the residual from the last trial
+       * step.
+       *
+       * @param[in] value Minimum ratio (0 to always reuse residual).
+       */
+      void lineSearchAcceptRatio(const PylithScalar value);
+
+      /** Set type of nonlinear solver.
+       *
+       * @param[in] value Type of nonlinear solver.
+       */
+      void solverType(const SolverTypeEnum value);
+
+      /** Set flag for adapting tolerance of linear solve in each
+       * Newton step (Eisenstat-Walker).
+       *
+       * @param[in] value True to use adaptive linear tolerance.
+       */
+      void adaptiveLinearTolerance(const bool value);
+
+      /** Set number of nonlinear iterations between reforming the
+       * Jacobian.
+       *
+       * @param[in] value Number of iterations.
+       */
+      void lagJacobian(const int value);
+
+      /** Set number of Jacobian reforms between rebuilding the
+       * preconditioner.
+       *
+       * @param[in] value Number of iterations.
+       */
+      void lagPreconditioner(const int value);
+
+      /** Set flag for updating state variables using the strain from
+       * the residual evaluation at the converged solution.
+       *
+       * @param[in] value True to reuse strain from residual evaluation.
+       */
+      void fuseStateVarsUpdate(const bool value);
+
       /** Initialize solver.
        *
        * @param fields Solution fields.
@@ -0,0 +1,104 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file modulesrc/problems/TimeStepper.i
+ *
+ * @brief Python interface to C++ TimeStepper.
+ */
+
+namespace pylith {
+  namespace problems {
+
+    class TimeStepper
+    { // TimeStepper
+
+      // PUBLIC MEMBERS /////////////////////////////////////////////////
+    public :
+
+      /// Constructor
+      TimeStepper(void);
+
+      /// Destructor
+      ~TimeStepper(void);
+
+      /// Deallocate PETSc and local data structures.
+      void deallocate(void);
+  
+      /** Set handles to formulation, solver, and fields.
+       *
+       * @param formulation Formulation of system of equations.
+       * @param solver Solver for system with lumped Jacobian.
+       * @param jacobian Lumped Jacobian of system.
+       * @param fields Solution fields.
+       */
+      void initialize(pylith::problems::Formulation* const formulation,
+		      pylith::problems::SolverLumped* const solver,
+		      pylith::topology::Field* const jacobian,
+		      pylith::topology::SolutionFields* const fields);
+
+      /** Set logger with stages of the formulation.
+       *
+       * @param logger Event logger of formulation.
+       */
+      void stageLogger(pylith::utils::EventLogger* const logger);
+
+      /** Set handles to constraints.
+       *
+       * @param constraintArray Array of constraints.
+       * @param numConstraints Number of constraints.
+       */
+      void constraints(pylith::feassemble::Constraint* constraintArray[],
+		       const int numConstraints);
+
+      /** Set values of constrained DOF in the increment in the
+       * solution and set the time step of the integrators.
+       *
+       * @param t Current time (nondimensional).
+       * @param dt Time step (nondimensional).
+       * @returns True if any integrator on any process needs a new
+       *   Jacobian, false otherwise.
+       */
+      bool prestep(const PylithScalar t,
+		   const PylithScalar dt);
+
+      /** Reform the residual and solve for the increment in the
+       * solution.
+       *
+       * @param t Current time (nondimensional).
+       * @param dt Time step (nondimensional).
+       */
+      void step(const PylithScalar t,
+		const PylithScalar dt);
+
+      /** Advance the displacement fields from time t to time t+dt and
+       * update the state variables of the integrators.
+       *
+       * @param t Current time (nondimensional).
+       * @param dt Time step (nondimensional).
+       */
+      void poststep(const PylithScalar t,
+		    const PylithScalar dt);
+
+    }; // TimeStepper
+
+  } // problems
+} // pylith
+
+
+// End of file 
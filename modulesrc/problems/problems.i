@@ -33,6 +33,7 @@
 #include "pylith/problems/SolverLinear.hh"
 #include "pylith/problems/SolverNonlinear.hh"
 #include "pylith/problems/SolverLumped.hh"
+#include "pylith/problems/TimeStepper.hh"
 %}
 
 %include "exception.i"
@@ -46,6 +47,7 @@
 
 %include "typemaps.i"
 %include "../include/integratorarray.i"
+%include "../include/constraintarray.i"
 %include "../include/scalartypemaps.i"
 
 // Interfaces
@@ -56,6 +58,7 @@
 %include "SolverLinear.i"
 %include "SolverNonlinear.i"
 %include "SolverLumped.i"
+%include "TimeStepper.i"
 
 
 // End of file
@@ -198,12 +198,25 @@ namespace pylith {
       /// Complete section by assembling across processors.
       void complete(void);
 
+      /// Begin completing section by assembling across processors.
+      void completeBegin(void);
+
+      /// End completing section by assembling across processors.
+      void completeEnd(void);
+
       /** Copy field values and metadata.
        *
        * @param field Field to copy.
        */
       void copy(const Field& field);
       
+      /** Swap values with another field with the same layout by
+       * exchanging the underlying PETSc vectors.
+       *
+       * @param field Field to swap values with.
+       */
+      void swapValues(Field& field);
+
       /** Copy subfield values and its metadata to field;
        *
        * @param field Field to copy from.
@@ -285,6 +298,34 @@ namespace pylith {
       void scatterGlobalToLocal(const PetscVec vector,
 				const char* context ="") const;
 
+      /** Begin scattering section information across processors to
+       * update the global view of the field.
+       *
+       * @param context Label for context associated with vector.
+       */
+      void scatterLocalToGlobalBegin(const char* context ="") const;
+
+      /** End scattering section information across processors to
+       * update the global view of the field.
+       *
+       * @param context Label for context associated with vector.
+       */
+      void scatterLocalToGlobalEnd(const char* context ="") const;
+
+      /** Begin scattering global information across processors to
+       * update the local view of the field.
+       *
+       * @param context Label for context associated with vector.
+       */
+      void scatterGlobalToLocalBegin(const char* context ="") const;
+
+      /** End scattering global information across processors to
+       * update the local view of the field.
+       *
+       * @param context Label for context associated with vector.
+       */
+      void scatterGlobalToLocalEnd(const char* context ="") const;
+
     }; // Field
 
   } // topology
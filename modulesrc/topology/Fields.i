@@ -90,6 +90,13 @@ namespace pylith {
        */
       pylith::topology::Field& get(const char* name);
 	   
+      /** Get handle for field.
+       *
+       * @param name Name of field.
+       * @returns Handle for field.
+       */
+      int handle(const char* name) const;
+
       /** Copy layout to other fields.
        *
        * @param name Name of field to use as template for layout.
@@ -38,6 +38,12 @@ namespace pylith {
       /// Destructor
       ~RefineUniform(void);
       
+      /** Set flag for retaining the coarser meshes in the refined mesh.
+       *
+       * @param value True to retain coarser meshes, false otherwise.
+       */
+      void retainHierarchy(const bool value);
+
       /** Refine mesh.
        *
        * @param newMesh Refined mesh (result).
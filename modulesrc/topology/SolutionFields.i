@@ -57,6 +57,30 @@ namespace pylith {
        * @returns Solution field.
        */
       Field& solution(void);
+
+      /** Create history of previous solutions.
+       *
+       * @param size Maximum number of previous solutions to retain.
+       */
+      void createHistory(const int size);
+
+      /** Get maximum number of previous solutions retained in history.
+       *
+       * @returns Size of history.
+       */
+      int historySize(void) const;
+
+      /** Get number of previous solutions currently stored in history.
+       *
+       * @returns Number of previous solutions.
+       */
+      int historyLength(void) const;
+
+      /// Copy current solution into history.
+      void shiftHistory(void);
+
+      /// Discard all solutions stored in history.
+      void clearHistory(void);
       
     }; // SolutionFields
 
@@ -0,0 +1,65 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file modulesrc/topology/SpaceFillingCurve.i
+ *
+ * @brief Python interface to C++ PyLith SpaceFillingCurve object.
+ */
+
+namespace pylith {
+  namespace topology {
+
+    // SpaceFillingCurve ------------------------------------------------
+    class SpaceFillingCurve
+    { // SpaceFillingCurve
+
+      // PUBLIC METHODS /////////////////////////////////////////////////
+    public :
+
+      /** Reorder vertices and cells of mesh along a space-filling curve
+       * within each material.
+       *
+       * @param mesh PyLith finite-element mesh.
+       */
+      static
+      void reorder(topology::Mesh* mesh);
+
+      /** Get mean and maximum over cells of the span of vertex
+       * numbers in the closure of a cell.
+       *
+       * @param meanSpan Mean span of vertices in closure of cells (output).
+       * @param maxSpan Maximum span of vertices in closure of cells (output).
+       * @param mesh PyLith finite-element mesh.
+       */
+      %apply double *OUTPUT { double* meanSpan };
+      %apply int *OUTPUT { int* maxSpan };
+      static
+      void closureSpan(double* meanSpan,
+		       int* maxSpan,
+		       const topology::Mesh& mesh);
+      %clear double* meanSpan;
+      %clear int* maxSpan;
+
+    }; // SpaceFillingCurve
+
+  } // topology
+} // pylith
+
+
+// End of file
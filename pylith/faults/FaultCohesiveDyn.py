@@ -47,10 +47,15 @@ class FaultCohesiveDyn(FaultCohesive, Integrator, ModuleFaultCohesiveDyn):
   @li \b open_free_surface If True, enforce traction free surface when
     the fault opens, otherwise use initial tractions even when the
     fault opens.
+  @li \b stats_slip_rate_threshold Slip rate threshold for detecting
+    events in rupture statistics (0 means no event detection).
+  @li \b stats_filename Filename for tables of rupture statistics.
   
   \b Facilities
   @li \b tract_perturbation Prescribed perturbation in fault tractions.
   @li \b friction Fault constitutive model.
+  @li \b stats_properties Spatial database with density and Vs for
+    computing rupture statistics during the simulation.
   @li \b output Output manager associated with fault data.
 
   Factory: fault
@@ -71,6 +76,19 @@ class FaultCohesiveDyn(FaultCohesive, Integrator, ModuleFaultCohesiveDyn):
     "the fault opens, otherwise use initial tractions even when the " \
     "fault opens."
 
+  from pyre.units.length import m
+  from pyre.units.time import s
+  statsSlipRateThreshold = pyre.inventory.dimensional("stats_slip_rate_threshold", default=1.0e-3*m/s, validator=pyre.inventory.greaterEqual(0.0*m/s))
+  statsSlipRateThreshold.meta['tip'] = "Slip rate threshold for detecting " \
+    "events in rupture statistics (0 means no event detection)."
+
+  statsFilename = pyre.inventory.str("stats_filename", default="output/fault_stats.txt")
+  statsFilename.meta['tip'] = "Filename for tables of rupture statistics."
+
+  statsDB = pyre.inventory.facility("stats_properties", family="spatial_database", factory=NullComponent)
+  statsDB.meta['tip'] = "Spatial database with density and Vs for " \
+    "computing rupture statistics during the simulation."
+
   tract = pyre.inventory.facility("traction_perturbation", family="traction_perturbation", factory=NullComponent)
   tract.meta['tip'] = "Prescribed perturbation in fault tractions."
 
@@ -216,6 +234,10 @@ class FaultCohesiveDyn(FaultCohesive, Integrator, ModuleFaultCohesiveDyn):
     ModuleFaultCohesiveDyn.zeroTolerance(self, self.inventory.zeroTolerance)
     ModuleFaultCohesiveDyn.zeroToleranceNormal(self, self.inventory.zeroToleranceNormal)
     ModuleFaultCohesiveDyn.openFreeSurf(self, self.inventory.openFreeSurf)
+    if not isinstance(self.inventory.statsDB, NullComponent):
+      ModuleFaultCohesiveDyn.statsProperties(self, self.inventory.statsDB)
+      ModuleFaultCohesiveDyn.statsSlipRateThreshold(self, self.inventory.statsSlipRateThreshold.value)
+      ModuleFaultCohesiveDyn.statsFilename(self, self.inventory.statsFilename)
     self.output = self.inventory.output
     return
 
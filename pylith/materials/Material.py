@@ -67,6 +67,8 @@ class Material(PetscComponent):
     ## \b Properties
     ## @li \b id Material identifier (from mesh generator)
     ## @li \b label Descriptive label for material.
+    ## @li \b property_precision Precision for storing physical properties.
+    ## @li \b compress_properties Store uniform or per-cell constant properties once.
     ##
     ## \b Facilities
     ## @li \b db_properties Database of material property parameters
@@ -81,6 +83,14 @@ class Material(PetscComponent):
     label = pyre.inventory.str("label", default="", validator=validateLabel)
     label.meta['tip'] = "Descriptive label for material."
 
+    propertyPrecision = pyre.inventory.str("property_precision", default="double",
+                                           validator=pyre.inventory.choice(["double", "single"]))
+    propertyPrecision.meta['tip'] = "Precision for storing physical properties."
+
+    compressProperties = pyre.inventory.bool("compress_properties", default=True)
+    compressProperties.meta['tip'] = "Store physical properties once per material " \
+        "or once per cell if they are uniform or constant within each cell."
+
     from spatialdata.spatialdb.SimpleDB import SimpleDB
     dbProperties = pyre.inventory.facility("db_properties",
                                            family="spatial_database",
@@ -185,6 +195,8 @@ class Material(PetscComponent):
       PetscComponent._configure(self)
       self.id(self.inventory.id)
       self.label(self.inventory.label)
+      self.singlePrecisionProperties("single" == self.inventory.propertyPrecision)
+      self.compressProperties(self.inventory.compressProperties)
       self.dbProperties(self.inventory.dbProperties)
       from pylith.utils.NullComponent import NullComponent
       if not isinstance(self.inventory.dbInitialState, NullComponent):
@@ -212,7 +224,9 @@ class Material(PetscComponent):
     Model allocated memory.
     """
     self.perfLogger.logMaterial('Materials', self)
-    self.perfLogger.logField('Materials', self.propertiesField())
+    self.perfLogger.logField('Materials', self.propertiesField(),
+                             self.singlePrecisionProperties(),
+                             self.propertiesStorageSize())
     self.perfLogger.logField('Materials', self.stateVarsField())
     return
 
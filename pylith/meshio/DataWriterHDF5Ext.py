@@ -34,6 +34,7 @@ class DataWriterHDF5Ext(DataWriter, ModuleDataWriterHDF5Ext):
 
   \b Properties
   @li \b filename Name of HDF5 file.
+  @li \b share_topology Reuse vertices and cells written by other writers for the same mesh.
   
   \b Facilities
   @li None
@@ -46,6 +47,10 @@ class DataWriterHDF5Ext(DataWriter, ModuleDataWriterHDF5Ext):
   filename = pyre.inventory.str("filename", default="output.h5")
   filename.meta['tip'] = "Name of HDF5 file."
 
+  shareTopology = pyre.inventory.bool("share_topology", default=False)
+  shareTopology.meta['tip'] = "Reuse vertices and cells written by other " \
+      "writers for the same mesh."
+
   # PUBLIC METHODS /////////////////////////////////////////////////////
 
   def __init__(self, name="datawriterhdf5"):
@@ -66,6 +71,7 @@ class DataWriterHDF5Ext(DataWriter, ModuleDataWriterHDF5Ext):
     timeScale = normalizer.timeScale()
 
     ModuleDataWriterHDF5Ext.filename(self, self.filename)
+    ModuleDataWriterHDF5Ext.shareTopology(self, self.shareTopology)
     ModuleDataWriterHDF5Ext.timeScale(self, timeScale.value)
     return
   
@@ -0,0 +1,114 @@
+#!/usr/bin/env python
+#
+# ----------------------------------------------------------------------
+#
+# Brad T. Aagaard, U.S. Geological Survey
+# Charles A. Williams, GNS Science
+# Matthew G. Knepley, University of Chicago
+#
+# This code was developed as part of the Computational Infrastructure
+# for Geodynamics (http://geodynamics.org).
+#
+# Copyright (c) 2010-2017 University of California, Davis
+#
+# See COPYING for license information.
+#
+# ----------------------------------------------------------------------
+#
+
+## @file pyre/meshio/DataWriterVTU.py
+##
+## @brief Python object for writing finite-element data to VTU files.
+
+from DataWriter import DataWriter
+from meshio import DataWriterVTU as ModuleDataWriterVTU
+
+# DataWriterVTU class
+class DataWriterVTU(DataWriter, ModuleDataWriterVTU):
+  """
+  Python object for writing finite-element data to VTU files.
+
+  Each process writes its own piece, and process 0 writes PVTU and
+  PVD files referencing the pieces and time steps.
+
+  Inventory
+
+  \b Properties
+  @li \b filename Name of VTU file.
+  @li \b time_format C style format string for time stamp in filename.
+  @li \b time_constant Value used to normalize time stamp in filename.
+  
+  \b Facilities
+  @li None
+  """
+
+  # INVENTORY //////////////////////////////////////////////////////////
+
+  import pyre.inventory
+
+  filename = pyre.inventory.str("filename", default="output.vtu")
+  filename.meta['tip'] = "Name of VTU file."
+
+  timeFormat = pyre.inventory.str("time_format", default="%f")
+  timeFormat.meta['tip'] = "C style format string for time stamp in filename."
+
+  from pyre.units.time import second
+  timeConstant = pyre.inventory.dimensional("time_constant",
+                                            default=1.0*second,
+                                            validator=pyre.inventory.greater(0.0*second))
+  timeConstant.meta['tip'] = "Values used to normalize time stamp in filename."
+
+
+  # PUBLIC METHODS /////////////////////////////////////////////////////
+
+  def __init__(self, name="datawritervtu"):
+    """
+    Constructor.
+    """
+    DataWriter.__init__(self, name)
+    ModuleDataWriterVTU.__init__(self)
+    return
+
+
+  def initialize(self, normalizer):
+    """
+    Initialize writer.
+    """
+    DataWriter.initialize(self, normalizer, self.filename)
+    
+    timeScale = normalizer.timeScale()
+    timeConstantN = normalizer.nondimensionalize(self.timeConstant, timeScale)
+
+    ModuleDataWriterVTU.filename(self, self.filename)
+    ModuleDataWriterVTU.timeScale(self, timeScale.value)
+    ModuleDataWriterVTU.timeFormat(self, self.timeFormat)
+    ModuleDataWriterVTU.timeConstant(self, timeConstantN)
+    return
+  
+
+  # PRIVATE METHODS ////////////////////////////////////////////////////
+
+  def _configure(self):
+    """
+    Configure object.
+    """
+    try:
+      DataWriter._configure(self)
+    except ValueError, err:
+      aliases = ", ".join(self.aliases)
+      raise ValueError("Error while configuring VTU output "
+                       "(%s):\n%s" % (aliases, err.message))
+
+    return
+
+
+# FACTORIES ////////////////////////////////////////////////////////////
+
+def data_writer():
+  """
+  Factory associated with DataWriter.
+  """
+  return DataWriterVTU()
+
+
+# End of file 
@@ -59,6 +59,7 @@ class MeshIOAscii(MeshIOObj, ModuleMeshIOAscii):
     ##
     ## \b Properties
     ## @li \b filename Name of mesh file
+    ## @li \b fast_parser Parse memory-mapped file without using streams.
     ##
     ## \b Facilities
     ## @li coordsys Coordinate system associated with mesh.
@@ -69,6 +70,9 @@ class MeshIOAscii(MeshIOObj, ModuleMeshIOAscii):
                                   validator=validateFilename)
     filename.meta['tip'] = "Name of mesh file"
 
+    fastParser = pyre.inventory.bool("fast_parser", default=True)
+    fastParser.meta['tip'] = "Parse memory-mapped file without using streams."
+
     from spatialdata.geocoords.CSCart import CSCart
     coordsys = pyre.inventory.facility("coordsys", family="coordsys",
                                        factory=CSCart)
@@ -94,6 +98,7 @@ class MeshIOAscii(MeshIOObj, ModuleMeshIOAscii):
     MeshIOObj._configure(self)
     self.coordsys = self.inventory.coordsys
     self.filename(self.inventory.filename)
+    self.useFastParser(self.inventory.fastParser)
     return
 
 
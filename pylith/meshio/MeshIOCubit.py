@@ -57,6 +57,7 @@ class MeshIOCubit(MeshIOObj, ModuleMeshIOCubit):
     ## \b Properties
     ## @li \b filename Name of Cubit Exodus file.
     ## @li \b use_nodeset_names Ues nodeset names instead of ids.
+    ## @li \b parallel_read Each process reads its own portion of the mesh.
     ##
     ## \b Facilities
     ## @li coordsys Coordinate system associated with mesh.
@@ -70,6 +71,10 @@ class MeshIOCubit(MeshIOObj, ModuleMeshIOCubit):
     useNames = pyre.inventory.bool("use_nodeset_names", default=True)
     useNames.meta['tip'] = "Use nodeset names instead of ids."
 
+    parallelRead = pyre.inventory.bool("parallel_read", default=False)
+    parallelRead.meta['tip'] = "Each process reads its own portion of the mesh " \
+        "(requires parallel partitioner and no faults)."
+
     from spatialdata.geocoords.CSCart import CSCart
     coordsys = pyre.inventory.facility("coordsys", family="coordsys",
                                        factory=CSCart)
@@ -96,6 +101,8 @@ class MeshIOCubit(MeshIOObj, ModuleMeshIOCubit):
     self.coordsys = self.inventory.coordsys
     ModuleMeshIOCubit.filename(self, self.inventory.filename)
     ModuleMeshIOCubit.useNodesetNames(self, self.inventory.useNames)
+    ModuleMeshIOCubit.useParallelRead(self, self.inventory.parallelRead)
+    self.parallelRead = self.inventory.parallelRead
     return
 
 
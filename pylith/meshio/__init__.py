@@ -24,6 +24,7 @@ __all__ = ['CellFilter',
            'CellFilterAvg',
            'DataWriter',
            'DataWriterVTK',
+           'DataWriterVTU',
            'MeshIOObj',
            'MeshIOAscii',
            'MeshIOCubit',
@@ -0,0 +1,238 @@
+#!/usr/bin/env python
+#
+# ----------------------------------------------------------------------
+#
+# Brad T. Aagaard, U.S. Geological Survey
+# Charles A. Williams, GNS Science
+# Matthew G. Knepley, University of Chicago
+#
+# This code was developed as part of the Computational Infrastructure
+# for Geodynamics (http://geodynamics.org).
+#
+# Copyright (c) 2010-2017 University of California, Davis
+#
+# See COPYING for license information.
+#
+# ----------------------------------------------------------------------
+#
+
+## @file pylith/perf/Benchmark.py
+##
+## @brief Python objects for running performance benchmarks and
+## comparing the results against a baseline.
+##
+## A benchmark suite is a configuration file with one section per
+## case. The [DEFAULT] section may set 'root', the directory relative
+## to the suite file that the case directories are relative to.
+##
+##   [elastic_hex8]
+##   dir = tests_auto/3d/hex8
+##   app = sheardisp
+##   args = sheardisp.cfg
+##   setup = sheardisp_gendb.GenerateDB
+##   nodes = 1
+##   events = ElIR compute, SoLi solve
+##
+## @li \b dir Directory containing the configuration files.
+## @li \b app Name of the application (section name in .cfg files).
+## @li \b args Command line arguments for PyLith.
+## @li \b setup Class with run() that generates spatial databases.
+## @li \b nodes Number of processes.
+## @li \b events Events used when comparing against a baseline (all
+##   events if empty).
+
+APP_TEMPLATE = """#!%(python)s
+# Generated by pylith_benchmark.
+
+from pylith.apps.PyLithApp import PyLithApp
+
+class BenchmarkApp(PyLithApp):
+
+  def __init__(self):
+    PyLithApp.__init__(self, name="%(app)s")
+    return
+
+
+if __name__ == "__main__":
+  from pyre.applications import start
+  start(applicationClass=BenchmarkApp)
+"""
+
+FORMAT_VERSION = 1
+
+
+# ----------------------------------------------------------------------
+class BenchmarkCase(object):
+  """
+  Python object for a single benchmark case.
+  """
+
+  def __init__(self, name, config):
+    """
+    Constructor.
+    """
+    import shlex
+    self.name = name
+    self.dir = config.get(name, "dir")
+    self.app = config.get(name, "app") if config.has_option(name, "app") else "pylithapp"
+    self.args = shlex.split(config.get(name, "args")) if config.has_option(name, "args") else []
+    self.setup = config.get(name, "setup") if config.has_option(name, "setup") else None
+    self.nodes = config.getint(name, "nodes") if config.has_option(name, "nodes") else 1
+    events = config.get(name, "events") if config.has_option(name, "events") else ""
+    self.events = [e.strip() for e in events.split(",") if e.strip()]
+    return
+
+
+# ----------------------------------------------------------------------
+class Benchmark(object):
+  """
+  Python object for running a suite of benchmarks.
+  """
+
+  def __init__(self, suiteFilename):
+    """
+    Constructor.
+    """
+    import os
+    import ConfigParser
+
+    config = ConfigParser.SafeConfigParser()
+    config.optionxform = str
+    if not config.read(suiteFilename):
+      raise IOError("Could not read benchmark suite '%s'." % suiteFilename)
+    suiteDir = os.path.dirname(os.path.abspath(suiteFilename))
+    root = config.defaults().get("root", ".")
+    self.rootDir = os.path.normpath(os.path.join(suiteDir, root))
+    self.cases = [BenchmarkCase(name, config) for name in config.sections()]
+    return
+
+
+  def run(self, outputDir, caseNames=None):
+    """
+    Run benchmark cases (all if caseNames is None) and return
+    dictionary with results.
+    """
+    import os
+    import socket
+    import time
+
+    outputDir = os.path.abspath(outputDir)
+    if not os.path.isdir(outputDir):
+      os.makedirs(outputDir)
+
+    cases = self.cases
+    if not caseNames is None:
+      names = [case.name for case in cases]
+      for name in caseNames:
+        if not name in names:
+          raise ValueError("Unknown benchmark case '%s'." % name)
+      cases = [case for case in cases if case.name in caseNames]
+
+    results = {'format': FORMAT_VERSION,
+               'date': time.strftime("%Y-%m-%dT%H:%M:%S"),
+               'host': socket.gethostname(),
+               'cases': {}}
+    for case in cases:
+      results['cases'][case.name] = self._runCase(case, outputDir)
+    return results
+
+
+  # PRIVATE METHODS ////////////////////////////////////////////////////
+
+  def _runCase(self, case, outputDir):
+    """
+    Run benchmark case and return dictionary with results.
+    """
+    import os
+    import sys
+    import subprocess
+    import time
+    from LogView import LogView
+
+    print "Running benchmark '%s' on %d process(es)." % (case.name, case.nodes)
+    caseDir = os.path.join(self.rootDir, case.dir)
+    logFilename = os.path.join(outputDir, "%s_log.py" % case.name)
+    if os.path.isfile(logFilename):
+      os.remove(logFilename)
+
+    if case.setup:
+      module, cls = case.setup.rsplit(".", 1)
+      code = "from %s import %s; %s().run()" % (module, cls, cls)
+      subprocess.check_call([sys.executable, "-c", code], cwd=caseDir)
+
+    # Run the application from a script, so that it uses the section
+    # names in the case's .cfg files and can be relaunched with MPI.
+    appFilename = os.path.join(outputDir, "%s_app.py" % case.name)
+    with open(appFilename, "w") as fout:
+      fout.write(APP_TEMPLATE % {'python': sys.executable, 'app': case.app})
+
+    cmd = [sys.executable, appFilename] + case.args + \
+        ["--nodes=%d" % case.nodes,
+         "--petsc.log_view=:%s:ascii_info_detail" % logFilename]
+    with open(os.path.join(outputDir, "%s.log" % case.name), "w") as flog:
+      tStart = time.time()
+      status = subprocess.call(cmd, cwd=caseDir, stdout=flog, stderr=subprocess.STDOUT)
+      walltime = time.time() - tStart
+
+    result = {'dir': case.dir,
+              'args': case.args,
+              'nodes': case.nodes,
+              'status': status,
+              'walltime': walltime,
+              'key_events': case.events}
+    if 0 == status and os.path.isfile(logFilename):
+      result.update(LogView().read(logFilename).summary())
+    elif 0 == status:
+      result['status'] = -1
+      print "WARNING: Benchmark '%s' did not write PETSc log '%s'." % (case.name, logFilename)
+    else:
+      print "WARNING: Benchmark '%s' failed with status %d." % (case.name, status)
+    return result
+
+
+# ----------------------------------------------------------------------
+def compare(baseline, current, threshold=0.10, minTime=0.01):
+  """
+  Compare benchmark results against baseline.
+
+  Returns list of dictionaries for times that increased by more than
+  the fraction 'threshold' relative to the baseline, ignoring times in
+  the baseline shorter than minTime (seconds), for cases that failed
+  or are missing from the baseline, and for key events of a case that
+  are missing from either run.
+  """
+  flagged = []
+  for name in sorted(current['cases'].keys()):
+    cur = current['cases'][name]
+    if not name in baseline['cases']:
+      flagged.append({'case': name, 'item': "missing from baseline"})
+      continue
+    base = baseline['cases'][name]
+    if cur['status'] != 0:
+      flagged.append({'case': name, 'item': "failed with status %d" % cur['status']})
+      continue
+    if base['status'] != 0:
+      continue
+
+    times = [("walltime", base['walltime'], cur['walltime'])]
+    for stage in sorted(cur.get('stages', {}).keys()):
+      if stage in base.get('stages', {}):
+        times.append(("stage '%s'" % stage, base['stages'][stage]['time'], cur['stages'][stage]['time']))
+    keyEvents = cur.get('key_events', [])
+    for event in keyEvents:
+      if not event in cur.get('events', {}):
+        flagged.append({'case': name, 'item': "key event '%s' missing from run" % event})
+      elif not event in base.get('events', {}):
+        flagged.append({'case': name, 'item': "key event '%s' missing from baseline" % event})
+    events = keyEvents or sorted(cur.get('events', {}).keys())
+    for event in events:
+      if event in base.get('events', {}) and event in cur.get('events', {}):
+        times.append(("event '%s'" % event, base['events'][event]['time'], cur['events'][event]['time']))
+
+    for item, tBase, tCur in times:
+      if tBase >= minTime and tCur > (1.0+threshold)*tBase:
+        flagged.append({'case': name, 'item': item, 'baseline': tBase, 'current': tCur, 'ratio': tCur/tBase})
+  return flagged
+
+
+# End of file
@@ -26,13 +26,19 @@ class Field(Memory):
   """
   Mesh object for holding field memory and performance information.
   """
-  def __init__(self, label = '', size = 0, chartSize = 0):
+  def __init__(self, label = '', size = 0, chartSize = 0,
+               singlePrecision = False, numStored = None):
     """
     Constructor.
+
+    numStored is the number of values actually stored, if the values
+    are stored in compressed form.
     """
     self.label     = label
     self.size      = size
     self.chartSize = chartSize
+    self.sizeValue = self.sizeFloat if singlePrecision else self.sizeDouble
+    self.numStored = size if numStored is None else numStored
     return
 
 
@@ -44,12 +50,19 @@ class Field(Memory):
     if not self.label in memDict:
       memDict[self.label] = 0
     memDict[self.label] += \
-        (self.sizeDouble * self.size) + \
+        (self.sizeValue * self.numStored) + \
         (2 * self.sizeInt * self.chartSize) + \
         (2 * self.sizeInt * self.chartSize)
     return
 
 
+  def saved(self):
+    """
+    Memory saved relative to storing all values in double precision.
+    """
+    return self.sizeDouble * self.size - self.sizeValue * self.numStored
+
+
 if __name__ == '__main__':
   print 'Memory:',Material('rock', 35).tabulate()
 
@@ -0,0 +1,108 @@
+#!/usr/bin/env python
+#
+# ----------------------------------------------------------------------
+#
+# Brad T. Aagaard, U.S. Geological Survey
+# Charles A. Williams, GNS Science
+# Matthew G. Knepley, University of Chicago
+#
+# This code was developed as part of the Computational Infrastructure
+# for Geodynamics (http://geodynamics.org).
+#
+# Copyright (c) 2010-2017 University of California, Davis
+#
+# See COPYING for license information.
+#
+# ----------------------------------------------------------------------
+#
+
+## @file pylith/perf/LogView.py
+##
+## @brief Python object for reading PETSc performance logs.
+##
+## The log must be written in the detailed Python format, i.e., with
+## the PETSc option -log_view :FILENAME:ascii_info_detail.
+
+class LogView(object):
+  """
+  Python object for reading PETSc performance logs.
+  """
+
+  # PUBLIC METHODS /////////////////////////////////////////////////////
+
+  def __init__(self):
+    """
+    Constructor.
+    """
+    self.nprocs = 0
+    self.times = {}
+    self.flop = {}
+    self.stages = {}
+    return
+
+
+  def read(self, filename):
+    """
+    Read log written by PETSc in detailed Python format.
+    """
+    # The log is Python code that fills dictionaries indexed by rank.
+    logDict = {}
+    exec(compile(open(filename).read(), filename, "exec"), logDict)
+
+    self.nprocs = logDict.get("size", 0)
+    self.times = logDict.get("LocalTimes", {})
+    self.flop = logDict.get("LocalFlop", logDict.get("LocalFlops", {}))
+    self.stages = logDict.get("Stages", {})
+    return self
+
+
+  def summary(self):
+    """
+    Summarize log as dictionary with times (maximum over processes)
+    and flop (sum over processes) for the run, each stage, and each
+    event. Events are combined over all stages.
+    """
+    stages = {}
+    events = {}
+    for stageName, stageEvents in self.stages.items():
+      for eventName, ranks in stageEvents.items():
+        time = max([self._value(r, "time") for r in ranks.values()] + [0.0])
+        flop = sum([self._value(r, "flop") for r in ranks.values()])
+        if "summary" == eventName:
+          stages[stageName] = {'time': time, 'flop': flop}
+          continue
+        count = max([int(self._value(r, "count")) for r in ranks.values()] + [0])
+        if 0 == count:
+          continue
+        if not eventName in events:
+          events[eventName] = {'count': 0, 'time': 0.0, 'flop': 0.0}
+        event = events[eventName]
+        event['count'] += count
+        event['time'] += time
+        event['flop'] += flop
+
+    for event in events.values():
+      event['flop_rate'] = event['flop'] / event['time'] if event['time'] > 0.0 else 0.0
+
+    return {'nprocs': self.nprocs,
+            'time': max(list(self.times.values()) + [0.0]),
+            'flop': sum(self.flop.values()),
+            'stages': stages,
+            'events': events}
+
+
+  # PRIVATE METHODS ////////////////////////////////////////////////////
+
+  def _value(self, info, name):
+    """
+    Get value from event information, allowing for older PETSc
+    releases that used 'flops' instead of 'flop'.
+    """
+    if name in info:
+      return info[name]
+    if "flop" == name:
+      return info.get("flops", 0.0)
+    return 0.0
+
+
+# End of file
@@ -25,6 +25,7 @@ from pylith.utils.utils import sizeofVoidPtr
 class Memory(object):
   sizeInt    = 4
   sizeDouble = 8
+  sizeFloat  = 4
   import distutils.sysconfig
   pointerSize = distutils.sysconfig.get_config_var('SIZEOF_VOID_P')
 
@@ -61,6 +61,7 @@ class MemoryLogger(Logger):
     self.megabyte = float(2**20)
     self.memory   = {}
     self.memory['Completion'] = 0
+    self.saved    = {}
     return
 
 
@@ -138,9 +139,13 @@ class MemoryLogger(Logger):
     return
 
 
-  def logField(self, stage, field):
+  def logField(self, stage, field, singlePrecision=False, numStored=None):
     """
     Read field parameters to determine memory from our model.
+
+    If singlePrecision is True or numStored is less than the size of
+    the field, the values are stored in compact form and the memory
+    saved is tabulated separately.
     """
     import pylith.perf.Field
 
@@ -149,8 +154,14 @@ class MemoryLogger(Logger):
       self.memory[stage]['Fields'] = {}
     if not field is None:
       fieldModel = pylith.perf.Field.Field(field.label(), field.sectionSize(), 
-                                           field.chartSize())
+                                           field.chartSize(), singlePrecision,
+                                           numStored)
       fieldModel.tabulate(self.memory[stage]['Fields'])
+      if fieldModel.saved() > 0:
+        if not stage in self.saved: self.saved[stage] = {}
+        label = fieldModel.label
+        self.saved[stage][label] = self.saved[stage].get(label, 0) + \
+            fieldModel.saved()
     return
 
 
@@ -209,6 +220,7 @@ class MemoryLogger(Logger):
     Incorporate information from another logger.
     """
     self.mergeMemDict(self.memory, logger.memory)
+    self.mergeMemDict(self.saved, logger.saved)
     return
 
 
@@ -282,6 +294,15 @@ class MemoryLogger(Logger):
                                #logger.getAllocationTotal('default'), 1))
     output.append(self.memLine('Code',  'Total Dealloced', 0))
                                #logger.getDeallocationTotal('default'), 1))
+    if self.saved:
+      output.append("COMPACT STORAGE SAVINGS")
+      total = 0
+      for stage,savedDict in self.saved.iteritems():
+        output.append(self.prefix(1)+stage)
+        for name,m in savedDict.iteritems():
+          output.append(self.memLine('Model', name, m, 2))
+          total += m
+      output.append(self.memLine('Model', 'Total saved', total, 1))
 
     print '\n'.join(output)
     return
@@ -28,6 +28,8 @@ __all__ = ['Memory',
            'Material', 
            'Field',
            'GlobalOrder',
+           'LogView',
+           'Benchmark',
            ]
 
 
@@ -84,6 +84,7 @@ class Explicit(Formulation, ModuleExplicit):
     ModuleExplicit.__init__(self)
     self._loggingPrefix = "TSEx "
     self.dtStable = None
+    self.stepper = None
     return
 
 
@@ -176,6 +177,8 @@ class Explicit(Formulation, ModuleExplicit):
     self.solver.initialize(self.fields, self.jacobian, self)
     self._debug.log(resourceUsageString())
 
+    self._setupStepper()
+
     #memoryLogger.stagePop()
     #memoryLogger.setDebug(0)
     self._eventLogger.eventEnd(logEvent)
@@ -189,6 +192,12 @@ class Explicit(Formulation, ModuleExplicit):
     logEvent = "%sprestep" % self._loggingPrefix
     self._eventLogger.eventBegin(logEvent)
     
+    if not self.stepper is None:
+      if self.stepper.prestep(t, dt):
+        self._reformJacobian(t, dt)
+      self._eventLogger.eventEnd(logEvent)
+      return
+
     dispIncr = self.fields.get("dispIncr(t->t+dt)")
     for constraint in self.constraints:
       constraint.setFieldIncr(t, t+dt, dispIncr)
@@ -212,6 +221,12 @@ class Explicit(Formulation, ModuleExplicit):
     from pylith.mpi.Communicator import mpi_comm_world
     comm = mpi_comm_world()
 
+    if not self.stepper is None:
+      if 0 == comm.rank:
+        self._info.log("Integrating residual and solving equations.")
+      self.stepper.step(t, dt)
+      return
+
     self._reformResidual(t, dt)
     
     if 0 == comm.rank:
@@ -244,6 +259,12 @@ class Explicit(Formulation, ModuleExplicit):
       output.writeData(t, self.fields)
     self._writeData(t)
 
+    if not self.stepper is None:
+      # Update displacement fields and state variables.
+      self.stepper.poststep(t, dt)
+      self._eventLogger.eventEnd(logEvent)
+      return
+
     # Update displacement field from time t to time t+dt.
     dispIncr = self.fields.get("dispIncr(t->t+dt)")
     dispT = self.fields.get("disp(t)")
@@ -302,6 +323,17 @@ class Explicit(Formulation, ModuleExplicit):
     return self.dtStable
   
 
+  def finalize(self):
+    """
+    Cleanup after time stepping.
+    """
+    if not self.stepper is None:
+      self.stepper.deallocate()
+      self.stepper = None
+    Formulation.finalize(self)
+    return
+
+
   # PRIVATE METHODS ////////////////////////////////////////////////////
 
   def _configure(self):
@@ -315,6 +347,28 @@ class Explicit(Formulation, ModuleExplicit):
     return
 
 
+  def _setupStepper(self):
+    """
+    Setup C++ time stepper for advancing the solution with a lumped
+    Jacobian. Use the Python time step hooks if the solver or a
+    constraint is not supported by the C++ time stepper.
+    """
+    from SolverLumped import SolverLumped
+    if not isinstance(self.solver, SolverLumped):
+      return
+
+    from problems import TimeStepper
+    stepper = TimeStepper()
+    try:
+      stepper.constraints(self.constraints)
+    except TypeError:
+      return
+    stepper.initialize(self, self.solver, self.jacobian, self.fields)
+    stepper.stageLogger(self._eventLogger)
+    self.stepper = stepper
+    return
+
+
   def _reformJacobian(self, t, dt):
     """
     Reform Jacobian matrix for operator.
@@ -34,6 +34,13 @@ def validateUseCUDA(value):
   return value
 
 
+# Validate initial guess strategy.
+def validateInitialGuess(value):
+  if not value in ["zero", "previous_increment", "quadratic_extrapolation", "projection"]:
+    raise ValueError("Unknown initial guess strategy '%s'." % value)
+  return value
+
+
 # Solver class
 class Solver(PetscComponent):
   """
@@ -53,7 +60,11 @@ class Solver(PetscComponent):
     ## Python object for managing Solver facilities and properties.
     ##
     ## \b Properties
+    ## @li \b create_null_space Create solution null space.
     ## @li \b use_cuda Use CUDA in solve if supported by solver.
+    ## @li \b initial_guess Strategy for initial guess of solution increment.
+    ## @li \b initial_guess_num_vectors Number of previous increments used in projection.
+    ## @li \b use_geometric_multigrid Use geometric multigrid preconditioner.
     ##
     ## \b Facilities
     ## @li None
@@ -67,6 +78,17 @@ class Solver(PetscComponent):
                                   validator=validateUseCUDA)
     useCUDA.meta['tip'] = "Enable use of CUDA for finite-element integrations."
 
+    initialGuess = pyre.inventory.str("initial_guess", default="zero",
+                                      validator=validateInitialGuess)
+    initialGuess.meta['tip'] = "Initial guess of solution increment ('zero', 'previous_increment', 'quadratic_extrapolation', 'projection')."
+
+    initialGuessNumVectors = pyre.inventory.int("initial_guess_num_vectors", default=3,
+                                                validator=pyre.inventory.greater(0))
+    initialGuessNumVectors.meta['tip'] = "Number of previous increments used in projection for initial guess."
+
+    useGeometricMultigrid = pyre.inventory.bool("use_geometric_multigrid", default=False)
+    useGeometricMultigrid.meta['tip'] = "Use geometric multigrid preconditioner with levels from uniform mesh refinement (requires refiner.retain_hierarchy)."
+
 
   # PUBLIC METHODS /////////////////////////////////////////////////////
 
@@ -97,6 +119,28 @@ class Solver(PetscComponent):
 
     self.useCUDA = self.inventory.useCUDA
     self.createNullSpace = self.inventory.createNullSpace
+    self.initialGuess = self.inventory.initialGuess
+    self.initialGuessNumVectors = self.inventory.initialGuessNumVectors
+    self.useGeometricMultigrid = self.inventory.useGeometricMultigrid
+    return
+
+
+  def _setInitialGuess(self, module):
+    """
+    Set strategy for initial guess in C++ solver.
+    """
+    if self.initialGuess == "zero":
+      guessEnum = module.INITIAL_GUESS_ZERO
+    elif self.initialGuess == "previous_increment":
+      guessEnum = module.INITIAL_GUESS_PREVIOUS
+    elif self.initialGuess == "quadratic_extrapolation":
+      guessEnum = module.INITIAL_GUESS_QUADRATIC
+    elif self.initialGuess == "projection":
+      guessEnum = module.INITIAL_GUESS_PROJECTION
+    else:
+      raise ValueError("Unknown initial guess strategy '%s'." % self.initialGuess)
+    module.initialGuessType(self, guessEnum)
+    module.initialGuessNumVectors(self, self.initialGuessNumVectors)
     return
 
 
@@ -75,6 +75,8 @@ class SolverLinear(Solver, ModuleSolverLinear):
     Solver._configure(self)
 
     ModuleSolverLinear.skipNullSpaceCreation(self, not self.createNullSpace)
+    self._setInitialGuess(ModuleSolverLinear)
+    ModuleSolverLinear.useGeometricMultigrid(self, self.useGeometricMultigrid)
     return
 
 
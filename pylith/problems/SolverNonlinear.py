@@ -23,6 +23,22 @@
 from Solver import Solver
 from problems import SolverNonlinear as ModuleSolverNonlinear
 
+# VALIDATORS ///////////////////////////////////////////////////////////
+
+# Validate nonlinear solver type.
+def validateSolverType(value):
+  if not value in ["newton", "nrichardson", "quasi_newton"]:
+    raise ValueError("Unknown nonlinear solver type '%s'." % value)
+  return value
+
+
+# Validate ratio of actual to predicted decrease in residual norm.
+def validateAcceptRatio(value):
+  if value < 0.0 or value > 1.0:
+    raise ValueError("Line search accept ratio (%s) must be in [0, 1]." % value)
+  return value
+
+
 # SolverNonlinear class
 class SolverNonlinear(Solver, ModuleSolverNonlinear):
   """
@@ -40,13 +56,44 @@ class SolverNonlinear(Solver, ModuleSolverNonlinear):
     ## Python object for managing SolverNonlinear facilities and properties.
     ##
     ## \b Properties
-    ## @li None
+    ## @li \b line_search_reuse_residual Reuse residual from last trial step in line search.
+    ## @li \b line_search_accept_ratio Minimum ratio of actual to predicted decrease for reusing residual.
+    ## @li \b solver_type Type of nonlinear solver.
+    ## @li \b adaptive_linear_tolerance Adapt tolerance of linear solve (Eisenstat-Walker).
+    ## @li \b lag_jacobian Number of iterations between reforming the Jacobian.
+    ## @li \b lag_preconditioner Number of Jacobian reforms between rebuilding the preconditioner.
+    ## @li \b fuse_state_vars_update Update state variables using strain from final residual evaluation.
     ##
     ## \b Facilities
     ## @li None
 
     import pyre.inventory
 
+    lineSearchReuseResidual = pyre.inventory.bool("line_search_reuse_residual", default=False)
+    lineSearchReuseResidual.meta['tip'] = "Reuse residual from last trial step in line search instead of reforming it at the accepted step."
+
+    lineSearchAcceptRatio = pyre.inventory.float("line_search_accept_ratio", default=0.5,
+                                                 validator=validateAcceptRatio)
+    lineSearchAcceptRatio.meta['tip'] = "Minimum ratio of actual to predicted (linearized) decrease in residual norm for reusing residual in line search."
+
+    solverType = pyre.inventory.str("solver_type", default="newton",
+                                    validator=validateSolverType)
+    solverType.meta['tip'] = "Type of nonlinear solver ('newton', 'nrichardson', 'quasi_newton')."
+
+    adaptiveLinearTolerance = pyre.inventory.bool("adaptive_linear_tolerance", default=False)
+    adaptiveLinearTolerance.meta['tip'] = "Adapt tolerance of linear solve in each Newton step (Eisenstat-Walker)."
+
+    lagJacobian = pyre.inventory.int("lag_jacobian", default=1,
+                                     validator=pyre.inventory.greater(0))
+    lagJacobian.meta['tip'] = "Number of nonlinear iterations between reforming the Jacobian."
+
+    lagPreconditioner = pyre.inventory.int("lag_preconditioner", default=1,
+                                           validator=pyre.inventory.greater(0))
+    lagPreconditioner.meta['tip'] = "Number of Jacobian reforms between rebuilding the preconditioner."
+
+    fuseStateVarsUpdate = pyre.inventory.bool("fuse_state_vars_update", default=False)
+    fuseStateVarsUpdate.meta['tip'] = "Update state variables using strain from residual evaluation at converged solution instead of recomputing it."
+
 
   # PUBLIC METHODS /////////////////////////////////////////////////////
 
@@ -68,6 +115,25 @@ class SolverNonlinear(Solver, ModuleSolverNonlinear):
     Solver._configure(self)
 
     ModuleSolverNonlinear.skipNullSpaceCreation(self, not self.createNullSpace)
+    self._setInitialGuess(ModuleSolverNonlinear)
+    ModuleSolverNonlinear.useGeometricMultigrid(self, self.useGeometricMultigrid)
+    ModuleSolverNonlinear.lineSearchReuseResidual(self, self.inventory.lineSearchReuseResidual)
+    ModuleSolverNonlinear.lineSearchAcceptRatio(self, self.inventory.lineSearchAcceptRatio)
+
+    solverType = self.inventory.solverType
+    if solverType == "newton":
+      typeEnum = ModuleSolverNonlinear.SOLVER_NEWTON
+    elif solverType == "nrichardson":
+      typeEnum = ModuleSolverNonlinear.SOLVER_NRICHARDSON
+    elif solverType == "quasi_newton":
+      typeEnum = ModuleSolverNonlinear.SOLVER_QUASI_NEWTON
+    else:
+      raise ValueError("Unknown nonlinear solver type '%s'." % solverType)
+    ModuleSolverNonlinear.solverType(self, typeEnum)
+    ModuleSolverNonlinear.adaptiveLinearTolerance(self, self.inventory.adaptiveLinearTolerance)
+    ModuleSolverNonlinear.lagJacobian(self, self.inventory.lagJacobian)
+    ModuleSolverNonlinear.lagPreconditioner(self, self.inventory.lagPreconditioner)
+    ModuleSolverNonlinear.fuseStateVarsUpdate(self, self.inventory.fuseStateVarsUpdate)
     return
 
 
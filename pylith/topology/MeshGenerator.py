@@ -106,25 +106,16 @@ class MeshGenerator(PetscComponent):
     #self._info.activate()
     #mesh.view("===== MESH BEFORE ADJUSTING TOPOLOGY =====")
 
-    if not interfaces is None:
-      firstFaultVertex    = 0
-      firstLagrangeVertex = 0
-      firstFaultCell      = 0
-      for interface in interfaces:
-        if 0 == comm.rank:
-          self._info.log("Counting vertices for fault '%s'." % interface.label())
-        nvertices = interface.numVerticesNoMesh(mesh)
-        firstLagrangeVertex += nvertices
-        firstFaultCell      += nvertices
-        if interface.useLagrangeConstraints():
-          firstFaultCell += nvertices
+    if not interfaces is None and len(interfaces) > 0:
       for interface in interfaces:
         nvertices = interface.numVerticesNoMesh(mesh)
         if 0 == comm.rank:
           self._info.log("Adjusting topology for fault '%s' with %d vertices." % \
                            (interface.label(), nvertices))
-        firstFaultVertex, firstLagrangeVertex, firstFaultCell = \
-            interface.adjustTopology(mesh, firstFaultVertex, firstLagrangeVertex, firstFaultCell)
+      # Insert cohesive cells for all faults together, so that faults
+      # that do not intersect share a single rebuild of the topology.
+      from pylith.faults.faults import FaultCohesive_adjustTopologyAll
+      FaultCohesive_adjustTopologyAll(mesh, list(interfaces))
         
     #mesh.view("===== MESH AFTER ADJUSTING TOPOLOGY =====")
     #self._info.deactivate()
@@ -43,7 +43,9 @@ class MeshImporter(MeshGenerator):
     ## Python object for managing MeshImporter facilities and properties.
     ##
     ## \b Properties
-    ## @li reorder_mesh Reorder mesh using reverse Cuthill-McKee if true.
+    ## @li reorder_mesh Reorder mesh if true.
+    ## @li reorder_type Type of reordering.
+    ## @li insert_faults_after_distribution Insert cohesive cells after distributing mesh.
     ##
     ## \b Facilities
     ## @li \b reader Mesh reader.
@@ -53,7 +55,15 @@ class MeshImporter(MeshGenerator):
     import pyre.inventory
 
     reorderMesh = pyre.inventory.bool("reorder_mesh", default=False)
-    reorderMesh.meta['tip'] = "Reorder mesh using reverse Cuthill-McKee."
+    reorderMesh.meta['tip'] = "Reorder mesh."
+
+    reorderType = pyre.inventory.str("reorder_type", default="reverse_cuthill_mckee",
+                                     validator=pyre.inventory.choice(["reverse_cuthill_mckee",
+                                                                      "space_filling_curve"]))
+    reorderType.meta['tip'] = "Type of reordering (reverse Cuthill-McKee or space-filling curve within each material)."
+
+    faultsAfterDistribution = pyre.inventory.bool("insert_faults_after_distribution", default=False)
+    faultsAfterDistribution.meta['tip'] = "Insert cohesive cells in parallel after distributing mesh."
 
     from pylith.meshio.MeshIOAscii import MeshIOAscii
     reader = pyre.inventory.facility("reader", family="mesh_io",
@@ -96,6 +106,15 @@ class MeshImporter(MeshGenerator):
     logEvent = "%screate" % self._loggingPrefix
     self._eventLogger.eventBegin(logEvent)    
 
+    # Check requirements for reading mesh in parallel
+    parallelRead = getattr(self.reader, "parallelRead", False)
+    if parallelRead and comm.size > 1:
+      if not faults is None and len(faults) > 0 and not self.faultsAfterDistribution:
+        raise ValueError("Reading the mesh in parallel is not supported with faults.")
+      if self.distributor.partitioner == "chaco":
+        raise ValueError("Reading the mesh in parallel requires a parallel partitioner "
+                         "(metis or parmetis).")
+
     # Read mesh
     mesh = self.reader.read(self.debug, self.interpolate)
     if self.debug:
@@ -108,16 +127,31 @@ class MeshImporter(MeshGenerator):
       self._debug.log(resourceUsageString())
       if 0 == comm.rank:
         self._info.log("Reordering cells and vertices.")
-      from pylith.topology.ReverseCuthillMcKee import ReverseCuthillMcKee
-      ordering = ReverseCuthillMcKee()
+      from pylith.topology.SpaceFillingCurve import SpaceFillingCurve
+      locality = SpaceFillingCurve()
+      # Computing the span traverses all cells, so skip it unless we log it.
+      logSpan = 0 == comm.rank and self._info.state
+      if logSpan:
+        spanOrig = locality.closureSpan(mesh)
+      if self.reorderType == "space_filling_curve":
+        ordering = locality
+      else:
+        from pylith.topology.ReverseCuthillMcKee import ReverseCuthillMcKee
+        ordering = ReverseCuthillMcKee()
       ordering.reorder(mesh)
+      if logSpan:
+        span = locality.closureSpan(mesh)
+        self._info.log("Span of vertices in closure of cells (mean, max): "
+                       "(%.1f, %d) before reordering, (%.1f, %d) after reordering." % \
+                       (spanOrig[0], spanOrig[1], span[0], span[1]))
       self._eventLogger.eventEnd(logEvent2)
 
     # Adjust topology
-    self._debug.log(resourceUsageString())
-    if 0 == comm.rank:
-      self._info.log("Adjusting topology.")
-    self._adjustTopology(mesh, faults)
+    if not self.faultsAfterDistribution:
+      self._debug.log(resourceUsageString())
+      if 0 == comm.rank:
+        self._info.log("Adjusting topology.")
+      self._adjustTopology(mesh, faults)
 
     # Distribute mesh
     if comm.size > 1:
@@ -128,6 +162,14 @@ class MeshImporter(MeshGenerator):
         mesh.view()
       mesh.memLoggingStage = "DistributedMesh"
 
+    # Adjust topology of distributed mesh. Each process inserts
+    # cohesive cells for the faces of its partition.
+    if self.faultsAfterDistribution:
+      self._debug.log(resourceUsageString())
+      if 0 == comm.rank:
+        self._info.log("Adjusting topology.")
+      self._adjustTopology(mesh, faults)
+
     # Refine mesh (if necessary)
     newMesh = self.refiner.refine(mesh)
     if not newMesh == mesh:
@@ -156,6 +198,8 @@ class MeshImporter(MeshGenerator):
     self.distributor = self.inventory.distributor
     self.refiner = self.inventory.refiner
     self.reorderMesh = self.inventory.reorderMesh
+    self.reorderType = self.inventory.reorderType
+    self.faultsAfterDistribution = self.inventory.faultsAfterDistribution
     return
   
 
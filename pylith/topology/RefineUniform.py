@@ -41,6 +41,9 @@ class RefineUniform(MeshRefiner, ModuleRefineUniform):
   levels = pyre.inventory.int("levels", default=1, validator=pyre.inventory.greaterEqual(1))
   levels.meta['tip'] = "Number of refinement levels."
 
+  retainHierarchy = pyre.inventory.bool("retain_hierarchy", default=False)
+  retainHierarchy.meta['tip'] = "Retain coarser meshes for geometric multigrid."
+
 
   # PUBLIC METHODS /////////////////////////////////////////////////////
 
@@ -85,6 +88,7 @@ class RefineUniform(MeshRefiner, ModuleRefineUniform):
     """
     MeshRefiner._configure(self)
     self.levels = self.inventory.levels
+    ModuleRefineUniform.retainHierarchy(self, self.inventory.retainHierarchy)
     return
 
 
@@ -0,0 +1,106 @@
+#!/usr/bin/env python
+#
+# ----------------------------------------------------------------------
+#
+# Brad T. Aagaard, U.S. Geological Survey
+# Charles A. Williams, GNS Science
+# Matthew G. Knepley, University of Chicago
+#
+# This code was developed as part of the Computational Infrastructure
+# for Geodynamics (http://geodynamics.org).
+#
+# Copyright (c) 2010-2017 University of California, Davis
+#
+# See COPYING for license information.
+#
+# ----------------------------------------------------------------------
+#
+
+## @file tests/3d/faultpc/generate_mesh.py
+##
+## @brief Generate PyLith ASCII hex8 mesh of a box with a vertical
+## fault on the plane x=0 cutting through the entire domain.
+##
+## Usage: generate_mesh.py NUM_CELLS_PER_SIDE FILENAME
+##
+## The number of fault vertices is (NUM_CELLS_PER_SIDE+1)**2.
+
+import sys
+
+# ----------------------------------------------------------------------
+def generate(nx, filename, length=6.0e+3):
+  """
+  Write mesh with nx**3 hex8 cells on [-length,length]^3.
+  """
+  if nx % 2:
+    raise ValueError("Number of cells per side must be even so fault is on x=0.")
+  dx = 2.0*length / nx
+  npts = nx + 1
+
+  def index(i, j, k):
+    return (k*npts + j)*npts + i
+
+  fout = open(filename, "w")
+  fout.write("mesh = {\n")
+  fout.write("  dimension = 3\n")
+  fout.write("  use-index-zero = true\n")
+  fout.write("  vertices = {\n")
+  fout.write("    dimension = 3\n")
+  fout.write("    count = %d\n" % npts**3)
+  fout.write("    coordinates = {\n")
+  for k in xrange(npts):
+    for j in xrange(npts):
+      for i in xrange(npts):
+        fout.write("%d %.6e %.6e %.6e\n" % (index(i,j,k), -length+i*dx, -length+j*dx, -length+k*dx))
+  fout.write("    }\n")
+  fout.write("  }\n")
+
+  fout.write("  cells = {\n")
+  fout.write("    count = %d\n" % nx**3)
+  fout.write("    num-corners = 8\n")
+  fout.write("    simplices = {\n")
+  icell = 0
+  for k in xrange(nx):
+    for j in xrange(nx):
+      for i in xrange(nx):
+        cell = (index(i,j,k), index(i+1,j,k), index(i+1,j+1,k), index(i,j+1,k),
+                index(i,j,k+1), index(i+1,j,k+1), index(i+1,j+1,k+1), index(i,j+1,k+1))
+        fout.write("%d  %d %d %d %d %d %d %d %d\n" % ((icell,)+cell))
+        icell += 1
+  fout.write("    }\n")
+  fout.write("    material-ids = {\n")
+  for icell in xrange(nx**3):
+    fout.write("%d 1\n" % icell)
+  fout.write("    }\n")
+  fout.write("  }\n")
+
+  def writeGroup(name, indices):
+    fout.write("  group = {\n")
+    fout.write("    name = %s\n" % name)
+    fout.write("    type = vertices\n")
+    fout.write("    count = %d\n" % len(indices))
+    fout.write("    indices = {\n")
+    for i in indices:
+      fout.write("%d\n" % i)
+    fout.write("    }\n")
+    fout.write("  }\n")
+    return
+
+  writeGroup("fault", [index(nx/2,j,k) for k in xrange(npts) for j in xrange(npts)])
+  writeGroup("face_xneg", [index(0,j,k) for k in xrange(npts) for j in xrange(npts)])
+  writeGroup("face_xpos", [index(nx,j,k) for k in xrange(npts) for j in xrange(npts)])
+  writeGroup("face_zneg", [index(i,j,0) for j in xrange(npts) for i in xrange(npts) if i != nx/2])
+  fout.write("}\n")
+  fout.close()
+  return
+
+
+# ----------------------------------------------------------------------
+if __name__ == "__main__":
+  if len(sys.argv) != 3:
+    print "Usage: generate_mesh.py NUM_CELLS_PER_SIDE FILENAME"
+    sys.exit(1)
+  generate(int(sys.argv[1]), sys.argv[2])
+
+
+# End of file
@@ -0,0 +1,106 @@
+#!/usr/bin/env python
+#
+# ----------------------------------------------------------------------
+#
+# Brad T. Aagaard, U.S. Geological Survey
+# Charles A. Williams, GNS Science
+# Matthew G. Knepley, University of Chicago
+#
+# This code was developed as part of the Computational Infrastructure
+# for Geodynamics (http://geodynamics.org).
+#
+# Copyright (c) 2010-2017 University of California, Davis
+#
+# See COPYING for license information.
+#
+# ----------------------------------------------------------------------
+#
+
+## @file tests/3d/faultpc/run_benchmark.py
+##
+## @brief Benchmark setup time and iteration count of the custom
+## preconditioner for fault Lagrange multipliers versus fault size.
+##
+## Usage: run_benchmark.py [--nodes=NPROCS] [NUM_CELLS_PER_SIDE ...]
+##
+## For each mesh size, we generate a box mesh with a through-going
+## fault, run PyLith with -log_view, and report the number of fault
+## vertices, the time spent in the "FaPr setup" and "FaPr compute"
+## events (max over processes, summed over calls), and the number of
+## linear iterations per solve.
+
+import sys
+import os
+import re
+import subprocess
+
+from generate_mesh import generate
+
+# ----------------------------------------------------------------------
+def parseLog(filename):
+  """
+  Extract event timings and iteration counts from PyLith log.
+  """
+  events = {"FaPr setup": 0.0,
+            "FaPr compute": 0.0,
+            }
+  iterations = []
+  reEvent = re.compile(r"^(FaPr setup|FaPr compute)\s+(\d+)\s+\S+\s+(\S+)")
+  reIts = re.compile(r"Linear solve converged due to \S+ iterations (\d+)")
+  for line in open(filename, "r"):
+    match = reEvent.match(line)
+    if match:
+      events[match.group(1)] += float(match.group(3))
+      continue
+    match = reIts.search(line)
+    if match:
+      iterations.append(int(match.group(1)))
+  return events, iterations
+
+
+# ----------------------------------------------------------------------
+def run(sizes, nodes):
+  """
+  Run benchmark for the given mesh sizes.
+  """
+  if not os.path.isdir("output"):
+    os.mkdir("output")
+
+  print "%10s %14s %14s %14s  %s" % \
+      ("nfaultvert", "setup (s)", "compute (s)", "total (s)", "iterations")
+  for nx in sizes:
+    meshFilename = "mesh_n%d.txt" % nx
+    logFilename = "output/faultpc_n%d_np%d.log" % (nx, nodes)
+    generate(nx, meshFilename)
+    cmd = ["pylith", "pylithapp.cfg",
+           "--mesh_generator.reader.filename=%s" % meshFilename,
+           "--nodes=%d" % nodes]
+    fout = open(logFilename, "w")
+    subprocess.check_call(cmd, stdout=fout, stderr=subprocess.STDOUT)
+    fout.close()
+
+    events, iterations = parseLog(logFilename)
+    numFaultVertices = (nx+1)**2
+    print "%10d %14.6e %14.6e %14.6e  %s" % \
+        (numFaultVertices,
+         events["FaPr setup"], events["FaPr compute"],
+         events["FaPr setup"]+events["FaPr compute"],
+         " ".join(["%d" % its for its in iterations]))
+  return
+
+
+# ----------------------------------------------------------------------
+if __name__ == "__main__":
+  nodes = 1
+  sizes = []
+  for arg in sys.argv[1:]:
+    if arg.startswith("--nodes="):
+      nodes = int(arg[len("--nodes="):])
+    else:
+      sizes.append(int(arg))
+  if not sizes:
+    sizes = [8, 16, 32, 64]
+  run(sizes, nodes)
+
+
+# End of file
@@ -21,6 +21,10 @@ pylith tension.cfg --nodes=1 >& tension_np1.log
 pylith tension.cfg --nodes=2 >& tension_np2.log
 pylith tension.cfg --nodes=3 >& tension_np3.log
 
+echo "RUNNING $dir tension (faults inserted after distribution)"
+pylith tension.cfg --mesh_generator.insert_faults_after_distribution=True --nodes=2 >& tension_dist_np2.log
+pylith tension.cfg --mesh_generator.insert_faults_after_distribution=True --nodes=3 >& tension_dist_np3.log
+
 echo "RUNNING $dir ratestate_weak"
 pylith ratestate.cfg ratestate_weak.cfg --nodes=1 >& weak_np1.log
 pylith ratestate.cfg ratestate_weak.cfg --nodes=2 >& weak_np2.log
@@ -34,6 +34,8 @@
 #include "spatialdata/units/Nondimensional.hh" // USES Nondimensional
 #include "spatialdata/geocoords/CSCart.hh" // USES CSCart
 
+#include <map> // USES std::map
+
 // ----------------------------------------------------------------------
 CPPUNIT_TEST_SUITE_REGISTRATION( pylith::faults::TestFaultCohesive );
 
@@ -729,6 +731,32 @@ pylith::faults::TestFaultCohesive::testAdjustTopologyHex8Lagrange(void)
   PYLITH_METHOD_END;
 } // testAdjustTopologyHex8Lagrange
 
+// ----------------------------------------------------------------------
+// Test adjustTopologyAll() with 2-D quadrilateral elements and two
+// intersecting faults.
+void
+pylith::faults::TestFaultCohesive::testAdjustTopologyAllQuad4h(void)
+{ // testAdjustTopologyAllQuad4h
+  PYLITH_METHOD_BEGIN;
+
+  _testAdjustTopologyAll("data/quad4h.mesh");
+
+  PYLITH_METHOD_END;
+} // testAdjustTopologyAllQuad4h
+
+// ----------------------------------------------------------------------
+// Test adjustTopologyAll() with 2-D quadrilateral elements and two
+// faults that do not intersect.
+void
+pylith::faults::TestFaultCohesive::testAdjustTopologyAllQuad4j(void)
+{ // testAdjustTopologyAllQuad4j
+  PYLITH_METHOD_BEGIN;
+
+  _testAdjustTopologyAll("data/quad4j.mesh");
+
+  PYLITH_METHOD_END;
+} // testAdjustTopologyAllQuad4j
+
 // ----------------------------------------------------------------------
 // Test adjustTopology().
 void
@@ -1010,5 +1038,101 @@ pylith::faults::TestFaultCohesive::_testAdjustTopology(Fault* faultA,
   PYLITH_METHOD_END;
 } // _testAdjustTopology
 
+// ----------------------------------------------------------------------
+// Test adjustTopologyAll().
+void
+pylith::faults::TestFaultCohesive::_testAdjustTopologyAll(const char* filename)
+{ // _testAdjustTopologyAll
+  PYLITH_METHOD_BEGIN;
+
+  // Insert faults one at a time.
+  topology::Mesh meshE;
+  meshio::MeshIOAscii iohandler;
+  iohandler.filename(filename);
+  iohandler.debug(false);
+  iohandler.read(&meshE);
+
+  FaultCohesiveKin faultAE;
+  faultAE.id(1);
+  faultAE.label("faultA");
+  FaultCohesiveKin faultBE;
+  faultBE.id(2);
+  faultBE.label("faultB");
+  int firstFaultVertex = 0, firstLagrangeVertex = 0, firstFaultCell = 0;
+  faultAE.adjustTopology(&meshE, &firstFaultVertex, &firstLagrangeVertex, &firstFaultCell);
+  faultBE.adjustTopology(&meshE, &firstFaultVertex, &firstLagrangeVertex, &firstFaultCell);
+
+  // Insert faults together.
+  topology::Mesh mesh;
+  iohandler.read(&mesh);
+
+  FaultCohesiveKin faultA;
+  faultA.id(1);
+  faultA.label("faultA");
+  FaultCohesiveKin faultB;
+  faultB.id(2);
+  faultB.label("faultB");
+  FaultCohesive* faults[2] = { &faultA, &faultB };
+  FaultCohesive::adjustTopologyAll(&mesh, faults, 2);
+
+  CPPUNIT_ASSERT_EQUAL(meshE.dimension(), mesh.dimension());
+  PetscDM dmMeshE = meshE.dmMesh();CPPUNIT_ASSERT(dmMeshE);
+  PetscDM dmMesh = mesh.dmMesh();CPPUNIT_ASSERT(dmMesh);
+
+  // Check vertices
+  topology::Stratum verticesStratumE(dmMeshE, topology::Stratum::DEPTH, 0);
+  topology::Stratum verticesStratum(dmMesh, topology::Stratum::DEPTH, 0);
+  CPPUNIT_ASSERT_EQUAL(verticesStratumE.size(), verticesStratum.size());
+
+  // Check cells
+  topology::Stratum cellsStratumE(dmMeshE, topology::Stratum::HEIGHT, 0);
+  topology::Stratum cellsStratum(dmMesh, topology::Stratum::HEIGHT, 0);
+  CPPUNIT_ASSERT_EQUAL(cellsStratumE.size(), cellsStratum.size());
+  PetscInt cMaxE = 0, cMax = 0;
+  PetscErrorCode err;
+  err = DMPlexGetHybridBounds(dmMeshE, &cMaxE, NULL, NULL, NULL);PYLITH_CHECK_ERROR(err);
+  err = DMPlexGetHybridBounds(dmMesh, &cMax, NULL, NULL, NULL);PYLITH_CHECK_ERROR(err);
+  CPPUNIT_ASSERT_EQUAL(cMaxE, cMax);
+
+  // Check number of cells and cone sizes for each material. Cohesive
+  // cells may be in a different order.
+  PetscDMLabel labelMaterialsE = NULL, labelMaterials = NULL;
+  err = DMGetLabel(dmMeshE, "material-id", &labelMaterialsE);PYLITH_CHECK_ERROR(err);CPPUNIT_ASSERT(labelMaterialsE);
+  err = DMGetLabel(dmMesh, "material-id", &labelMaterials);PYLITH_CHECK_ERROR(err);CPPUNIT_ASSERT(labelMaterials);
+  // Map material id to number of cells and sum of cone sizes.
+  std::map<PetscInt, std::pair<int,int> > coneSizesE, coneSizes;
+  for (PetscInt c = cellsStratumE.begin(); c < cellsStratumE.end(); ++c) {
+    PetscInt value = 0, coneSize = 0;
+    err = DMLabelGetValue(labelMaterialsE, c, &value);PYLITH_CHECK_ERROR(err);
+    err = DMPlexGetConeSize(dmMeshE, c, &coneSize);PYLITH_CHECK_ERROR(err);
+    coneSizesE[value].first += 1;
+    coneSizesE[value].second += coneSize;
+  } // for
+  for (PetscInt c = cellsStratum.begin(); c < cellsStratum.end(); ++c) {
+    PetscInt value = 0, coneSize = 0;
+    err = DMLabelGetValue(labelMaterials, c, &value);PYLITH_CHECK_ERROR(err);
+    err = DMPlexGetConeSize(dmMesh, c, &coneSize);PYLITH_CHECK_ERROR(err);
+    coneSizes[value].first += 1;
+    coneSizes[value].second += coneSize;
+  } // for
+  CPPUNIT_ASSERT_EQUAL(coneSizesE.size(), coneSizes.size());
+  for (std::map<PetscInt, std::pair<int,int> >::const_iterator iterE = coneSizesE.begin(); iterE != coneSizesE.end(); ++iterE) {
+    CPPUNIT_ASSERT(coneSizes.find(iterE->first) != coneSizes.end());
+    CPPUNIT_ASSERT_EQUAL(iterE->second.first, coneSizes[iterE->first].first);
+    CPPUNIT_ASSERT_EQUAL(iterE->second.second, coneSizes[iterE->first].second);
+  } // for
+
+  // Check groups
+  const char* groupNames[2] = { "faultA", "faultB" };
+  for (int i=0; i < 2; ++i) {
+    PetscInt numPointsE = 0, numPoints = 0;
+    err = DMGetStratumSize(dmMeshE, groupNames[i], 1, &numPointsE);PYLITH_CHECK_ERROR(err);
+    err = DMGetStratumSize(dmMesh, groupNames[i], 1, &numPoints);PYLITH_CHECK_ERROR(err);
+    CPPUNIT_ASSERT_EQUAL(numPointsE, numPoints);
+  } // for
+
+  PYLITH_METHOD_END;
+} // _testAdjustTopologyAll
+
 
 // End of file 
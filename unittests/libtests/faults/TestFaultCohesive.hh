@@ -92,6 +92,9 @@ class pylith::faults::TestFaultCohesive : public CppUnit::TestFixture
   CPPUNIT_TEST( testAdjustTopologyTet4Lagrange );
   CPPUNIT_TEST( testAdjustTopologyHex8Lagrange );
 
+  CPPUNIT_TEST( testAdjustTopologyAllQuad4h );
+  CPPUNIT_TEST( testAdjustTopologyAllQuad4j );
+
   CPPUNIT_TEST_SUITE_END();
 
   // PUBLIC METHODS /////////////////////////////////////////////////////
@@ -230,6 +233,14 @@ public :
   /// multipliers.
   void testAdjustTopologyHex8Lagrange(void);
 
+  /// Test adjustTopologyAll() with 2-D quadrilateral elements and
+  /// two intersecting faults.
+  void testAdjustTopologyAllQuad4h(void);
+
+  /// Test adjustTopologyAll() with 2-D quadrilateral elements and
+  /// two faults that do not intersect.
+  void testAdjustTopologyAllQuad4j(void);
+
   // PROTECTED METHODS //////////////////////////////////////////////////
 public :
 
@@ -251,6 +262,13 @@ public :
 			   Fault* faultB,
 			   const CohesiveData& data);
 
+  /** Test adjustTopologyAll() by comparing with adjustTopology()
+   * applied to each fault in order.
+   *
+   * @param filename Filename of mesh with groups faultA and faultB.
+   */
+  void _testAdjustTopologyAll(const char* filename);
+
 }; // class TestFaultCohesive
 
 #endif // pylith_faults_testfaultcohesive_hh
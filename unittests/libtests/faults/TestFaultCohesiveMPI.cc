@@ -0,0 +1,438 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "TestFaultCohesiveMPI.hh" // Implementation of class methods
+
+#include "pylith/faults/FaultCohesiveTract.hh" // USES FaultCohesiveTract
+
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/Distributor.hh" // USES Distributor
+#include "pylith/topology/Stratum.hh" // USES Stratum
+#include "pylith/topology/CoordsVisitor.hh" // USES CoordsVisitor
+
+#include "pylith/meshio/MeshIOAscii.hh" // USES MeshIOAscii
+
+#include <algorithm> // USES std::sort()
+#include <stdexcept> // USES std::runtime_error
+
+// ----------------------------------------------------------------------
+CPPUNIT_TEST_SUITE_REGISTRATION( pylith::faults::TestFaultCohesiveMPI );
+
+// ----------------------------------------------------------------------
+const int pylith::faults::TestFaultCohesiveMPI::_signatureSize = 5;
+
+// ----------------------------------------------------------------------
+// Test adjustTopologyAll() after distributing mesh.
+void
+pylith::faults::TestFaultCohesiveMPI::testAdjustTopologyDistributed(void)
+{ // testAdjustTopologyDistributed
+  PYLITH_METHOD_BEGIN;
+
+  topology::Mesh meshSerial;
+  _createMesh(&meshSerial, true);
+
+  topology::Mesh meshDist;
+  _createMesh(&meshDist, false);
+  _insertFault(&meshDist, NULL);
+
+  int commSize = 0;
+  PetscErrorCode err = MPI_Comm_size(meshDist.comm(), &commSize);PYLITH_CHECK_ERROR(err);
+  CPPUNIT_ASSERT(commSize > 1);
+
+  // Fault must cross the boundary between partitions, so more than
+  // one process inserts cohesive cells.
+  PetscDM dmMesh = meshDist.dmMesh();CPPUNIT_ASSERT(dmMesh);
+  PetscInt cMax = 0, cEnd = 0;
+  err = DMPlexGetHeightStratum(dmMesh, 0, NULL, &cEnd);PYLITH_CHECK_ERROR(err);
+  err = DMPlexGetHybridBounds(dmMesh, &cMax, NULL, NULL, NULL);PYLITH_CHECK_ERROR(err);
+  int hasCohesive = (cMax >= 0 && cEnd > cMax) ? 1 : 0;
+  int numProcsCohesive = 0;
+  err = MPI_Allreduce(&hasCohesive, &numProcsCohesive, 1, MPI_INT, MPI_SUM, meshDist.comm());PYLITH_CHECK_ERROR(err);
+  CPPUNIT_ASSERT(numProcsCohesive > 1);
+
+  // Owned points in each stratum (includes number of cohesive cells
+  // and copies of split vertices).
+  std::vector<int> numPointsE;
+  _numOwnedPoints(&numPointsE, meshSerial);
+  std::vector<int> numPoints;
+  _numOwnedPoints(&numPoints, meshDist);
+  CPPUNIT_ASSERT_EQUAL(numPointsE.size(), numPoints.size());
+  for (size_t i=0; i < numPoints.size(); ++i) {
+    CPPUNIT_ASSERT_EQUAL(numPointsE[i], numPoints[i]);
+  } // for
+
+  // Vertices in cones of cohesive cells.
+  std::vector<std::vector<double> > signaturesE;
+  _cohesiveSignatures(&signaturesE, meshSerial);
+  std::vector<std::vector<double> > signatures;
+  _cohesiveSignatures(&signatures, meshDist);
+  const size_t numCohesiveE = 2;
+  CPPUNIT_ASSERT_EQUAL(numCohesiveE, signaturesE.size());
+  CPPUNIT_ASSERT_EQUAL(numCohesiveE, signatures.size());
+  const double tolerance = 1.0e-06;
+  for (size_t i=0; i < numCohesiveE; ++i) {
+    CPPUNIT_ASSERT_EQUAL(signaturesE[i].size(), signatures[i].size());
+    for (size_t j=0; j < signatures[i].size(); ++j) {
+      CPPUNIT_ASSERT_DOUBLES_EQUAL(signaturesE[i][j], signatures[i][j], tolerance);
+    } // for
+  } // for
+
+  // Copies of shared points, including the two copies of split
+  // vertices, match the points owned by other processes.
+  _checkPointSF(meshSerial);
+  _checkPointSF(meshDist);
+
+  PYLITH_METHOD_END;
+} // testAdjustTopologyDistributed
+
+// ----------------------------------------------------------------------
+// Test missing label for buried edges.
+void
+pylith::faults::TestFaultCohesiveMPI::testMissingEdgeLabel(void)
+{ // testMissingEdgeLabel
+  PYLITH_METHOD_BEGIN;
+
+  topology::Mesh mesh;
+  _createMesh(&mesh, false);
+
+  bool caught = false;
+  try {
+    _insertFault(&mesh, "missing edge");
+  } catch (const std::runtime_error& err) {
+    caught = true;
+  } // try/catch
+
+  // Every process must throw; a process that does not would hang in
+  // the next collective operation.
+  int caughtLocal = caught ? 1 : 0;
+  int caughtAll = 0;
+  PetscErrorCode err = MPI_Allreduce(&caughtLocal, &caughtAll, 1, MPI_INT, MPI_MIN, mesh.comm());PYLITH_CHECK_ERROR(err);
+  CPPUNIT_ASSERT_EQUAL(1, caughtAll);
+
+  PYLITH_METHOD_END;
+} // testMissingEdgeLabel
+
+// ----------------------------------------------------------------------
+// Read mesh and distribute it.
+void
+pylith::faults::TestFaultCohesiveMPI::_createMesh(topology::Mesh* mesh,
+						  const bool insertFirst)
+{ // _createMesh
+  PYLITH_METHOD_BEGIN;
+
+  CPPUNIT_ASSERT(mesh);
+
+  // Simple partitioner puts the bottom cells and the top cells on
+  // different processes, so the fault crosses the boundary between
+  // partitions.
+  topology::Mesh meshOrig;
+  meshio::MeshIOAscii iohandler;
+  iohandler.filename("data/fourquad4.mesh");
+  iohandler.debug(false);
+  iohandler.read(&meshOrig);
+
+  if (insertFirst) {
+    _insertFault(&meshOrig, NULL);
+  } // if
+  topology::Distributor::distribute(mesh, meshOrig, "simple");
+
+  PYLITH_METHOD_END;
+} // _createMesh
+
+// ----------------------------------------------------------------------
+// Insert cohesive cells for fault.
+void
+pylith::faults::TestFaultCohesiveMPI::_insertFault(topology::Mesh* mesh,
+						   const char* edge)
+{ // _insertFault
+  PYLITH_METHOD_BEGIN;
+
+  CPPUNIT_ASSERT(mesh);
+
+  FaultCohesiveTract fault;
+  fault.id(100);
+  fault.label("fault");
+  if (edge) {
+    fault.edge(edge);
+  } // if
+
+  FaultCohesive* faults[1] = { &fault };
+  FaultCohesive::adjustTopologyAll(mesh, faults, 1);
+
+  PYLITH_METHOD_END;
+} // _insertFault
+
+// ----------------------------------------------------------------------
+// Get global number of owned points in each depth stratum.
+void
+pylith::faults::TestFaultCohesiveMPI::_numOwnedPoints(std::vector<int>* numPoints,
+						      const topology::Mesh& mesh)
+{ // _numOwnedPoints
+  PYLITH_METHOD_BEGIN;
+
+  CPPUNIT_ASSERT(numPoints);
+
+  PetscDM dmMesh = mesh.dmMesh();CPPUNIT_ASSERT(dmMesh);
+  PetscErrorCode err;
+
+  PetscInt pStart = 0, pEnd = 0;
+  err = DMPlexGetChart(dmMesh, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+  std::vector<bool> isLeaf(pEnd-pStart, false);
+  PetscSF pointSF = NULL;
+  PetscInt numRoots = 0, numLeaves = 0;
+  const PetscInt* leaves = NULL;
+  err = DMGetPointSF(dmMesh, &pointSF);PYLITH_CHECK_ERROR(err);
+  err = PetscSFGetGraph(pointSF, &numRoots, &numLeaves, &leaves, NULL);PYLITH_CHECK_ERROR(err);
+  for (PetscInt i=0; numRoots >= 0 && i < numLeaves; ++i) {
+    isLeaf[(leaves ? leaves[i] : i)-pStart] = true;
+  } // for
+
+  PetscInt depth = 0;
+  err = DMPlexGetDepth(dmMesh, &depth);PYLITH_CHECK_ERROR(err);
+  std::vector<int> numPointsLocal(depth+1, 0);
+  for (PetscInt d=0; d <= depth; ++d) {
+    PetscInt dStart = 0, dEnd = 0;
+    err = DMPlexGetDepthStratum(dmMesh, d, &dStart, &dEnd);PYLITH_CHECK_ERROR(err);
+    for (PetscInt p=dStart; p < dEnd; ++p) {
+      numPointsLocal[d] += isLeaf[p-pStart] ? 0 : 1;
+    } // for
+  } // for
+
+  numPoints->resize(depth+1);
+  err = MPI_Allreduce(&numPointsLocal[0], &(*numPoints)[0], depth+1, MPI_INT, MPI_SUM, mesh.comm());PYLITH_CHECK_ERROR(err);
+
+  PYLITH_METHOD_END;
+} // _numOwnedPoints
+
+// ----------------------------------------------------------------------
+// Get signatures of owned cohesive cells on all processes.
+void
+pylith::faults::TestFaultCohesiveMPI::_cohesiveSignatures(std::vector<std::vector<double> >* signatures,
+							  const topology::Mesh& mesh)
+{ // _cohesiveSignatures
+  PYLITH_METHOD_BEGIN;
+
+  CPPUNIT_ASSERT(signatures);
+
+  PetscDM dmMesh = mesh.dmMesh();CPPUNIT_ASSERT(dmMesh);
+  PetscErrorCode err;
+
+  std::vector<double> pointSignatures;
+  _pointSignatures(&pointSignatures, dmMesh);
+
+  PetscInt pStart = 0, pEnd = 0, cMax = 0, cEnd = 0;
+  err = DMPlexGetChart(dmMesh, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+  err = DMPlexGetHeightStratum(dmMesh, 0, NULL, &cEnd);PYLITH_CHECK_ERROR(err);
+  err = DMPlexGetHybridBounds(dmMesh, &cMax, NULL, NULL, NULL);PYLITH_CHECK_ERROR(err);
+  if (cMax < 0) {
+    cMax = cEnd;
+  } // if
+
+  std::vector<bool> isLeaf(pEnd-pStart, false);
+  PetscSF pointSF = NULL;
+  PetscInt numRoots = 0, numLeaves = 0;
+  const PetscInt* leaves = NULL;
+  err = DMGetPointSF(dmMesh, &pointSF);PYLITH_CHECK_ERROR(err);
+  err = PetscSFGetGraph(pointSF, &numRoots, &numLeaves, &leaves, NULL);PYLITH_CHECK_ERROR(err);
+  for (PetscInt i=0; numRoots >= 0 && i < numLeaves; ++i) {
+    isLeaf[(leaves ? leaves[i] : i)-pStart] = true;
+  } // for
+
+  // Signature of cohesive cell is signatures of the two faces in its
+  // cone.
+  const int cellSignatureSize = 2*_signatureSize;
+  std::vector<double> localSignatures;
+  for (PetscInt c=cMax; c < cEnd; ++c) {
+    if (isLeaf[c-pStart]) {
+      continue;
+    } // if
+    const PetscInt* cone = NULL;
+    PetscInt coneSize = 0;
+    err = DMPlexGetConeSize(dmMesh, c, &coneSize);PYLITH_CHECK_ERROR(err);
+    err = DMPlexGetCone(dmMesh, c, &cone);PYLITH_CHECK_ERROR(err);
+    CPPUNIT_ASSERT(coneSize >= 2);
+    for (int iFace=0; iFace < 2; ++iFace) {
+      for (int i=0; i < _signatureSize; ++i) {
+	localSignatures.push_back(pointSignatures[(cone[iFace]-pStart)*_signatureSize+i]);
+      } // for
+    } // for
+  } // for
+
+  // Gather signatures from all processes.
+  int commSize = 0;
+  err = MPI_Comm_size(mesh.comm(), &commSize);PYLITH_CHECK_ERROR(err);
+  int localSize = localSignatures.size();
+  std::vector<int> sizes(commSize);
+  err = MPI_Allgather(&localSize, 1, MPI_INT, &sizes[0], 1, MPI_INT, mesh.comm());PYLITH_CHECK_ERROR(err);
+  std::vector<int> offsets(commSize, 0);
+  for (int i=1; i < commSize; ++i) {
+    offsets[i] = offsets[i-1] + sizes[i-1];
+  } // for
+  const int globalSize = offsets[commSize-1] + sizes[commSize-1];
+  std::vector<double> globalSignatures(globalSize > 0 ? globalSize : 1);
+  err = MPI_Allgatherv(localSize > 0 ? &localSignatures[0] : NULL, localSize, MPI_DOUBLE,
+		       &globalSignatures[0], &sizes[0], &offsets[0], MPI_DOUBLE, mesh.comm());PYLITH_CHECK_ERROR(err);
+
+  const int numCells = globalSize / cellSignatureSize;
+  signatures->resize(numCells);
+  for (int iCell=0; iCell < numCells; ++iCell) {
+    (*signatures)[iCell].assign(globalSignatures.begin()+iCell*cellSignatureSize,
+				globalSignatures.begin()+(iCell+1)*cellSignatureSize);
+  } // for
+  std::sort(signatures->begin(), signatures->end());
+
+  PYLITH_METHOD_END;
+} // _cohesiveSignatures
+
+// ----------------------------------------------------------------------
+// Check signatures of shared points.
+void
+pylith::faults::TestFaultCohesiveMPI::_checkPointSF(const topology::Mesh& mesh)
+{ // _checkPointSF
+  PYLITH_METHOD_BEGIN;
+
+  PetscDM dmMesh = mesh.dmMesh();CPPUNIT_ASSERT(dmMesh);
+  PetscErrorCode err;
+
+  std::vector<double> signatures;
+  _pointSignatures(&signatures, dmMesh);
+
+  PetscSF pointSF = NULL;
+  PetscInt numRoots = 0, numLeaves = 0;
+  const PetscInt* leaves = NULL;
+  err = DMGetPointSF(dmMesh, &pointSF);PYLITH_CHECK_ERROR(err);
+  err = PetscSFGetGraph(pointSF, &numRoots, &numLeaves, &leaves, NULL);PYLITH_CHECK_ERROR(err);
+  CPPUNIT_ASSERT(numRoots >= 0);
+
+  PetscInt pStart = 0, pEnd = 0;
+  err = DMPlexGetChart(dmMesh, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+  CPPUNIT_ASSERT_EQUAL(PetscInt(0), pStart);
+
+  MPI_Datatype signatureType;
+  err = MPI_Type_contiguous(_signatureSize, MPI_DOUBLE, &signatureType);PYLITH_CHECK_ERROR(err);
+  err = MPI_Type_commit(&signatureType);PYLITH_CHECK_ERROR(err);
+  std::vector<double> rootSignatures(signatures.size() > 0 ? signatures.size() : 1, 0.0);
+  double* signaturesArray = signatures.size() > 0 ? &signatures[0] : NULL;
+  err = PetscSFBroadcastBegin(pointSF, signatureType, signaturesArray, &rootSignatures[0]);PYLITH_CHECK_ERROR(err);
+  err = PetscSFBroadcastEnd(pointSF, signatureType, signaturesArray, &rootSignatures[0]);PYLITH_CHECK_ERROR(err);
+  err = MPI_Type_free(&signatureType);PYLITH_CHECK_ERROR(err);
+
+  const double tolerance = 1.0e-06;
+  for (PetscInt i=0; i < numLeaves; ++i) {
+    const PetscInt leaf = leaves ? leaves[i] : i;
+    for (int j=0; j < _signatureSize; ++j) {
+      const size_t index = leaf*_signatureSize+j;
+      CPPUNIT_ASSERT_DOUBLES_EQUAL(rootSignatures[index], signatures[index], tolerance);
+    } // for
+  } // for
+
+  PYLITH_METHOD_END;
+} // _checkPointSF
+
+// ----------------------------------------------------------------------
+// Compute signature of each point in mesh.
+void
+pylith::faults::TestFaultCohesiveMPI::_pointSignatures(std::vector<double>* signatures,
+						       PetscDM dm)
+{ // _pointSignatures
+  PYLITH_METHOD_BEGIN;
+
+  CPPUNIT_ASSERT(signatures);
+  CPPUNIT_ASSERT(dm);
+
+  PetscErrorCode err;
+  PetscInt pStart = 0, pEnd = 0, cMax = 0;
+  err = DMPlexGetChart(dm, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+  err = DMPlexGetHybridBounds(dm, &cMax, NULL, NULL, NULL);PYLITH_CHECK_ERROR(err);
+
+  topology::Stratum cellsStratum(dm, topology::Stratum::HEIGHT, 0);
+  const PetscInt cStart = cellsStratum.begin();
+  if (cMax < 0) {
+    cMax = cellsStratum.end();
+  } // if
+  topology::Stratum verticesStratum(dm, topology::Stratum::DEPTH, 0);
+  const PetscInt vStart = verticesStratum.begin();
+  const PetscInt vEnd = verticesStratum.end();
+
+  topology::CoordsVisitor coordsVisitor(dm);
+  const PetscScalar* coordsArray = coordsVisitor.localArray();
+  const int spaceDim = (vEnd > vStart) ? coordsVisitor.sectionDof(vStart) : 0;
+  CPPUNIT_ASSERT(spaceDim+2 <= _signatureSize);
+
+  // Side of each vertex relative to the local cells in its star.
+  std::vector<int> sides(vEnd-vStart, 0);
+  for (PetscInt v=vStart; v < vEnd; ++v) {
+    const PetscInt voff = coordsVisitor.sectionOffset(v);
+    PetscInt* star = NULL;
+    PetscInt starSize = 0;
+    double offset = 0.0;
+    err = DMPlexGetTransitiveClosure(dm, v, PETSC_FALSE, &starSize, &star);PYLITH_CHECK_ERROR(err);
+    for (PetscInt s=0; s < starSize*2; s += 2) {
+      const PetscInt cell = star[s];
+      if (cell < cStart || cell >= cMax) {
+	continue;
+      } // if
+      PetscInt* closure = NULL;
+      PetscInt closureSize = 0, numCorners = 0;
+      double centroid = 0.0;
+      err = DMPlexGetTransitiveClosure(dm, cell, PETSC_TRUE, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
+      for (PetscInt c=0; c < closureSize*2; c += 2) {
+	if (closure[c] >= vStart && closure[c] < vEnd) {
+	  centroid += coordsArray[coordsVisitor.sectionOffset(closure[c])];
+	  ++numCorners;
+	} // if
+      } // for
+      err = DMPlexRestoreTransitiveClosure(dm, cell, PETSC_TRUE, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
+      CPPUNIT_ASSERT(numCorners > 0);
+      offset += centroid / numCorners - coordsArray[voff];
+    } // for
+    err = DMPlexRestoreTransitiveClosure(dm, v, PETSC_FALSE, &starSize, &star);PYLITH_CHECK_ERROR(err);
+    sides[v-vStart] = (offset > 1.0e-06) ? 1 : ((offset < -1.0e-06) ? -1 : 0);
+  } // for
+
+  signatures->resize((pEnd-pStart)*_signatureSize);
+  for (PetscInt p=pStart; p < pEnd; ++p) {
+    double* sig = &(*signatures)[(p-pStart)*_signatureSize];
+    for (int i=0; i < _signatureSize; ++i) {
+      sig[i] = 0.0;
+    } // for
+    PetscInt* closure = NULL;
+    PetscInt closureSize = 0;
+    err = DMPlexGetTransitiveClosure(dm, p, PETSC_TRUE, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
+    for (PetscInt c=0; c < closureSize*2; c += 2) {
+      const PetscInt v = closure[c];
+      if (v < vStart || v >= vEnd) {
+	continue;
+      } // if
+      const PetscInt off = coordsVisitor.sectionOffset(v);
+      for (int d=0; d < spaceDim; ++d) {
+	sig[d] += coordsArray[off+d];
+      } // for
+      sig[_signatureSize-2] += sides[v-vStart];
+      sig[_signatureSize-1] += 1.0;
+    } // for
+    err = DMPlexRestoreTransitiveClosure(dm, p, PETSC_TRUE, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
+  } // for
+
+  PYLITH_METHOD_END;
+} // _pointSignatures
+
+
+// End of file
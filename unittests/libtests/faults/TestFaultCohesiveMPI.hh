@@ -0,0 +1,149 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+/**
+ * @file unittests/libtests/faults/TestFaultCohesiveMPI.hh
+ *
+ * @brief C++ unit testing for inserting cohesive cells in a
+ * distributed mesh.
+ *
+ * Run on 2 or more processes.
+ */
+
+#if !defined(pylith_faults_testfaultcohesivempi_hh)
+#define pylith_faults_testfaultcohesivempi_hh
+
+// Include directives ---------------------------------------------------
+#include <cppunit/extensions/HelperMacros.h>
+
+#include "pylith/topology/topologyfwd.hh" // forward declarations
+#include "pylith/utils/petscfwd.h" // USES PetscDM
+
+#include <vector> // USES std::vector
+
+// Forward declarations -------------------------------------------------
+/// Namespace for pylith package
+namespace pylith {
+  namespace faults {
+    class TestFaultCohesiveMPI;
+  } // faults
+} // pylith
+
+// TestFaultCohesiveMPI -------------------------------------------------
+/// C++ unit testing for inserting cohesive cells in a distributed mesh.
+class pylith::faults::TestFaultCohesiveMPI : public CppUnit::TestFixture
+{ // class TestFaultCohesiveMPI
+
+  // CPPUNIT TEST SUITE /////////////////////////////////////////////////
+  CPPUNIT_TEST_SUITE( TestFaultCohesiveMPI );
+
+  CPPUNIT_TEST( testAdjustTopologyDistributed );
+  CPPUNIT_TEST( testMissingEdgeLabel );
+
+  CPPUNIT_TEST_SUITE_END();
+
+  // PUBLIC METHODS /////////////////////////////////////////////////////
+public :
+
+  /** Test adjustTopologyAll() after distributing a mesh with a fault
+   * that crosses the boundary between partitions against inserting
+   * the fault before distributing the mesh.
+   */
+  void testAdjustTopologyDistributed(void);
+
+  /** Test that a missing label for buried edges raises an exception
+   * on all processes.
+   */
+  void testMissingEdgeLabel(void);
+
+  // PRIVATE METHODS ////////////////////////////////////////////////////
+private :
+
+  /** Read mesh and distribute it.
+   *
+   * @param mesh Distributed mesh (output).
+   * @param insertFirst True if inserting fault before distributing
+   *   mesh, false if caller inserts fault into distributed mesh.
+   */
+  static
+  void _createMesh(topology::Mesh* mesh,
+		   const bool insertFirst);
+
+  /** Insert cohesive cells for fault.
+   *
+   * @param mesh Finite-element mesh.
+   * @param edge Label for buried edges of fault (NULL if none).
+   */
+  static
+  void _insertFault(topology::Mesh* mesh,
+		    const char* edge);
+
+  /** Get global number of owned points in each depth stratum.
+   *
+   * @param numPoints Global number of owned points in each stratum (output).
+   * @param mesh Finite-element mesh.
+   */
+  static
+  void _numOwnedPoints(std::vector<int>* numPoints,
+		       const topology::Mesh& mesh);
+
+  /** Get signatures of owned cohesive cells on all processes, sorted.
+   *
+   * The signature of a cohesive cell is the signature of each of the
+   * two faces in its cone.
+   *
+   * @param signatures Signatures of cohesive cells (output).
+   * @param mesh Finite-element mesh.
+   */
+  static
+  void _cohesiveSignatures(std::vector<std::vector<double> >* signatures,
+			   const topology::Mesh& mesh);
+
+  /** Check that each point shared among processes has the same
+   * signature on the process that owns it and on every process with
+   * a copy.
+   *
+   * @param mesh Finite-element mesh.
+   */
+  static
+  void _checkPointSF(const topology::Mesh& mesh);
+
+  /** Compute signature of each point in mesh.
+   *
+   * The signature is the sum of the coordinates of the vertices in
+   * the closure of the point, the sum of their sides of the fault, and
+   * the number of vertices. The side of a vertex is the sign of the
+   * sum of the offsets of the centroids of the local (non-cohesive)
+   * cells in its star, so the two copies of a split vertex have
+   * different signatures.
+   *
+   * @param signatures Signature of each point (output).
+   * @param dm PETSc DM for mesh.
+   */
+  static
+  void _pointSignatures(std::vector<double>* signatures,
+			PetscDM dm);
+
+  static const int _signatureSize; ///< Size of signature of point.
+
+}; // class TestFaultCohesiveMPI
+
+#endif // pylith_faults_testfaultcohesivempi_hh
+
+
+// End of file
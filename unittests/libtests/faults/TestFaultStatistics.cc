@@ -0,0 +1,261 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "TestFaultStatistics.hh" // Implementation of class methods
+
+#include "pylith/faults/FaultStatistics.hh" // USES FaultStatistics
+
+#include "pylith/utils/error.h" // USES PYLITH_METHOD_BEGIN/END
+
+#include <cmath> // USES pow()
+#include <stdexcept> // USES std::runtime_error
+
+// ----------------------------------------------------------------------
+CPPUNIT_TEST_SUITE_REGISTRATION( pylith::faults::TestFaultStatistics );
+
+// ----------------------------------------------------------------------
+namespace pylith {
+  namespace faults {
+    namespace _TestFaultStatistics {
+      const int numVertices = 3;
+      const PylithScalar area[numVertices] = { 1.0, 2.0, 3.0 };
+      const PylithScalar shearModulus = 10.0;
+    } // namespace _TestFaultStatistics
+  } // faults
+} // pylith
+
+// ----------------------------------------------------------------------
+// Test constructor.
+void
+pylith::faults::TestFaultStatistics::testConstructor(void)
+{ // testConstructor
+  PYLITH_METHOD_BEGIN;
+
+  FaultStatistics stats;
+
+  CPPUNIT_ASSERT_EQUAL(-1, stats.stepStats().eventId);
+  CPPUNIT_ASSERT_EQUAL(size_t(0), stats.eventStats().size());
+
+  PYLITH_METHOD_END;
+} // testConstructor
+
+// ----------------------------------------------------------------------
+// Test slipRateThreshold().
+void
+pylith::faults::TestFaultStatistics::testSlipRateThreshold(void)
+{ // testSlipRateThreshold
+  PYLITH_METHOD_BEGIN;
+
+  FaultStatistics stats;
+  CPPUNIT_ASSERT_EQUAL(PylithScalar(0.0), stats._slipRateThreshold);
+
+  const PylithScalar value = 1.0e-3;
+  stats.slipRateThreshold(value);
+  CPPUNIT_ASSERT_EQUAL(value, stats._slipRateThreshold);
+
+  CPPUNIT_ASSERT_THROW(stats.slipRateThreshold(-1.0), std::runtime_error);
+
+  PYLITH_METHOD_END;
+} // testSlipRateThreshold
+
+// ----------------------------------------------------------------------
+// Test filename().
+void
+pylith::faults::TestFaultStatistics::testFilename(void)
+{ // testFilename
+  PYLITH_METHOD_BEGIN;
+
+  FaultStatistics stats;
+  CPPUNIT_ASSERT_EQUAL(std::string(""), stats._filename);
+
+  const std::string& filename = "output/fault_stats.txt";
+  stats.filename(filename.c_str());
+  CPPUNIT_ASSERT_EQUAL(filename, stats._filename);
+
+  PYLITH_METHOD_END;
+} // testFilename
+
+// ----------------------------------------------------------------------
+// Test momentMagnitude().
+void
+pylith::faults::TestFaultStatistics::testMomentMagnitude(void)
+{ // testMomentMagnitude
+  PYLITH_METHOD_BEGIN;
+
+  const double tolerance = 1.0e-6;
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(6.0, FaultStatistics::momentMagnitude(pow(10.0, 18.05)), tolerance);
+  CPPUNIT_ASSERT(FaultStatistics::momentMagnitude(0.0) < -1.0e+10);
+
+  PYLITH_METHOD_END;
+} // testMomentMagnitude
+
+// ----------------------------------------------------------------------
+// Test accumulate() and update() with event detection.
+void
+pylith::faults::TestFaultStatistics::testUpdate(void)
+{ // testUpdate
+  PYLITH_METHOD_BEGIN;
+
+  const double tolerance = 1.0e-6;
+
+  FaultStatistics stats;
+  stats.slipRateThreshold(0.1);
+  _setupVertices(&stats);
+
+  { // No slip.
+    const PylithScalar slip[3] = { 0.0, 0.0, 0.0 };
+    const PylithScalar slipRate[3] = { 0.0, 0.0, 0.0 };
+    _step(&stats, 1.0, slip, slipRate);
+    const FaultStatistics::Stats& s = stats.stepStats();
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, s.t, tolerance);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(0.0, s.ruptureArea, tolerance);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(0.0, s.potency, tolerance);
+    CPPUNIT_ASSERT_EQUAL(-1, s.eventId);
+  } // No slip
+
+  { // Event 0 starts at vertex 0.
+    const PylithScalar slip[3] = { 0.5, 0.0, 0.0 };
+    const PylithScalar slipRate[3] = { 1.0, 0.0, 0.0 };
+    _step(&stats, 2.0, slip, slipRate);
+    const FaultStatistics::Stats& s = stats.stepStats();
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, s.ruptureArea, tolerance);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(0.5, s.potency, tolerance);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(5.0, s.moment, tolerance);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, s.peakSlipRate, tolerance);
+    CPPUNIT_ASSERT_EQUAL(0, s.eventId);
+  } // Event 0 starts
+
+  { // Event 0 spreads to vertex 1 (slip rate at vertex 2 below threshold).
+    const PylithScalar slip[3] = { 1.0, 0.5, 0.0 };
+    const PylithScalar slipRate[3] = { 0.5, 0.5, 0.05 };
+    _step(&stats, 3.0, slip, slipRate);
+    const FaultStatistics::Stats& s = stats.stepStats();
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(3.0, s.ruptureArea, tolerance);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(2.0, s.potency, tolerance);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(20.0, s.moment, tolerance);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(0.5, s.peakSlipRate, tolerance);
+    CPPUNIT_ASSERT_EQUAL(0, s.eventId);
+  } // Event 0 spreads
+
+  { // Event 0 ends.
+    const PylithScalar slip[3] = { 1.0, 0.5, 0.0 };
+    const PylithScalar slipRate[3] = { 0.0, 0.0, 0.0 };
+    _step(&stats, 4.0, slip, slipRate);
+    CPPUNIT_ASSERT_EQUAL(-1, stats.stepStats().eventId);
+
+    CPPUNIT_ASSERT_EQUAL(size_t(1), stats.eventStats().size());
+    const FaultStatistics::Stats& e = stats.eventStats()[0];
+    CPPUNIT_ASSERT_EQUAL(0, e.eventId);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(2.0, e.t, tolerance);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, e.duration, tolerance);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(3.0, e.ruptureArea, tolerance);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(2.0, e.potency, tolerance);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(20.0, e.moment, tolerance);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, e.peakSlipRate, tolerance);
+  } // Event 0 ends
+
+  { // Event 1 uses slip relative to end of event 0.
+    const PylithScalar slip[3] = { 1.5, 0.5, 0.0 };
+    const PylithScalar slipRate[3] = { 0.2, 0.0, 0.0 };
+    _step(&stats, 5.0, slip, slipRate);
+    CPPUNIT_ASSERT_EQUAL(1, stats.stepStats().eventId);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(2.5, stats.stepStats().potency, tolerance);
+  } // Event 1
+
+  // Event in progress is recorded when statistics are deallocated.
+  stats.deallocate();
+  CPPUNIT_ASSERT_EQUAL(size_t(2), stats.eventStats().size());
+  const FaultStatistics::Stats& e = stats.eventStats()[1];
+  CPPUNIT_ASSERT_EQUAL(1, e.eventId);
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(5.0, e.t, tolerance);
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, e.ruptureArea, tolerance);
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(0.5, e.potency, tolerance);
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(5.0, e.moment, tolerance);
+
+  PYLITH_METHOD_END;
+} // testUpdate
+
+// ----------------------------------------------------------------------
+// Test accumulate() and update() without event detection.
+void
+pylith::faults::TestFaultStatistics::testUpdateNoEvents(void)
+{ // testUpdateNoEvents
+  PYLITH_METHOD_BEGIN;
+
+  const double tolerance = 1.0e-6;
+
+  FaultStatistics stats;
+  _setupVertices(&stats);
+
+  const PylithScalar slip[3] = { 0.5, 0.0, 1.0 };
+  const PylithScalar slipRate[3] = { 1.0, 0.0, 2.0 };
+  _step(&stats, 1.0, slip, slipRate);
+
+  const FaultStatistics::Stats& s = stats.stepStats();
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(4.0, s.ruptureArea, tolerance);
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(3.5, s.potency, tolerance);
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(35.0, s.moment, tolerance);
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(2.0, s.peakSlipRate, tolerance);
+  CPPUNIT_ASSERT_EQUAL(-1, s.eventId);
+
+  stats.deallocate();
+  CPPUNIT_ASSERT_EQUAL(size_t(0), stats.eventStats().size());
+
+  PYLITH_METHOD_END;
+} // testUpdateNoEvents
+
+// ----------------------------------------------------------------------
+// Setup area and shear modulus of vertices without a mesh.
+void
+pylith::faults::TestFaultStatistics::_setupVertices(FaultStatistics* stats)
+{ // _setupVertices
+  CPPUNIT_ASSERT(stats);
+
+  const int numVertices = _TestFaultStatistics::numVertices;
+  stats->_area.resize(numVertices);
+  stats->_areaMu.resize(numVertices);
+  for (int i=0; i < numVertices; ++i) {
+    stats->_area[i] = _TestFaultStatistics::area[i];
+    stats->_areaMu[i] = _TestFaultStatistics::area[i] * _TestFaultStatistics::shearModulus;
+  } // for
+  stats->_slip.resize(numVertices);
+  stats->_slip = 0.0;
+  stats->_slipStart.resize(numVertices);
+  stats->_slipStart = 0.0;
+  stats->_ruptured.assign(numVertices, false);
+} // _setupVertices
+
+// ----------------------------------------------------------------------
+// Accumulate values at vertices and update statistics.
+void
+pylith::faults::TestFaultStatistics::_step(FaultStatistics* stats,
+					   const PylithScalar t,
+					   const PylithScalar* slip,
+					   const PylithScalar* slipRate)
+{ // _step
+  CPPUNIT_ASSERT(stats);
+
+  for (int i=0; i < _TestFaultStatistics::numVertices; ++i)
+    stats->accumulate(i, slip[i], slipRate[i]);
+  stats->update(t);
+} // _step
+
+
+// End of file 
@@ -0,0 +1,105 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+/**
+ * @file unittests/libtests/faults/TestFaultStatistics.hh
+ *
+ * @brief C++ TestFaultStatistics object
+ *
+ * C++ unit testing for FaultStatistics.
+ */
+
+#if !defined(pylith_faults_testfaultstatistics_hh)
+#define pylith_faults_testfaultstatistics_hh
+
+#include "pylith/faults/faultsfwd.hh" // USES FaultStatistics
+#include "pylith/utils/types.hh" // USES PylithScalar
+
+#include <cppunit/extensions/HelperMacros.h>
+
+/// Namespace for pylith package
+namespace pylith {
+  namespace faults {
+    class TestFaultStatistics;
+  } // faults
+} // pylith
+
+/// C++ unit testing for FaultStatistics
+class pylith::faults::TestFaultStatistics : public CppUnit::TestFixture
+{ // class TestFaultStatistics
+
+  // CPPUNIT TEST SUITE /////////////////////////////////////////////////
+  CPPUNIT_TEST_SUITE( TestFaultStatistics );
+
+  CPPUNIT_TEST( testConstructor );
+  CPPUNIT_TEST( testSlipRateThreshold );
+  CPPUNIT_TEST( testFilename );
+  CPPUNIT_TEST( testMomentMagnitude );
+  CPPUNIT_TEST( testUpdate );
+  CPPUNIT_TEST( testUpdateNoEvents );
+
+  CPPUNIT_TEST_SUITE_END();
+
+  // PUBLIC METHODS /////////////////////////////////////////////////////
+public :
+
+  /// Test constructor.
+  void testConstructor(void);
+
+  /// Test slipRateThreshold().
+  void testSlipRateThreshold(void);
+
+  /// Test filename().
+  void testFilename(void);
+
+  /// Test momentMagnitude().
+  void testMomentMagnitude(void);
+
+  /// Test accumulate() and update() with event detection.
+  void testUpdate(void);
+
+  /// Test accumulate() and update() without event detection.
+  void testUpdateNoEvents(void);
+
+  // PRIVATE METHODS ////////////////////////////////////////////////////
+private :
+
+  /** Setup area and shear modulus of vertices without a mesh.
+   *
+   * @param stats Fault statistics.
+   */
+  void _setupVertices(FaultStatistics* stats);
+
+  /** Accumulate values at vertices and update statistics.
+   *
+   * @param stats Fault statistics.
+   * @param t Time.
+   * @param slip Slip at vertices.
+   * @param slipRate Slip rate at vertices.
+   */
+  void _step(FaultStatistics* stats,
+	     const PylithScalar t,
+	     const PylithScalar* slip,
+	     const PylithScalar* slipRate);
+
+}; // class TestFaultStatistics
+
+#endif // pylith_faults_testfaultstatistics_hh
+
+
+// End of file 
@@ -0,0 +1,233 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+/** @file unittests/libtests/faults/benchmark_cohesivetopology.cc
+ *
+ * Benchmark insertion of cohesive cells for many faults one fault at
+ * a time (FaultCohesive::adjustTopology()) and for all faults together
+ * (FaultCohesive::adjustTopologyAll()).
+ *
+ * Usage: benchmark_cohesivetopology [NX] [NFAULTS] [NREPEAT]
+ *
+ * Writes 2-D meshes of 2*NX*NX triangular cells with NFAULTS faults
+ * and reports the best time for inserting the cohesive cells with
+ * each approach. In the 'parallel' case the faults are vertical lines
+ * that cut through the domain and do not intersect. In the 'chain'
+ * case the faults are collinear horizontal segments in which each
+ * fault shares an end vertex with the next fault, so
+ * adjustTopologyAll() inserts them in two passes.
+ *
+ * Build with 'make benchmark_cohesivetopology' (not built by 'make check').
+ */
+
+#include <portinfo>
+
+#include "pylith/faults/FaultCohesiveKin.hh" // USES FaultCohesiveKin
+#include "pylith/meshio/MeshIOAscii.hh" // USES MeshIOAscii
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/utils/error.h" // USES PYLITH_CHECK_ERROR
+
+#include <petsc.h>
+#include <petsctime.h> // USES PetscTime()
+#include <Python.h>
+
+#include <cstdio> // USES fopen(), fprintf()
+#include <cstdlib> // USES atoi()
+#include <iostream> // USES std::cout
+#include <iomanip> // USES std::setw()
+#include <sstream> // USES std::ostringstream
+#include <stdexcept> // USES std::runtime_error
+#include <vector> // USES std::vector
+
+// ----------------------------------------------------------------------
+// Write 2-D mesh of triangular cells with faults in PyLith ASCII
+// format. Faults are vertical lines or, if chain is true, a chain of
+// horizontal segments.
+static
+void
+writeMesh(const char* filename,
+	  const int nx,
+	  const int numFaults,
+	  const bool chain)
+{ // writeMesh
+  FILE* fout = fopen(filename, "w");
+  if (!fout)
+    throw std::runtime_error("Could not open benchmark mesh file for writing.");
+
+  const int numVertices = (nx+1)*(nx+1);
+  const int numCells = 2*nx*nx;
+  const double dx = 1.0 / nx;
+
+  fprintf(fout, "mesh = {\n  dimension = 2\n  use-index-zero = true\n");
+  fprintf(fout, "  vertices = {\n    dimension = 2\n    count = %d\n    coordinates = {\n", numVertices);
+  for (int j=0, iVertex=0; j <= nx; ++j)
+    for (int i=0; i <= nx; ++i, ++iVertex)
+      fprintf(fout, "      %8d%18.6e%18.6e\n", iVertex, i*dx, j*dx);
+  fprintf(fout, "    }\n  }\n");
+
+  fprintf(fout, "  cells = {\n    count = %d\n    num-corners = 3\n    simplices = {\n", numCells);
+  for (int j=0, iCell=0; j < nx; ++j)
+    for (int i=0; i < nx; ++i) {
+      const int v0 = j*(nx+1) + i;
+      const int v1 = v0 + 1;
+      const int v2 = v0 + (nx+1);
+      const int v3 = v2 + 1;
+      fprintf(fout, "      %8d%8d%8d%8d\n", iCell++, v0, v1, v3);
+      fprintf(fout, "      %8d%8d%8d%8d\n", iCell++, v0, v3, v2);
+    } // for
+  fprintf(fout, "    }\n    material-ids = {\n");
+  for (int iCell=0; iCell < numCells; ++iCell)
+    fprintf(fout, "      %8d%4d\n", iCell, 1);
+  fprintf(fout, "    }\n  }\n");
+
+  if (chain) {
+    // Faults are segments of the middle row of vertices, and
+    // consecutive faults share an end vertex.
+    const int row = nx / 2;
+    for (int iFault=0; iFault < numFaults; ++iFault) {
+      const int columnBegin = iFault*nx / numFaults;
+      const int columnEnd = (iFault+1)*nx / numFaults;
+      fprintf(fout, "  group = {\n    name = fault%d\n    type = vertices\n    count = %d\n    indices = {\n", iFault, columnEnd-columnBegin+1);
+      for (int i=columnBegin; i <= columnEnd; ++i)
+	fprintf(fout, "      %d\n", row*(nx+1) + i);
+      fprintf(fout, "    }\n  }\n");
+    } // for
+  } else {
+    // Faults are evenly spaced vertical lines of vertices.
+    for (int iFault=0; iFault < numFaults; ++iFault) {
+      const int column = (iFault+1)*nx / (numFaults+1);
+      fprintf(fout, "  group = {\n    name = fault%d\n    type = vertices\n    count = %d\n    indices = {\n", iFault, nx+1);
+      for (int j=0; j <= nx; ++j)
+	fprintf(fout, "      %d\n", j*(nx+1) + column);
+      fprintf(fout, "    }\n  }\n");
+    } // for
+  } // if/else
+  fprintf(fout, "}\n");
+
+  fclose(fout);
+} // writeMesh
+
+// ----------------------------------------------------------------------
+// Get best time for inserting cohesive cells.
+static
+PetscLogDouble
+timeInsert(const char* filename,
+	   const int numFaults,
+	   const bool insertAll,
+	   const int numRepeat,
+	   int* numCells)
+{ // timeInsert
+  pylith::meshio::MeshIOAscii iohandler;
+  iohandler.filename(filename);
+  iohandler.interpolate(true);
+
+  PetscLogDouble best = 0.0;
+  for (int iRepeat=0; iRepeat < numRepeat; ++iRepeat) {
+    pylith::topology::Mesh mesh;
+    iohandler.read(&mesh);
+
+    pylith::faults::FaultCohesiveKin* faults = new pylith::faults::FaultCohesiveKin[numFaults];
+    std::vector<pylith::faults::FaultCohesive*> faultPtrs(numFaults);
+    for (int iFault=0; iFault < numFaults; ++iFault) {
+      std::ostringstream label;
+      label << "fault" << iFault;
+      faults[iFault].id(100+iFault);
+      faults[iFault].label(label.str().c_str());
+      faultPtrs[iFault] = &faults[iFault];
+    } // for
+
+    PetscLogDouble tstart = 0.0, tstop = 0.0;
+    PetscErrorCode err = PetscTime(&tstart);PYLITH_CHECK_ERROR(err);
+    if (insertAll) {
+      pylith::faults::FaultCohesive::adjustTopologyAll(&mesh, numFaults ? &faultPtrs[0] : 0, numFaults);
+    } else {
+      int firstFaultVertex = 0, firstLagrangeVertex = 0, firstFaultCell = 0;
+      for (int iFault=0; iFault < numFaults; ++iFault) {
+	faults[iFault].adjustTopology(&mesh, &firstFaultVertex, &firstLagrangeVertex, &firstFaultCell);
+      } // for
+    } // if/else
+    err = PetscTime(&tstop);PYLITH_CHECK_ERROR(err);
+    if (0 == iRepeat || tstop - tstart < best)
+      best = tstop - tstart;
+    *numCells = mesh.numCells();
+    delete[] faults; faults = 0;
+  } // for
+
+  return best;
+} // timeInsert
+
+// ----------------------------------------------------------------------
+// Write mesh and report times for inserting cohesive cells one fault
+// at a time and all faults together.
+static
+void
+runCase(const char* name,
+	const char* filename,
+	const int nx,
+	const int numFaults,
+	const bool chain,
+	const int numRepeat)
+{ // runCase
+  writeMesh(filename, nx, numFaults, chain);
+
+  int numCellsSeparate = 0, numCellsAll = 0;
+  const PetscLogDouble tSeparate = timeInsert(filename, numFaults, false, numRepeat, &numCellsSeparate);
+  const PetscLogDouble tAll = timeInsert(filename, numFaults, true, numRepeat, &numCellsAll);
+  if (numCellsSeparate != numCellsAll)
+    throw std::runtime_error("Number of cells differs between fault insertion approaches.");
+
+  std::cout
+    << name << ": " << 2*nx*nx << " cells, " << numFaults << " faults, "
+    << numCellsAll << " cells with cohesive cells\n"
+    << std::setw(10) << "separate" << ": " << tSeparate << " s\n"
+    << std::setw(10) << "all" << ": " << tAll << " s\n"
+    << "Speedup: " << tSeparate / tAll << std::endl;
+} // runCase
+
+// ----------------------------------------------------------------------
+int
+main(int argc,
+     char* argv[])
+{ // main
+  const int nx = (argc > 1) ? atoi(argv[1]) : 200;
+  const int numFaults = (argc > 2) ? atoi(argv[2]) : 50;
+  const int numRepeat = (argc > 3) ? atoi(argv[3]) : 3;
+  const char* filename = "benchmark_cohesivetopology.txt";
+
+  PetscErrorCode err = PetscInitialize(&argc, &argv, NULL, NULL);CHKERRQ(err);
+  Py_Initialize();
+
+  try {
+    if (numFaults < 0 || 2*(numFaults+1) > nx)
+      throw std::runtime_error("Number of faults must be nonnegative and less than NX/2.");
+    runCase("parallel", filename, nx, numFaults, false, numRepeat);
+    runCase("chain", filename, nx, numFaults, true, numRepeat);
+  } catch (const std::exception& err) {
+    std::cerr << "Error: " << err.what() << std::endl;
+  } // catch
+
+  remove(filename);
+
+  Py_Finalize();
+  err = PetscFinalize();CHKERRQ(err);
+
+  return 0;
+} // main
+
+
+// End of file
@@ -27,6 +27,7 @@
 #include "pylith/materials/ElasticIsotropic3D.hh" // USES ElasticIsotropic3D
 #include "pylith/feassemble/Quadrature.hh" // USES Quadrature
 #include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/Field.hh" // USES Field
 #include "pylith/topology/MeshOps.hh" // USES MeshOps::nondimensionalize()
 #include "pylith/topology/Stratum.hh" // USES Stratum
 #include "pylith/topology/VisitorMesh.hh" // USES VecVisitorMesh
@@ -40,6 +41,7 @@
 #include "spatialdata/units/Nondimensional.hh" // USES Nondimensional
 
 #include <math.h> // USES fabs()
+#include <algorithm> // USES std::max()
 
 // ----------------------------------------------------------------------
 CPPUNIT_TEST_SUITE_REGISTRATION( pylith::feassemble::TestElasticityImplicit );
@@ -303,6 +305,128 @@ pylith::feassemble::TestElasticityImplicit::testUpdateStateVars(void)
   PYLITH_METHOD_END;
 } // testUpdateStateVars
 
+// ----------------------------------------------------------------------
+// Test updateStateVars() with total strain stored during residual evaluation.
+void 
+pylith::feassemble::TestElasticityImplicit::testUpdateStateVarsStoredStrain(void)
+{ // testUpdateStateVarsStoredStrain
+  PYLITH_METHOD_BEGIN;
+
+  CPPUNIT_ASSERT(_data);
+  CPPUNIT_ASSERT(_material);
+  CPPUNIT_ASSERT(_material->hasStateVars());
+
+  const PylithScalar t = 1.0;
+
+  // Compute total strain from displacement.
+  scalar_array totalStrainE;
+  scalar_array viscousStrainE;
+  { // generic
+    topology::Mesh mesh;
+    ElasticityImplicit integrator;
+    topology::SolutionFields fields(mesh);
+    _initialize(&mesh, &integrator, &fields);
+
+    fields.get("disp(t)").add(fields.get("dispIncr(t->t+dt)"));
+    integrator.updateStateVars(t, &fields);
+
+    _copyValues(&totalStrainE, integrator.cellField("total_strain", mesh, &fields));
+    _copyValues(&viscousStrainE, integrator.cellField("viscous_strain", mesh, &fields));
+  } // generic
+
+  // Use total strain stored during residual evaluation.
+  scalar_array totalStrain;
+  scalar_array viscousStrain;
+  { // stored strain
+    topology::Mesh mesh;
+    ElasticityImplicit integrator;
+    topology::SolutionFields fields(mesh);
+    _initialize(&mesh, &integrator, &fields);
+
+    integrator.storeResidualState(true);
+    topology::Field& residual = fields.get("residual");
+    integrator.integrateResidual(residual, t, &fields);
+    integrator.residualAtSolution(true);
+    CPPUNIT_ASSERT_EQUAL(true, integrator._strainAtSolution);
+
+    fields.get("disp(t)").add(fields.get("dispIncr(t->t+dt)"));
+    integrator.updateStateVars(t, &fields);
+    CPPUNIT_ASSERT_EQUAL(false, integrator._strainAtSolution);
+
+    _copyValues(&totalStrain, integrator.cellField("total_strain", mesh, &fields));
+    _copyValues(&viscousStrain, integrator.cellField("viscous_strain", mesh, &fields));
+  } // stored strain
+
+  _checkValues(totalStrainE, totalStrain);
+  _checkValues(viscousStrainE, viscousStrain);
+
+  PYLITH_METHOD_END;
+} // testUpdateStateVarsStoredStrain
+
+// ----------------------------------------------------------------------
+// Test cellField() for stress and total strain.
+void 
+pylith::feassemble::TestElasticityImplicit::testCellFieldStressStrain(void)
+{ // testCellFieldStressStrain
+  PYLITH_METHOD_BEGIN;
+
+  CPPUNIT_ASSERT(_data);
+  CPPUNIT_ASSERT(_material);
+
+  const PylithScalar t = 1.0;
+  PetscErrorCode err;
+
+  // Compute total strain and stress separately from displacement.
+  scalar_array totalStrainE;
+  scalar_array stressE;
+  { // generic
+    topology::Mesh mesh;
+    ElasticityImplicit integrator;
+    topology::SolutionFields fields(mesh);
+    _initialize(&mesh, &integrator, &fields);
+
+    topology::Field& dispT = fields.get("disp(t)");
+    dispT.add(fields.get("dispIncr(t->t+dt)"));
+    integrator.updateStateVars(t, &fields);
+
+    // Changing the state of the displacement prevents reuse of the
+    // total strain from the state variables.
+    err = PetscObjectStateIncrease((PetscObject) dispT.localVector());PYLITH_CHECK_ERROR(err);
+    _copyValues(&totalStrainE, integrator.cellField("total_strain", mesh, &fields));
+    _copyValues(&stressE, integrator.cellField("stress", mesh, &fields));
+  } // generic
+
+  // Compute stress first, so total strain comes from the same
+  // traversal or from the state variables.
+  scalar_array totalStrain;
+  scalar_array stress;
+  { // fused
+    topology::Mesh mesh;
+    ElasticityImplicit integrator;
+    topology::SolutionFields fields(mesh);
+    _initialize(&mesh, &integrator, &fields);
+
+    topology::Field& dispT = fields.get("disp(t)");
+    dispT.add(fields.get("dispIncr(t->t+dt)"));
+    integrator.updateStateVars(t, &fields);
+    if (_material->hasStateVar("total_strain")) {
+      CPPUNIT_ASSERT_EQUAL(integrator._stateVarsDispState, integrator._fieldState(dispT));
+    } // if
+
+    _copyValues(&stress, integrator.cellField("stress", mesh, &fields));
+    if (!_material->hasStateVar("total_strain")) {
+      CPPUNIT_ASSERT_EQUAL(integrator._tensorCacheDispState, integrator._fieldState(dispT));
+      CPPUNIT_ASSERT_EQUAL(false, integrator._tensorCacheStress);
+    } // if
+    _copyValues(&totalStrain, integrator.cellField("total_strain", mesh, &fields));
+  } // fused
+
+  _checkValues(totalStrainE, totalStrain);
+  _checkValues(stressE, stress);
+
+  PYLITH_METHOD_END;
+} // testCellFieldStressStrain
+
 // ----------------------------------------------------------------------
 // Test StableTimeStep().
 void
@@ -441,5 +565,59 @@ pylith::feassemble::TestElasticityImplicit::_initialize(topology::Mesh* mesh,
   PYLITH_METHOD_END;
 } // _initialize
 
+// ----------------------------------------------------------------------
+// Copy values of local vector of field.
+void
+pylith::feassemble::TestElasticityImplicit::_copyValues(scalar_array* values,
+							const topology::Field& field)
+{ // _copyValues
+  PYLITH_METHOD_BEGIN;
+
+  CPPUNIT_ASSERT(values);
+
+  PetscVec vec = field.localVector();CPPUNIT_ASSERT(vec);
+  PetscInt size = 0;
+  const PetscScalar* array = NULL;
+  PetscErrorCode err;
+  err = VecGetLocalSize(vec, &size);PYLITH_CHECK_ERROR(err);
+  err = VecGetArrayRead(vec, &array);PYLITH_CHECK_ERROR(err);
+  values->resize(size);
+  for (PetscInt i=0; i < size; ++i) {
+    (*values)[i] = array[i];
+  } // for
+  err = VecRestoreArrayRead(vec, &array);PYLITH_CHECK_ERROR(err);
+
+  PYLITH_METHOD_END;
+} // _copyValues
+
+// ----------------------------------------------------------------------
+// Check values against expected values.
+void
+pylith::feassemble::TestElasticityImplicit::_checkValues(const scalar_array& valuesE,
+							 const scalar_array& values)
+{ // _checkValues
+  PYLITH_METHOD_BEGIN;
+
+  const size_t size = valuesE.size();
+  CPPUNIT_ASSERT(size > 0);
+  CPPUNIT_ASSERT_EQUAL(size, values.size());
+
+  // Values are nondimensional, so compare relative to largest value.
+  PylithScalar scale = 0.0;
+  for (size_t i=0; i < size; ++i) {
+    scale = std::max(scale, PylithScalar(fabs(valuesE[i])));
+  } // for
+  if (scale <= 0.0) {
+    scale = 1.0;
+  } // if
+
+  const PylithScalar tolerance = (sizeof(double) == sizeof(PylithScalar)) ? 1.0e-06 : 1.0e-05;
+  for (size_t i=0; i < size; ++i) {
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(valuesE[i]/scale, values[i]/scale, tolerance);
+  } // for
+
+  PYLITH_METHOD_END;
+} // _checkValues
+
 
 // End of file 
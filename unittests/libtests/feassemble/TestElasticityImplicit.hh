@@ -32,6 +32,7 @@
 #include "pylith/feassemble/feassemblefwd.hh" // forward declarations
 #include "pylith/topology/topologyfwd.hh" // USES Mesh, SolutionFields
 #include "pylith/materials/materialsfwd.hh" // USES ElasticMaterial
+#include "pylith/utils/arrayfwd.hh" // USES scalar_array
 
 #include "spatialdata/spatialdb/spatialdbfwd.hh" // USES GravityField
 
@@ -97,6 +98,16 @@ public :
   /// Test updateStateVars().
   void testUpdateStateVars(void);
 
+  /** Test updateStateVars() with total strain stored during residual
+   * evaluation against computing the strain from the displacement.
+   */
+  void testUpdateStateVarsStoredStrain(void);
+
+  /** Test cellField() for stress and total strain computed in the same
+   * traversal against computing each one separately.
+   */
+  void testCellFieldStressStrain(void);
+
   // PROTECTED MEMBERS //////////////////////////////////////////////////
 protected :
 
@@ -118,6 +129,24 @@ private :
 		   ElasticityImplicit* const integrator,
 		   topology::SolutionFields* const fields);
 
+  /** Copy values of local vector of field.
+   *
+   * @param values Array of values (output).
+   * @param field Field with values.
+   */
+  static
+  void _copyValues(scalar_array* values,
+		   const topology::Field& field);
+
+  /** Check values against expected values.
+   *
+   * @param valuesE Array of expected values.
+   * @param values Array of values.
+   */
+  static
+  void _checkValues(const scalar_array& valuesE,
+		    const scalar_array& values);
+
 }; // class TestElasticityImplicit
 
 #endif // pylith_feassemble_testelasticityimplicit_hh
@@ -29,6 +29,8 @@
 
 #include "pylith/materials/ElasticPlaneStrain.hh" // USES ElasticPlaneStrain
 #include "pylith/materials/ElasticIsotropic3D.hh" // USES ElasticIsotropic3D
+#include "pylith/materials/MaxwellPlaneStrain.hh" // USES MaxwellPlaneStrain
+#include "pylith/materials/MaxwellIsotropic3D.hh" // USES MaxwellIsotropic3D
 
 #include "spatialdata/spatialdb/GravityField.hh" // USES GravityField
 
@@ -285,4 +287,58 @@ pylith::feassemble::TestElasticityImplicitGrav3DQuadratic::setUp(void)
 } // setUp
 
 
+// ----------------------------------------------------------------------
+CPPUNIT_TEST_SUITE_REGISTRATION( pylith::feassemble::TestElasticityImplicitMaxwell2DLinear );
+
+// Setup testing data.
+void
+pylith::feassemble::TestElasticityImplicitMaxwell2DLinear::setUp(void)
+{ // setUp
+  PYLITH_METHOD_BEGIN;
+
+  TestElasticityImplicit::setUp();
+
+  _data = new ElasticityImplicitData2DLinear();
+  _gravityField = 0;
+  CPPUNIT_ASSERT(_quadrature);
+  GeometryTri2D geometry;
+  _quadrature->refGeometry(&geometry);
+
+  _material = new materials::MaxwellPlaneStrain;
+  CPPUNIT_ASSERT(_material);
+
+  CPPUNIT_ASSERT(_data);
+  _data->matDBFilename = const_cast<char*>("data/maxwellplanestrain.spatialdb");
+
+  PYLITH_METHOD_END;
+} // setUp
+
+
+// ----------------------------------------------------------------------
+CPPUNIT_TEST_SUITE_REGISTRATION( pylith::feassemble::TestElasticityImplicitMaxwell3DLinear );
+
+// Setup testing data.
+void
+pylith::feassemble::TestElasticityImplicitMaxwell3DLinear::setUp(void)
+{ // setUp
+  PYLITH_METHOD_BEGIN;
+
+  TestElasticityImplicit::setUp();
+
+  _data = new ElasticityImplicitData3DLinear();
+  _gravityField = 0;
+  CPPUNIT_ASSERT(_quadrature);
+  GeometryTet3D geometry;
+  _quadrature->refGeometry(&geometry);
+
+  _material = new materials::MaxwellIsotropic3D;
+  CPPUNIT_ASSERT(_material);
+
+  CPPUNIT_ASSERT(_data);
+  _data->matDBFilename = const_cast<char*>("data/maxwellisotropic3d.spatialdb");
+
+  PYLITH_METHOD_END;
+} // setUp
+
+
 // End of file 
@@ -41,6 +41,9 @@ namespace pylith {
     class TestElasticityImplicitGrav2DQuadratic;
     class TestElasticityImplicitGrav3DLinear;
     class TestElasticityImplicitGrav3DQuadratic;
+
+    class TestElasticityImplicitMaxwell2DLinear;
+    class TestElasticityImplicitMaxwell3DLinear;
   } // feassemble
 } // pylith
 
@@ -58,6 +61,7 @@ class pylith::feassemble::TestElasticityImplicit2DLinear :
   CPPUNIT_TEST( testIntegrateJacobian );
   CPPUNIT_TEST( testUpdateStateVars );
   CPPUNIT_TEST( testStableTimeStep );
+  CPPUNIT_TEST( testCellFieldStressStrain );
 
   CPPUNIT_TEST_SUITE_END();
 
@@ -84,6 +88,7 @@ class pylith::feassemble::TestElasticityImplicit2DQuadratic :
   CPPUNIT_TEST( testIntegrateJacobian );
   CPPUNIT_TEST( testUpdateStateVars );
   CPPUNIT_TEST( testStableTimeStep );
+  CPPUNIT_TEST( testCellFieldStressStrain );
 
   CPPUNIT_TEST_SUITE_END();
 
@@ -110,6 +115,7 @@ class pylith::feassemble::TestElasticityImplicit3DLinear :
   CPPUNIT_TEST( testIntegrateJacobian );
   CPPUNIT_TEST( testUpdateStateVars );
   CPPUNIT_TEST( testStableTimeStep );
+  CPPUNIT_TEST( testCellFieldStressStrain );
 
   CPPUNIT_TEST_SUITE_END();
 
@@ -136,6 +142,7 @@ class pylith::feassemble::TestElasticityImplicit3DQuadratic :
   CPPUNIT_TEST( testIntegrateJacobian );
   CPPUNIT_TEST( testUpdateStateVars );
   CPPUNIT_TEST( testStableTimeStep );
+  CPPUNIT_TEST( testCellFieldStressStrain );
 
   CPPUNIT_TEST_SUITE_END();
 
@@ -252,6 +259,52 @@ public :
 }; // class TestElasticityImplicitGrav3DQuadratic
 
 
+// ----------------------------------------------------------------------
+/// C++ unit testing for ElasticityImplicit w/2-D linear cells and Maxwell viscoelastic material.
+class pylith::feassemble::TestElasticityImplicitMaxwell2DLinear :
+  public TestElasticityImplicit
+{ // class TestElasticityImplicitMaxwell2DLinear
+
+  // CPPUNIT TEST SUITE /////////////////////////////////////////////////
+  CPPUNIT_TEST_SUITE( TestElasticityImplicitMaxwell2DLinear );
+
+  CPPUNIT_TEST( testUpdateStateVarsStoredStrain );
+  CPPUNIT_TEST( testCellFieldStressStrain );
+
+  CPPUNIT_TEST_SUITE_END();
+
+  // PUBLIC METHODS /////////////////////////////////////////////////////
+public :
+
+  /// Setup testing data.
+  void setUp(void);
+
+}; // class TestElasticityImplicitMaxwell2DLinear
+
+
+// ----------------------------------------------------------------------
+/// C++ unit testing for ElasticityImplicit w/3-D linear cells and Maxwell viscoelastic material.
+class pylith::feassemble::TestElasticityImplicitMaxwell3DLinear :
+  public TestElasticityImplicit
+{ // class TestElasticityImplicitMaxwell3DLinear
+
+  // CPPUNIT TEST SUITE /////////////////////////////////////////////////
+  CPPUNIT_TEST_SUITE( TestElasticityImplicitMaxwell3DLinear );
+
+  CPPUNIT_TEST( testUpdateStateVarsStoredStrain );
+  CPPUNIT_TEST( testCellFieldStressStrain );
+
+  CPPUNIT_TEST_SUITE_END();
+
+  // PUBLIC METHODS /////////////////////////////////////////////////////
+public :
+
+  /// Setup testing data.
+  void setUp(void);
+
+}; // class TestElasticityImplicitMaxwell3DLinear
+
+
 #endif // pylith_feassemble_testelasticityimplicitcases_hh
 
 
@@ -0,0 +1,196 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "TestEffectiveStressCache.hh" // Implementation of class methods
+
+#include "pylith/materials/EffectiveStressCache.hh" // USES EffectiveStressCache
+
+#include <vector> // USES std::vector
+
+// ----------------------------------------------------------------------
+CPPUNIT_TEST_SUITE_REGISTRATION( pylith::materials::TestEffectiveStressCache );
+
+// ----------------------------------------------------------------------
+namespace pylith {
+  namespace materials {
+    namespace _EffectiveStressCache {
+      struct Params {
+	PylithScalar root;
+	PylithScalar dt;
+      }; // Params
+
+      class Linear {
+      public :
+	Linear(void) : root(0.0) {};
+	~Linear(void) {};
+	PylithScalar effStressFunc(const PylithScalar x) {
+	  evaluations.push_back(x);
+	  return x - root;
+	};
+	void effStressFuncDerivFunc(PylithScalar* f,
+				    PylithScalar* df,
+				    const PylithScalar x) {
+	  *f = x - root;
+	  *df = 1.0;
+	};
+	PylithScalar root;
+	std::vector<PylithScalar> evaluations;
+      }; // Linear
+    } // _EffectiveStressCache
+  } // materials
+} // pylith
+
+// ----------------------------------------------------------------------
+// Test calculate() with identical parameters.
+void
+pylith::materials::TestEffectiveStressCache::testCalculateHit(void)
+{ // testCalculateHit
+  typedef _EffectiveStressCache::Params Params;
+  typedef _EffectiveStressCache::Linear Linear;
+
+  EffectiveStressCache<Params> cache;
+  Linear material;
+  material.root = 10.0;
+  const Params params = { 10.0, 0.5 };
+  const PylithScalar initialGuess = 6.0;
+  const PylithScalar scale = 1.0;
+  const PylithScalar tolerance = 1.0e-06;
+
+  const PylithScalar valueE = 10.0;
+  const PylithScalar value =
+    cache.calculate<Linear>(2, params, initialGuess, scale, &material);
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, value/valueE, tolerance);
+  CPPUNIT_ASSERT_EQUAL(0, cache.numHits());
+  CPPUNIT_ASSERT_EQUAL(1, cache.numMisses());
+
+  // Identical parameters reuse the value without evaluating the function.
+  material.evaluations.clear();
+  const PylithScalar valueCached =
+    cache.calculate<Linear>(2, params, initialGuess, scale, &material);
+  CPPUNIT_ASSERT_EQUAL(value, valueCached);
+  CPPUNIT_ASSERT(material.evaluations.empty());
+  CPPUNIT_ASSERT_EQUAL(1, cache.numHits());
+  CPPUNIT_ASSERT_EQUAL(1, cache.numMisses());
+
+  // Entries at other quadrature points are independent.
+  cache.calculate<Linear>(0, params, initialGuess, scale, &material);
+  CPPUNIT_ASSERT_EQUAL(1, cache.numHits());
+  CPPUNIT_ASSERT_EQUAL(2, cache.numMisses());
+} // testCalculateHit
+
+// ----------------------------------------------------------------------
+// Test calculate() with different parameters.
+void
+pylith::materials::TestEffectiveStressCache::testCalculateMiss(void)
+{ // testCalculateMiss
+  typedef _EffectiveStressCache::Params Params;
+  typedef _EffectiveStressCache::Linear Linear;
+
+  EffectiveStressCache<Params> cache;
+  Linear material;
+  const PylithScalar initialGuess = 6.0;
+  const PylithScalar scale = 1.0;
+  const PylithScalar tolerance = 1.0e-06;
+
+  material.root = 10.0;
+  const Params params = { 10.0, 0.5 };
+  cache.calculate<Linear>(0, params, initialGuess, scale, &material);
+
+  // Any change in the parameters requires a new solve.
+  material.root = 12.0;
+  const Params paramsB = { 10.0, 0.25 };
+  const PylithScalar value =
+    cache.calculate<Linear>(0, paramsB, initialGuess, scale, &material);
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, value/material.root, tolerance);
+  CPPUNIT_ASSERT_EQUAL(0, cache.numHits());
+  CPPUNIT_ASSERT_EQUAL(2, cache.numMisses());
+
+  // Cache holds most recent value.
+  const PylithScalar valueCached =
+    cache.calculate<Linear>(0, paramsB, initialGuess, scale, &material);
+  CPPUNIT_ASSERT_EQUAL(value, valueCached);
+  CPPUNIT_ASSERT_EQUAL(1, cache.numHits());
+} // testCalculateMiss
+
+// ----------------------------------------------------------------------
+// Test calculate() starts from narrow bracket about cached value.
+void
+pylith::materials::TestEffectiveStressCache::testBracket(void)
+{ // testBracket
+  typedef _EffectiveStressCache::Params Params;
+  typedef _EffectiveStressCache::Linear Linear;
+
+  EffectiveStressCache<Params> cache;
+  Linear material;
+  const PylithScalar initialGuess = 6.0;
+  const PylithScalar scale = 1.0;
+  const PylithScalar tolerance = 1.0e-06;
+
+  // Without a cached value, bracket is about the initial guess.
+  material.root = 10.0;
+  const Params params = { 10.0, 0.5 };
+  cache.calculate<Linear>(0, params, initialGuess, scale, &material);
+  CPPUNIT_ASSERT(material.evaluations.size() >= 2);
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(0.9*initialGuess, material.evaluations[0], tolerance);
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(1.1*initialGuess, material.evaluations[1], tolerance);
+
+  // With a cached value, bracket is +/- 10% about it and already
+  // contains a nearby root.
+  material.evaluations.clear();
+  material.root = 10.5;
+  const Params paramsB = { 10.5, 0.5 };
+  const PylithScalar value =
+    cache.calculate<Linear>(0, paramsB, initialGuess, scale, &material);
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, value/material.root, tolerance);
+  CPPUNIT_ASSERT(material.evaluations.size() >= 2);
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(9.0, material.evaluations[0], tolerance);
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(11.0, material.evaluations[1], tolerance);
+} // testBracket
+
+// ----------------------------------------------------------------------
+// Test clear().
+void
+pylith::materials::TestEffectiveStressCache::testClear(void)
+{ // testClear
+  typedef _EffectiveStressCache::Params Params;
+  typedef _EffectiveStressCache::Linear Linear;
+
+  EffectiveStressCache<Params> cache;
+  Linear material;
+  material.root = 10.0;
+  const Params params = { 10.0, 0.5 };
+  const PylithScalar initialGuess = 6.0;
+  const PylithScalar scale = 1.0;
+
+  cache.calculate<Linear>(0, params, initialGuess, scale, &material);
+  cache.calculate<Linear>(0, params, initialGuess, scale, &material);
+  CPPUNIT_ASSERT_EQUAL(1, cache.numHits());
+
+  cache.clear();
+  CPPUNIT_ASSERT_EQUAL(0, cache.numHits());
+  CPPUNIT_ASSERT_EQUAL(0, cache.numMisses());
+
+  cache.calculate<Linear>(0, params, initialGuess, scale, &material);
+  CPPUNIT_ASSERT_EQUAL(0, cache.numHits());
+  CPPUNIT_ASSERT_EQUAL(1, cache.numMisses());
+} // testClear
+
+
+// End of file 
@@ -0,0 +1,74 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+/**
+ * @file unittests/libtests/materials/TestEffectiveStressCache.hh
+ *
+ * @brief C++ TestEffectiveStressCache object
+ *
+ * C++ unit testing for EffectiveStressCache.
+ */
+
+#if !defined(pylith_materials_testeffectivestresscache_hh)
+#define pylith_materials_testeffectivestresscache_hh
+
+#include "pylith/utils/types.hh" // HASA PylithScalar
+
+#include <cppunit/extensions/HelperMacros.h>
+
+/// Namespace for pylith package
+namespace pylith {
+  namespace materials {
+    class TestEffectiveStressCache;
+  } // materials
+} // pylith
+
+/// C++ unit testing for EffectiveStressCache
+class pylith::materials::TestEffectiveStressCache : public CppUnit::TestFixture
+{ // class TestEffectiveStressCache
+
+  // CPPUNIT TEST SUITE /////////////////////////////////////////////////
+  CPPUNIT_TEST_SUITE( TestEffectiveStressCache );
+
+  CPPUNIT_TEST( testCalculateHit );
+  CPPUNIT_TEST( testCalculateMiss );
+  CPPUNIT_TEST( testBracket );
+  CPPUNIT_TEST( testClear );
+
+  CPPUNIT_TEST_SUITE_END();
+
+  // PUBLIC METHODS /////////////////////////////////////////////////////
+public :
+
+  /// Test calculate() with identical parameters.
+  void testCalculateHit(void);
+
+  /// Test calculate() with different parameters.
+  void testCalculateMiss(void);
+
+  /// Test calculate() starts from narrow bracket about cached value.
+  void testBracket(void);
+
+  /// Test clear().
+  void testClear(void);
+
+}; // class TestEffectiveStressCache
+
+#endif // pylith_materials_testeffectivestresscache_hh
+
+// End of file 
@@ -38,6 +38,7 @@
 
 #include "spatialdata/spatialdb/SimpleDB.hh" // USES SimpleDB
 #include "spatialdata/spatialdb/SimpleIOAscii.hh" // USES SimpleIOAscii
+#include "spatialdata/spatialdb/UniformDB.hh" // USES UniformDB
 #include "spatialdata/geocoords/CSCart.hh" // USES CSCart
 #include "spatialdata/units/Nondimensional.hh" // USES Nondimensional
 
@@ -250,6 +251,157 @@ pylith::materials::TestElasticMaterial::testRetrievePropsAndVars(void)
   PYLITH_METHOD_END;
 } // testRetrievePropsAndVars
 
+// ----------------------------------------------------------------------
+// Test retrievePropsAndVars() with properties stored in single precision.
+void
+pylith::materials::TestElasticMaterial::testRetrievePropsAndVarsSingle(void)
+{ // testRetrievePropsAndVarsSingle
+  PYLITH_METHOD_BEGIN;
+
+  topology::Mesh mesh;
+  ElasticPlaneStrain material;
+  ElasticPlaneStrainData data;
+  material.singlePrecisionProperties(true);
+  _initialize(&mesh, &material, &data);
+
+  // Double precision values should have been freed.
+  CPPUNIT_ASSERT(material._properties);
+  CPPUNIT_ASSERT(!material._properties->localVector());
+  CPPUNIT_ASSERT_EQUAL(size_t(material._properties->sectionSize()), material._propertiesSingle.size());
+
+  // Get cells associated with material
+  const int materialId = 24;
+  PetscDM dmMesh = mesh.dmMesh();CPPUNIT_ASSERT(dmMesh);
+  topology::StratumIS materialIS(dmMesh, "material-id", materialId);
+  const PetscInt* cells = materialIS.points();
+  PetscInt cell = cells[0];
+
+  material.createPropsAndVarsVisitors();
+  material.retrievePropsAndVars(cell);
+  material.destroyPropsAndVarsVisitors();
+
+  const PylithScalar tolerance = 1.0e-06;
+  const PylithScalar* propertiesE = data.propertiesNondim;
+  CPPUNIT_ASSERT(propertiesE);
+  const scalar_array& properties = material._propertiesCell;
+  const size_t size = data.numLocs*data.numPropsQuadPt;
+  CPPUNIT_ASSERT_EQUAL(size, properties.size());
+  for (size_t i=0; i < size; ++i)
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, properties[i]/propertiesE[i], tolerance);
+
+  // Properties for output are converted back to double precision.
+  topology::Field field(mesh);
+  material.getField(&field, "density");
+  topology::VecVisitorMesh fieldVisitor(field);
+  const PetscScalar* fieldArray = fieldVisitor.localArray();
+  const PylithScalar* densityE = data.density;
+  CPPUNIT_ASSERT(densityE);
+  const PetscInt off = fieldVisitor.sectionOffset(cell);
+  CPPUNIT_ASSERT_EQUAL(PetscInt(data.numLocs), fieldVisitor.sectionDof(cell));
+  for (int iQuad=0; iQuad < data.numLocs; ++iQuad)
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, fieldArray[off+iQuad]/densityE[iQuad], tolerance);
+
+  PYLITH_METHOD_END;
+} // testRetrievePropsAndVarsSingle
+
+// ----------------------------------------------------------------------
+// Test retrievePropsAndVars() with properties stored in compressed form.
+void
+pylith::materials::TestElasticMaterial::testRetrievePropsAndVarsCompressed(void)
+{ // testRetrievePropsAndVarsCompressed
+  PYLITH_METHOD_BEGIN;
+
+  const int materialId = 24;
+  const PylithScalar tolerance = 1.0e-06;
+
+  // Properties vary among quadrature points, so they are not compressed.
+  { // quadpts
+    topology::Mesh mesh;
+    ElasticPlaneStrain material;
+    ElasticPlaneStrainData data;
+    material.compressProperties(true);
+    _initialize(&mesh, &material, &data);
+
+    CPPUNIT_ASSERT_EQUAL(Material::PROPERTIES_QUADPTS, material.propertiesLayout());
+    CPPUNIT_ASSERT(material._properties);
+    CPPUNIT_ASSERT(material._properties->localVector());
+    CPPUNIT_ASSERT_EQUAL(int(material._properties->sectionSize()), material.propertiesStorageSize());
+
+    PetscDM dmMesh = mesh.dmMesh();CPPUNIT_ASSERT(dmMesh);
+    topology::StratumIS materialIS(dmMesh, "material-id", materialId);
+    const PetscInt* cells = materialIS.points();
+    PetscInt cell = cells[0];
+
+    material.createPropsAndVarsVisitors();
+    material.retrievePropsAndVars(cell);
+    material.destroyPropsAndVarsVisitors();
+
+    const PylithScalar* propertiesE = data.propertiesNondim;
+    CPPUNIT_ASSERT(propertiesE);
+    const scalar_array& properties = material._propertiesCell;
+    const size_t size = data.numLocs*data.numPropsQuadPt;
+    CPPUNIT_ASSERT_EQUAL(size, properties.size());
+    for (size_t i=0; i < size; ++i)
+      CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, properties[i]/propertiesE[i], tolerance);
+  } // quadpts
+
+  // Properties are the same in all cells, so they are stored once.
+  { // uniform
+    topology::Mesh mesh;
+    ElasticPlaneStrain material;
+    ElasticPlaneStrainData data;
+
+    const int numDBProperties = data.numDBProperties;
+    CPPUNIT_ASSERT_EQUAL(3, numDBProperties);
+    const char* units[3] = { "kg/m**3", "m/s", "m/s" };
+    spatialdata::spatialdb::UniformDB db("TestElasticMaterial uniform");
+    db.setData(data.dbPropertyValues, units, data.dbProperties, numDBProperties);
+
+    material.compressProperties(true);
+    _initialize(&mesh, &material, &data, &db);
+
+    const int numPropsQuadPt = data.numPropsQuadPt;
+    CPPUNIT_ASSERT_EQUAL(Material::PROPERTIES_UNIFORM, material.propertiesLayout());
+    CPPUNIT_ASSERT_EQUAL(numPropsQuadPt, material.propertiesStorageSize());
+
+    PetscDM dmMesh = mesh.dmMesh();CPPUNIT_ASSERT(dmMesh);
+    topology::StratumIS materialIS(dmMesh, "material-id", materialId);
+    const PetscInt* cells = materialIS.points();
+    const PetscInt numCells = materialIS.size();
+
+    // Values at first location of data are expanded to all quadrature points.
+    const PylithScalar* propertiesE = data.propertiesNondim;
+    CPPUNIT_ASSERT(propertiesE);
+    const int numQuadPts = data.numLocs;
+    material.createPropsAndVarsVisitors();
+    for (PetscInt c=0; c < numCells; ++c) {
+      material.retrievePropsAndVars(cells[c]);
+      const scalar_array& properties = material._propertiesCell;
+      CPPUNIT_ASSERT_EQUAL(size_t(numQuadPts*numPropsQuadPt), properties.size());
+      for (int iQuad=0; iQuad < numQuadPts; ++iQuad)
+	for (int i=0; i < numPropsQuadPt; ++i)
+	  CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, properties[iQuad*numPropsQuadPt+i]/propertiesE[i], tolerance);
+    } // for
+    material.destroyPropsAndVarsVisitors();
+
+    // Properties for output are expanded to all quadrature points.
+    topology::Field field(mesh);
+    material.getField(&field, "density");
+    topology::VecVisitorMesh fieldVisitor(field);
+    const PetscScalar* fieldArray = fieldVisitor.localArray();
+    const PylithScalar* densityE = data.density;
+    CPPUNIT_ASSERT(densityE);
+    for (PetscInt c=0; c < numCells; ++c) {
+      const PetscInt off = fieldVisitor.sectionOffset(cells[c]);
+      CPPUNIT_ASSERT_EQUAL(PetscInt(numQuadPts), fieldVisitor.sectionDof(cells[c]));
+      for (int iQuad=0; iQuad < numQuadPts; ++iQuad)
+	CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, fieldArray[off+iQuad]/densityE[0], tolerance);
+    } // for
+  } // uniform
+
+  PYLITH_METHOD_END;
+} // testRetrievePropsAndVarsCompressed
+
 // ----------------------------------------------------------------------
 // Test calcDensity()
 void
@@ -840,7 +992,8 @@ pylith::materials::TestElasticMaterial::setupNormalizer(void)
 void
 pylith::materials::TestElasticMaterial::_initialize(topology::Mesh* mesh,
 						    ElasticPlaneStrain* material,
-						    const ElasticPlaneStrainData* data)
+						    const ElasticPlaneStrainData* data,
+						    spatialdata::spatialdb::SpatialDB* dbProperties)
 { // _initialize
   PYLITH_METHOD_BEGIN;
 
@@ -935,7 +1088,7 @@ pylith::materials::TestElasticMaterial::_initialize(topology::Mesh* mesh,
   dbStrain.ioHandler(&dbIOStrain);
   dbStrain.queryType(spatialdata::spatialdb::SimpleDB::NEAREST);
   
-  material->dbProperties(&db);
+  material->dbProperties(dbProperties ? dbProperties : &db);
   material->id(materialId);
   material->label("my_material");
   material->normalizer(normalizer);
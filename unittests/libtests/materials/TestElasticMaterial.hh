@@ -31,6 +31,8 @@
 #include "pylith/materials/materialsfwd.hh" // forward declarations
 #include "pylith/topology/topologyfwd.hh" // forward declarations
 
+#include "spatialdata/spatialdb/spatialdbfwd.hh" // USES SpatialDB
+
 /// Namespace for pylith package
 namespace pylith {
   namespace materials {
@@ -51,6 +53,8 @@ class pylith::materials::TestElasticMaterial : public TestMaterial
   CPPUNIT_TEST( testDBInitialStrain );
   CPPUNIT_TEST( testInitialize );
   CPPUNIT_TEST( testRetrievePropsAndVars );
+  CPPUNIT_TEST( testRetrievePropsAndVarsSingle );
+  CPPUNIT_TEST( testRetrievePropsAndVarsCompressed );
   CPPUNIT_TEST( testCalcDensity );
   CPPUNIT_TEST( testCalcStress );
   CPPUNIT_TEST( testCalcDerivElastic );
@@ -75,6 +79,12 @@ public :
   /// Test retrievePropsAndVars().
   void testRetrievePropsAndVars(void);
 
+  /// Test retrievePropsAndVars() with properties stored in single precision.
+  void testRetrievePropsAndVarsSingle(void);
+
+  /// Test retrievePropsAndVars() with properties stored in compressed form.
+  void testRetrievePropsAndVarsCompressed(void);
+
   /// Test calcDensity()
   void testCalcDensity(void);
 
@@ -144,10 +154,13 @@ private :
    * @param mesh Finite-element mesh.
    * @param material Elastic material.
    * @param data Data with properties for elastic material.
+   * @param dbProperties Database for properties (NULL to use
+   *   data/matinitialize.spatialdb).
    */
   void _initialize(topology::Mesh* mesh,
 		   ElasticPlaneStrain* material,
-		   const ElasticPlaneStrainData* data);
+		   const ElasticPlaneStrainData* data,
+		   spatialdata::spatialdb::SpatialDB* dbProperties =0);
 
 }; // class TestElasticMaterial
 
@@ -316,6 +316,75 @@ pylith::materials::TestMaterial::testInitialize(void)
   PYLITH_METHOD_END;
 } // testInitialize
 
+// ----------------------------------------------------------------------
+// Test _findPropertiesLayout() and _getPropertiesCell().
+void
+pylith::materials::TestMaterial::testCompressProperties(void)
+{ // testCompressProperties
+  PYLITH_METHOD_BEGIN;
+
+  ElasticPlaneStrain material;
+  CPPUNIT_ASSERT_EQUAL(Material::PROPERTIES_QUADPTS, material.propertiesLayout());
+
+  const int numPropsQuadPt = material._numPropsQuadPt;
+  CPPUNIT_ASSERT_EQUAL(3, numPropsQuadPt);
+  const int numQuadPts = 2;
+  const int numCells = 2;
+  const int fiberDim = numQuadPts*numPropsQuadPt;
+  const int size = numCells*fiberDim;
+
+  const PylithScalar propsUniform[size] = {
+    1.0, 2.0, 3.0,  1.0, 2.0, 3.0,
+    1.0, 2.0, 3.0,  1.0, 2.0, 3.0,
+  };
+  const PylithScalar propsCells[size] = {
+    1.0, 2.0, 3.0,  1.0, 2.0, 3.0,
+    4.0, 5.0, 6.0,  4.0, 5.0, 6.0,
+  };
+  const PylithScalar propsQuadPts[size] = {
+    1.0, 2.0, 3.0,  1.0, 2.0, 3.0,
+    4.0, 5.0, 6.0,  4.0, 5.0, 6.5,
+  };
+  CPPUNIT_ASSERT_EQUAL(Material::PROPERTIES_UNIFORM, material._findPropertiesLayout(propsUniform, size, fiberDim));
+  CPPUNIT_ASSERT_EQUAL(Material::PROPERTIES_CELLS, material._findPropertiesLayout(propsCells, size, fiberDim));
+  CPPUNIT_ASSERT_EQUAL(Material::PROPERTIES_QUADPTS, material._findPropertiesLayout(propsQuadPts, size, fiberDim));
+  CPPUNIT_ASSERT_EQUAL(Material::PROPERTIES_UNIFORM, material._findPropertiesLayout(0, 0, fiberDim));
+
+  // Values once per cell in double precision.
+  material._propertiesStoredCompact = true;
+  material._propertiesLayout = Material::PROPERTIES_CELLS;
+  material._propertiesDouble.resize(numCells*numPropsQuadPt);
+  for (int c=0; c < numCells; ++c) {
+    for (int i=0; i < numPropsQuadPt; ++i) {
+      material._propertiesDouble[c*numPropsQuadPt+i] = propsCells[c*fiberDim+i];
+    } // for
+  } // for
+  scalar_array values(fiberDim);
+  for (int c=0; c < numCells; ++c) {
+    material._getPropertiesCell(&values[0], fiberDim, c*fiberDim);
+    for (int i=0; i < fiberDim; ++i) {
+      CPPUNIT_ASSERT_EQUAL(propsCells[c*fiberDim+i], values[i]);
+    } // for
+  } // for
+
+  // Values once for material in single precision.
+  material._singlePrecisionProperties = true;
+  material._propertiesLayout = Material::PROPERTIES_UNIFORM;
+  material._propertiesDouble.clear();
+  material._propertiesSingle.resize(numPropsQuadPt);
+  for (int i=0; i < numPropsQuadPt; ++i) {
+    material._propertiesSingle[i] = float(propsUniform[i]);
+  } // for
+  for (int c=0; c < numCells; ++c) {
+    material._getPropertiesCell(&values[0], fiberDim, c*fiberDim);
+    for (int i=0; i < fiberDim; ++i) {
+      CPPUNIT_ASSERT_EQUAL(propsUniform[c*fiberDim+i], values[i]);
+    } // for
+  } // for
+
+  PYLITH_METHOD_END;
+} // testCompressProperties
+
 // ----------------------------------------------------------------------
 // Setup testing data.
 void
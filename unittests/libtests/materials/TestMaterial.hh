@@ -55,6 +55,7 @@ class pylith::materials::TestMaterial : public CppUnit::TestFixture
   CPPUNIT_TEST( testNeedNewJacobian );
   CPPUNIT_TEST( testIsJacobianSymmetric );
   CPPUNIT_TEST( testInitialize );
+  CPPUNIT_TEST( testCompressProperties );
 
   CPPUNIT_TEST_SUITE_END();
 
@@ -88,6 +89,9 @@ public :
   /// Test initialize()
   void testInitialize(void);
 
+  /// Test _findPropertiesLayout() and _getPropertiesCell().
+  void testCompressProperties(void);
+
   // PUBLIC METHODS /////////////////////////////////////////////////////
 public :
 
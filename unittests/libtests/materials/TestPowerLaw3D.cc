@@ -24,8 +24,10 @@
 #include "data/PowerLaw3DTimeDepData.hh" // USES PowerLaw3DTimeDepData
 
 #include "pylith/materials/PowerLaw3D.hh" // USES PowerLaw3D
+#include "pylith/utils/array.hh" // USES scalar_array
 
 #include <cstring> // USES memcpy()
+#include <cmath> // USES fabs()
 
 // ----------------------------------------------------------------------
 CPPUNIT_TEST_SUITE_REGISTRATION( pylith::materials::TestPowerLaw3D );
@@ -179,6 +181,131 @@ pylith::materials::TestPowerLaw3D::test_updateStateVarsTimeDep(void)
 
 } // test_updateStateVarsTimeDep
 
+// ----------------------------------------------------------------------
+// Test reuse of effective stress by _calcStress(), _calcElasticConsts(),
+// and _updateStateVars().
+void
+pylith::materials::TestPowerLaw3D::testEffStressCache(void)
+{ // testEffStressCache
+  PowerLaw3DTimeDepData data;
+
+  const PylithScalar dt = 2.0e+5;
+  PowerLaw3D material;
+  material.useElasticBehavior(false);
+  material.timeStep(dt);
+
+  // Reference material with cache cleared before every call.
+  PowerLaw3D materialNoCache;
+  materialNoCache.useElasticBehavior(false);
+  materialNoCache.timeStep(dt);
+
+  const bool computeStateVars = true;
+
+  const int numLocs = data.numLocs;
+  const int numPropsQuadPt = data.numPropsQuadPt;
+  const int numVarsQuadPt = data.numVarsQuadPt;
+  const int tensorSize = 6;
+  const int numConsts = 36;
+
+  scalar_array stress(tensorSize);
+  scalar_array stressE(tensorSize);
+  scalar_array elasticConsts(numConsts);
+  scalar_array elasticConstsE(numConsts);
+  scalar_array properties(numPropsQuadPt);
+  scalar_array stateVars(numVarsQuadPt);
+  scalar_array stateVarsE(numVarsQuadPt);
+  scalar_array strain(tensorSize);
+  scalar_array initialStress(tensorSize);
+  scalar_array initialStrain(tensorSize);
+
+  for (int iLoc=0; iLoc < numLocs; ++iLoc) {
+    memcpy(&properties[0], &data.properties[iLoc*numPropsQuadPt],
+	   numPropsQuadPt*sizeof(PylithScalar));
+    memcpy(&strain[0], &data.strain[iLoc*tensorSize],
+	   tensorSize*sizeof(PylithScalar));
+    memcpy(&initialStress[0], &data.initialStress[iLoc*tensorSize],
+	   tensorSize*sizeof(PylithScalar));
+    memcpy(&initialStrain[0], &data.initialStrain[iLoc*tensorSize],
+	   tensorSize*sizeof(PylithScalar));
+
+    // Same sequence as calcStress(), calcDerivElastic(), and
+    // updateStateVars() at a quadrature point.
+    material._quadPtIndex = iLoc;
+    memcpy(&stateVars[0], &data.stateVars[iLoc*numVarsQuadPt],
+	   numVarsQuadPt*sizeof(PylithScalar));
+    material._calcStress(&stress[0], stress.size(),
+			 &properties[0], properties.size(),
+			 &stateVars[0], stateVars.size(),
+			 &strain[0], strain.size(),
+			 &initialStress[0], initialStress.size(),
+			 &initialStrain[0], initialStrain.size(),
+			 computeStateVars);
+    material._calcElasticConsts(&elasticConsts[0], elasticConsts.size(),
+				&properties[0], properties.size(),
+				&stateVars[0], stateVars.size(),
+				&strain[0], strain.size(),
+				&initialStress[0], initialStress.size(),
+				&initialStrain[0], initialStrain.size());
+    material._updateStateVars(&stateVars[0], stateVars.size(),
+			      &properties[0], properties.size(),
+			      &strain[0], strain.size(),
+			      &initialStress[0], initialStress.size(),
+			      &initialStrain[0], initialStrain.size());
+
+    materialNoCache._quadPtIndex = iLoc;
+    memcpy(&stateVarsE[0], &data.stateVars[iLoc*numVarsQuadPt],
+	   numVarsQuadPt*sizeof(PylithScalar));
+    materialNoCache._effStressCache.clear();
+    materialNoCache._calcStress(&stressE[0], stressE.size(),
+				&properties[0], properties.size(),
+				&stateVarsE[0], stateVarsE.size(),
+				&strain[0], strain.size(),
+				&initialStress[0], initialStress.size(),
+				&initialStrain[0], initialStrain.size(),
+				computeStateVars);
+    materialNoCache._effStressCache.clear();
+    materialNoCache._calcElasticConsts(&elasticConstsE[0], elasticConstsE.size(),
+				       &properties[0], properties.size(),
+				       &stateVarsE[0], stateVarsE.size(),
+				       &strain[0], strain.size(),
+				       &initialStress[0], initialStress.size(),
+				       &initialStrain[0], initialStrain.size());
+    materialNoCache._effStressCache.clear();
+    materialNoCache._updateStateVars(&stateVarsE[0], stateVarsE.size(),
+				     &properties[0], properties.size(),
+				     &strain[0], strain.size(),
+				     &initialStress[0], initialStress.size(),
+				     &initialStrain[0], initialStrain.size());
+    CPPUNIT_ASSERT_EQUAL(0, materialNoCache._effStressCache.numHits());
+
+    const PylithScalar tolerance = (8 == sizeof(PylithScalar)) ? 1.0e-06 : 1.0e-04;
+    for (int i=0; i < tensorSize; ++i)
+      if (fabs(stressE[i]) > tolerance)
+	CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, stress[i]/stressE[i], tolerance);
+      else
+	CPPUNIT_ASSERT_DOUBLES_EQUAL(stressE[i], stress[i], tolerance);
+    for (int i=0; i < numConsts; ++i)
+      if (fabs(elasticConstsE[i]) > tolerance)
+	CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, elasticConsts[i]/elasticConstsE[i],
+				     tolerance);
+      else
+	CPPUNIT_ASSERT_DOUBLES_EQUAL(elasticConstsE[i], elasticConsts[i],
+				     tolerance);
+    for (int i=0; i < numVarsQuadPt; ++i)
+      if (fabs(stateVarsE[i]) > tolerance)
+	CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, stateVars[i]/stateVarsE[i], tolerance);
+      else
+	CPPUNIT_ASSERT_DOUBLES_EQUAL(stateVarsE[i], stateVars[i], tolerance);
+  } // for
+
+  // One solve per quadrature point; the elastic constants and state
+  // variables reuse it.
+  const int numMisses = material._effStressCache.numMisses();
+  CPPUNIT_ASSERT(numMisses > 0);
+  CPPUNIT_ASSERT(numMisses <= numLocs);
+  CPPUNIT_ASSERT_EQUAL(2*numMisses, material._effStressCache.numHits());
+} // testEffStressCache
+
 // ----------------------------------------------------------------------
 // Test _stableTimeStepImplicit()
 void
@@ -68,6 +68,7 @@ class pylith::materials::TestPowerLaw3D : public TestElasticMaterial
   CPPUNIT_TEST( test_calcElasticConstsTimeDep );
   CPPUNIT_TEST( test_updateStateVarsElastic );
   CPPUNIT_TEST( test_updateStateVarsTimeDep );
+  CPPUNIT_TEST( testEffStressCache );
 
   CPPUNIT_TEST( testHasProperty );
   CPPUNIT_TEST( testHasStateVar );
@@ -107,6 +108,10 @@ public :
   /// Test _updateStatevarsTimeDep()
   void test_updateStateVarsTimeDep(void);
 
+  /// Test reuse of effective stress by _calcStress(),
+  /// _calcElasticConsts(), and _updateStateVars().
+  void testEffStressCache(void);
+
   /// Test _stableTimeStepImplicit()
   void test_stableTimeStepImplicit(void);
 
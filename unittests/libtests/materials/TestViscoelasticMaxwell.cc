@@ -0,0 +1,127 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "TestViscoelasticMaxwell.hh" // Implementation of class methods
+
+#include "pylith/materials/ViscoelasticMaxwell.hh" // USES ViscoelasticMaxwell
+
+#include <cmath> // USES exp()
+#include <stdexcept> // USES std::runtime_error
+
+// ----------------------------------------------------------------------
+CPPUNIT_TEST_SUITE_REGISTRATION( pylith::materials::TestViscoelasticMaxwell );
+
+// ----------------------------------------------------------------------
+// Test viscousStrainParam().
+void
+pylith::materials::TestViscoelasticMaxwell::testViscousStrainParam(void)
+{ // testViscousStrainParam
+  const PylithScalar tolerance = 1.0e-06;
+
+  { // Default solution
+    const PylithScalar dt = 0.5;
+    const PylithScalar maxwellTime = 2.0;
+    const PylithScalar dqE = maxwellTime*(1.0-exp(-dt/maxwellTime))/dt;
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, ViscoelasticMaxwell::viscousStrainParam(dt, maxwellTime)/dqE, tolerance);
+  } // Default solution
+
+  { // Series expansion for very small time step
+    const PylithScalar dt = 1.0e-12;
+    const PylithScalar maxwellTime = 1.0e+3;
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, ViscoelasticMaxwell::viscousStrainParam(dt, maxwellTime), tolerance);
+  } // Series expansion
+
+  { // Very small Maxwell time
+    const PylithScalar dt = 1.0e+3;
+    const PylithScalar maxwellTime = 1.0e-12;
+    const PylithScalar dqE = maxwellTime/dt;
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, ViscoelasticMaxwell::viscousStrainParam(dt, maxwellTime)/dqE, tolerance);
+  } // Very small Maxwell time
+
+  CPPUNIT_ASSERT_THROW(ViscoelasticMaxwell::viscousStrainParam(1.0, 0.0), std::runtime_error);
+} // testViscousStrainParam
+
+// ----------------------------------------------------------------------
+// Test ParamCache with more Maxwell times than entries in cache.
+void
+pylith::materials::TestViscoelasticMaxwell::testParamCache(void)
+{ // testParamCache
+  const PylithScalar tolerance = 1.0e-06;
+  const PylithScalar dt = 0.1;
+  const int numTimes = 200;
+
+  // Entries collide and are replaced, so make two passes in
+  // different orders.
+  ViscoelasticMaxwell::ParamCache cache;
+  for (int iPass=0; iPass < 2; ++iPass) {
+    for (int i=0; i < numTimes; ++i) {
+      const int iTime = (0 == iPass) ? i : (i*7) % numTimes;
+      const PylithScalar maxwellTime = 0.05 * (1 + iTime);
+      const PylithScalar dqE = ViscoelasticMaxwell::viscousStrainParam(dt, maxwellTime);
+      const PylithScalar expFacE = exp(-dt/maxwellTime);
+
+      CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, cache.viscousStrainParam(dt, maxwellTime)/dqE, tolerance);
+      CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, cache.expFactor(dt, maxwellTime)/expFacE, tolerance);
+      // Entry is in cache.
+      CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, cache.viscousStrainParam(dt, maxwellTime)/dqE, tolerance);
+    } // for
+  } // for
+} // testParamCache
+
+// ----------------------------------------------------------------------
+// Test ParamCache with change in time step.
+void
+pylith::materials::TestViscoelasticMaxwell::testParamCacheTimeStep(void)
+{ // testParamCacheTimeStep
+  const PylithScalar tolerance = 1.0e-06;
+  const PylithScalar maxwellTime = 3.0;
+
+  ViscoelasticMaxwell::ParamCache cache;
+  const PylithScalar dts[4] = { 0.1, 0.2, 0.2, 0.1 };
+  for (int i=0; i < 4; ++i) {
+    const PylithScalar dt = dts[i];
+    const PylithScalar dqE = ViscoelasticMaxwell::viscousStrainParam(dt, maxwellTime);
+    const PylithScalar expFacE = exp(-dt/maxwellTime);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, cache.expFactor(dt, maxwellTime)/expFacE, tolerance);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, cache.viscousStrainParam(dt, maxwellTime)/dqE, tolerance);
+  } // for
+} // testParamCacheTimeStep
+
+// ----------------------------------------------------------------------
+// Test ParamCache::clear().
+void
+pylith::materials::TestViscoelasticMaxwell::testParamCacheClear(void)
+{ // testParamCacheClear
+  const PylithScalar tolerance = 1.0e-06;
+  const PylithScalar dt = 0.1;
+  const PylithScalar maxwellTime = 0.5;
+  const PylithScalar dqE = ViscoelasticMaxwell::viscousStrainParam(dt, maxwellTime);
+
+  ViscoelasticMaxwell::ParamCache cache;
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, cache.viscousStrainParam(dt, maxwellTime)/dqE, tolerance);
+  cache.clear();
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, cache.viscousStrainParam(dt, maxwellTime)/dqE, tolerance);
+
+  // Invalid Maxwell time is never cached.
+  CPPUNIT_ASSERT_THROW(cache.viscousStrainParam(dt, -1.0), std::runtime_error);
+} // testParamCacheClear
+
+
+// End of file 
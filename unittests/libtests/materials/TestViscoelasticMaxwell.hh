@@ -0,0 +1,74 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+/**
+ * @file unittests/libtests/materials/TestViscoelasticMaxwell.hh
+ *
+ * @brief C++ TestViscoelasticMaxwell object
+ *
+ * C++ unit testing for ViscoelasticMaxwell.
+ */
+
+#if !defined(pylith_materials_testviscoelasticmaxwell_hh)
+#define pylith_materials_testviscoelasticmaxwell_hh
+
+#include "pylith/utils/types.hh" // HASA PylithScalar
+
+#include <cppunit/extensions/HelperMacros.h>
+
+/// Namespace for pylith package
+namespace pylith {
+  namespace materials {
+    class TestViscoelasticMaxwell;
+  } // materials
+} // pylith
+
+/// C++ unit testing for ViscoelasticMaxwell
+class pylith::materials::TestViscoelasticMaxwell : public CppUnit::TestFixture
+{ // class TestViscoelasticMaxwell
+
+  // CPPUNIT TEST SUITE /////////////////////////////////////////////////
+  CPPUNIT_TEST_SUITE( TestViscoelasticMaxwell );
+
+  CPPUNIT_TEST( testViscousStrainParam );
+  CPPUNIT_TEST( testParamCache );
+  CPPUNIT_TEST( testParamCacheTimeStep );
+  CPPUNIT_TEST( testParamCacheClear );
+
+  CPPUNIT_TEST_SUITE_END();
+
+  // PUBLIC METHODS /////////////////////////////////////////////////////
+public :
+
+  /// Test viscousStrainParam().
+  void testViscousStrainParam(void);
+
+  /// Test ParamCache with more Maxwell times than entries in cache.
+  void testParamCache(void);
+
+  /// Test ParamCache with change in time step.
+  void testParamCacheTimeStep(void);
+
+  /// Test ParamCache::clear().
+  void testParamCacheClear(void);
+
+}; // class TestViscoelasticMaxwell
+
+#endif // pylith_materials_testviscoelasticmaxwell_hh
+
+// End of file 
@@ -86,6 +86,22 @@ pylith::meshio::TestDataWriterHDF5ExtMesh::testFilename(void)
   PYLITH_METHOD_END;
 } // testFilename
 
+// ----------------------------------------------------------------------
+// Test shareTopology()
+void
+pylith::meshio::TestDataWriterHDF5ExtMesh::testShareTopology(void)
+{ // testShareTopology
+  PYLITH_METHOD_BEGIN;
+
+  DataWriterHDF5Ext writer;
+  CPPUNIT_ASSERT_EQUAL(false, writer._shareTopology); // default
+
+  writer.shareTopology(true);
+  CPPUNIT_ASSERT_EQUAL(true, writer._shareTopology);
+
+  PYLITH_METHOD_END;
+} // testShareTopology
+
 // ----------------------------------------------------------------------
 // Test open() and close()
 void
@@ -117,6 +133,54 @@ pylith::meshio::TestDataWriterHDF5ExtMesh::testOpenClose(void)
   PYLITH_METHOD_END;
 } // testOpenClose
 
+// ----------------------------------------------------------------------
+// Test open() with topology shared between writers.
+void
+pylith::meshio::TestDataWriterHDF5ExtMesh::testOpenShareTopology(void)
+{ // testOpenShareTopology
+  PYLITH_METHOD_BEGIN;
+
+  CPPUNIT_ASSERT(_mesh);
+  CPPUNIT_ASSERT(_data);
+
+  DataWriterHDF5Ext writerA;
+  writerA.filename("hdf5ext_share_a.h5");
+  writerA.shareTopology(true);
+
+  DataWriterHDF5Ext writerB;
+  writerB.filename("hdf5ext_share_b.h5");
+  writerB.shareTopology(true);
+
+  const int numTimeSteps = 1;
+  const char* label = _data->cellsLabel;
+  const int id = _data->labelId;
+  writerA.open(*_mesh, numTimeSteps, label, id);
+  writerB.open(*_mesh, numTimeSteps, label, id);
+
+  CPPUNIT_ASSERT(writerA._numVertices > 0);
+  CPPUNIT_ASSERT_EQUAL(writerA._numVertices, writerB._numVertices);
+  CPPUNIT_ASSERT_EQUAL(writerA._numCells, writerB._numCells);
+  CPPUNIT_ASSERT_EQUAL(writerA._verticesKey, writerB._verticesKey);
+  CPPUNIT_ASSERT_EQUAL(writerA._cellsKey, writerB._cellsKey);
+
+  // Second writer references files written by first writer.
+  const DataWriterHDF5Ext::shared_type& shared = DataWriterHDF5Ext::_sharedDatasets;
+  DataWriterHDF5Ext::shared_type::const_iterator iter = shared.find(writerB._verticesKey);
+  CPPUNIT_ASSERT(iter != shared.end());
+  CPPUNIT_ASSERT_EQUAL(writerA._datasetFilename("vertices"), iter->second.filename);
+  iter = shared.find(writerB._cellsKey);
+  CPPUNIT_ASSERT(iter != shared.end());
+  CPPUNIT_ASSERT_EQUAL(writerA._datasetFilename("cells"), iter->second.filename);
+
+  // Closing the writer that wrote the datasets stops sharing them.
+  writerA.close();
+  CPPUNIT_ASSERT(shared.find(writerB._verticesKey) == shared.end());
+  CPPUNIT_ASSERT(shared.find(writerB._cellsKey) == shared.end());
+  writerB.close();
+
+  PYLITH_METHOD_END;
+} // testOpenShareTopology
+
 // ----------------------------------------------------------------------
 // Test writeVertexField.
 void
@@ -50,6 +50,7 @@ class pylith::meshio::TestDataWriterHDF5ExtMesh : public TestDataWriterHDF5,
 
   CPPUNIT_TEST( testConstructor );
   CPPUNIT_TEST( testFilename );
+  CPPUNIT_TEST( testShareTopology );
   CPPUNIT_TEST( testHdf5Filename );
   CPPUNIT_TEST( testDatasetFilename );
 
@@ -70,9 +71,15 @@ public :
   /// Test filename()
   void testFilename(void);
 
+  /// Test shareTopology()
+  void testShareTopology(void);
+
   /// Test open() and close()
   void testOpenClose(void);
 
+  /// Test open() with topology shared between writers.
+  void testOpenShareTopology(void);
+
   /// Test writeVertexField.
   void testWriteVertexField(void);
 
@@ -48,6 +48,7 @@ class pylith::meshio::TestDataWriterHDF5ExtMeshTri3 : public TestDataWriterHDF5E
   CPPUNIT_TEST_SUITE( TestDataWriterHDF5ExtMeshTri3 );
 
   CPPUNIT_TEST( testOpenClose );
+  CPPUNIT_TEST( testOpenShareTopology );
   CPPUNIT_TEST( testWriteVertexField );
   CPPUNIT_TEST( testWriteCellField );
 
@@ -71,6 +72,7 @@ class pylith::meshio::TestDataWriterHDF5ExtMeshQuad4 : public TestDataWriterHDF5
   CPPUNIT_TEST_SUITE( TestDataWriterHDF5ExtMeshQuad4 );
 
   CPPUNIT_TEST( testOpenClose );
+  CPPUNIT_TEST( testOpenShareTopology );
   CPPUNIT_TEST( testWriteVertexField );
   CPPUNIT_TEST( testWriteCellField );
 
@@ -94,6 +96,7 @@ class pylith::meshio::TestDataWriterHDF5ExtMeshTet4 : public TestDataWriterHDF5E
   CPPUNIT_TEST_SUITE( TestDataWriterHDF5ExtMeshTet4 );
 
   CPPUNIT_TEST( testOpenClose );
+  CPPUNIT_TEST( testOpenShareTopology );
   CPPUNIT_TEST( testWriteVertexField );
   CPPUNIT_TEST( testWriteCellField );
 
@@ -117,6 +120,7 @@ class pylith::meshio::TestDataWriterHDF5ExtMeshHex8 : public TestDataWriterHDF5E
   CPPUNIT_TEST_SUITE( TestDataWriterHDF5ExtMeshHex8 );
 
   CPPUNIT_TEST( testOpenClose );
+  CPPUNIT_TEST( testOpenShareTopology );
   CPPUNIT_TEST( testWriteVertexField );
   CPPUNIT_TEST( testWriteCellField );
 
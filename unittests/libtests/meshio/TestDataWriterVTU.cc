@@ -0,0 +1,288 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "TestDataWriterVTU.hh" // Implementation of class methods
+
+#include "pylith/meshio/DataWriterVTU.hh" // USES DataWriterVTU
+
+#include "pylith/utils/error.h" // USES PYLITH_METHOD_BEGIN/END
+
+#include <stdexcept> // USES std::runtime_error, std::logic_error
+#include <string.h> // USES strcmp(), memcpy()
+#include <stdio.h> // USES sprintf()
+#include <iostream> // USES std::cerr
+#include <sstream> // USES std::ostringstream
+#include <fstream> // USES std::ifstream
+#include <iterator> // USES std::istreambuf_iterator
+
+// ----------------------------------------------------------------------
+CPPUNIT_TEST_SUITE_REGISTRATION( pylith::meshio::TestDataWriterVTU );
+
+// ----------------------------------------------------------------------
+// Test constructor
+void
+pylith::meshio::TestDataWriterVTU::testConstructor(void)
+{ // testConstructor
+  PYLITH_METHOD_BEGIN;
+
+  DataWriterVTU writer;
+
+  CPPUNIT_ASSERT_EQUAL(std::string("output.vtu"), writer._filename);
+  CPPUNIT_ASSERT_EQUAL(false, writer._isOpen);
+  CPPUNIT_ASSERT_EQUAL(false, writer._isOpenTimeStep);
+
+  PYLITH_METHOD_END;
+} // testConstructor
+
+// ----------------------------------------------------------------------
+// Test filename()
+void
+pylith::meshio::TestDataWriterVTU::testFilename(void)
+{ // testFilename
+  PYLITH_METHOD_BEGIN;
+
+  DataWriterVTU writer;
+
+  const char* filename = "data.vtu";
+  writer.filename(filename);
+  CPPUNIT_ASSERT_EQUAL(std::string(filename), writer._filename);
+
+  PYLITH_METHOD_END;
+} // testFilename
+
+// ----------------------------------------------------------------------
+// Test timeFormat()
+void
+pylith::meshio::TestDataWriterVTU::testTimeFormat(void)
+{ // testTimeFormat
+  PYLITH_METHOD_BEGIN;
+
+  DataWriterVTU writer;
+
+  const char* format = "%4.1f";
+  writer.timeFormat(format);
+  CPPUNIT_ASSERT_EQUAL(std::string(format), writer._timeFormat);
+
+  PYLITH_METHOD_END;
+} // testTimeFormat
+
+// ----------------------------------------------------------------------
+// Test timeConstant()
+void
+pylith::meshio::TestDataWriterVTU::testTimeConstant(void)
+{ // testTimeConstant
+  PYLITH_METHOD_BEGIN;
+
+  DataWriterVTU writer;
+
+  const PylithScalar value = 4.5;
+  writer.timeConstant(value);
+  CPPUNIT_ASSERT_EQUAL(value, writer._timeConstant);
+
+  CPPUNIT_ASSERT_THROW(writer.timeConstant(-1.0), std::runtime_error);
+
+  PYLITH_METHOD_END;
+} // testTimeConstant
+
+// ----------------------------------------------------------------------
+// Test _vtuFilename() and _pvdFilename().
+void
+pylith::meshio::TestDataWriterVTU::testVtuFilename(void)
+{ // testVtuFilename
+  PYLITH_METHOD_BEGIN;
+
+  DataWriterVTU writer;
+
+  // Append info to filename if number of time steps is 0.
+  writer._numTimeSteps = 0;
+  writer._filename = "output.vtu";
+  CPPUNIT_ASSERT_EQUAL(std::string("output_info.pvtu"), writer._vtuFilename(0.0, -1));
+  CPPUNIT_ASSERT_EQUAL(std::string("output_info_p3.vtu"), writer._vtuFilename(0.0, 3));
+
+  // Use default normalization of 1.0, remove period from time stamp.
+  writer._numTimeSteps = 100;
+  writer._filename = "output.vtu";
+  writer.timeFormat("%05.2f");
+  CPPUNIT_ASSERT_EQUAL(std::string("output_t0230.pvtu"), writer._vtuFilename(2.3, -1));
+  CPPUNIT_ASSERT_EQUAL(std::string("output_t0230_p0.vtu"), writer._vtuFilename(2.3, 0));
+
+  // Use normalization of 20.0, remove period from time stamp.
+  writer.timeConstant(20.0);
+  CPPUNIT_ASSERT_EQUAL(std::string("output_t0250_p12.vtu"), writer._vtuFilename(50.0, 12));
+
+  writer._filename = "output/step.vtu";
+  CPPUNIT_ASSERT_EQUAL(std::string("output/step.pvd"), writer._pvdFilename());
+
+  PYLITH_METHOD_END;
+} // testVtuFilename
+
+// ----------------------------------------------------------------------
+// Test _vtkCellType().
+void
+pylith::meshio::TestDataWriterVTU::testVtkCellType(void)
+{ // testVtkCellType
+  PYLITH_METHOD_BEGIN;
+
+  CPPUNIT_ASSERT_EQUAL(1, int(DataWriterVTU::_vtkCellType(0, 1)));
+  CPPUNIT_ASSERT_EQUAL(3, int(DataWriterVTU::_vtkCellType(1, 2)));
+  CPPUNIT_ASSERT_EQUAL(5, int(DataWriterVTU::_vtkCellType(2, 3)));
+  CPPUNIT_ASSERT_EQUAL(9, int(DataWriterVTU::_vtkCellType(2, 4)));
+  CPPUNIT_ASSERT_EQUAL(10, int(DataWriterVTU::_vtkCellType(3, 4)));
+  CPPUNIT_ASSERT_EQUAL(12, int(DataWriterVTU::_vtkCellType(3, 8)));
+
+  CPPUNIT_ASSERT_THROW(DataWriterVTU::_vtkCellType(2, 6), std::logic_error);
+
+  PYLITH_METHOD_END;
+} // testVtkCellType
+
+// ----------------------------------------------------------------------
+// Check PVD, PVTU, and XML header of VTU file against archived files.
+void
+pylith::meshio::TestDataWriterVTU::checkFile(const char* filename,
+					     const PylithScalar t,
+					     const char* timeFormat)
+{ // checkFile
+  PYLITH_METHOD_BEGIN;
+
+  const std::string fileroot(filename, 0, std::string(filename).find(".vtu"));
+
+  _checkLines(fileroot + ".pvd");
+  _checkLines(_stepFilename(filename, t, timeFormat, ".pvtu"));
+  _checkLines(_stepFilename(filename, t, timeFormat, "_p0.vtu"));
+
+  PYLITH_METHOD_END;
+} // checkFile
+
+// ----------------------------------------------------------------------
+// Read blocks of raw data in appended section of VTU file.
+void
+pylith::meshio::TestDataWriterVTU::readAppendedData(std::vector<std::string>* blocks,
+						    const char* filename,
+						    const PylithScalar t,
+						    const char* timeFormat,
+						    const size_t numBlocks)
+{ // readAppendedData
+  PYLITH_METHOD_BEGIN;
+
+  CPPUNIT_ASSERT(blocks);
+
+  const std::string& pieceFilename = _stepFilename(filename, t, timeFormat, "_p0.vtu");
+  std::ifstream fileIn(pieceFilename.c_str(), std::ios::in | std::ios::binary);
+  if (!fileIn.is_open()) {
+    std::cerr << "Could not open file '" << pieceFilename << "'." << std::endl;
+  } // if
+  CPPUNIT_ASSERT(fileIn.is_open());
+  const std::string contents((std::istreambuf_iterator<char>(fileIn)), std::istreambuf_iterator<char>());
+  fileIn.close();
+
+  const std::string start = "<AppendedData encoding=\"raw\">\n_";
+  size_t pos = contents.find(start);
+  CPPUNIT_ASSERT(pos != std::string::npos);
+  pos += start.length();
+
+  // Each block has a header with the number of bytes.
+  blocks->resize(numBlocks);
+  for (size_t i = 0; i < numBlocks; ++i) {
+    unsigned long long nbytes = 0;
+    CPPUNIT_ASSERT(pos + sizeof(nbytes) <= contents.length());
+    memcpy(&nbytes, &contents[pos], sizeof(nbytes));
+    pos += sizeof(nbytes);
+    CPPUNIT_ASSERT(pos + nbytes <= contents.length());
+    (*blocks)[i] = contents.substr(pos, nbytes);
+    pos += nbytes;
+  } // for
+
+  CPPUNIT_ASSERT_EQUAL(std::string("\n  </AppendedData>\n</VTKFile>\n"), contents.substr(pos));
+
+  PYLITH_METHOD_END;
+} // readAppendedData
+
+// ----------------------------------------------------------------------
+// Get name of file for time step.
+std::string
+pylith::meshio::TestDataWriterVTU::_stepFilename(const char* filename,
+						 const PylithScalar t,
+						 const char* timeFormat,
+						 const char* suffix)
+{ // _stepFilename
+  PYLITH_METHOD_BEGIN;
+
+  const std::string fileroot(filename, 0, std::string(filename).find(".vtu"));
+
+  // Add time stamp to filename
+  char sbuffer[256];
+  sprintf(sbuffer, timeFormat, t);
+  std::string timestamp(sbuffer);
+  const size_t pos = timestamp.find(".");
+  if (pos != std::string::npos)
+    timestamp.erase(pos, 1);
+
+  std::ostringstream buffer;
+  buffer << fileroot << "_t" << timestamp << suffix;
+
+  PYLITH_METHOD_RETURN(std::string(buffer.str()));
+} // _stepFilename
+
+// ----------------------------------------------------------------------
+// Check lines of file against archived file.
+void
+pylith::meshio::TestDataWriterVTU::_checkLines(const std::string& filename)
+{ // _checkLines
+  PYLITH_METHOD_BEGIN;
+
+  const std::string filenameE = "data/" + filename;
+
+  std::ifstream fileInE(filenameE.c_str());
+  if (!fileInE.is_open()) {
+    std::cerr << "Could not open file '" << filenameE << "'." << std::endl;
+  } // if
+  CPPUNIT_ASSERT(fileInE.is_open());
+
+  std::ifstream fileIn(filename.c_str());
+  if (!fileIn.is_open()) {
+    std::cerr << "Could not open file '" << filename << "'." << std::endl;
+  } // if
+  CPPUNIT_ASSERT(fileIn.is_open());
+
+  const int maxLen = 256;
+  char line[maxLen];
+  char lineE[maxLen];
+
+  // Stop at end of archived file, which may cover only the start of
+  // the file (VTU file without appended data).
+  int i = 1;
+  while(fileInE.getline(lineE, maxLen)) {
+    fileIn.getline(line, maxLen);
+    if (!fileIn.good() || 0 != strcmp(line, lineE)) {
+      std::cerr << "Line " << i << " of file '" << filename << "' is incorrect."
+		<< std::endl;
+      CPPUNIT_ASSERT(false);
+    } // if
+    ++i;
+  } // while
+
+  fileInE.close();
+  fileIn.close();
+
+  PYLITH_METHOD_END;
+} // _checkLines
+
+
+// End of file 
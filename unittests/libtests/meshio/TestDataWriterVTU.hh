@@ -0,0 +1,141 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+/**
+ * @file unittests/libtests/meshio/TestDataWriterVTU.hh
+ *
+ * @brief C++ TestDataWriterVTU object
+ *
+ * C++ unit testing for DataWriterVTU.
+ */
+
+#if !defined(pylith_meshio_testdatawritervtu_hh)
+#define pylith_meshio_testdatawritervtu_hh
+
+#include <cppunit/extensions/HelperMacros.h>
+
+#include "pylith/utils/types.hh" // USES PylithScalar
+
+#include <string> // USES std::string
+#include <vector> // USES std::vector
+
+/// Namespace for pylith package
+namespace pylith {
+  namespace meshio {
+    class TestDataWriterVTU;
+  } // meshio
+} // pylith
+
+/// C++ unit testing for DataWriterVTU
+class pylith::meshio::TestDataWriterVTU : public CppUnit::TestFixture
+{ // class TestDataWriterVTU
+
+  // CPPUNIT TEST SUITE /////////////////////////////////////////////////
+  CPPUNIT_TEST_SUITE( TestDataWriterVTU );
+
+  CPPUNIT_TEST( testConstructor );
+  CPPUNIT_TEST( testFilename );
+  CPPUNIT_TEST( testTimeFormat );
+  CPPUNIT_TEST( testTimeConstant );
+  CPPUNIT_TEST( testVtuFilename );
+  CPPUNIT_TEST( testVtkCellType );
+
+  CPPUNIT_TEST_SUITE_END();
+
+  // PUBLIC METHODS /////////////////////////////////////////////////////
+public :
+
+  /// Test constructor
+  void testConstructor(void);
+
+  /// Test filename()
+  void testFilename(void);
+
+  /// Test timeFormat()
+  void testTimeFormat(void);
+
+  /// Test timeConstant()
+  void testTimeConstant(void);
+
+  /// Test _vtuFilename() and _pvdFilename().
+  void testVtuFilename(void);
+
+  /// Test _vtkCellType().
+  void testVtkCellType(void);
+
+  /** Check PVD, PVTU, and XML header of VTU file for rank 0 against
+   * archived files.
+   *
+   * The archived VTU file ends with the start of the appended data,
+   * which is checked using readAppendedData().
+   *
+   * @param filename Name of VTU file given to writer.
+   * @param t Time for file.
+   * @param timeFormat Format of timestamp in filename.
+   */
+  static
+  void checkFile(const char* filename,
+		 const PylithScalar t,
+		 const char* timeFormat);
+
+  /** Read blocks of raw data in appended section of VTU file for rank 0.
+   *
+   * @param blocks Bytes in each block, excluding block header [output].
+   * @param filename Name of VTU file given to writer.
+   * @param t Time for file.
+   * @param timeFormat Format of timestamp in filename.
+   * @param numBlocks Expected number of blocks.
+   */
+  static
+  void readAppendedData(std::vector<std::string>* blocks,
+			const char* filename,
+			const PylithScalar t,
+			const char* timeFormat,
+			const size_t numBlocks);
+
+  // PRIVATE METHODS ////////////////////////////////////////////////////
+private :
+
+  /** Get name of file for time step.
+   *
+   * @param filename Name of VTU file given to writer.
+   * @param t Time for file.
+   * @param timeFormat Format of timestamp in filename.
+   * @param suffix Suffix appended to timestamp.
+   * @returns Name of file.
+   */
+  static
+  std::string _stepFilename(const char* filename,
+			    const PylithScalar t,
+			    const char* timeFormat,
+			    const char* suffix);
+
+  /** Check lines of file against all lines of archived file in data
+   * directory.
+   *
+   * @param filename Name of file to check.
+   */
+  static
+  void _checkLines(const std::string& filename);
+
+}; // class TestDataWriterVTU
+
+#endif // pylith_meshio_testdatawritervtu_hh
+
+
+// End of file 
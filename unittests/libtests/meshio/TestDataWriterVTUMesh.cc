@@ -0,0 +1,307 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "TestDataWriterVTUMesh.hh" // Implementation of class methods
+
+#include "TestDataWriterVTU.hh" // USES TestDataWriterVTU
+#include "data/DataWriterData.hh" // USES DataWriterData
+
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/Field.hh" // USES Field
+#include "pylith/topology/Fields.hh" // USES Fields
+#include "pylith/topology/Stratum.hh" // USES Stratum
+#include "pylith/meshio/DataWriterVTU.hh" // USES DataWriterVTU
+
+#include <string.h> // USES memcpy()
+#include <math.h> // USES fabs()
+#include <iostream> // USES std::cerr
+#include <fstream> // USES std::ifstream
+
+// ----------------------------------------------------------------------
+// Setup testing data.
+void
+pylith::meshio::TestDataWriterVTUMesh::setUp(void)
+{ // setUp
+  PYLITH_METHOD_BEGIN;
+
+  TestDataWriterMesh::setUp();
+
+  PYLITH_METHOD_END;
+} // setUp
+
+// ----------------------------------------------------------------------
+// Tear down testing data.
+void
+pylith::meshio::TestDataWriterVTUMesh::tearDown(void)
+{ // tearDown
+  PYLITH_METHOD_BEGIN;
+
+  TestDataWriterMesh::tearDown();
+
+  PYLITH_METHOD_END;
+} // tearDown
+
+// ----------------------------------------------------------------------
+// Test openTimeStep() and closeTimeStep()
+void
+pylith::meshio::TestDataWriterVTUMesh::testTimeStep(void)
+{ // testTimeStep
+  PYLITH_METHOD_BEGIN;
+
+  CPPUNIT_ASSERT(_mesh);
+  CPPUNIT_ASSERT(_data);
+
+  DataWriterVTU writer;
+
+  const std::string& filename = _vtuFilename(_data->timestepFilename);
+  writer.filename(filename.c_str());
+  writer.timeFormat(_data->timeFormat);
+
+  const PylithScalar t = _data->time;
+  const int numTimeSteps = 1;
+  if (!_data->cellsLabel) {
+    writer.open(*_mesh, numTimeSteps);
+    writer.openTimeStep(t, *_mesh);
+  } else {
+    const char* label = _data->cellsLabel;
+    const int id = _data->labelId;
+    writer.open(*_mesh, numTimeSteps, label, id);
+    writer.openTimeStep(t, *_mesh, label, id);
+  } // else
+
+  CPPUNIT_ASSERT(writer._isOpen);
+  CPPUNIT_ASSERT(writer._isOpenTimeStep);
+  CPPUNIT_ASSERT_EQUAL(false, writer._hasEmptyPiece);
+
+  writer.closeTimeStep();
+  CPPUNIT_ASSERT_EQUAL(false, writer._isOpenTimeStep);
+  CPPUNIT_ASSERT_EQUAL(size_t(0), writer._timeSeries.size());
+
+  writer.close();
+  CPPUNIT_ASSERT_EQUAL(false, writer._isOpen);
+
+  // We do not create VTU files without fields.
+  std::ifstream fileIn(writer._pvdFilename().c_str());
+  CPPUNIT_ASSERT(!fileIn.is_open());
+
+  PYLITH_METHOD_END;
+} // testTimeStep
+
+// ----------------------------------------------------------------------
+// Test writeVertexField.
+void
+pylith::meshio::TestDataWriterVTUMesh::testWriteVertexField(void)
+{ // testWriteVertexField
+  PYLITH_METHOD_BEGIN;
+
+  CPPUNIT_ASSERT(_mesh);
+  CPPUNIT_ASSERT(_data);
+
+  DataWriterVTU writer;
+
+  topology::Fields vertexFields(*_mesh);
+  _createVertexFields(&vertexFields);
+
+  const std::string& filename = _vtuFilename(_data->vertexFilename);
+  writer.filename(filename.c_str());
+  writer.timeFormat(_data->timeFormat);
+
+  const int nfields = _data->numVertexFields;
+
+  const PylithScalar t = _data->time;
+  const int numTimeSteps = 1;
+  if (!_data->cellsLabel) {
+    writer.open(*_mesh, numTimeSteps);
+    writer.openTimeStep(t, *_mesh);
+  } else {
+    const char* label = _data->cellsLabel;
+    const int id = _data->labelId;
+    writer.open(*_mesh, numTimeSteps, label, id);
+    writer.openTimeStep(t, *_mesh, label, id);
+  } // else
+  for (int i=0; i < nfields; ++i) {
+    topology::Field& field = vertexFields.get(_data->vertexFieldsInfo[i].name);
+    writer.writeVertexField(t, field, *_mesh);
+
+    // Make sure we can reuse field
+    std::string fieldLabel = std::string(field.label()) + std::string("2");
+    field.label(fieldLabel.c_str());
+    field.dimensionalizeOkay(true);
+    field.scale(2.0);
+    field.dimensionalize();
+    writer.writeVertexField(t, field, *_mesh);
+  } // for
+  CPPUNIT_ASSERT_EQUAL(size_t(2*nfields), writer._vertexFields.size());
+  writer.closeTimeStep();
+
+  // Piece is cleared when closing writer.
+  const std::vector<PetscInt> vertices = writer._pieceVertices;
+  CPPUNIT_ASSERT_EQUAL(size_t(_data->numVertices), vertices.size());
+  writer.close();
+
+  TestDataWriterVTU::checkFile(filename.c_str(), t, _data->timeFormat);
+
+  // Two blocks for each field followed by points, connectivity,
+  // offsets, and types.
+  std::vector<std::string> blocks;
+  TestDataWriterVTU::readAppendedData(&blocks, filename.c_str(), t, _data->timeFormat, 2*nfields+4);
+
+  topology::Stratum verticesStratum(_mesh->dmMesh(), topology::Stratum::DEPTH, 0);
+  const PetscInt vStart = verticesStratum.begin();
+  for (int i=0; i < nfields; ++i) {
+    const DataWriterData::FieldStruct& info = _data->vertexFieldsInfo[i];
+    const int numComponents = (topology::FieldBase::VECTOR == info.field_type && info.fiber_dim < 3) ? 3 : info.fiber_dim;
+    _checkValues(blocks[2*i], info.name, _data->vertexFields[i], info.fiber_dim, numComponents, vertices, vStart, 1.0);
+    _checkValues(blocks[2*i+1], info.name, _data->vertexFields[i], info.fiber_dim, numComponents, vertices, vStart, 2.0);
+  } // for
+
+  PYLITH_METHOD_END;
+} // testWriteVertexField
+
+// ----------------------------------------------------------------------
+// Test writeCellField.
+void
+pylith::meshio::TestDataWriterVTUMesh::testWriteCellField(void)
+{ // testWriteCellField
+  PYLITH_METHOD_BEGIN;
+
+  CPPUNIT_ASSERT(_mesh);
+  CPPUNIT_ASSERT(_data);
+
+  DataWriterVTU writer;
+
+  topology::Fields cellFields(*_mesh);
+  _createCellFields(&cellFields);
+
+  const std::string& filename = _vtuFilename(_data->cellFilename);
+  writer.filename(filename.c_str());
+  writer.timeFormat(_data->timeFormat);
+
+  const int nfields = _data->numCellFields;
+
+  const PylithScalar t = _data->time;
+  const int numTimeSteps = 1;
+  if (!_data->cellsLabel) {
+    writer.open(*_mesh, numTimeSteps);
+    writer.openTimeStep(t, *_mesh);
+    for (int i=0; i < nfields; ++i) {
+      topology::Field& field = cellFields.get(_data->cellFieldsInfo[i].name);
+      writer.writeCellField(t, field);
+    } // for
+  } else {
+    const char* label = _data->cellsLabel;
+    const int id = _data->labelId;
+    writer.open(*_mesh, numTimeSteps, label, id);
+    writer.openTimeStep(t, *_mesh, label, id);
+    for (int i=0; i < nfields; ++i) {
+      topology::Field& field = cellFields.get(_data->cellFieldsInfo[i].name);
+      writer.writeCellField(t, field, label, id);
+    } // for
+  } // else
+  CPPUNIT_ASSERT_EQUAL(size_t(nfields), writer._cellFields.size());
+  writer.closeTimeStep();
+
+  // Piece is cleared when closing writer.
+  const std::vector<PetscInt> cells = writer._pieceCells;
+  writer.close();
+
+  TestDataWriterVTU::checkFile(filename.c_str(), t, _data->timeFormat);
+
+  // One block for each field followed by points, connectivity,
+  // offsets, and types.
+  std::vector<std::string> blocks;
+  TestDataWriterVTU::readAppendedData(&blocks, filename.c_str(), t, _data->timeFormat, nfields+4);
+
+  // Cohesive cells are not included in the piece, so the index of the
+  // values for a cell is the offset from the first cell.
+  topology::Stratum cellsStratum(_mesh->dmMesh(), topology::Stratum::HEIGHT, 0);
+  const PetscInt cStart = cellsStratum.begin();
+  for (int i=0; i < nfields; ++i) {
+    const DataWriterData::FieldStruct& info = _data->cellFieldsInfo[i];
+    const int numComponents = (topology::FieldBase::VECTOR == info.field_type && info.fiber_dim < 3) ? 3 : info.fiber_dim;
+    _checkValues(blocks[i], info.name, _data->cellFields[i], info.fiber_dim, numComponents, cells, cStart, 1.0);
+  } // for
+
+  PYLITH_METHOD_END;
+} // testWriteCellField
+
+// ----------------------------------------------------------------------
+// Get name of VTU file from name of VTK file in test data.
+std::string
+pylith::meshio::TestDataWriterVTUMesh::_vtuFilename(const char* filename)
+{ // _vtuFilename
+  PYLITH_METHOD_BEGIN;
+
+  CPPUNIT_ASSERT(filename);
+  std::string vtuFilename(filename);
+  const size_t indexExt = vtuFilename.find(".vtk");
+  CPPUNIT_ASSERT(indexExt != std::string::npos);
+  vtuFilename.replace(indexExt, 4, ".vtu");
+
+  PYLITH_METHOD_RETURN(vtuFilename);
+} // _vtuFilename
+
+// ----------------------------------------------------------------------
+// Check values of field in block of appended data.
+void
+pylith::meshio::TestDataWriterVTUMesh::_checkValues(const std::string& block,
+						    const char* name,
+						    const PylithScalar* valuesE,
+						    const int fiberDim,
+						    const int numComponents,
+						    const std::vector<PetscInt>& points,
+						    const PetscInt pStart,
+						    const PylithScalar scale)
+{ // _checkValues
+  PYLITH_METHOD_BEGIN;
+
+  CPPUNIT_ASSERT(valuesE);
+
+  const size_t numPoints = points.size();
+  const size_t size = numPoints*numComponents;
+  CPPUNIT_ASSERT_EQUAL(size*sizeof(PylithScalar), block.size());
+  std::vector<PylithScalar> values(size);
+  if (size > 0) {
+    memcpy(&values[0], block.data(), block.size());
+  } // if
+
+  // Components beyond the fiber dimension are padding.
+  const PylithScalar tolerance = 1.0e-06;
+  for (size_t iP = 0; iP < numPoints; ++iP) {
+    const PetscInt index = points[iP] - pStart;
+    for (int d = 0; d < numComponents; ++d) {
+      const PylithScalar valueE = (d < fiberDim) ? scale*valuesE[index*fiberDim+d] : 0.0;
+      const PylithScalar value = values[iP*numComponents+d];
+      if (fabs(valueE) > tolerance) {
+	if (fabs(1.0 - value/valueE) > tolerance) {
+	  std::cerr << "Value " << d << " at point " << points[iP] << " of field '" << name << "' is incorrect." << std::endl;
+	} // if
+	CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, value/valueE, tolerance);
+      } else {
+	CPPUNIT_ASSERT_DOUBLES_EQUAL(valueE, value, tolerance);
+      } // if/else
+    } // for
+  } // for
+
+  PYLITH_METHOD_END;
+} // _checkValues
+
+
+// End of file 
@@ -0,0 +1,107 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+/**
+ * @file unittests/libtests/meshio/TestDataWriterVTUMesh.hh
+ *
+ * @brief C++ TestDataWriterVTUMesh object
+ *
+ * C++ unit testing for DataWriterVTU with output over the mesh.
+ */
+
+#if !defined(pylith_meshio_testdatawritervtumesh_hh)
+#define pylith_meshio_testdatawritervtumesh_hh
+
+#include "TestDataWriterMesh.hh" // ISA TestDataWriterMesh
+
+#include "pylith/topology/topologyfwd.hh" // USES Mesh, Field
+#include "pylith/utils/types.hh" // USES PylithScalar
+
+#include <cppunit/extensions/HelperMacros.h>
+
+#include <string> // USES std::string
+#include <vector> // USES std::vector
+
+/// Namespace for pylith package
+namespace pylith {
+  namespace meshio {
+    class TestDataWriterVTUMesh;
+  } // meshio
+} // pylith
+
+/// C++ unit testing for DataWriterVTU
+class pylith::meshio::TestDataWriterVTUMesh : public TestDataWriterMesh,
+					      public CppUnit::TestFixture
+{ // class TestDataWriterVTUMesh
+
+  // PUBLIC METHODS /////////////////////////////////////////////////////
+public :
+
+  /// Setup testing data.
+  void setUp(void);
+
+  /// Tear down testing data.
+  void tearDown(void);
+
+  /// Test openTimeStep() and closeTimeStep()
+  void testTimeStep(void);
+
+  /// Test writeVertexField.
+  void testWriteVertexField(void);
+
+  /// Test writeCellField.
+  void testWriteCellField(void);
+
+  // PRIVATE METHODS ////////////////////////////////////////////////////
+private :
+
+  /** Get name of VTU file from name of VTK file in test data.
+   *
+   * @param filename Name of VTK file.
+   * @returns Name of VTU file.
+   */
+  static
+  std::string _vtuFilename(const char* filename);
+
+  /** Check values of field in block of appended data.
+   *
+   * @param block Bytes in block of appended data.
+   * @param name Name of field.
+   * @param valuesE Expected values of field at each point.
+   * @param fiberDim Number of values per point.
+   * @param numComponents Number of components per point in VTU file.
+   * @param points Points in piece, in order of output.
+   * @param pStart First point in stratum (index of point in valuesE is point-pStart).
+   * @param scale Scale applied to expected values.
+   */
+  static
+  void _checkValues(const std::string& block,
+		    const char* name,
+		    const PylithScalar* valuesE,
+		    const int fiberDim,
+		    const int numComponents,
+		    const std::vector<PetscInt>& points,
+		    const PetscInt pStart,
+		    const PylithScalar scale);
+
+}; // class TestDataWriterVTUMesh
+
+#endif // pylith_meshio_testdatawritervtumesh_hh
+
+
+// End of file 
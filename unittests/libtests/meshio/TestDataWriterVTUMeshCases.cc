@@ -0,0 +1,99 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "TestDataWriterVTUMeshCases.hh" // Implementation of class methods
+
+#include "pylith/utils/error.h" // USES PYLITH_METHOD_BEGIN/END
+
+// Meshes and fields are the same as those for DataWriterVTK.
+#include "data/DataWriterVTKDataMeshTri3.hh" // USES DataWriterVTKDataMeshTri3
+#include "data/DataWriterVTKDataMeshQuad4.hh" // USES DataWriterVTKDataMeshQuad4
+#include "data/DataWriterVTKDataMeshTet4.hh" // USES DataWriterVTKDataMeshTet4
+#include "data/DataWriterVTKDataMeshHex8.hh" // USES DataWriterVTKDataMeshHex8
+
+
+// ----------------------------------------------------------------------
+CPPUNIT_TEST_SUITE_REGISTRATION( pylith::meshio::TestDataWriterVTUMeshTri3 );
+CPPUNIT_TEST_SUITE_REGISTRATION( pylith::meshio::TestDataWriterVTUMeshQuad4 );
+CPPUNIT_TEST_SUITE_REGISTRATION( pylith::meshio::TestDataWriterVTUMeshTet4 );
+CPPUNIT_TEST_SUITE_REGISTRATION( pylith::meshio::TestDataWriterVTUMeshHex8 );
+
+
+// ----------------------------------------------------------------------
+// Setup testing data.
+void
+pylith::meshio::TestDataWriterVTUMeshTri3::setUp(void)
+{ // setUp
+  PYLITH_METHOD_BEGIN;
+
+  TestDataWriterVTUMesh::setUp();
+  _data = new DataWriterVTKDataMeshTri3;
+  _initialize();
+
+  PYLITH_METHOD_END;
+} // setUp
+
+
+// ----------------------------------------------------------------------
+// Setup testing data.
+void
+pylith::meshio::TestDataWriterVTUMeshQuad4::setUp(void)
+{ // setUp
+  PYLITH_METHOD_BEGIN;
+
+  TestDataWriterVTUMesh::setUp();
+  _data = new DataWriterVTKDataMeshQuad4;
+  _initialize();
+
+  PYLITH_METHOD_END;
+} // setUp
+
+
+// ----------------------------------------------------------------------
+// Setup testing data.
+void
+pylith::meshio::TestDataWriterVTUMeshTet4::setUp(void)
+{ // setUp
+  PYLITH_METHOD_BEGIN;
+
+  TestDataWriterVTUMesh::setUp();
+  _data = new DataWriterVTKDataMeshTet4;
+  _initialize();
+
+  PYLITH_METHOD_END;
+} // setUp
+
+
+// ----------------------------------------------------------------------
+// Setup testing data.
+void
+pylith::meshio::TestDataWriterVTUMeshHex8::setUp(void)
+{ // setUp
+  PYLITH_METHOD_BEGIN;
+
+  TestDataWriterVTUMesh::setUp();
+  _data = new DataWriterVTKDataMeshHex8;
+  _initialize();
+
+  PYLITH_METHOD_END;
+} // setUp
+
+
+// End of file 
@@ -0,0 +1,137 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+/**
+ * @file unittests/libtests/meshio/TestDataWriterVTUMeshCases.hh
+ *
+ * @brief C++ unit testing for DataWriterVTU mesh output with various
+ * cell types.
+ */
+
+#if !defined(pylith_meshio_testdatawritervtumeshcases_hh)
+#define pylith_meshio_testdatawritervtumeshcases_hh
+
+#include "TestDataWriterVTUMesh.hh"
+
+/// Namespace for pylith package
+namespace pylith {
+  namespace meshio {
+    class TestDataWriterVTUMeshTri3;
+    class TestDataWriterVTUMeshQuad4;
+    class TestDataWriterVTUMeshTet4;
+    class TestDataWriterVTUMeshHex8;
+  } // meshio
+} // pylith
+
+
+// ----------------------------------------------------------------------
+/// C++ unit testing for DataWriterVTU
+class pylith::meshio::TestDataWriterVTUMeshTri3 : public TestDataWriterVTUMesh
+{ // class TestDataWriterVTUMeshTri3
+
+  // CPPUNIT TEST SUITE /////////////////////////////////////////////////
+  CPPUNIT_TEST_SUITE( TestDataWriterVTUMeshTri3 );
+
+  CPPUNIT_TEST( testTimeStep );
+  CPPUNIT_TEST( testWriteVertexField );
+  CPPUNIT_TEST( testWriteCellField );
+
+  CPPUNIT_TEST_SUITE_END();
+
+  // PUBLIC METHODS /////////////////////////////////////////////////////
+public :
+
+  /// Setup testing data.
+  void setUp(void);
+
+}; // class TestDataWriterVTUMeshTri3
+
+
+// ----------------------------------------------------------------------
+/// C++ unit testing for DataWriterVTU
+class pylith::meshio::TestDataWriterVTUMeshQuad4 : public TestDataWriterVTUMesh
+{ // class TestDataWriterVTUMeshQuad4
+
+  // CPPUNIT TEST SUITE /////////////////////////////////////////////////
+  CPPUNIT_TEST_SUITE( TestDataWriterVTUMeshQuad4 );
+
+  CPPUNIT_TEST( testTimeStep );
+  CPPUNIT_TEST( testWriteVertexField );
+  CPPUNIT_TEST( testWriteCellField );
+
+  CPPUNIT_TEST_SUITE_END();
+
+  // PUBLIC METHODS /////////////////////////////////////////////////////
+public :
+
+  /// Setup testing data.
+  void setUp(void);
+
+}; // class TestDataWriterVTUMeshQuad4
+
+
+// ----------------------------------------------------------------------
+/// C++ unit testing for DataWriterVTU
+class pylith::meshio::TestDataWriterVTUMeshTet4 : public TestDataWriterVTUMesh
+{ // class TestDataWriterVTUMeshTet4
+
+  // CPPUNIT TEST SUITE /////////////////////////////////////////////////
+  CPPUNIT_TEST_SUITE( TestDataWriterVTUMeshTet4 );
+
+  CPPUNIT_TEST( testTimeStep );
+  CPPUNIT_TEST( testWriteVertexField );
+  CPPUNIT_TEST( testWriteCellField );
+
+  CPPUNIT_TEST_SUITE_END();
+
+  // PUBLIC METHODS /////////////////////////////////////////////////////
+public :
+
+  /// Setup testing data.
+  void setUp(void);
+
+}; // class TestDataWriterVTUMeshTet4
+
+
+// ----------------------------------------------------------------------
+/// C++ unit testing for DataWriterVTU
+class pylith::meshio::TestDataWriterVTUMeshHex8 : public TestDataWriterVTUMesh
+{ // class TestDataWriterVTUMeshHex8
+
+  // CPPUNIT TEST SUITE /////////////////////////////////////////////////
+  CPPUNIT_TEST_SUITE( TestDataWriterVTUMeshHex8 );
+
+  CPPUNIT_TEST( testTimeStep );
+  CPPUNIT_TEST( testWriteVertexField );
+  CPPUNIT_TEST( testWriteCellField );
+
+  CPPUNIT_TEST_SUITE_END();
+
+  // PUBLIC METHODS /////////////////////////////////////////////////////
+public :
+
+  /// Setup testing data.
+  void setUp(void);
+
+}; // class TestDataWriterVTUMeshHex8
+
+
+#endif // pylith_meshio_testdatawritervtumeshcases_hh
+
+
+// End of file 
@@ -0,0 +1,182 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "TestMappedLineParser.hh" // Implementation of class methods
+
+#include "pylith/meshio/MappedLineParser.hh" // USES MappedLineParser
+
+#include "pylith/utils/error.h" // USES PYLITH_METHOD_BEGIN/END
+
+#include <cstring> // USES strlen()
+
+// ----------------------------------------------------------------------
+CPPUNIT_TEST_SUITE_REGISTRATION( pylith::meshio::TestMappedLineParser );
+
+// ----------------------------------------------------------------------
+// Test open() and close().
+void
+pylith::meshio::TestMappedLineParser::testOpen(void)
+{ // testOpen
+  PYLITH_METHOD_BEGIN;
+
+  MappedLineParser parser;
+  CPPUNIT_ASSERT(!parser.open("data/this_file_does_not_exist.txt"));
+
+  CPPUNIT_ASSERT(parser.open("data/mesh2D_comments.txt"));
+  CPPUNIT_ASSERT_EQUAL(std::string("mesh = { "), parser.next());
+  CPPUNIT_ASSERT_EQUAL(3, parser.lineNumber());
+  CPPUNIT_ASSERT_EQUAL(std::string("dimension = 2 "), parser.next());
+  CPPUNIT_ASSERT_EQUAL(5, parser.lineNumber());
+  parser.close();
+
+  CPPUNIT_ASSERT_EQUAL(std::string(""), parser.next());
+
+  PYLITH_METHOD_END;
+} // testOpen
+
+// ----------------------------------------------------------------------
+// Test next() and nextLine().
+void
+pylith::meshio::TestMappedLineParser::testNext(void)
+{ // testNext
+  PYLITH_METHOD_BEGIN;
+
+  const char* contents =
+    "// comment\n"
+    "\n"
+    "  abc = 2 // comment\n"
+    "\t  \r\n"
+    "def\n"
+    "  ghi";
+
+  MappedLineParser parser;
+  parser.buffer(contents, strlen(contents));
+  CPPUNIT_ASSERT_EQUAL(std::string("abc = 2 "), parser.next());
+  CPPUNIT_ASSERT_EQUAL(3, parser.lineNumber());
+  CPPUNIT_ASSERT(parser.endOfLine());
+
+  CPPUNIT_ASSERT(parser.nextLine());
+  CPPUNIT_ASSERT_EQUAL(5, parser.lineNumber());
+  CPPUNIT_ASSERT(!parser.endOfLine());
+
+  CPPUNIT_ASSERT_EQUAL(std::string("ghi"), parser.next());
+  CPPUNIT_ASSERT_EQUAL(6, parser.lineNumber());
+
+  CPPUNIT_ASSERT(!parser.nextLine());
+  CPPUNIT_ASSERT_EQUAL(std::string(""), parser.next());
+
+  PYLITH_METHOD_END;
+} // testNext
+
+// ----------------------------------------------------------------------
+// Test ignore().
+void
+pylith::meshio::TestMappedLineParser::testIgnore(void)
+{ // testIgnore
+  PYLITH_METHOD_BEGIN;
+
+  const char* contents =
+    "values = {\n"
+    "  1 2\n"
+    "  3 4\n"
+    "  }\n"
+    "next = 1\n";
+
+  MappedLineParser parser;
+  parser.buffer(contents, strlen(contents));
+  CPPUNIT_ASSERT_EQUAL(std::string("values = {"), parser.next());
+  parser.ignore('}');
+  CPPUNIT_ASSERT_EQUAL(std::string("next = 1"), parser.next());
+  CPPUNIT_ASSERT_EQUAL(5, parser.lineNumber());
+
+  parser.ignore('}');
+  CPPUNIT_ASSERT_EQUAL(std::string(""), parser.next());
+
+  PYLITH_METHOD_END;
+} // testIgnore
+
+// ----------------------------------------------------------------------
+// Test readInt().
+void
+pylith::meshio::TestMappedLineParser::testReadInt(void)
+{ // testReadInt
+  PYLITH_METHOD_BEGIN;
+
+  const char* contents =
+    "  0 -12\t+7 // 8\n"
+    "13a 99999999999999999999999\n";
+
+  MappedLineParser parser;
+  parser.buffer(contents, strlen(contents));
+
+  long value = 0;
+  CPPUNIT_ASSERT(parser.nextLine());
+  CPPUNIT_ASSERT(parser.readInt(&value));
+  CPPUNIT_ASSERT_EQUAL(0L, value);
+  CPPUNIT_ASSERT(parser.readInt(&value));
+  CPPUNIT_ASSERT_EQUAL(-12L, value);
+  CPPUNIT_ASSERT(parser.readInt(&value));
+  CPPUNIT_ASSERT_EQUAL(7L, value);
+  CPPUNIT_ASSERT(!parser.readInt(&value)); // comment
+  CPPUNIT_ASSERT(parser.endOfLine());
+
+  CPPUNIT_ASSERT(parser.nextLine());
+  CPPUNIT_ASSERT(!parser.readInt(&value)); // trailing characters
+  CPPUNIT_ASSERT_EQUAL(7L, value);
+
+  PYLITH_METHOD_END;
+} // testReadInt
+
+// ----------------------------------------------------------------------
+// Test readDouble().
+void
+pylith::meshio::TestMappedLineParser::testReadDouble(void)
+{ // testReadDouble
+  PYLITH_METHOD_BEGIN;
+
+  const char* contents =
+    "  1.5 -2.0e+03\t4 abc\n"
+    "3.25";
+
+  MappedLineParser parser;
+  parser.buffer(contents, strlen(contents));
+
+  double value = 0.0;
+  CPPUNIT_ASSERT(parser.nextLine());
+  CPPUNIT_ASSERT(parser.readDouble(&value));
+  CPPUNIT_ASSERT_EQUAL(1.5, value);
+  CPPUNIT_ASSERT(parser.readDouble(&value));
+  CPPUNIT_ASSERT_EQUAL(-2.0e+03, value);
+  CPPUNIT_ASSERT(parser.readDouble(&value));
+  CPPUNIT_ASSERT_EQUAL(4.0, value);
+  CPPUNIT_ASSERT(!parser.readDouble(&value));
+  CPPUNIT_ASSERT_EQUAL(4.0, value);
+
+  // Last value is not followed by a newline.
+  CPPUNIT_ASSERT(parser.nextLine());
+  CPPUNIT_ASSERT(parser.readDouble(&value));
+  CPPUNIT_ASSERT_EQUAL(3.25, value);
+  CPPUNIT_ASSERT(parser.endOfLine());
+
+  PYLITH_METHOD_END;
+} // testReadDouble
+
+
+// End of file 
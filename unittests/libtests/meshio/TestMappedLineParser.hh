@@ -0,0 +1,77 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+/**
+ * @file unittests/libtests/meshio/TestMappedLineParser.hh
+ *
+ * @brief C++ TestMappedLineParser object
+ *
+ * C++ unit testing for MappedLineParser.
+ */
+
+#if !defined(pylith_meshio_testmappedlineparser_hh)
+#define pylith_meshio_testmappedlineparser_hh
+
+#include <cppunit/extensions/HelperMacros.h>
+
+/// Namespace for pylith package
+namespace pylith {
+  namespace meshio {
+    class TestMappedLineParser;
+  } // meshio
+} // pylith
+
+/// C++ unit testing for MappedLineParser
+class pylith::meshio::TestMappedLineParser : public CppUnit::TestFixture
+{ // class TestMappedLineParser
+
+  // CPPUNIT TEST SUITE /////////////////////////////////////////////////
+  CPPUNIT_TEST_SUITE( TestMappedLineParser );
+
+  CPPUNIT_TEST( testOpen );
+  CPPUNIT_TEST( testNext );
+  CPPUNIT_TEST( testIgnore );
+  CPPUNIT_TEST( testReadInt );
+  CPPUNIT_TEST( testReadDouble );
+
+  CPPUNIT_TEST_SUITE_END();
+
+  // PUBLIC METHODS /////////////////////////////////////////////////////
+public :
+
+  /// Test open() and close().
+  void testOpen(void);
+
+  /// Test next() and nextLine().
+  void testNext(void);
+
+  /// Test ignore().
+  void testIgnore(void);
+
+  /// Test readInt().
+  void testReadInt(void);
+
+  /// Test readDouble().
+  void testReadDouble(void);
+
+}; // class TestMappedLineParser
+
+#endif // pylith_meshio_testmappedlineparser_hh
+
+
+// End of file 
@@ -91,6 +91,25 @@ pylith::meshio::TestMeshIOAscii::testFilename(void)
   PYLITH_METHOD_END;
 } // testFilename
 
+// ----------------------------------------------------------------------
+// Test useFastParser()
+void
+pylith::meshio::TestMeshIOAscii::testUseFastParser(void)
+{ // testUseFastParser
+  PYLITH_METHOD_BEGIN;
+
+  MeshIOAscii iohandler;
+  CPPUNIT_ASSERT_EQUAL(true, iohandler.useFastParser()); // default
+
+  iohandler.useFastParser(false);
+  CPPUNIT_ASSERT_EQUAL(false, iohandler.useFastParser());
+
+  iohandler.useFastParser(true);
+  CPPUNIT_ASSERT_EQUAL(true, iohandler.useFastParser());
+
+  PYLITH_METHOD_END;
+} // testUseFastParser
+
 // ----------------------------------------------------------------------
 // Test write() and read() for 1D mesh.
 void
@@ -203,6 +222,22 @@ pylith::meshio::TestMeshIOAscii::testReadComments(void)
   PYLITH_METHOD_END;
 } // testWriteReadComments
 
+// ----------------------------------------------------------------------
+// Test read() using stream parser instead of fast parser.
+void
+pylith::meshio::TestMeshIOAscii::testReadStreamParser(void)
+{ // testReadStreamParser
+  PYLITH_METHOD_BEGIN;
+
+  MeshData3DIndexOne data3D;
+  _testRead(data3D, "data/mesh3DIndexOne.txt", false);
+
+  MeshData2D data2D;
+  _testRead(data2D, "data/mesh2D_comments.txt", false);
+
+  PYLITH_METHOD_END;
+} // testReadStreamParser
+
 // ----------------------------------------------------------------------
 // Build mesh, perform write() and read(), and then check values.
 void
@@ -232,13 +267,15 @@ pylith::meshio::TestMeshIOAscii::_testWriteRead(const MeshData& data,
 // Read mesh and then check values.
 void
 pylith::meshio::TestMeshIOAscii::_testRead(const MeshData& data,
-					   const char* filename)
+					   const char* filename,
+					   const bool useFastParser)
 { // _testWriteRead
   PYLITH_METHOD_BEGIN;
 
   // Read mesh
   MeshIOAscii iohandler;
   iohandler.filename(filename);
+  iohandler.useFastParser(useFastParser);
   delete _mesh; _mesh = new topology::Mesh;
   iohandler.read(_mesh);
 
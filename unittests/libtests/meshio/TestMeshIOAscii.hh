@@ -49,6 +49,7 @@ class pylith::meshio::TestMeshIOAscii : public TestMeshIO
   CPPUNIT_TEST( testDebug );
   CPPUNIT_TEST( testInterpolate );
   CPPUNIT_TEST( testFilename );
+  CPPUNIT_TEST( testUseFastParser );
   CPPUNIT_TEST( testWriteRead1D );
   CPPUNIT_TEST( testWriteRead1Din2D );
   CPPUNIT_TEST( testWriteRead1Din3D );
@@ -57,6 +58,7 @@ class pylith::meshio::TestMeshIOAscii : public TestMeshIO
   CPPUNIT_TEST( testWriteRead3D );
   CPPUNIT_TEST( testRead3DIndexOne );
   CPPUNIT_TEST( testReadComments );
+  CPPUNIT_TEST( testReadStreamParser );
 
   CPPUNIT_TEST_SUITE_END();
 
@@ -75,6 +77,9 @@ public :
   /// Test filename()
   void testFilename(void);
 
+  /// Test useFastParser()
+  void testUseFastParser(void);
+
   /// Test write() and read() for 1D mesh in 1D space.
   void testWriteRead1D(void);
 
@@ -99,6 +104,9 @@ public :
   /// Test and read() for 2D mesh in 2D space with comments.
   void testReadComments(void);
 
+  /// Test read() using stream parser instead of fast parser.
+  void testReadStreamParser(void);
+
   // PRIVATE METHODS ////////////////////////////////////////////////////
 private :
 
@@ -114,9 +122,11 @@ private :
    *
    * @param data Mesh data
    * @param filename Name of mesh file to read
+   * @param useFastParser True to use fast parser, false otherwise.
    */
   void _testRead(const MeshData& data,
-		 const char* filename);
+		 const char* filename,
+		 const bool useFastParser =true);
 
 }; // class TestMeshIOAscii
 
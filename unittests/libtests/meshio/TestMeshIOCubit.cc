@@ -145,17 +145,37 @@ pylith::meshio::TestMeshIOCubit::testReadHex(void)
   PYLITH_METHOD_END;
 } // testReadHex
 
+// ----------------------------------------------------------------------
+// Test read() with each process reading its own portion of the mesh.
+void
+pylith::meshio::TestMeshIOCubit::testReadParallel(void)
+{ // testReadParallel
+  PYLITH_METHOD_BEGIN;
+
+  const bool parallelRead = true;
+
+  MeshDataCubitTri dataTri;
+  _testRead(dataTri, "data/twotri3_13.0.exo", parallelRead);
+
+  MeshDataCubitHex dataHex;
+  _testRead(dataHex, "data/twohex8_12.2.exo", parallelRead);
+
+  PYLITH_METHOD_END;
+} // testReadParallel
+
 // ----------------------------------------------------------------------
 // Build mesh, perform read(), and then check values.
 void
 pylith::meshio::TestMeshIOCubit::_testRead(const MeshData& data,
-					   const char* filename)
+					   const char* filename,
+					   const bool parallelRead)
 { // _testRead
   PYLITH_METHOD_BEGIN;
 
   MeshIOCubit iohandler;
   iohandler.filename(filename);
   iohandler.useNodesetNames(true);
+  iohandler.useParallelRead(parallelRead);
 
   // Read mesh
   delete _mesh; _mesh = new topology::Mesh;
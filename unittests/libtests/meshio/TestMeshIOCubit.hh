@@ -52,6 +52,7 @@ class pylith::meshio::TestMeshIOCubit : public TestMeshIO
   CPPUNIT_TEST( testReadQuad );
   CPPUNIT_TEST( testReadTet );
   CPPUNIT_TEST( testReadHex );
+  CPPUNIT_TEST( testReadParallel );
   CPPUNIT_TEST( testOrientLine );
   CPPUNIT_TEST( testOrientTri );
   CPPUNIT_TEST( testOrientQuad );
@@ -86,6 +87,9 @@ public :
   /// Test read() for mesh with hexahedral cells.
   void testReadHex(void);
 
+  /// Test read() with each process reading its own portion of the mesh.
+  void testReadParallel(void);
+
   /// Test _orientCells with line cells.
   void testOrientLine(void);
 
@@ -108,9 +112,11 @@ private :
    *
    * @param data Mesh data
    * @param filename Name of mesh file to read
+   * @param parallelRead True if each process reads its own portion of the mesh.
    */
   void _testRead(const MeshData& data,
-		 const char* filename);
+		 const char* filename,
+		 const bool parallelRead =false);
 
 }; // class TestMeshIOCubit
 
@@ -0,0 +1,258 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "TestMeshIOCubitMPI.hh" // Implementation of class methods
+
+#include "pylith/meshio/MeshIOCubit.hh" // USES MeshIOCubit
+
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/Stratum.hh" // USES Stratum
+#include "pylith/topology/CoordsVisitor.hh" // USES CoordsVisitor
+
+#include "data/MeshDataCubitTri.hh"
+#include "data/MeshDataCubitHex.hh"
+
+#include <vector> // USES std::vector
+#include <algorithm> // USES std::sort()
+#include <cmath> // USES fabs()
+
+// ----------------------------------------------------------------------
+CPPUNIT_TEST_SUITE_REGISTRATION( pylith::meshio::TestMeshIOCubitMPI );
+
+// ----------------------------------------------------------------------
+void
+pylith::meshio::TestMeshIOCubitMPI::setUp(void)
+{ // setUp
+  PYLITH_METHOD_BEGIN;
+
+  _mesh = 0;
+
+  PYLITH_METHOD_END;
+} // setUp
+
+// ----------------------------------------------------------------------
+void
+pylith::meshio::TestMeshIOCubitMPI::tearDown(void)
+{ // tearDown
+  PYLITH_METHOD_BEGIN;
+
+  delete _mesh; _mesh = 0;
+
+  PYLITH_METHOD_END;
+} // tearDown
+
+// ----------------------------------------------------------------------
+// Test read() for mesh with triangle cells.
+void
+pylith::meshio::TestMeshIOCubitMPI::testReadTri(void)
+{ // testReadTri
+  PYLITH_METHOD_BEGIN;
+
+  MeshDataCubitTri data;
+  _testRead(data, "data/twotri3_13.0.exo");
+
+  PYLITH_METHOD_END;
+} // testReadTri
+
+// ----------------------------------------------------------------------
+// Test read() for mesh with hexahedral cells.
+void
+pylith::meshio::TestMeshIOCubitMPI::testReadHex(void)
+{ // testReadHex
+  PYLITH_METHOD_BEGIN;
+
+  MeshDataCubitHex data;
+  _testRead(data, "data/twohex8_12.2.exo");
+
+  PYLITH_METHOD_END;
+} // testReadHex
+
+// ----------------------------------------------------------------------
+// Perform read() in parallel and check values.
+void
+pylith::meshio::TestMeshIOCubitMPI::_testRead(const MeshData& data,
+					      const char* filename)
+{ // _testRead
+  PYLITH_METHOD_BEGIN;
+
+  MeshIOCubit iohandler;
+  iohandler.filename(filename);
+  iohandler.useNodesetNames(true);
+  iohandler.useParallelRead(true);
+
+  delete _mesh; _mesh = new topology::Mesh;
+  iohandler.read(_mesh);
+
+  const MPI_Comm comm = _mesh->comm();
+  int commSize = 0;
+  PetscErrorCode err = MPI_Comm_size(comm, &commSize);PYLITH_CHECK_ERROR(err);
+  CPPUNIT_ASSERT(commSize > 1);
+
+  CPPUNIT_ASSERT_EQUAL(data.cellDim, _mesh->dimension());
+  const int spaceDim = data.spaceDim;
+
+  PetscDM dmMesh = _mesh->dmMesh();CPPUNIT_ASSERT(dmMesh);
+  topology::Stratum verticesStratum(dmMesh, topology::Stratum::DEPTH, 0);
+  const PetscInt vStart = verticesStratum.begin();
+  const PetscInt vEnd = verticesStratum.end();
+  topology::Stratum cellsStratum(dmMesh, topology::Stratum::HEIGHT, 0);
+  const PetscInt cStart = cellsStratum.begin();
+  const PetscInt cEnd = cellsStratum.end();
+
+  // Each process reads a disjoint block of cells, so no process holds
+  // the entire mesh and each cell is read exactly once.
+  int numCellsLocal = cellsStratum.size();
+  CPPUNIT_ASSERT(numCellsLocal < data.numCells);
+  int numCellsGlobal = 0;
+  err = MPI_Allreduce(&numCellsLocal, &numCellsGlobal, 1, MPI_INT, MPI_SUM, comm);PYLITH_CHECK_ERROR(err);
+  CPPUNIT_ASSERT_EQUAL(data.numCells, numCellsGlobal);
+
+  // Check vertices: every local vertex is a vertex in the data and
+  // every vertex in the data is on some process.
+  topology::CoordsVisitor coordsVisitor(dmMesh);
+  const PetscScalar* coordsArray = coordsVisitor.localArray();
+  std::vector<int> vertexIndices(vEnd-vStart);
+  std::vector<int> vertexFound(data.numVertices, 0);
+  for (PetscInt v = vStart; v < vEnd; ++v) {
+    CPPUNIT_ASSERT_EQUAL(spaceDim, coordsVisitor.sectionDof(v));
+    const PetscInt off = coordsVisitor.sectionOffset(v);
+    const int index = _findVertex(data, &coordsArray[off]);
+    CPPUNIT_ASSERT(index >= 0);
+    vertexIndices[v-vStart] = index;
+    vertexFound[index] = 1;
+  } // for
+  std::vector<int> vertexFoundGlobal(data.numVertices, 0);
+  err = MPI_Allreduce(&vertexFound[0], &vertexFoundGlobal[0], data.numVertices, MPI_INT, MPI_MAX, comm);PYLITH_CHECK_ERROR(err);
+  for (int i = 0; i < data.numVertices; ++i) {
+    CPPUNIT_ASSERT_EQUAL(1, vertexFoundGlobal[i]);
+  } // for
+
+  // Check cells and materials: match each local cell to a cell in the
+  // data using its set of vertices.
+  std::vector<int> cellFound(data.numCells, 0);
+  for (PetscInt c = cStart; c < cEnd; ++c) {
+    PetscInt *closure = NULL;
+    PetscInt closureSize = 0;
+    std::vector<int> cone;
+    err = DMPlexGetTransitiveClosure(dmMesh, c, PETSC_TRUE, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
+    for (PetscInt p = 0; p < closureSize*2; p += 2) {
+      const PetscInt point = closure[p];
+      if ((point >= vStart) && (point < vEnd)) {
+        cone.push_back(vertexIndices[point-vStart]);
+      } // if
+    } // for
+    err = DMPlexRestoreTransitiveClosure(dmMesh, c, PETSC_TRUE, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
+    CPPUNIT_ASSERT_EQUAL(data.numCorners, int(cone.size()));
+    std::sort(cone.begin(), cone.end());
+
+    int cellIndex = -1;
+    for (int iCell = 0; iCell < data.numCells; ++iCell) {
+      std::vector<int> coneE(&data.cells[iCell*data.numCorners], &data.cells[(iCell+1)*data.numCorners]);
+      std::sort(coneE.begin(), coneE.end());
+      if (cone == coneE) {
+        cellIndex = iCell;
+        break;
+      } // if
+    } // for
+    CPPUNIT_ASSERT(cellIndex >= 0);
+    ++cellFound[cellIndex];
+
+    PetscInt matId = 0;
+    err = DMGetLabelValue(dmMesh, "material-id", c, &matId);PYLITH_CHECK_ERROR(err);
+    CPPUNIT_ASSERT_EQUAL(data.materialIds[cellIndex], int(matId));
+  } // for
+  std::vector<int> cellFoundGlobal(data.numCells, 0);
+  err = MPI_Allreduce(&cellFound[0], &cellFoundGlobal[0], data.numCells, MPI_INT, MPI_SUM, comm);PYLITH_CHECK_ERROR(err);
+  for (int i = 0; i < data.numCells; ++i) {
+    CPPUNIT_ASSERT_EQUAL(1, cellFoundGlobal[i]);
+  } // for
+
+  // Check groups: local vertices in each group belong to the group in
+  // the data and every vertex in the group is on some process.
+  for (int iGroup = 0, index = 0; iGroup < data.numGroups; index += data.groupSizes[iGroup++]) {
+    const char* name = data.groupNames[iGroup];
+    const int* groupE = &data.groups[index];
+    const int groupSize = data.groupSizes[iGroup];
+
+    std::vector<int> groupFound(groupSize, 0);
+    PetscBool hasLabel = PETSC_FALSE;
+    err = DMHasLabel(dmMesh, name, &hasLabel);PYLITH_CHECK_ERROR(err);
+    if (hasLabel) {
+      PetscInt numPoints = 0;
+      PetscIS pointIS = NULL;
+      const PetscInt *points = NULL;
+      err = DMGetStratumSize(dmMesh, name, 1, &numPoints);PYLITH_CHECK_ERROR(err);
+      err = DMGetStratumIS(dmMesh, name, 1, &pointIS);PYLITH_CHECK_ERROR(err);
+      if (numPoints > 0) {
+        err = ISGetIndices(pointIS, &points);PYLITH_CHECK_ERROR(err);
+      } // if
+      for (PetscInt p = 0; p < numPoints; ++p) {
+        CPPUNIT_ASSERT(points[p] >= vStart && points[p] < vEnd);
+        const int vertexIndex = vertexIndices[points[p]-vStart];
+        int iPoint = 0;
+        for (; iPoint < groupSize; ++iPoint) {
+          if (groupE[iPoint] == vertexIndex) {
+            groupFound[iPoint] = 1;
+            break;
+          } // if
+        } // for
+        CPPUNIT_ASSERT(iPoint < groupSize);
+      } // for
+      if (numPoints > 0) {
+        err = ISRestoreIndices(pointIS, &points);PYLITH_CHECK_ERROR(err);
+      } // if
+      err = ISDestroy(&pointIS);PYLITH_CHECK_ERROR(err);
+    } // if
+
+    std::vector<int> groupFoundGlobal(groupSize, 0);
+    err = MPI_Allreduce(&groupFound[0], &groupFoundGlobal[0], groupSize, MPI_INT, MPI_MAX, comm);PYLITH_CHECK_ERROR(err);
+    for (int i = 0; i < groupSize; ++i) {
+      CPPUNIT_ASSERT_EQUAL(1, groupFoundGlobal[i]);
+    } // for
+  } // for
+
+  PYLITH_METHOD_END;
+} // _testRead
+
+// ----------------------------------------------------------------------
+// Get index of vertex in mesh data matching coordinates.
+int
+pylith::meshio::TestMeshIOCubitMPI::_findVertex(const MeshData& data,
+						const PylithScalar* coords)
+{ // _findVertex
+  const PylithScalar tolerance = 1.0e-06;
+  const int spaceDim = data.spaceDim;
+  for (int iVertex = 0; iVertex < data.numVertices; ++iVertex) {
+    bool match = true;
+    for (int iDim = 0; iDim < spaceDim && match; ++iDim) {
+      const PylithScalar valueE = data.vertices[iVertex*spaceDim+iDim];
+      const PylithScalar scale = (fabs(valueE) > 1.0) ? fabs(valueE) : 1.0;
+      match = fabs(coords[iDim] - valueE) < tolerance*scale;
+    } // for
+    if (match) {
+      return iVertex;
+    } // if
+  } // for
+
+  return -1;
+} // _findVertex
+
+
+// End of file
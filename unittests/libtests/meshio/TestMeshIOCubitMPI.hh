@@ -0,0 +1,107 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+/**
+ * @file unittests/libtests/meshio/TestMeshIOCubitMPI.hh
+ *
+ * @brief C++ unit testing for MeshIOCubit with each process reading
+ * its own portion of the mesh.
+ *
+ * Run on 2 or more processes.
+ */
+
+#if !defined(pylith_meshio_testmeshiocubitmpi_hh)
+#define pylith_meshio_testmeshiocubitmpi_hh
+
+// Include directives ---------------------------------------------------
+#include <cppunit/extensions/HelperMacros.h>
+
+#include "pylith/topology/topologyfwd.hh" // forward declarations
+#include "pylith/utils/types.hh" // HASA PylithScalar
+
+// Forward declarations -------------------------------------------------
+/// Namespace for pylith package
+namespace pylith {
+  namespace meshio {
+    class TestMeshIOCubitMPI;
+    class MeshData;
+  } // meshio
+} // pylith
+
+// TestMeshIOCubitMPI ---------------------------------------------------
+/// C++ unit testing for MeshIOCubit with parallel read.
+class pylith::meshio::TestMeshIOCubitMPI : public CppUnit::TestFixture
+{ // class TestMeshIOCubitMPI
+
+  // CPPUNIT TEST SUITE /////////////////////////////////////////////////
+  CPPUNIT_TEST_SUITE( TestMeshIOCubitMPI );
+
+  CPPUNIT_TEST( testReadTri );
+  CPPUNIT_TEST( testReadHex );
+
+  CPPUNIT_TEST_SUITE_END();
+
+  // PUBLIC METHODS /////////////////////////////////////////////////////
+public :
+
+  /// Setup test data.
+  void setUp(void);
+
+  /// Tear down test data.
+  void tearDown(void);
+
+  /// Test read() for mesh with triangle cells.
+  void testReadTri(void);
+
+  /// Test read() for mesh with hexahedral cells.
+  void testReadHex(void);
+
+  // PRIVATE METHODS ////////////////////////////////////////////////////
+private :
+
+  /** Perform read() with each process reading a block of cells and
+   * vertices and check that the union of the local meshes matches the
+   * data.
+   *
+   * @param data Mesh data
+   * @param filename Name of mesh file to read
+   */
+  void _testRead(const MeshData& data,
+		 const char* filename);
+
+  /** Get index of vertex in mesh data matching coordinates.
+   *
+   * @param data Mesh data
+   * @param coords Coordinates of vertex.
+   *
+   * @returns Index of vertex in data (-1 if not found).
+   */
+  int _findVertex(const MeshData& data,
+		  const PylithScalar* coords);
+
+  // PRIVATE MEMBERS ////////////////////////////////////////////////////
+private :
+
+  topology::Mesh* _mesh; ///< Mesh read in parallel.
+
+}; // class TestMeshIOCubitMPI
+
+#endif // pylith_meshio_testmeshiocubitmpi_hh
+
+
+// End of file
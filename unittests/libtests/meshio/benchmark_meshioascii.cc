@@ -0,0 +1,165 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+/** @file unittests/libtests/meshio/benchmark_meshioascii.cc
+ *
+ * Benchmark parse throughput of MeshIOAscii with the fast
+ * (memory-mapped) parser and the stream (LineParser) parser.
+ *
+ * Usage: benchmark_meshioascii [NX] [NREPEAT]
+ *
+ * Writes a 2-D mesh of 2*NX*NX triangular cells with a vertex group
+ * to a temporary file and reports the best time and throughput of
+ * reading it with each parser. Times include building the mesh,
+ * which is the same for both parsers.
+ *
+ * Build with 'make benchmark_meshioascii' (not built by 'make check').
+ */
+
+#include <portinfo>
+
+#include "pylith/meshio/MeshIOAscii.hh" // USES MeshIOAscii
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/utils/error.h" // USES PYLITH_CHECK_ERROR
+
+#include <petsc.h>
+#include <petsctime.h> // USES PetscTime()
+#include <Python.h>
+
+#include <cstdio> // USES fopen(), fprintf()
+#include <cstdlib> // USES atoi()
+#include <iostream> // USES std::cout
+#include <iomanip> // USES std::setw()
+#include <stdexcept> // USES std::runtime_error
+
+// ----------------------------------------------------------------------
+// Write 2-D mesh of triangular cells in PyLith ASCII format.
+static
+long
+writeMesh(const char* filename,
+	  const int nx)
+{ // writeMesh
+  FILE* fout = fopen(filename, "w");
+  if (!fout)
+    throw std::runtime_error("Could not open benchmark mesh file for writing.");
+
+  const int numVertices = (nx+1)*(nx+1);
+  const int numCells = 2*nx*nx;
+  const double dx = 1.0 / nx;
+
+  fprintf(fout, "mesh = {\n  dimension = 2\n  use-index-zero = true\n");
+  fprintf(fout, "  vertices = {\n    dimension = 2\n    count = %d\n    coordinates = {\n", numVertices);
+  for (int j=0, iVertex=0; j <= nx; ++j)
+    for (int i=0; i <= nx; ++i, ++iVertex)
+      fprintf(fout, "      %8d%18.6e%18.6e\n", iVertex, i*dx, j*dx);
+  fprintf(fout, "    }\n  }\n");
+
+  fprintf(fout, "  cells = {\n    count = %d\n    num-corners = 3\n    simplices = {\n", numCells);
+  for (int j=0, iCell=0; j < nx; ++j)
+    for (int i=0; i < nx; ++i) {
+      const int v0 = j*(nx+1) + i;
+      const int v1 = v0 + 1;
+      const int v2 = v0 + (nx+1);
+      const int v3 = v2 + 1;
+      fprintf(fout, "      %8d%8d%8d%8d\n", iCell++, v0, v1, v3);
+      fprintf(fout, "      %8d%8d%8d%8d\n", iCell++, v0, v3, v2);
+    } // for
+  fprintf(fout, "    }\n    material-ids = {\n");
+  for (int iCell=0; iCell < numCells; ++iCell)
+    fprintf(fout, "      %8d%4d\n", iCell, 1 + iCell % 2);
+  fprintf(fout, "    }\n  }\n");
+
+  fprintf(fout, "  group = {\n    name = x_neg\n    type = vertices\n    count = %d\n    indices = {\n", nx+1);
+  for (int j=0; j <= nx; ++j)
+    fprintf(fout, "      %d\n", j*(nx+1));
+  fprintf(fout, "    }\n  }\n}\n");
+
+  const long nbytes = ftell(fout);
+  fclose(fout);
+
+  return nbytes;
+} // writeMesh
+
+// ----------------------------------------------------------------------
+// Get best time for reading mesh.
+static
+PetscLogDouble
+timeRead(const char* filename,
+	 const bool useFastParser,
+	 const int numRepeat)
+{ // timeRead
+  pylith::meshio::MeshIOAscii iohandler;
+  iohandler.filename(filename);
+  iohandler.useFastParser(useFastParser);
+  iohandler.interpolate(false);
+
+  PetscLogDouble best = 0.0;
+  for (int iRepeat=0; iRepeat < numRepeat; ++iRepeat) {
+    pylith::topology::Mesh mesh;
+    PetscLogDouble tstart = 0.0, tstop = 0.0;
+    PetscErrorCode err = PetscTime(&tstart);PYLITH_CHECK_ERROR(err);
+    iohandler.read(&mesh);
+    err = PetscTime(&tstop);PYLITH_CHECK_ERROR(err);
+    if (0 == iRepeat || tstop - tstart < best)
+      best = tstop - tstart;
+  } // for
+
+  return best;
+} // timeRead
+
+// ----------------------------------------------------------------------
+int
+main(int argc,
+     char* argv[])
+{ // main
+  const int nx = (argc > 1) ? atoi(argv[1]) : 500;
+  const int numRepeat = (argc > 2) ? atoi(argv[2]) : 3;
+  const char* filename = "benchmark_meshioascii.txt";
+
+  PetscErrorCode err = PetscInitialize(&argc, &argv, NULL, NULL);CHKERRQ(err);
+  Py_Initialize();
+
+  try {
+    const long nbytes = writeMesh(filename, nx);
+    const double mbytes = nbytes / (1024.0*1024.0);
+
+    const PetscLogDouble tStream = timeRead(filename, false, numRepeat);
+    const PetscLogDouble tFast = timeRead(filename, true, numRepeat);
+
+    std::cout
+      << "Mesh: " << 2*nx*nx << " cells, " << (nx+1)*(nx+1) << " vertices, "
+      << mbytes << " MB\n"
+      << std::setw(8) << "stream" << ": " << tStream << " s, "
+      << mbytes / tStream << " MB/s\n"
+      << std::setw(8) << "fast" << ": " << tFast << " s, "
+      << mbytes / tFast << " MB/s\n"
+      << "Speedup: " << tStream / tFast << std::endl;
+  } catch (const std::exception& err) {
+    std::cerr << "Error: " << err.what() << std::endl;
+  } // catch
+
+  remove(filename);
+
+  Py_Finalize();
+  err = PetscFinalize();CHKERRQ(err);
+
+  return 0;
+} // main
+
+
+// End of file
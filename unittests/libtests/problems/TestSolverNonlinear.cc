@@ -0,0 +1,521 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "TestSolverNonlinear.hh" // Implementation of class methods
+
+#include "pylith/problems/SolverNonlinear.hh" // USES SolverNonlinear
+#include "pylith/problems/Formulation.hh" // USES Formulation
+
+#include "pylith/feassemble/Integrator.hh" // ISA Integrator
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/Field.hh" // USES Field
+#include "pylith/topology/SolutionFields.hh" // USES SolutionFields
+#include "pylith/topology/Jacobian.hh" // USES Jacobian
+#include "pylith/topology/Stratum.hh" // USES Stratum
+#include "pylith/topology/VisitorMesh.hh" // USES VecVisitorMesh
+#include "pylith/meshio/MeshIOAscii.hh" // USES MeshIOAscii
+
+#include "spatialdata/geocoords/CSCart.hh" // USES CSCart
+
+#include <petscsnes.h> // USES SNES
+
+#include <stdexcept> // USES std::runtime_error
+
+// ----------------------------------------------------------------------
+CPPUNIT_TEST_SUITE_REGISTRATION( pylith::problems::TestSolverNonlinear );
+
+// ----------------------------------------------------------------------
+namespace pylith {
+  namespace problems {
+    namespace _TestSolverNonlinear {
+
+      /// Integrator for the nonlinear system u^3 + u = b at each
+      /// degree of freedom, with b = value + scale*(vertex index).
+      class Integrator : public feassemble::Integrator {
+      public :
+	Integrator(const PylithScalar value,
+		   const PylithScalar scale) :
+	  _value(value),
+	  _scale(scale)
+	{}
+
+	void integrateResidual(const topology::Field& residual,
+			       const PylithScalar t,
+			       topology::SolutionFields* const fields) {
+	  CPPUNIT_ASSERT(fields);
+	  PetscDM dmMesh = residual.mesh().dmMesh();CPPUNIT_ASSERT(dmMesh);
+	  topology::Stratum verticesStratum(dmMesh, topology::Stratum::DEPTH, 0);
+	  const PetscInt vStart = verticesStratum.begin();
+	  const PetscInt vEnd = verticesStratum.end();
+
+	  topology::VecVisitorMesh solutionVisitor(fields->solution());
+	  const PetscScalar* solutionArray = solutionVisitor.localArray();
+	  topology::VecVisitorMesh residualVisitor(residual);
+	  PetscScalar* residualArray = residualVisitor.localArray();
+	  for (PetscInt v = vStart; v < vEnd; ++v) {
+	    const PetscInt off = residualVisitor.sectionOffset(v);
+	    const PetscInt dof = residualVisitor.sectionDof(v);
+	    const PetscInt soff = solutionVisitor.sectionOffset(v);
+	    for (PetscInt d = 0; d < dof; ++d) {
+	      const PylithScalar u = solutionArray[soff+d];
+	      residualArray[off+d] += _value + _scale*(v-vStart) - (u*u*u + u);
+	    } // for
+	  } // for
+	} // integrateResidual
+
+	void integrateJacobian(topology::Jacobian* jacobian,
+			       const PylithScalar t,
+			       topology::SolutionFields* const fields) {
+	  CPPUNIT_ASSERT(jacobian);
+	  CPPUNIT_ASSERT(fields);
+	  const topology::Field& solution = fields->solution();
+	  PetscDM dmMesh = solution.mesh().dmMesh();CPPUNIT_ASSERT(dmMesh);
+	  topology::Stratum verticesStratum(dmMesh, topology::Stratum::DEPTH, 0);
+	  const PetscInt vStart = verticesStratum.begin();
+	  const PetscInt vEnd = verticesStratum.end();
+
+	  topology::VecVisitorMesh solutionVisitor(solution);
+	  const PetscScalar* solutionArray = solutionVisitor.localArray();
+	  PetscSection globalSection = solution.globalSection();CPPUNIT_ASSERT(globalSection);
+	  PetscMat jacobianMat = jacobian->matrix();CPPUNIT_ASSERT(jacobianMat);
+
+	  PetscErrorCode err = 0;
+	  for (PetscInt v = vStart; v < vEnd; ++v) {
+	    PetscInt goff = 0;
+	    err = PetscSectionGetOffset(globalSection, v, &goff);PYLITH_CHECK_ERROR(err);
+	    if (goff < 0) {
+	      continue;
+	    } // if
+	    const PetscInt off = solutionVisitor.sectionOffset(v);
+	    const PetscInt dof = solutionVisitor.sectionDof(v);
+	    for (PetscInt d = 0; d < dof; ++d) {
+	      const PylithScalar u = solutionArray[off+d];
+	      err = MatSetValue(jacobianMat, goff+d, goff+d, 3.0*u*u + 1.0, ADD_VALUES);PYLITH_CHECK_ERROR(err);
+	    } // for
+	  } // for
+	} // integrateJacobian
+
+	void verifyConfiguration(const topology::Mesh& mesh) const {}
+
+	/** Check solution against u^3 + u = b.
+	 *
+	 * @param solution Solution field.
+	 */
+	void checkSolution(const topology::Field& solution) const {
+	  PetscDM dmMesh = solution.mesh().dmMesh();CPPUNIT_ASSERT(dmMesh);
+	  topology::Stratum verticesStratum(dmMesh, topology::Stratum::DEPTH, 0);
+	  const PetscInt vStart = verticesStratum.begin();
+	  const PetscInt vEnd = verticesStratum.end();
+
+	  topology::VecVisitorMesh solutionVisitor(solution);
+	  const PetscScalar* solutionArray = solutionVisitor.localArray();
+	  const PylithScalar tolerance = 1.0e-6;
+	  for (PetscInt v = vStart; v < vEnd; ++v) {
+	    const PetscInt off = solutionVisitor.sectionOffset(v);
+	    const PetscInt dof = solutionVisitor.sectionDof(v);
+	    const PylithScalar valueE = _value + _scale*(v-vStart);
+	    for (PetscInt d = 0; d < dof; ++d) {
+	      const PylithScalar u = solutionArray[off+d];
+	      CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, (u*u*u + u) / valueE, tolerance);
+	    } // for
+	  } // for
+	} // checkSolution
+
+      private :
+	PylithScalar _value; ///< Value of b at first vertex.
+	PylithScalar _scale; ///< Increment in b between vertices.
+      }; // Integrator
+
+      /// Formulation without rate fields.
+      class Formulation : public problems::Formulation {
+      protected :
+	void calcRateFields(void) {}
+      }; // Formulation
+
+    } // _TestSolverNonlinear
+  } // problems
+} // pylith
+
+// ----------------------------------------------------------------------
+// Setup testing data.
+void
+pylith::problems::TestSolverNonlinear::setUp(void)
+{ // setUp
+  PYLITH_METHOD_BEGIN;
+
+  _mesh = new topology::Mesh;CPPUNIT_ASSERT(_mesh);
+  meshio::MeshIOAscii iohandler;
+  iohandler.filename("data/tri3.mesh");
+  iohandler.read(_mesh);
+
+  const int spaceDim = 2;
+  spatialdata::geocoords::CSCart cs;
+  cs.setSpaceDim(spaceDim);
+  cs.initialize();
+  _mesh->coordsys(&cs);
+
+  _fields = new topology::SolutionFields(*_mesh);CPPUNIT_ASSERT(_fields);
+  _fields->add("dispIncr(t->t+dt)", "displacement_increment");
+  _fields->add("residual", "residual");
+  _fields->solutionName("dispIncr(t->t+dt)");
+
+  topology::Field& dispIncr = _fields->get("dispIncr(t->t+dt)");
+  dispIncr.newSection(topology::FieldBase::VERTICES_FIELD, spaceDim);
+  dispIncr.allocate();
+  dispIncr.zeroAll();
+  dispIncr.createScatter(*_mesh);
+
+  topology::Field& residual = _fields->get("residual");
+  residual.cloneSection(dispIncr);
+  residual.zeroAll();
+  residual.createScatter(*_mesh);
+
+  _jacobian = new topology::Jacobian(dispIncr);CPPUNIT_ASSERT(_jacobian);
+
+  PYLITH_METHOD_END;
+} // setUp
+
+// ----------------------------------------------------------------------
+// Tear down testing data.
+void
+pylith::problems::TestSolverNonlinear::tearDown(void)
+{ // tearDown
+  PYLITH_METHOD_BEGIN;
+
+  delete _jacobian; _jacobian = 0;
+  delete _fields; _fields = 0;
+  delete _mesh; _mesh = 0;
+
+  PYLITH_METHOD_END;
+} // tearDown
+
+// ----------------------------------------------------------------------
+// Test constructor.
+void
+pylith::problems::TestSolverNonlinear::testConstructor(void)
+{ // testConstructor
+  PYLITH_METHOD_BEGIN;
+
+  SolverNonlinear solver;
+
+  PYLITH_METHOD_END;
+} // testConstructor
+
+// ----------------------------------------------------------------------
+// Test solverType().
+void
+pylith::problems::TestSolverNonlinear::testSolverType(void)
+{ // testSolverType
+  PYLITH_METHOD_BEGIN;
+
+  SolverNonlinear solver;
+  CPPUNIT_ASSERT_EQUAL(SolverNonlinear::SOLVER_NEWTON, solver._solverType);
+
+  solver.solverType(SolverNonlinear::SOLVER_QUASI_NEWTON);
+  CPPUNIT_ASSERT_EQUAL(SolverNonlinear::SOLVER_QUASI_NEWTON, solver._solverType);
+
+  solver.solverType(SolverNonlinear::SOLVER_NRICHARDSON);
+  CPPUNIT_ASSERT_EQUAL(SolverNonlinear::SOLVER_NRICHARDSON, solver._solverType);
+
+  PYLITH_METHOD_END;
+} // testSolverType
+
+// ----------------------------------------------------------------------
+// Test adaptiveLinearTolerance().
+void
+pylith::problems::TestSolverNonlinear::testAdaptiveLinearTolerance(void)
+{ // testAdaptiveLinearTolerance
+  PYLITH_METHOD_BEGIN;
+
+  SolverNonlinear solver;
+  CPPUNIT_ASSERT_EQUAL(false, solver._adaptiveLinearTolerance);
+
+  solver.adaptiveLinearTolerance(true);
+  CPPUNIT_ASSERT_EQUAL(true, solver._adaptiveLinearTolerance);
+
+  PYLITH_METHOD_END;
+} // testAdaptiveLinearTolerance
+
+// ----------------------------------------------------------------------
+// Test lagJacobian().
+void
+pylith::problems::TestSolverNonlinear::testLagJacobian(void)
+{ // testLagJacobian
+  PYLITH_METHOD_BEGIN;
+
+  SolverNonlinear solver;
+  CPPUNIT_ASSERT_EQUAL(1, solver._lagJacobian);
+
+  solver.lagJacobian(3);
+  CPPUNIT_ASSERT_EQUAL(3, solver._lagJacobian);
+
+  CPPUNIT_ASSERT_THROW(solver.lagJacobian(0), std::runtime_error);
+  CPPUNIT_ASSERT_EQUAL(3, solver._lagJacobian);
+
+  PYLITH_METHOD_END;
+} // testLagJacobian
+
+// ----------------------------------------------------------------------
+// Test lagPreconditioner().
+void
+pylith::problems::TestSolverNonlinear::testLagPreconditioner(void)
+{ // testLagPreconditioner
+  PYLITH_METHOD_BEGIN;
+
+  SolverNonlinear solver;
+  CPPUNIT_ASSERT_EQUAL(1, solver._lagPreconditioner);
+
+  solver.lagPreconditioner(2);
+  CPPUNIT_ASSERT_EQUAL(2, solver._lagPreconditioner);
+
+  CPPUNIT_ASSERT_THROW(solver.lagPreconditioner(-1), std::runtime_error);
+  CPPUNIT_ASSERT_EQUAL(2, solver._lagPreconditioner);
+
+  PYLITH_METHOD_END;
+} // testLagPreconditioner
+
+// ----------------------------------------------------------------------
+// Test initialize() with Newton solver.
+void
+pylith::problems::TestSolverNonlinear::testInitializeNewton(void)
+{ // testInitializeNewton
+  PYLITH_METHOD_BEGIN;
+
+  _TestSolverNonlinear::Integrator integrator(0.5, 0.1);
+  feassemble::Integrator* integrators[1] = { &integrator };
+  _TestSolverNonlinear::Formulation formulation;
+  formulation.integrators(integrators, 1);
+
+  SolverNonlinear solver;
+  solver.skipNullSpaceCreation(true);
+  solver.solverType(SolverNonlinear::SOLVER_NEWTON);
+  solver.adaptiveLinearTolerance(true);
+  solver.lagJacobian(3);
+  solver.lagPreconditioner(2);
+  solver.initialize(*_fields, *_jacobian, &formulation);
+  CPPUNIT_ASSERT(solver._snes);
+
+  PetscErrorCode err = 0;
+  PetscBool isType = PETSC_FALSE;
+  err = PetscObjectTypeCompare((PetscObject) solver._snes, SNESNEWTONLS, &isType);PYLITH_CHECK_ERROR(err);
+  CPPUNIT_ASSERT(isType);
+
+  // Newton uses our custom line search.
+  PetscSNESLineSearch ls = 0;
+  err = SNESGetLineSearch(solver._snes, &ls);PYLITH_CHECK_ERROR(err);
+  err = PetscObjectTypeCompare((PetscObject) ls, SNESLINESEARCHSHELL, &isType);PYLITH_CHECK_ERROR(err);
+  CPPUNIT_ASSERT(isType);
+
+  PetscBool useEW = PETSC_FALSE;
+  err = SNESKSPGetUseEW(solver._snes, &useEW);PYLITH_CHECK_ERROR(err);
+  CPPUNIT_ASSERT(useEW);
+
+  PetscInt lag = 0;
+  err = SNESGetLagJacobian(solver._snes, &lag);PYLITH_CHECK_ERROR(err);
+  CPPUNIT_ASSERT_EQUAL(PetscInt(3), lag);
+  err = SNESGetLagPreconditioner(solver._snes, &lag);PYLITH_CHECK_ERROR(err);
+  CPPUNIT_ASSERT_EQUAL(PetscInt(2), lag);
+
+  PYLITH_METHOD_END;
+} // testInitializeNewton
+
+// ----------------------------------------------------------------------
+// Test initialize() with nonlinear Richardson solver.
+void
+pylith::problems::TestSolverNonlinear::testInitializeNRichardson(void)
+{ // testInitializeNRichardson
+  PYLITH_METHOD_BEGIN;
+
+  _TestSolverNonlinear::Integrator integrator(0.5, 0.1);
+  feassemble::Integrator* integrators[1] = { &integrator };
+  _TestSolverNonlinear::Formulation formulation;
+  formulation.integrators(integrators, 1);
+
+  SolverNonlinear solver;
+  solver.skipNullSpaceCreation(true);
+  solver.solverType(SolverNonlinear::SOLVER_NRICHARDSON);
+  solver.initialize(*_fields, *_jacobian, &formulation);
+  CPPUNIT_ASSERT(solver._snes);
+
+  PetscErrorCode err = 0;
+  PetscBool isType = PETSC_FALSE;
+  err = PetscObjectTypeCompare((PetscObject) solver._snes, SNESNRICHARDSON, &isType);PYLITH_CHECK_ERROR(err);
+  CPPUNIT_ASSERT(isType);
+
+  // Our line search requires the Jacobian, so it is not used.
+  PetscSNESLineSearch ls = 0;
+  err = SNESGetLineSearch(solver._snes, &ls);PYLITH_CHECK_ERROR(err);
+  err = PetscObjectTypeCompare((PetscObject) ls, SNESLINESEARCHSHELL, &isType);PYLITH_CHECK_ERROR(err);
+  CPPUNIT_ASSERT(!isType);
+
+  PetscBool useEW = PETSC_TRUE;
+  err = SNESKSPGetUseEW(solver._snes, &useEW);PYLITH_CHECK_ERROR(err);
+  CPPUNIT_ASSERT(!useEW);
+
+  PetscInt lag = 0;
+  err = SNESGetLagJacobian(solver._snes, &lag);PYLITH_CHECK_ERROR(err);
+  CPPUNIT_ASSERT_EQUAL(PetscInt(1), lag);
+  err = SNESGetLagPreconditioner(solver._snes, &lag);PYLITH_CHECK_ERROR(err);
+  CPPUNIT_ASSERT_EQUAL(PetscInt(1), lag);
+
+  PYLITH_METHOD_END;
+} // testInitializeNRichardson
+
+// ----------------------------------------------------------------------
+// Test initialize() with quasi-Newton solver.
+void
+pylith::problems::TestSolverNonlinear::testInitializeQuasiNewton(void)
+{ // testInitializeQuasiNewton
+  PYLITH_METHOD_BEGIN;
+
+  _TestSolverNonlinear::Integrator integrator(0.5, 0.1);
+  feassemble::Integrator* integrators[1] = { &integrator };
+  _TestSolverNonlinear::Formulation formulation;
+  formulation.integrators(integrators, 1);
+
+  SolverNonlinear solver;
+  solver.skipNullSpaceCreation(true);
+  solver.solverType(SolverNonlinear::SOLVER_QUASI_NEWTON);
+  solver.lagJacobian(2);
+  solver.initialize(*_fields, *_jacobian, &formulation);
+  CPPUNIT_ASSERT(solver._snes);
+
+  PetscErrorCode err = 0;
+  PetscBool isType = PETSC_FALSE;
+  err = PetscObjectTypeCompare((PetscObject) solver._snes, SNESQN, &isType);PYLITH_CHECK_ERROR(err);
+  CPPUNIT_ASSERT(isType);
+
+  PetscSNESLineSearch ls = 0;
+  err = SNESGetLineSearch(solver._snes, &ls);PYLITH_CHECK_ERROR(err);
+  err = PetscObjectTypeCompare((PetscObject) ls, SNESLINESEARCHSHELL, &isType);PYLITH_CHECK_ERROR(err);
+  CPPUNIT_ASSERT(!isType);
+
+  PetscInt lag = 0;
+  err = SNESGetLagJacobian(solver._snes, &lag);PYLITH_CHECK_ERROR(err);
+  CPPUNIT_ASSERT_EQUAL(PetscInt(2), lag);
+
+  PYLITH_METHOD_END;
+} // testInitializeQuasiNewton
+
+// ----------------------------------------------------------------------
+// Test solve() and counts of Jacobian and preconditioner reforms.
+void
+pylith::problems::TestSolverNonlinear::testSolve(void)
+{ // testSolve
+  PYLITH_METHOD_BEGIN;
+
+  SolverNonlinear solver;
+  int numIterations = 0;
+  _solve(&solver, &numIterations);
+
+  // Jacobian and preconditioner are reformed in every iteration.
+  CPPUNIT_ASSERT(numIterations > 1);
+  CPPUNIT_ASSERT_EQUAL(numIterations, solver._numJacobians);
+  CPPUNIT_ASSERT_EQUAL(numIterations, solver._numPCSetups);
+
+  PYLITH_METHOD_END;
+} // testSolve
+
+// ----------------------------------------------------------------------
+// Test solve() with lagged Jacobian.
+void
+pylith::problems::TestSolverNonlinear::testSolveLagJacobian(void)
+{ // testSolveLagJacobian
+  PYLITH_METHOD_BEGIN;
+
+  SolverNonlinear solver;
+  solver.lagJacobian(2);
+  int numIterations = 0;
+  _solve(&solver, &numIterations);
+
+  // Jacobian is reformed in iterations 0, 2, 4, ... along with the
+  // preconditioner.
+  CPPUNIT_ASSERT(numIterations > 1);
+  CPPUNIT_ASSERT_EQUAL((numIterations+1)/2, solver._numJacobians);
+  CPPUNIT_ASSERT_EQUAL(solver._numJacobians, solver._numPCSetups);
+
+  PYLITH_METHOD_END;
+} // testSolveLagJacobian
+
+// ----------------------------------------------------------------------
+// Test solve() with lagged preconditioner.
+void
+pylith::problems::TestSolverNonlinear::testSolveLagPreconditioner(void)
+{ // testSolveLagPreconditioner
+  PYLITH_METHOD_BEGIN;
+
+  SolverNonlinear solver;
+  solver.lagPreconditioner(2);
+  int numIterations = 0;
+  _solve(&solver, &numIterations);
+
+  // Jacobian is reformed in every iteration, preconditioner in
+  // iterations 0, 2, 4, ...
+  CPPUNIT_ASSERT(numIterations > 1);
+  CPPUNIT_ASSERT_EQUAL(numIterations, solver._numJacobians);
+  CPPUNIT_ASSERT_EQUAL((numIterations+1)/2, solver._numPCSetups);
+
+  PYLITH_METHOD_END;
+} // testSolveLagPreconditioner
+
+// ----------------------------------------------------------------------
+// Solve nonlinear problem and check solution.
+void
+pylith::problems::TestSolverNonlinear::_solve(SolverNonlinear* solver,
+					      int* numIterations)
+{ // _solve
+  PYLITH_METHOD_BEGIN;
+
+  CPPUNIT_ASSERT(solver);
+  CPPUNIT_ASSERT(numIterations);
+  CPPUNIT_ASSERT(_fields);
+  CPPUNIT_ASSERT(_jacobian);
+
+  _TestSolverNonlinear::Integrator integrator(0.5, 0.1);
+  feassemble::Integrator* integrators[1] = { &integrator };
+  _TestSolverNonlinear::Formulation formulation;
+  formulation.integrators(integrators, 1);
+  const PylithScalar t = 0.0;
+  const PylithScalar dt = 1.0;
+  formulation.updateSettings(_jacobian, _fields, t, dt);
+
+  solver->skipNullSpaceCreation(true);
+  solver->initialize(*_fields, *_jacobian, &formulation);
+
+  topology::Field& solution = _fields->solution();
+  const topology::Field& residual = _fields->get("residual");
+  solver->solve(&solution, _jacobian, residual);
+
+  PetscErrorCode err = 0;
+  SNESConvergedReason reason;
+  err = SNESGetConvergedReason(solver->_snes, &reason);PYLITH_CHECK_ERROR(err);
+  CPPUNIT_ASSERT(reason > 0);
+
+  PetscInt iterations = 0;
+  err = SNESGetIterationNumber(solver->_snes, &iterations);PYLITH_CHECK_ERROR(err);
+  *numIterations = iterations;
+
+  integrator.checkSolution(solution);
+
+  PYLITH_METHOD_END;
+} // _solve
+
+
+// End of file
@@ -0,0 +1,128 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+/**
+ * @file unittests/libtests/problems/TestSolverNonlinear.hh
+ *
+ * @brief C++ TestSolverNonlinear object.
+ *
+ * C++ unit testing for SolverNonlinear.
+ */
+
+#if !defined(pylith_problems_testsolvernonlinear_hh)
+#define pylith_problems_testsolvernonlinear_hh
+
+#include <cppunit/extensions/HelperMacros.h>
+
+#include "pylith/topology/topologyfwd.hh"
+
+/// Namespace for pylith package
+namespace pylith {
+  namespace problems {
+    class TestSolverNonlinear;
+    class SolverNonlinear;
+  } // problems
+} // pylith
+
+/// C++ unit testing for SolverNonlinear.
+class pylith::problems::TestSolverNonlinear : public CppUnit::TestFixture
+{ // class TestSolverNonlinear
+
+  // CPPUNIT TEST SUITE /////////////////////////////////////////////////
+  CPPUNIT_TEST_SUITE( TestSolverNonlinear );
+
+  CPPUNIT_TEST( testConstructor );
+  CPPUNIT_TEST( testSolverType );
+  CPPUNIT_TEST( testAdaptiveLinearTolerance );
+  CPPUNIT_TEST( testLagJacobian );
+  CPPUNIT_TEST( testLagPreconditioner );
+  CPPUNIT_TEST( testInitializeNewton );
+  CPPUNIT_TEST( testInitializeNRichardson );
+  CPPUNIT_TEST( testInitializeQuasiNewton );
+  CPPUNIT_TEST( testSolve );
+  CPPUNIT_TEST( testSolveLagJacobian );
+  CPPUNIT_TEST( testSolveLagPreconditioner );
+
+  CPPUNIT_TEST_SUITE_END();
+
+  // PUBLIC METHODS /////////////////////////////////////////////////////
+public :
+
+  /// Setup testing data.
+  void setUp(void);
+
+  /// Tear down testing data.
+  void tearDown(void);
+
+  /// Test constructor.
+  void testConstructor(void);
+
+  /// Test solverType().
+  void testSolverType(void);
+
+  /// Test adaptiveLinearTolerance().
+  void testAdaptiveLinearTolerance(void);
+
+  /// Test lagJacobian().
+  void testLagJacobian(void);
+
+  /// Test lagPreconditioner().
+  void testLagPreconditioner(void);
+
+  /// Test initialize() with Newton solver.
+  void testInitializeNewton(void);
+
+  /// Test initialize() with nonlinear Richardson solver.
+  void testInitializeNRichardson(void);
+
+  /// Test initialize() with quasi-Newton solver.
+  void testInitializeQuasiNewton(void);
+
+  /// Test solve() and counts of Jacobian and preconditioner reforms.
+  void testSolve(void);
+
+  /// Test solve() with lagged Jacobian.
+  void testSolveLagJacobian(void);
+
+  /// Test solve() with lagged preconditioner.
+  void testSolveLagPreconditioner(void);
+
+  // PRIVATE METHODS ////////////////////////////////////////////////////
+private :
+
+  /** Solve nonlinear problem and check solution.
+   *
+   * @param solver Nonlinear solver.
+   * @param numIterations Number of nonlinear iterations.
+   */
+  void _solve(SolverNonlinear* solver,
+	      int* numIterations);
+
+  // PRIVATE MEMBERS ////////////////////////////////////////////////////
+private :
+
+  topology::Mesh* _mesh; ///< Finite-element mesh.
+  topology::SolutionFields* _fields; ///< Solution fields.
+  topology::Jacobian* _jacobian; ///< Jacobian of system.
+
+}; // class TestSolverNonlinear
+
+#endif // pylith_problems_testsolvernonlinear_hh
+
+
+// End of file
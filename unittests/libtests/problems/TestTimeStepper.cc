@@ -0,0 +1,419 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "TestTimeStepper.hh" // Implementation of class methods
+
+#include "pylith/problems/TimeStepper.hh" // USES TimeStepper
+#include "pylith/problems/Formulation.hh" // USES Formulation
+#include "pylith/problems/SolverLumped.hh" // USES SolverLumped
+
+#include "pylith/feassemble/Integrator.hh" // ISA Integrator
+#include "pylith/bc/DirichletBC.hh" // USES DirichletBC
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/Field.hh" // USES Field
+#include "pylith/topology/SolutionFields.hh" // USES SolutionFields
+#include "pylith/topology/Stratum.hh" // USES Stratum
+#include "pylith/topology/VisitorMesh.hh" // USES VecVisitorMesh
+#include "pylith/meshio/MeshIOAscii.hh" // USES MeshIOAscii
+#include "pylith/utils/EventLogger.hh" // USES EventLogger
+
+#include "spatialdata/geocoords/CSCart.hh" // USES CSCart
+
+// ----------------------------------------------------------------------
+CPPUNIT_TEST_SUITE_REGISTRATION( pylith::problems::TestTimeStepper );
+
+// ----------------------------------------------------------------------
+namespace pylith {
+  namespace problems {
+    namespace _TestTimeStepper {
+
+      /// Integrator that adds value + scale*(vertex index) to the
+      /// residual and records the calls made by TimeStepper.
+      class Integrator : public feassemble::Integrator {
+      public :
+	Integrator(const bool needNewJacobian,
+		   const PylithScalar value,
+		   const PylithScalar scale) :
+	  tState(-1.0),
+	  numUpdates(0),
+	  _value(value),
+	  _scale(scale)
+	{ _needNewJacobian = needNewJacobian; }
+
+	PylithScalar timeStep(void) const { return _dt; }
+	using feassemble::Integrator::timeStep;
+
+	void integrateResidual(const topology::Field& residual,
+			       const PylithScalar t,
+			       topology::SolutionFields* const fields) {
+	  PetscDM dmMesh = residual.mesh().dmMesh();CPPUNIT_ASSERT(dmMesh);
+	  topology::Stratum verticesStratum(dmMesh, topology::Stratum::DEPTH, 0);
+	  const PetscInt vStart = verticesStratum.begin();
+	  const PetscInt vEnd = verticesStratum.end();
+
+	  topology::VecVisitorMesh residualVisitor(residual);
+	  PetscScalar* residualArray = residualVisitor.localArray();
+	  for (PetscInt v = vStart; v < vEnd; ++v) {
+	    const PetscInt off = residualVisitor.sectionOffset(v);
+	    const PetscInt dof = residualVisitor.sectionDof(v);
+	    for (PetscInt d = 0; d < dof; ++d) {
+	      residualArray[off+d] += _value + _scale*(v-vStart);
+	    } // for
+	  } // for
+	} // integrateResidual
+
+	void updateStateVars(const PylithScalar t,
+			     topology::SolutionFields* const fields) {
+	  tState = t;
+	  ++numUpdates;
+	} // updateStateVars
+
+	void verifyConfiguration(const topology::Mesh& mesh) const {}
+
+	PylithScalar tState; ///< Time of most recent update of state variables.
+	int numUpdates; ///< Number of updates of state variables.
+
+      private :
+	PylithScalar _value; ///< Value at first vertex.
+	PylithScalar _scale; ///< Increment in value between vertices.
+      }; // Integrator
+
+      /// Formulation without rate fields.
+      class Formulation : public problems::Formulation {
+      protected :
+	void calcRateFields(void) {}
+      }; // Formulation
+
+    } // _TestTimeStepper
+  } // problems
+} // pylith
+
+// ----------------------------------------------------------------------
+// Setup testing data.
+void
+pylith::problems::TestTimeStepper::setUp(void)
+{ // setUp
+  PYLITH_METHOD_BEGIN;
+
+  _mesh = new topology::Mesh;CPPUNIT_ASSERT(_mesh);
+  meshio::MeshIOAscii iohandler;
+  iohandler.filename("data/tri3.mesh");
+  iohandler.read(_mesh);
+
+  const int spaceDim = 2;
+  spatialdata::geocoords::CSCart cs;
+  cs.setSpaceDim(spaceDim);
+  cs.initialize();
+  _mesh->coordsys(&cs);
+
+  _fields = new topology::SolutionFields(*_mesh);CPPUNIT_ASSERT(_fields);
+  _fields->add("dispIncr(t->t+dt)", "displacement_increment");
+  _fields->add("disp(t)", "displacement");
+  _fields->add("disp(t-dt)", "displacement");
+  _fields->add("residual", "residual");
+  _fields->solutionName("dispIncr(t->t+dt)");
+
+  topology::Field& dispIncr = _fields->get("dispIncr(t->t+dt)");
+  dispIncr.newSection(topology::FieldBase::VERTICES_FIELD, spaceDim);
+  dispIncr.allocate();
+  dispIncr.zeroAll();
+  dispIncr.createScatter(*_mesh);
+
+  const char* names[] = { "disp(t)", "disp(t-dt)", "residual" };
+  const int numNames = 3;
+  for (int i=0; i < numNames; ++i) {
+    topology::Field& field = _fields->get(names[i]);
+    field.cloneSection(dispIncr);
+    field.zeroAll();
+  } // for
+  _fields->get("residual").createScatter(*_mesh);
+
+  _jacobian = new topology::Field(*_mesh);CPPUNIT_ASSERT(_jacobian);
+  _jacobian->label("jacobian");
+  _jacobian->cloneSection(dispIncr);
+  _setField(_jacobian, 2.0, 0.0);
+
+  PYLITH_METHOD_END;
+} // setUp
+
+// ----------------------------------------------------------------------
+// Tear down testing data.
+void
+pylith::problems::TestTimeStepper::tearDown(void)
+{ // tearDown
+  PYLITH_METHOD_BEGIN;
+
+  delete _jacobian; _jacobian = 0;
+  delete _fields; _fields = 0;
+  delete _mesh; _mesh = 0;
+
+  PYLITH_METHOD_END;
+} // tearDown
+
+// ----------------------------------------------------------------------
+// Test constructor.
+void
+pylith::problems::TestTimeStepper::testConstructor(void)
+{ // testConstructor
+  PYLITH_METHOD_BEGIN;
+
+  TimeStepper stepper;
+
+  PYLITH_METHOD_END;
+} // testConstructor
+
+// ----------------------------------------------------------------------
+// Test constraints().
+void
+pylith::problems::TestTimeStepper::testConstraints(void)
+{ // testConstraints
+  PYLITH_METHOD_BEGIN;
+
+  TimeStepper stepper;
+  stepper.constraints(0, 0);
+  CPPUNIT_ASSERT_EQUAL(size_t(0), stepper._constraints.size());
+
+  bc::DirichletBC bcA;
+  bc::DirichletBC bcB;
+  feassemble::Constraint* constraints[2] = { &bcA, &bcB };
+  const int numConstraints = 2;
+  stepper.constraints(constraints, numConstraints);
+  CPPUNIT_ASSERT_EQUAL(size_t(numConstraints), stepper._constraints.size());
+  for (int i=0; i < numConstraints; ++i)
+    CPPUNIT_ASSERT_EQUAL(constraints[i], stepper._constraints[i]);
+
+  PYLITH_METHOD_END;
+} // testConstraints
+
+// ----------------------------------------------------------------------
+// Test prestep().
+void
+pylith::problems::TestTimeStepper::testPrestep(void)
+{ // testPrestep
+  PYLITH_METHOD_BEGIN;
+
+  _TestTimeStepper::Integrator integratorA(false, 0.0, 0.0);
+  _TestTimeStepper::Integrator integratorB(false, 0.0, 0.0);
+  feassemble::Integrator* integrators[2] = { &integratorA, &integratorB };
+  _TestTimeStepper::Formulation formulation;
+  formulation.integrators(integrators, 2);
+
+  SolverLumped solver;
+  solver.initialize(*_fields, *_jacobian, &formulation);
+
+  TimeStepper stepper;
+  stepper.initialize(&formulation, &solver, _jacobian, _fields);
+
+  const PylithScalar t = 1.0;
+  const PylithScalar dt = 0.25;
+  CPPUNIT_ASSERT(!stepper.prestep(t, dt));
+  CPPUNIT_ASSERT_EQUAL(dt, integratorA.timeStep());
+  CPPUNIT_ASSERT_EQUAL(dt, integratorB.timeStep());
+
+  // Any integrator that needs a new Jacobian triggers reforming it.
+  _TestTimeStepper::Integrator integratorC(true, 0.0, 0.0);
+  integrators[1] = &integratorC;
+  formulation.integrators(integrators, 2);
+  CPPUNIT_ASSERT(stepper.prestep(t, dt));
+  CPPUNIT_ASSERT_EQUAL(dt, integratorC.timeStep());
+
+  PYLITH_METHOD_END;
+} // testPrestep
+
+// ----------------------------------------------------------------------
+// Test step().
+void
+pylith::problems::TestTimeStepper::testStep(void)
+{ // testStep
+  PYLITH_METHOD_BEGIN;
+
+  // Residual is the sum of the contributions from the integrators.
+  _TestTimeStepper::Integrator integratorA(false, 1.0, 0.5);
+  _TestTimeStepper::Integrator integratorB(false, 3.0, 1.5);
+  feassemble::Integrator* integrators[2] = { &integratorA, &integratorB };
+  _TestTimeStepper::Formulation formulation;
+  formulation.integrators(integrators, 2);
+
+  SolverLumped solver;
+  solver.initialize(*_fields, *_jacobian, &formulation);
+
+  TimeStepper stepper;
+  stepper.initialize(&formulation, &solver, _jacobian, _fields);
+
+  // Residual is reformed within the stage of the formulation's logger.
+  utils::EventLogger logger;
+  logger.className("TestTimeStepper");
+  logger.initialize();
+  logger.registerStage("Reform Residual");
+  stepper.stageLogger(&logger);
+  CPPUNIT_ASSERT(&logger == stepper._stageLogger);
+
+  PetscErrorCode err;
+  PetscStageLog stageLog = NULL;
+  int stageBefore = -1, stageAfter = -1;
+  err = PetscLogGetStageLog(&stageLog);PYLITH_CHECK_ERROR(err);
+  err = PetscStageLogGetCurrent(stageLog, &stageBefore);PYLITH_CHECK_ERROR(err);
+
+  const PylithScalar t = 1.0;
+  const PylithScalar dt = 0.25;
+  stepper.prestep(t, dt);
+  stepper.step(t, dt);
+
+  // Stage is popped after reforming the residual.
+  err = PetscStageLogGetCurrent(stageLog, &stageAfter);PYLITH_CHECK_ERROR(err);
+  CPPUNIT_ASSERT_EQUAL(stageBefore, stageAfter);
+
+  _checkField(_fields->get("residual"), 4.0, 2.0);
+
+  // dispIncr = residual / jacobian
+  _checkField(_fields->get("dispIncr(t->t+dt)"), 2.0, 1.0);
+
+  CPPUNIT_ASSERT_EQUAL(0, integratorA.numUpdates);
+  CPPUNIT_ASSERT_EQUAL(0, integratorB.numUpdates);
+
+  PYLITH_METHOD_END;
+} // testStep
+
+// ----------------------------------------------------------------------
+// Test poststep().
+void
+pylith::problems::TestTimeStepper::testPoststep(void)
+{ // testPoststep
+  PYLITH_METHOD_BEGIN;
+
+  _TestTimeStepper::Integrator integratorA(false, 0.0, 0.0);
+  _TestTimeStepper::Integrator integratorB(false, 0.0, 0.0);
+  feassemble::Integrator* integrators[2] = { &integratorA, &integratorB };
+  _TestTimeStepper::Formulation formulation;
+  formulation.integrators(integrators, 2);
+
+  SolverLumped solver;
+  solver.initialize(*_fields, *_jacobian, &formulation);
+
+  TimeStepper stepper;
+  stepper.initialize(&formulation, &solver, _jacobian, _fields);
+
+  _setField(&_fields->get("disp(t-dt)"), -1.0, 0.0);
+  _setField(&_fields->get("disp(t)"), 1.0, 2.0);
+  _setField(&_fields->get("dispIncr(t->t+dt)"), 0.5, 0.25);
+
+  const PylithScalar t = 1.0;
+  const PylithScalar dt = 0.25;
+  stepper.poststep(t, dt);
+
+  _checkField(_fields->get("disp(t-dt)"), 1.0, 2.0);
+  _checkField(_fields->get("disp(t)"), 1.5, 2.25);
+  _checkField(_fields->get("dispIncr(t->t+dt)"), 0.0, 0.0);
+
+  CPPUNIT_ASSERT_EQUAL(1, integratorA.numUpdates);
+  CPPUNIT_ASSERT_EQUAL(t, integratorA.tState);
+  CPPUNIT_ASSERT_EQUAL(1, integratorB.numUpdates);
+  CPPUNIT_ASSERT_EQUAL(t, integratorB.tState);
+
+  PYLITH_METHOD_END;
+} // testPoststep
+
+// ----------------------------------------------------------------------
+// Test advanceDisp().
+void
+pylith::problems::TestTimeStepper::testAdvanceDisp(void)
+{ // testAdvanceDisp
+  PYLITH_METHOD_BEGIN;
+
+  _setField(&_fields->get("disp(t-dt)"), 0.0, 0.0);
+  _setField(&_fields->get("disp(t)"), 2.0, 1.0);
+  _setField(&_fields->get("dispIncr(t->t+dt)"), 0.5, 0.5);
+
+  // Advance two time steps to check that the exchanged vectors are
+  // used consistently.
+  TimeStepper::advanceDisp(_fields);
+  _checkField(_fields->get("disp(t-dt)"), 2.0, 1.0);
+  _checkField(_fields->get("disp(t)"), 2.5, 1.5);
+  _checkField(_fields->get("dispIncr(t->t+dt)"), 0.0, 0.0);
+
+  _setField(&_fields->get("dispIncr(t->t+dt)"), 1.0, 0.0);
+  TimeStepper::advanceDisp(_fields);
+  _checkField(_fields->get("disp(t-dt)"), 2.5, 1.5);
+  _checkField(_fields->get("disp(t)"), 3.5, 1.5);
+  _checkField(_fields->get("dispIncr(t->t+dt)"), 0.0, 0.0);
+
+  PYLITH_METHOD_END;
+} // testAdvanceDisp
+
+// ----------------------------------------------------------------------
+// Set values of field at vertices.
+void
+pylith::problems::TestTimeStepper::_setField(topology::Field* field,
+					     const double value,
+					     const double scale)
+{ // _setField
+  PYLITH_METHOD_BEGIN;
+
+  CPPUNIT_ASSERT(field);
+
+  PetscDM dmMesh = field->mesh().dmMesh();CPPUNIT_ASSERT(dmMesh);
+  topology::Stratum verticesStratum(dmMesh, topology::Stratum::DEPTH, 0);
+  const PetscInt vStart = verticesStratum.begin();
+  const PetscInt vEnd = verticesStratum.end();
+
+  topology::VecVisitorMesh fieldVisitor(*field);
+  PetscScalar* fieldArray = fieldVisitor.localArray();
+  for (PetscInt v = vStart; v < vEnd; ++v) {
+    const PetscInt off = fieldVisitor.sectionOffset(v);
+    const PetscInt dof = fieldVisitor.sectionDof(v);
+    for (PetscInt d = 0; d < dof; ++d) {
+      fieldArray[off+d] = value + scale*(v-vStart);
+    } // for
+  } // for
+
+  PYLITH_METHOD_END;
+} // _setField
+
+// ----------------------------------------------------------------------
+// Check values of field at vertices.
+void
+pylith::problems::TestTimeStepper::_checkField(const topology::Field& field,
+					       const double value,
+					       const double scale)
+{ // _checkField
+  PYLITH_METHOD_BEGIN;
+
+  PetscDM dmMesh = field.mesh().dmMesh();CPPUNIT_ASSERT(dmMesh);
+  topology::Stratum verticesStratum(dmMesh, topology::Stratum::DEPTH, 0);
+  const PetscInt vStart = verticesStratum.begin();
+  const PetscInt vEnd = verticesStratum.end();
+
+  const PylithScalar tolerance = 1.0e-06;
+  topology::VecVisitorMesh fieldVisitor(field);
+  const PetscScalar* fieldArray = fieldVisitor.localArray();
+  for (PetscInt v = vStart; v < vEnd; ++v) {
+    const PetscInt off = fieldVisitor.sectionOffset(v);
+    const PetscInt dof = fieldVisitor.sectionDof(v);
+    for (PetscInt d = 0; d < dof; ++d) {
+      const PylithScalar valueE = value + scale*(v-vStart);
+      CPPUNIT_ASSERT_DOUBLES_EQUAL(valueE, fieldArray[off+d], tolerance);
+    } // for
+  } // for
+
+  PYLITH_METHOD_END;
+} // _checkField
+
+
+// End of file
@@ -0,0 +1,121 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+/**
+ * @file unittests/libtests/problems/TestTimeStepper.hh
+ *
+ * @brief C++ TestTimeStepper object.
+ *
+ * C++ unit testing for TimeStepper.
+ */
+
+#if !defined(pylith_problems_testtimestepper_hh)
+#define pylith_problems_testtimestepper_hh
+
+#include <cppunit/extensions/HelperMacros.h>
+
+#include "pylith/topology/topologyfwd.hh"
+
+/// Namespace for pylith package
+namespace pylith {
+  namespace problems {
+    class TestTimeStepper;
+  } // problems
+} // pylith
+
+/// C++ unit testing for TimeStepper.
+class pylith::problems::TestTimeStepper : public CppUnit::TestFixture
+{ // class TestTimeStepper
+
+  // CPPUNIT TEST SUITE /////////////////////////////////////////////////
+  CPPUNIT_TEST_SUITE( TestTimeStepper );
+
+  CPPUNIT_TEST( testConstructor );
+  CPPUNIT_TEST( testConstraints );
+  CPPUNIT_TEST( testPrestep );
+  CPPUNIT_TEST( testStep );
+  CPPUNIT_TEST( testPoststep );
+  CPPUNIT_TEST( testAdvanceDisp );
+
+  CPPUNIT_TEST_SUITE_END();
+
+  // PUBLIC METHODS /////////////////////////////////////////////////////
+public :
+
+  /// Setup testing data.
+  void setUp(void);
+
+  /// Tear down testing data.
+  void tearDown(void);
+
+  /// Test constructor.
+  void testConstructor(void);
+
+  /// Test constraints().
+  void testConstraints(void);
+
+  /// Test prestep().
+  void testPrestep(void);
+
+  /// Test step().
+  void testStep(void);
+
+  /// Test poststep().
+  void testPoststep(void);
+
+  /// Test advanceDisp().
+  void testAdvanceDisp(void);
+
+  // PRIVATE METHODS ////////////////////////////////////////////////////
+private :
+
+  /** Set values of field at vertices to value + scale*(vertex index).
+   *
+   * @param field Field to set.
+   * @param value Value at first vertex.
+   * @param scale Increment in value between vertices.
+   */
+  static
+  void _setField(topology::Field* field,
+		 const double value,
+		 const double scale);
+
+  /** Check values of field at vertices against value + scale*(vertex index).
+   *
+   * @param field Field to check.
+   * @param value Expected value at first vertex.
+   * @param scale Expected increment in value between vertices.
+   */
+  static
+  void _checkField(const topology::Field& field,
+		   const double value,
+		   const double scale);
+
+  // PRIVATE MEMBERS ////////////////////////////////////////////////////
+private :
+
+  topology::Mesh* _mesh; ///< Finite-element mesh.
+  topology::SolutionFields* _fields; ///< Solution fields.
+  topology::Field* _jacobian; ///< Lumped Jacobian.
+
+}; // class TestTimeStepper
+
+#endif // pylith_problems_testtimestepper_hh
+
+
+// End of file
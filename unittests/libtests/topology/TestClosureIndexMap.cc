@@ -0,0 +1,277 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "TestClosureIndexMap.hh" // Implementation of class methods
+
+#include "pylith/topology/ClosureIndexMap.hh" // USES ClosureIndexMap
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/Field.hh" // USES Field
+#include "pylith/topology/Stratum.hh" // USES Stratum
+#include "pylith/topology/VisitorMesh.hh" // USES VecVisitorMesh
+
+#include "pylith/meshio/MeshIOAscii.hh" // USES MeshIOAscii
+
+#include "pylith/utils/array.hh" // USES scalar_array
+
+#include <vector> // USES std::vector
+
+// ----------------------------------------------------------------------
+CPPUNIT_TEST_SUITE_REGISTRATION( pylith::topology::TestClosureIndexMap );
+
+// ----------------------------------------------------------------------
+void
+pylith::topology::TestClosureIndexMap::setUp(void)
+{ // setUp
+  PYLITH_METHOD_BEGIN;
+
+  _mesh = new Mesh;
+  meshio::MeshIOAscii importer;
+  importer.filename("data/tri3.mesh");
+  importer.read(_mesh);
+
+  PYLITH_METHOD_END;
+} // setUp
+
+// ----------------------------------------------------------------------
+void
+pylith::topology::TestClosureIndexMap::tearDown(void)
+{ // tearDown
+  PYLITH_METHOD_BEGIN;
+
+  delete _mesh; _mesh = 0;
+
+  PYLITH_METHOD_END;
+} // tearDown
+
+// ----------------------------------------------------------------------
+// Test initialize(), hasCell(), and closureSize().
+void
+pylith::topology::TestClosureIndexMap::testInitialize(void)
+{ // testInitialize
+  PYLITH_METHOD_BEGIN;
+
+  const int fiberDim = 2;
+  Field field(*_mesh);
+  _setupField(&field, fiberDim);
+
+  PetscDM dmMesh = _mesh->dmMesh();CPPUNIT_ASSERT(dmMesh);
+  Stratum cellsStratum(dmMesh, Stratum::HEIGHT, 0);
+  const PetscInt cStart = cellsStratum.begin();
+  const PetscInt cEnd = cellsStratum.end();
+  Stratum verticesStratum(dmMesh, Stratum::DEPTH, 0);
+  const PetscInt vStart = verticesStratum.begin();
+
+  // Use all cells except the first one.
+  const PetscInt numCells = cEnd - cStart - 1;
+  CPPUNIT_ASSERT(numCells > 0);
+  std::vector<PetscInt> cells(numCells);
+  for (PetscInt c=0; c < numCells; ++c) {
+    cells[c] = cStart + c + 1;
+  } // for
+
+  ClosureIndexMap map;
+  map.initialize(dmMesh, field.localSection(), &cells[0], numCells);
+
+  const PetscInt numCorners = _mesh->numCorners();
+  CPPUNIT_ASSERT(!map.hasCell(cStart));
+  CPPUNIT_ASSERT(!map.hasCell(vStart));
+  for (PetscInt c=0; c < numCells; ++c) {
+    CPPUNIT_ASSERT(map.hasCell(cells[c]));
+    CPPUNIT_ASSERT_EQUAL(numCorners*fiberDim, map.closureSize(cells[c]));
+  } // for
+
+  PYLITH_METHOD_END;
+} // testInitialize
+
+// ----------------------------------------------------------------------
+// Test getClosure().
+void
+pylith::topology::TestClosureIndexMap::testGetClosure(void)
+{ // testGetClosure
+  PYLITH_METHOD_BEGIN;
+
+  const int fiberDim = 2;
+  Field field(*_mesh);
+  _setupField(&field, fiberDim);
+
+  PetscDM dmMesh = _mesh->dmMesh();CPPUNIT_ASSERT(dmMesh);
+  Stratum cellsStratum(dmMesh, Stratum::HEIGHT, 0);
+  const PetscInt cStart = cellsStratum.begin();
+  const PetscInt cEnd = cellsStratum.end();
+  const PetscInt numCells = cEnd - cStart;
+  std::vector<PetscInt> cells(numCells);
+  for (PetscInt c=0; c < numCells; ++c) {
+    cells[c] = cStart + c;
+  } // for
+
+  ClosureIndexMap map;
+  map.initialize(dmMesh, field.localSection(), &cells[0], numCells);
+
+  VecVisitorMesh fieldVisitor(field);
+  PetscScalar* fieldArray = fieldVisitor.localArray();
+  PetscInt size = 0;
+  PetscErrorCode err = VecGetLocalSize(field.localVector(), &size);PYLITH_CHECK_ERROR(err);
+  for (PetscInt i=0; i < size; ++i) {
+    fieldArray[i] = 1.0 + 0.5*i;
+  } // for
+
+  const PetscInt closureSize = _mesh->numCorners()*fiberDim;
+  scalar_array valuesE(closureSize);
+  scalar_array values(closureSize);
+  for (PetscInt c=0; c < numCells; ++c) {
+    fieldVisitor.getClosure(&valuesE, cells[c]);
+    map.getClosure(&values[0], values.size(), fieldArray, cells[c]);
+    for (PetscInt i=0; i < closureSize; ++i) {
+      CPPUNIT_ASSERT_EQUAL(valuesE[i], values[i]);
+    } // for
+  } // for
+
+  PYLITH_METHOD_END;
+} // testGetClosure
+
+// ----------------------------------------------------------------------
+// Test setClosure().
+void
+pylith::topology::TestClosureIndexMap::testSetClosure(void)
+{ // testSetClosure
+  PYLITH_METHOD_BEGIN;
+
+  const int fiberDim = 2;
+  Field fieldE(*_mesh);
+  _setupField(&fieldE, fiberDim);
+  Field field(*_mesh);
+  field.cloneSection(fieldE);
+  field.zeroAll();
+
+  PetscDM dmMesh = _mesh->dmMesh();CPPUNIT_ASSERT(dmMesh);
+  Stratum cellsStratum(dmMesh, Stratum::HEIGHT, 0);
+  const PetscInt cStart = cellsStratum.begin();
+  const PetscInt cEnd = cellsStratum.end();
+  const PetscInt numCells = cEnd - cStart;
+  std::vector<PetscInt> cells(numCells);
+  for (PetscInt c=0; c < numCells; ++c) {
+    cells[c] = cStart + c;
+  } // for
+
+  ClosureIndexMap map;
+  map.initialize(dmMesh, field.localSection(), &cells[0], numCells);
+
+  const InsertMode modes[2] = { ADD_VALUES, ADD_ALL_VALUES };
+  for (int iMode=0; iMode < 2; ++iMode) {
+    fieldE.zeroAll();
+    field.zeroAll();
+
+    VecVisitorMesh fieldEVisitor(fieldE);
+    VecVisitorMesh fieldVisitor(field);
+    PetscScalar* fieldArray = fieldVisitor.localArray();
+
+    const PetscInt closureSize = _mesh->numCorners()*fiberDim;
+    scalar_array values(closureSize);
+    for (PetscInt c=0; c < numCells; ++c) {
+      for (PetscInt i=0; i < closureSize; ++i) {
+	values[i] = 1.0 + 0.1*c + 0.01*i;
+      } // for
+      fieldEVisitor.setClosure(&values[0], values.size(), cells[c], modes[iMode]);
+      map.setClosure(fieldArray, &values[0], values.size(), cells[c], modes[iMode]);
+    } // for
+
+    PetscInt size = 0;
+    PetscErrorCode err = VecGetLocalSize(field.localVector(), &size);PYLITH_CHECK_ERROR(err);
+    const PetscScalar* fieldEArray = fieldEVisitor.localArray();
+    const PylithScalar tolerance = 1.0e-6;
+    for (PetscInt i=0; i < size; ++i) {
+      CPPUNIT_ASSERT_DOUBLES_EQUAL(fieldEArray[i], fieldArray[i], tolerance);
+    } // for
+  } // for
+
+  PYLITH_METHOD_END;
+} // testSetClosure
+
+// ----------------------------------------------------------------------
+// Test isCompatible().
+void
+pylith::topology::TestClosureIndexMap::testIsCompatible(void)
+{ // testIsCompatible
+  PYLITH_METHOD_BEGIN;
+
+  Field field(*_mesh);
+  _setupField(&field, 2);
+  Field fieldClone(*_mesh);
+  fieldClone.cloneSection(field);
+  Field fieldOther(*_mesh);
+  _setupField(&fieldOther, 3);
+
+  PetscDM dmMesh = _mesh->dmMesh();CPPUNIT_ASSERT(dmMesh);
+  Stratum cellsStratum(dmMesh, Stratum::HEIGHT, 0);
+  const PetscInt cStart = cellsStratum.begin();
+  const PetscInt numCells = cellsStratum.size();
+  std::vector<PetscInt> cells(numCells);
+  for (PetscInt c=0; c < numCells; ++c) {
+    cells[c] = cStart + c;
+  } // for
+
+  ClosureIndexMap map;
+  map.initialize(dmMesh, field.localSection(), &cells[0], numCells);
+
+  CPPUNIT_ASSERT(map.isCompatible(field.localSection()));
+  CPPUNIT_ASSERT(map.isCompatible(fieldClone.localSection()));
+  CPPUNIT_ASSERT(!map.isCompatible(fieldOther.localSection()));
+  // Check cached results.
+  CPPUNIT_ASSERT(map.isCompatible(fieldClone.localSection()));
+  CPPUNIT_ASSERT(!map.isCompatible(fieldOther.localSection()));
+
+  PYLITH_METHOD_END;
+} // testIsCompatible
+
+// ----------------------------------------------------------------------
+// Create field with constraints over vertices.
+void
+pylith::topology::TestClosureIndexMap::_setupField(Field* field,
+						   const int fiberDim)
+{ // _setupField
+  PYLITH_METHOD_BEGIN;
+
+  CPPUNIT_ASSERT(field);
+  CPPUNIT_ASSERT(_mesh);
+
+  PetscDM dmMesh = _mesh->dmMesh();CPPUNIT_ASSERT(dmMesh);
+  Stratum verticesStratum(dmMesh, Stratum::DEPTH, 0);
+  const PetscInt vStart = verticesStratum.begin();
+  const PetscInt vEnd = verticesStratum.end();
+
+  // Constrain last component at every other vertex.
+  PetscErrorCode err = 0;
+  field->newSection(Field::VERTICES_FIELD, fiberDim);
+  PetscSection section = field->localSection();CPPUNIT_ASSERT(section);
+  for (PetscInt v=vStart; v < vEnd; v += 2) {
+    err = PetscSectionAddConstraintDof(section, v, 1);PYLITH_CHECK_ERROR(err);
+  } // for
+  field->allocate();
+  const PetscInt constraint = fiberDim-1;
+  for (PetscInt v=vStart; v < vEnd; v += 2) {
+    err = PetscSectionSetConstraintIndices(section, v, &constraint);PYLITH_CHECK_ERROR(err);
+  } // for
+  field->zeroAll();
+
+  PYLITH_METHOD_END;
+} // _setupField
+
+
+// End of file
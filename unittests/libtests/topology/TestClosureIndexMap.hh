@@ -0,0 +1,98 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+/**
+ * @file unittests/libtests/topology/TestClosureIndexMap.hh
+ *
+ * @brief C++ unit testing for ClosureIndexMap.
+ */
+
+#if !defined(pylith_topology_testclosureindexmap_hh)
+#define pylith_topology_testclosureindexmap_hh
+
+// Include directives ---------------------------------------------------
+#include <cppunit/extensions/HelperMacros.h>
+
+#include "pylith/topology/topologyfwd.hh" // forward declarations
+
+// Forward declarations -------------------------------------------------
+/// Namespace for pylith package
+namespace pylith {
+  namespace topology {
+    class TestClosureIndexMap;
+  } // topology
+} // pylith
+
+// TestClosureIndexMap --------------------------------------------------
+/// C++ unit testing for ClosureIndexMap.
+class pylith::topology::TestClosureIndexMap : public CppUnit::TestFixture
+{ // class TestClosureIndexMap
+
+  // CPPUNIT TEST SUITE /////////////////////////////////////////////////
+  CPPUNIT_TEST_SUITE( TestClosureIndexMap );
+
+  CPPUNIT_TEST( testInitialize );
+  CPPUNIT_TEST( testGetClosure );
+  CPPUNIT_TEST( testSetClosure );
+  CPPUNIT_TEST( testIsCompatible );
+
+  CPPUNIT_TEST_SUITE_END();
+
+  // PUBLIC METHODS /////////////////////////////////////////////////////
+public :
+
+  /// Setup test data.
+  void setUp(void);
+
+  /// Tear down test data.
+  void tearDown(void);
+
+  /// Test initialize(), hasCell(), and closureSize().
+  void testInitialize(void);
+
+  /// Test getClosure().
+  void testGetClosure(void);
+
+  /// Test setClosure().
+  void testSetClosure(void);
+
+  /// Test isCompatible().
+  void testIsCompatible(void);
+
+  // PRIVATE METHODS ////////////////////////////////////////////////////
+private :
+
+  /** Create field with constraints over vertices.
+   *
+   * @param field Field to setup.
+   * @param fiberDim Fiber dimension.
+   */
+  void _setupField(Field* field,
+		   const int fiberDim);
+
+  // PRIVATE MEMBERS ////////////////////////////////////////////////////
+private :
+
+  Mesh* _mesh; ///< Finite-element mesh.
+
+}; // class TestClosureIndexMap
+
+#endif // pylith_topology_testclosureindexmap_hh
+
+
+// End of file 
@@ -818,6 +818,92 @@ pylith::topology::TestFieldMesh::testCopy(void)
   PYLITH_METHOD_END;
 } // testCopy
 
+// ----------------------------------------------------------------------
+// Test swapValues().
+void
+pylith::topology::TestFieldMesh::testSwapValues(void)
+{ // testSwapValues
+  PYLITH_METHOD_BEGIN;
+
+  const int fiberDim = 3;
+  const PylithScalar valuesA[] = {
+    1.1, 2.2, 3.3,
+    1.2, 2.3, 3.4,
+    1.3, 2.4, 3.5,
+    1.4, 2.5, 3.6,
+  };
+  const PylithScalar valuesB[] = {
+    4.1, 5.2, 6.3,
+    4.2, 5.3, 6.4,
+    4.3, 5.4, 6.5,
+    4.4, 5.5, 6.6,
+  };
+
+  Mesh mesh;
+  _buildMesh(&mesh);
+
+  PetscDM dmMesh = mesh.dmMesh();CPPUNIT_ASSERT(dmMesh);
+  Stratum depthStratum(dmMesh, Stratum::DEPTH, 0);
+  const PetscInt vStart = depthStratum.begin();
+  const PetscInt vEnd = depthStratum.end();
+
+  Field fieldA(mesh);
+  fieldA.newSection(Field::VERTICES_FIELD, fiberDim);
+  fieldA.allocate();
+  fieldA.label("field A");
+  Field fieldB(mesh);
+  fieldB.cloneSection(fieldA);
+  fieldB.label("field B");
+  { // Setup fields
+    VecVisitorMesh visitorA(fieldA);
+    PetscScalar* arrayA = visitorA.localArray();
+    VecVisitorMesh visitorB(fieldB);
+    PetscScalar* arrayB = visitorB.localArray();
+    for(PetscInt v = vStart, i = 0; v < vEnd; ++v) {
+      const PetscInt off = visitorA.sectionOffset(v);
+      for(PetscInt d = 0; d < fiberDim; ++d, ++i) {
+	arrayA[off+d] = valuesA[i];
+	arrayB[off+d] = valuesB[i];
+      } // for
+    } // for
+  } // Setup fields
+
+  const PetscVec vecA = fieldA.localVector();
+  const PetscVec vecB = fieldB.localVector();
+  PetscObjectState stateA = 0, stateB = 0;
+  PetscErrorCode err;
+  err = PetscObjectStateGet((PetscObject) vecA, &stateA);CPPUNIT_ASSERT(!err);
+  err = PetscObjectStateGet((PetscObject) vecB, &stateB);CPPUNIT_ASSERT(!err);
+
+  fieldA.swapValues(fieldB);
+
+  CPPUNIT_ASSERT(vecB == fieldA.localVector());
+  CPPUNIT_ASSERT(vecA == fieldB.localVector());
+  CPPUNIT_ASSERT_EQUAL(std::string("field A"), std::string(fieldA.label()));
+  CPPUNIT_ASSERT_EQUAL(std::string("field B"), std::string(fieldB.label()));
+
+  PetscObjectState state = 0;
+  err = PetscObjectStateGet((PetscObject) fieldA.localVector(), &state);CPPUNIT_ASSERT(!err);
+  CPPUNIT_ASSERT(state > stateA && state > stateB);
+  err = PetscObjectStateGet((PetscObject) fieldB.localVector(), &state);CPPUNIT_ASSERT(!err);
+  CPPUNIT_ASSERT(state > stateA && state > stateB);
+
+  VecVisitorMesh visitorA(fieldA);
+  const PetscScalar* arrayA = visitorA.localArray();
+  VecVisitorMesh visitorB(fieldB);
+  const PetscScalar* arrayB = visitorB.localArray();
+  const PylithScalar tolerance = 1.0e-6;
+  for(PetscInt v = vStart, i = 0; v < vEnd; ++v) {
+    const PetscInt off = visitorA.sectionOffset(v);
+    for(PetscInt d = 0; d < fiberDim; ++d, ++i) {
+      CPPUNIT_ASSERT_DOUBLES_EQUAL(valuesB[i], arrayA[off+d], tolerance);
+      CPPUNIT_ASSERT_DOUBLES_EQUAL(valuesA[i], arrayB[off+d], tolerance);
+    } // for
+  } // for
+
+  PYLITH_METHOD_END;
+} // testSwapValues
+
 // ----------------------------------------------------------------------
 // Test copySubfield().
 void
@@ -1372,6 +1458,80 @@ pylith::topology::TestFieldMesh::testScatterGlobalToLocal(void)
   PYLITH_METHOD_END;
 } // testScatterGlobalToLocal
 
+// ----------------------------------------------------------------------
+// Test split-phase scatters and completeBegin()/completeEnd().
+void
+pylith::topology::TestFieldMesh::testScatterBeginEnd(void)
+{ // testScatterBeginEnd
+  PYLITH_METHOD_BEGIN;
+
+  const char* context = "abcde";
+  const int fiberDim = 3;
+  const PylithScalar valuesE[] = {
+    1.1, 2.2, 3.3,
+    1.2, 2.3, 3.4,
+    1.3, 2.4, 3.5,
+    1.4, 2.5, 3.6,
+  };
+
+  Mesh mesh;
+  _buildMesh(&mesh);
+
+  PetscDM dmMesh = mesh.dmMesh();CPPUNIT_ASSERT(dmMesh);
+  Stratum depthStratum(dmMesh, Stratum::DEPTH, 0);
+  const PetscInt vStart = depthStratum.begin();
+  const PetscInt vEnd = depthStratum.end();
+
+  Field field(mesh);
+  { // setup field
+    field.newSection(Field::VERTICES_FIELD, fiberDim);
+    field.allocate();
+    VecVisitorMesh fieldVisitor(field);
+    PetscScalar* fieldArray = fieldVisitor.localArray();
+    for(PetscInt v = vStart, i = 0; v < vEnd; ++v) {
+      const PetscInt off = fieldVisitor.sectionOffset(v);
+      for(PetscInt d = 0; d < fiberDim; ++d)
+	fieldArray[off+d] = valuesE[i++];
+    } // for
+  } // setup field
+  field.createScatter(mesh, context);
+
+  // Local to global and back to local after zeroing local values.
+  field.scatterLocalToGlobalBegin(context);
+  field.scatterLocalToGlobalEnd(context);
+  field.zeroAll();
+  field.scatterGlobalToLocalBegin(context);
+  field.scatterGlobalToLocalEnd(context);
+
+  const PylithScalar tolerance = 1.0e-06;
+  { // check values
+    VecVisitorMesh fieldVisitor(field);
+    const PetscScalar* fieldArray = fieldVisitor.localArray();
+    for (PetscInt v = vStart, i = 0; v < vEnd; ++v) {
+      const PetscInt off = fieldVisitor.sectionOffset(v);
+      for (int iDim=0; iDim < fiberDim; ++iDim) {
+	CPPUNIT_ASSERT_DOUBLES_EQUAL(valuesE[i++], fieldArray[off+iDim], tolerance);
+      } // for
+    } // for
+  } // check values
+
+  // Expect no change from completing the field for this serial test.
+  field.completeBegin();
+  field.completeEnd();
+  { // check values
+    VecVisitorMesh fieldVisitor(field);
+    const PetscScalar* fieldArray = fieldVisitor.localArray();
+    for (PetscInt v = vStart, i = 0; v < vEnd; ++v) {
+      const PetscInt off = fieldVisitor.sectionOffset(v);
+      for (int iDim=0; iDim < fiberDim; ++iDim) {
+	CPPUNIT_ASSERT_DOUBLES_EQUAL(valuesE[i++], fieldArray[off+iDim], tolerance);
+      } // for
+    } // for
+  } // check values
+
+  PYLITH_METHOD_END;
+} // testScatterBeginEnd
+
 // ----------------------------------------------------------------------
 // Test splitDefault().
 void
@@ -68,6 +68,7 @@ class pylith::topology::TestFieldMesh : public CppUnit::TestFixture
   CPPUNIT_TEST( testComplete );
   CPPUNIT_TEST( testCopy );
   CPPUNIT_TEST( testCopySubfield );
+  CPPUNIT_TEST( testSwapValues );
   CPPUNIT_TEST( testOperatorAdd );
   CPPUNIT_TEST( testDimensionalize );
   CPPUNIT_TEST( testView );
@@ -76,6 +77,7 @@ class pylith::topology::TestFieldMesh : public CppUnit::TestFixture
   CPPUNIT_TEST( testVector );
   CPPUNIT_TEST( testScatterLocalToGlobal );
   CPPUNIT_TEST( testScatterGlobalToLocal );
+  CPPUNIT_TEST( testScatterBeginEnd );
   CPPUNIT_TEST( testSplitDefault );
   CPPUNIT_TEST( testCloneSectionSplit );
 
@@ -153,6 +155,9 @@ public :
   /// Test copySubfield().
   void testCopySubfield(void);
 
+  /// Test swapValues().
+  void testSwapValues(void);
+
   /// Test operator+=().
   void testOperatorAdd(void);
 
@@ -177,6 +182,9 @@ public :
   /// Test scatterGlobalToLocal().
   void testScatterGlobalToLocal(void);
 
+  /// Test split-phase scatters and completeBegin()/completeEnd().
+  void testScatterBeginEnd(void);
+
   /// Test splitDefault().
   void testSplitDefault(void);
 
@@ -0,0 +1,182 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "TestFieldMeshMPI.hh" // Implementation of class methods
+
+#include "pylith/topology/Field.hh" // USES Field
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/Distributor.hh" // USES Distributor
+#include "pylith/topology/Stratum.hh" // USES Stratum
+#include "pylith/topology/CoordsVisitor.hh" // USES CoordsVisitor
+#include "pylith/topology/VisitorMesh.hh" // USES VecVisitorMesh
+
+#include "pylith/meshio/MeshIOAscii.hh" // USES MeshIOAscii
+
+#include <cmath> // USES fabs()
+
+// ----------------------------------------------------------------------
+CPPUNIT_TEST_SUITE_REGISTRATION( pylith::topology::TestFieldMeshMPI );
+
+// ----------------------------------------------------------------------
+void
+pylith::topology::TestFieldMeshMPI::setUp(void)
+{ // setUp
+  PYLITH_METHOD_BEGIN;
+
+  Mesh mesh;
+  meshio::MeshIOAscii importer;
+  importer.filename("data/fourquad4.mesh");
+  importer.read(&mesh);
+
+  _mesh = new Mesh;
+  Distributor::distribute(_mesh, mesh, "simple");
+
+  PYLITH_METHOD_END;
+} // setUp
+
+// ----------------------------------------------------------------------
+void
+pylith::topology::TestFieldMeshMPI::tearDown(void)
+{ // tearDown
+  PYLITH_METHOD_BEGIN;
+
+  delete _mesh; _mesh = 0;
+
+  PYLITH_METHOD_END;
+} // tearDown
+
+// ----------------------------------------------------------------------
+// Test complete().
+void
+pylith::topology::TestFieldMeshMPI::testComplete(void)
+{ // testComplete
+  PYLITH_METHOD_BEGIN;
+
+  _testAssemble(false);
+
+  PYLITH_METHOD_END;
+} // testComplete
+
+// ----------------------------------------------------------------------
+// Test completeBegin() and completeEnd().
+void
+pylith::topology::TestFieldMeshMPI::testCompleteBeginEnd(void)
+{ // testCompleteBeginEnd
+  PYLITH_METHOD_BEGIN;
+
+  _testAssemble(true);
+
+  PYLITH_METHOD_END;
+} // testCompleteBeginEnd
+
+// ----------------------------------------------------------------------
+// Add contribution of each local cell to its vertices and check
+// assembled values.
+void
+pylith::topology::TestFieldMeshMPI::_testAssemble(const bool splitPhase)
+{ // _testAssemble
+  PYLITH_METHOD_BEGIN;
+
+  CPPUNIT_ASSERT(_mesh);
+  int commSize = 0;
+  PetscErrorCode err = MPI_Comm_size(_mesh->comm(), &commSize);PYLITH_CHECK_ERROR(err);
+  CPPUNIT_ASSERT(commSize > 1);
+
+  const int fiberDim = 2;
+
+  PetscDM dmMesh = _mesh->dmMesh();CPPUNIT_ASSERT(dmMesh);
+  Stratum cellsStratum(dmMesh, Stratum::HEIGHT, 0);
+  const PetscInt cStart = cellsStratum.begin();
+  const PetscInt cEnd = cellsStratum.end();
+  Stratum verticesStratum(dmMesh, Stratum::DEPTH, 0);
+  const PetscInt vStart = verticesStratum.begin();
+  const PetscInt vEnd = verticesStratum.end();
+
+  // Make sure the test exercises shared points on every process.
+  PetscSF pointSF = NULL;
+  PetscInt numRoots = 0, numLeaves = 0;
+  err = DMGetPointSF(dmMesh, &pointSF);PYLITH_CHECK_ERROR(err);
+  err = PetscSFGetGraph(pointSF, &numRoots, &numLeaves, NULL, NULL);PYLITH_CHECK_ERROR(err);
+  CPPUNIT_ASSERT(numRoots >= 0);
+  PetscInt numLeavesGlobal = 0;
+  err = MPI_Allreduce(&numLeaves, &numLeavesGlobal, 1, MPIU_INT, MPI_SUM, _mesh->comm());PYLITH_CHECK_ERROR(err);
+  CPPUNIT_ASSERT(numLeavesGlobal > 0);
+
+  Field field(*_mesh);
+  field.newSection(FieldBase::VERTICES_FIELD, fiberDim);
+  field.allocate();
+  field.zeroAll();
+
+  // Each cell adds (1, 2) to each of its vertices. Cells are not
+  // overlapped, so after assembly each vertex holds the number of
+  // cells in the global mesh that contain it.
+  { // integrate
+    VecVisitorMesh fieldVisitor(field);
+    PetscScalar* fieldArray = fieldVisitor.localArray();
+    for (PetscInt c = cStart; c < cEnd; ++c) {
+      PetscInt closureSize = 0;
+      PetscInt* closure = NULL;
+      err = DMPlexGetTransitiveClosure(dmMesh, c, PETSC_TRUE, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
+      for (PetscInt i=0; i < 2*closureSize; i+=2) {
+	const PetscInt point = closure[i];
+	if (point < vStart || point >= vEnd) {
+	  continue;
+	} // if
+	const PetscInt off = fieldVisitor.sectionOffset(point);
+	for (int d=0; d < fiberDim; ++d) {
+	  fieldArray[off+d] += PylithScalar(d+1);
+	} // for
+      } // for
+      err = DMPlexRestoreTransitiveClosure(dmMesh, c, PETSC_TRUE, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
+    } // for
+  } // integrate
+
+  if (splitPhase) {
+    field.completeBegin();
+    field.completeEnd();
+  } else {
+    field.complete();
+  } // if/else
+
+  // In the 2x2 quad mesh on [-1,1]x[-1,1], the center vertex is in 4
+  // cells, the vertices at the middle of the edges are in 2 cells, and
+  // the corner vertices are in 1 cell.
+  const PylithScalar tolerance = 1.0e-06;
+  CoordsVisitor coordsVisitor(dmMesh);
+  const PetscScalar* coordsArray = coordsVisitor.localArray();CPPUNIT_ASSERT(coordsArray);
+  VecVisitorMesh fieldVisitor(field);
+  const PetscScalar* fieldArray = fieldVisitor.localArray();CPPUNIT_ASSERT(fieldArray);
+  for (PetscInt v = vStart; v < vEnd; ++v) {
+    const PetscInt coff = coordsVisitor.sectionOffset(v);
+    const bool onX = fabs(coordsArray[coff+0]) < tolerance;
+    const bool onY = fabs(coordsArray[coff+1]) < tolerance;
+    const int numCellsE = (onX && onY) ? 4 : (onX || onY) ? 2 : 1;
+
+    const PetscInt off = fieldVisitor.sectionOffset(v);
+    for (int d=0; d < fiberDim; ++d) {
+      CPPUNIT_ASSERT_DOUBLES_EQUAL(numCellsE*(d+1), fieldArray[off+d], tolerance);
+    } // for
+  } // for
+
+  PYLITH_METHOD_END;
+} // _testAssemble
+
+
+// End of file 
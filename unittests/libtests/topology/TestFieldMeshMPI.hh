@@ -0,0 +1,92 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+/**
+ * @file unittests/libtests/topology/TestFieldMeshMPI.hh
+ *
+ * @brief C++ unit testing for Field with a distributed mesh.
+ *
+ * Run on 2 or more processes.
+ */
+
+#if !defined(pylith_topology_testfieldmeshmpi_hh)
+#define pylith_topology_testfieldmeshmpi_hh
+
+// Include directives ---------------------------------------------------
+#include <cppunit/extensions/HelperMacros.h>
+
+#include "pylith/topology/topologyfwd.hh" // forward declarations
+
+// Forward declarations -------------------------------------------------
+/// Namespace for pylith package
+namespace pylith {
+  namespace topology {
+    class TestFieldMeshMPI;
+  } // topology
+} // pylith
+
+// TestFieldMeshMPI -----------------------------------------------------
+/// C++ unit testing for Field with a distributed mesh.
+class pylith::topology::TestFieldMeshMPI : public CppUnit::TestFixture
+{ // class TestFieldMeshMPI
+
+  // CPPUNIT TEST SUITE /////////////////////////////////////////////////
+  CPPUNIT_TEST_SUITE( TestFieldMeshMPI );
+
+  CPPUNIT_TEST( testComplete );
+  CPPUNIT_TEST( testCompleteBeginEnd );
+
+  CPPUNIT_TEST_SUITE_END();
+
+  // PUBLIC METHODS /////////////////////////////////////////////////////
+public :
+
+  /// Setup test data.
+  void setUp(void);
+
+  /// Tear down test data.
+  void tearDown(void);
+
+  /// Test complete().
+  void testComplete(void);
+
+  /// Test completeBegin() and completeEnd().
+  void testCompleteBeginEnd(void);
+
+  // PRIVATE METHODS ////////////////////////////////////////////////////
+private :
+
+  /** Add contribution of each local cell to its vertices and check
+   * assembled values at all local vertices, including shared ones.
+   *
+   * @param splitPhase True if using completeBegin()/completeEnd(),
+   *   false if using complete().
+   */
+  void _testAssemble(const bool splitPhase);
+
+  // PRIVATE MEMBERS ////////////////////////////////////////////////////
+private :
+
+  Mesh* _mesh; ///< Distributed mesh.
+
+}; // class TestFieldMeshMPI
+
+#endif // pylith_topology_testfieldmeshmpi_hh
+
+
+// End of file 
@@ -28,6 +28,8 @@
 
 #include "pylith/meshio/MeshIOAscii.hh" // USES MeshIOAscii
 
+#include <stdexcept> // USES std::runtime_error
+
 // ----------------------------------------------------------------------
 CPPUNIT_TEST_SUITE_REGISTRATION( pylith::topology::TestFieldsMesh );
 
@@ -184,6 +186,45 @@ pylith::topology::TestFieldsMesh::testGetConst(void)
   PYLITH_METHOD_END;
 } // testGetConst
 
+// ----------------------------------------------------------------------
+// Test handle() and get() with handle.
+void
+pylith::topology::TestFieldsMesh::testHandle(void)
+{ // testHandle
+  PYLITH_METHOD_BEGIN;
+
+  CPPUNIT_ASSERT(_mesh);
+  Fields fields(*_mesh);
+
+  fields.add("field A", "velocity");
+  fields.add("field B", "displacement");
+  fields.add("field C", "traction");
+
+  const int handleA = fields.handle("field A");
+  const int handleB = fields.handle("field B");
+  const int handleC = fields.handle("field C");
+  CPPUNIT_ASSERT(handleA != handleB);
+  CPPUNIT_ASSERT(handleB != handleC);
+  CPPUNIT_ASSERT_EQUAL(&fields.get("field A"), &fields.get(handleA));
+  CPPUNIT_ASSERT_EQUAL(&fields.get("field B"), &fields.get(handleB));
+
+  const Fields* fieldsPtr = &fields;
+  CPPUNIT_ASSERT_EQUAL(&fieldsPtr->get("field C"), &fieldsPtr->get(handleC));
+
+  // Handles of remaining fields are unchanged after a field is
+  // deleted, and the handle of the deleted field is not reused.
+  fields.del("field B");
+  fields.add("field D", "velocity");
+  CPPUNIT_ASSERT_EQUAL(handleA, fields.handle("field A"));
+  CPPUNIT_ASSERT_EQUAL(handleC, fields.handle("field C"));
+  CPPUNIT_ASSERT(handleB != fields.handle("field D"));
+  CPPUNIT_ASSERT_THROW(fields.get(handleB), std::runtime_error);
+  CPPUNIT_ASSERT_THROW(fields.get(-1), std::runtime_error);
+  CPPUNIT_ASSERT_THROW(fields.handle("field B"), std::runtime_error);
+
+  PYLITH_METHOD_END;
+} // testHandle
+
 // ----------------------------------------------------------------------
 // Test hasField().
 void
@@ -52,6 +52,7 @@ class pylith::topology::TestFieldsMesh : public CppUnit::TestFixture
   CPPUNIT_TEST( testDelete );
   CPPUNIT_TEST( testGet );
   CPPUNIT_TEST( testGetConst );
+  CPPUNIT_TEST( testHandle );
   CPPUNIT_TEST( testHasField );
   CPPUNIT_TEST( testCopyLayout );
 
@@ -84,6 +85,9 @@ public :
   /// Test get() for const Fields.
   void testGetConst(void);
 
+  /// Test handle() and get() with handle.
+  void testHandle(void);
+
   /// Test hasField().
   void testHasField(void);
 
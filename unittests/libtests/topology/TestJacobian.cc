@@ -131,6 +131,48 @@ pylith::topology::TestJacobian::testZero(void)
   PYLITH_METHOD_END;
 } // testZero
 
+// ----------------------------------------------------------------------
+// Test localDiagonal().
+void
+pylith::topology::TestJacobian::testLocalDiagonal(void)
+{ // testLocalDiagonal
+  PYLITH_METHOD_BEGIN;
+
+  Mesh mesh;
+  _initializeMesh(&mesh);
+  Field field(mesh);
+  _initializeField(&mesh, &field);
+  Jacobian jacobian(field);
+
+  jacobian.zero();
+  jacobian.assemble("final_assembly");
+  PetscErrorCode err = MatShift(jacobian.matrix(), 2.0);CPPUNIT_ASSERT(!err);
+
+  const PetscVec diagVec = jacobian.localDiagonal(field);CPPUNIT_ASSERT(diagVec);
+  // Diagonal is reused until the matrix is zeroed or assembled.
+  CPPUNIT_ASSERT(diagVec == jacobian.localDiagonal(field));
+
+  PetscInt size = 0;
+  const PetscScalar* diagArray = NULL;
+  err = VecGetLocalSize(diagVec, &size);CPPUNIT_ASSERT(!err);
+  CPPUNIT_ASSERT(size > 0);
+  err = VecGetArrayRead(diagVec, &diagArray);CPPUNIT_ASSERT(!err);
+  const PylithScalar tolerance = 1.0e-06;
+  for (PetscInt i=0; i < size; ++i)
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(2.0, diagArray[i], tolerance);
+  err = VecRestoreArrayRead(diagVec, &diagArray);CPPUNIT_ASSERT(!err);
+
+  // Zeroing the matrix updates the diagonal.
+  jacobian.zero();
+  jacobian.assemble("final_assembly");
+  err = VecGetArrayRead(jacobian.localDiagonal(field), &diagArray);CPPUNIT_ASSERT(!err);
+  for (PetscInt i=0; i < size; ++i)
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(0.0, diagArray[i], tolerance);
+  err = VecRestoreArrayRead(jacobian.localDiagonal(field), &diagArray);CPPUNIT_ASSERT(!err);
+
+  PYLITH_METHOD_END;
+} // testLocalDiagonal
+
 // ----------------------------------------------------------------------
 // Test view().
 void
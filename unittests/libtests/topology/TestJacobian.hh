@@ -50,6 +50,7 @@ class pylith::topology::TestJacobian : public CppUnit::TestFixture
   CPPUNIT_TEST( testMatrix );
   CPPUNIT_TEST( testAssemble );
   CPPUNIT_TEST( testZero );
+  CPPUNIT_TEST( testLocalDiagonal );
   CPPUNIT_TEST( testView );
   CPPUNIT_TEST( testWrite );
 
@@ -73,6 +74,9 @@ public :
   /// Test zero().
   void testZero(void);
 
+  /// Test localDiagonal().
+  void testLocalDiagonal(void);
+
   /// Test view().
   void testView(void);
 
@@ -31,6 +31,7 @@
 #include "spatialdata/units/Nondimensional.hh" // USES Nondimensional
 
 #include <stdexcept> // USES std::runtime_error
+#include <vector> // USES std::vector
 
 // ----------------------------------------------------------------------
 CPPUNIT_TEST_SUITE_REGISTRATION( pylith::topology::TestMeshOps );
@@ -143,6 +144,91 @@ pylith::topology::TestMeshOps::testCheckMaterialIds(void)
 
   PYLITH_METHOD_END;
 } // testCheckMaterialIds
+
+// ----------------------------------------------------------------------
+// Test orderBoundaryCells().
+void
+pylith::topology::TestMeshOps::testOrderBoundaryCells(void)
+{ // testOrderBoundaryCells
+  PYLITH_METHOD_BEGIN;
+
+  Mesh mesh;
+
+  meshio::MeshIOAscii iohandler;
+  iohandler.filename("data/tri3.mesh");
+  iohandler.read(&mesh);
+
+  PetscDM dmMesh = mesh.dmMesh();CPPUNIT_ASSERT(dmMesh);
+  Stratum cellsStratum(dmMesh, Stratum::HEIGHT, 0);
+  const PetscInt cStart = cellsStratum.begin();
+  const PetscInt cEnd = cellsStratum.end();
+  const PetscInt numCells = cellsStratum.size();
+  std::vector<PetscInt> cells(numCells);
+  for (PetscInt c=cStart; c < cEnd; ++c) {
+    cells[c-cStart] = c;
+  } // for
+  std::vector<PetscInt> orderedCells(numCells);
+
+  // No ghost points.
+  PetscInt numBoundary = MeshOps::orderBoundaryCells(&orderedCells[0], mesh, &cells[0], numCells);
+  CPPUNIT_ASSERT_EQUAL(PetscInt(0), numBoundary);
+  for (PetscInt i=0; i < numCells; ++i) {
+    CPPUNIT_ASSERT_EQUAL(cells[i], orderedCells[i]);
+  } // for
+
+  // Mark the last vertex as a ghost point.
+  Stratum verticesStratum(dmMesh, Stratum::DEPTH, 0);
+  const PetscInt vertex = verticesStratum.end()-1;
+  PetscInt pStart = 0, pEnd = 0;
+  PetscErrorCode err = DMPlexGetChart(dmMesh, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+  PetscSF pointSF = NULL;
+  PetscInt* leaves = NULL;
+  PetscSFNode* remotes = NULL;
+  err = PetscMalloc1(1, &leaves);PYLITH_CHECK_ERROR(err);
+  err = PetscMalloc1(1, &remotes);PYLITH_CHECK_ERROR(err);
+  leaves[0] = vertex;
+  remotes[0].rank = 0;
+  remotes[0].index = vertex;
+  err = PetscSFCreate(mesh.comm(), &pointSF);PYLITH_CHECK_ERROR(err);
+  err = PetscSFSetGraph(pointSF, pEnd-pStart, 1, leaves, PETSC_OWN_POINTER, remotes, PETSC_OWN_POINTER);PYLITH_CHECK_ERROR(err);
+  err = DMSetPointSF(dmMesh, pointSF);PYLITH_CHECK_ERROR(err);
+  err = PetscSFDestroy(&pointSF);PYLITH_CHECK_ERROR(err);
+
+  // Boundary cells are the cells in the star of the vertex, in their
+  // original order, followed by the other cells in their original order.
+  PetscInt* star = NULL;
+  PetscInt starSize = 0;
+  std::vector<bool> inStar(numCells, false);
+  err = DMPlexGetTransitiveClosure(dmMesh, vertex, PETSC_FALSE, &starSize, &star);PYLITH_CHECK_ERROR(err);
+  for (PetscInt p=0; p < starSize*2; p += 2) {
+    if (star[p] >= cStart && star[p] < cEnd) {
+      inStar[star[p]-cStart] = true;
+    } // if
+  } // for
+  err = DMPlexRestoreTransitiveClosure(dmMesh, vertex, PETSC_FALSE, &starSize, &star);PYLITH_CHECK_ERROR(err);
+  std::vector<PetscInt> orderedCellsE;
+  for (PetscInt i=0; i < numCells; ++i) {
+    if (inStar[i]) {
+      orderedCellsE.push_back(cells[i]);
+    } // if
+  } // for
+  const PetscInt numBoundaryE = orderedCellsE.size();
+  for (PetscInt i=0; i < numCells; ++i) {
+    if (!inStar[i]) {
+      orderedCellsE.push_back(cells[i]);
+    } // if
+  } // for
+  CPPUNIT_ASSERT(numBoundaryE > 0);
+  CPPUNIT_ASSERT(numBoundaryE < numCells);
+
+  numBoundary = MeshOps::orderBoundaryCells(&orderedCells[0], mesh, &cells[0], numCells);
+  CPPUNIT_ASSERT_EQUAL(numBoundaryE, numBoundary);
+  for (PetscInt i=0; i < numCells; ++i) {
+    CPPUNIT_ASSERT_EQUAL(orderedCellsE[i], orderedCells[i]);
+  } // for
+
+  PYLITH_METHOD_END;
+} // testOrderBoundaryCells
  
 
 // End of file 
@@ -46,6 +46,7 @@ class pylith::topology::TestMeshOps : public CppUnit::TestFixture
   CPPUNIT_TEST( testCreateDMMesh );
   CPPUNIT_TEST( testNondimensionalize );
   CPPUNIT_TEST( testCheckMaterialIds );
+  CPPUNIT_TEST( testOrderBoundaryCells );
 
   CPPUNIT_TEST_SUITE_END();
 
@@ -61,6 +62,9 @@ public :
   /// Test checkMaterialIds().
   void testCheckMaterialIds(void);
 
+  /// Test orderBoundaryCells().
+  void testOrderBoundaryCells(void);
+
 }; // class TestMeshOps
 
 #endif // pylith_topology_meshops_hh
@@ -0,0 +1,320 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "TestRefineInterpolator.hh" // Implementation of class methods
+
+#include "pylith/topology/RefineInterpolator.hh" // USES RefineInterpolator
+
+#include "pylith/topology/RefineUniform.hh" // USES RefineUniform
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/Field.hh" // USES Field
+#include "pylith/utils/array.hh" // USES int_array
+#include "pylith/meshio/MeshIOAscii.hh" // USES MeshIOAscii
+#include "pylith/faults/FaultCohesiveKin.hh" // USES FaultCohesiveKin
+
+#include "data/MeshDataCohesiveTri3Level1Fault1.hh"
+#include "data/MeshDataCohesiveQuad4Level1Fault1.hh"
+#include "data/MeshDataCohesiveTet4Level1Fault1.hh"
+#include "data/MeshDataCohesiveHex8Level1Fault1.hh"
+
+// ----------------------------------------------------------------------
+CPPUNIT_TEST_SUITE_REGISTRATION( pylith::topology::TestRefineInterpolator );
+
+// ----------------------------------------------------------------------
+// Test constructor.
+void
+pylith::topology::TestRefineInterpolator::testConstructor(void)
+{ // testConstructor
+  PYLITH_METHOD_BEGIN;
+
+  RefineInterpolator interpolator;
+  CPPUNIT_ASSERT_EQUAL(0, interpolator.numLevels());
+
+  PYLITH_METHOD_END;
+} // testConstructor
+
+// ----------------------------------------------------------------------
+// Test initialize() and interpolation() with tri3 cells and one fault.
+void
+pylith::topology::TestRefineInterpolator::testInterpolationTri3(void)
+{ // testInterpolationTri3
+  PYLITH_METHOD_BEGIN;
+
+  MeshDataCohesiveTri3Level1Fault1 data;
+  _testInterpolation(data, false);
+
+  PYLITH_METHOD_END;
+} // testInterpolationTri3
+
+// ----------------------------------------------------------------------
+// Test initialize() and interpolation() with quad4 cells and one fault.
+void
+pylith::topology::TestRefineInterpolator::testInterpolationQuad4(void)
+{ // testInterpolationQuad4
+  PYLITH_METHOD_BEGIN;
+
+  MeshDataCohesiveQuad4Level1Fault1 data;
+  _testInterpolation(data, false);
+
+  PYLITH_METHOD_END;
+} // testInterpolationQuad4
+
+// ----------------------------------------------------------------------
+// Test initialize() and interpolation() with tet4 cells and one fault.
+void
+pylith::topology::TestRefineInterpolator::testInterpolationTet4(void)
+{ // testInterpolationTet4
+  PYLITH_METHOD_BEGIN;
+
+  MeshDataCohesiveTet4Level1Fault1 data;
+  _testInterpolation(data, false);
+
+  PYLITH_METHOD_END;
+} // testInterpolationTet4
+
+// ----------------------------------------------------------------------
+// Test initialize() and interpolation() with hex8 cells and one fault.
+void
+pylith::topology::TestRefineInterpolator::testInterpolationHex8(void)
+{ // testInterpolationHex8
+  PYLITH_METHOD_BEGIN;
+
+  MeshDataCohesiveHex8Level1Fault1 data;
+  _testInterpolation(data, false);
+
+  PYLITH_METHOD_END;
+} // testInterpolationHex8
+
+// ----------------------------------------------------------------------
+// Test interpolation() of DOF on vertices and hybrid edges with tri3 cells and one fault.
+void
+pylith::topology::TestRefineInterpolator::testInterpolationLagrangeTri3(void)
+{ // testInterpolationLagrangeTri3
+  PYLITH_METHOD_BEGIN;
+
+  MeshDataCohesiveTri3Level1Fault1 data;
+  _testInterpolation(data, true);
+
+  PYLITH_METHOD_END;
+} // testInterpolationLagrangeTri3
+
+// ----------------------------------------------------------------------
+// Test interpolation() of DOF on vertices and hybrid edges with quad4 cells and one fault.
+void
+pylith::topology::TestRefineInterpolator::testInterpolationLagrangeQuad4(void)
+{ // testInterpolationLagrangeQuad4
+  PYLITH_METHOD_BEGIN;
+
+  MeshDataCohesiveQuad4Level1Fault1 data;
+  _testInterpolation(data, true);
+
+  PYLITH_METHOD_END;
+} // testInterpolationLagrangeQuad4
+
+// ----------------------------------------------------------------------
+// Test interpolation() of DOF on vertices and hybrid edges with tet4 cells and one fault.
+void
+pylith::topology::TestRefineInterpolator::testInterpolationLagrangeTet4(void)
+{ // testInterpolationLagrangeTet4
+  PYLITH_METHOD_BEGIN;
+
+  MeshDataCohesiveTet4Level1Fault1 data;
+  _testInterpolation(data, true);
+
+  PYLITH_METHOD_END;
+} // testInterpolationLagrangeTet4
+
+// ----------------------------------------------------------------------
+// Test interpolation() of DOF on vertices and hybrid edges with hex8 cells and one fault.
+void
+pylith::topology::TestRefineInterpolator::testInterpolationLagrangeHex8(void)
+{ // testInterpolationLagrangeHex8
+  PYLITH_METHOD_BEGIN;
+
+  MeshDataCohesiveHex8Level1Fault1 data;
+  _testInterpolation(data, true);
+
+  PYLITH_METHOD_END;
+} // testInterpolationLagrangeHex8
+
+// ----------------------------------------------------------------------
+// Test interpolation of vertex coordinates.
+void
+pylith::topology::TestRefineInterpolator::_testInterpolation(const MeshDataCohesive& data,
+							      const bool withLagrange)
+{ // _testInterpolation
+  PYLITH_METHOD_BEGIN;
+
+  Mesh mesh(data.cellDim);
+  meshio::MeshIOAscii iohandler;
+  iohandler.filename(data.filename);
+  iohandler.interpolate(true);
+  iohandler.read(&mesh);
+
+  if (data.faultA) {
+    faults::FaultCohesiveKin fault;
+    fault.id(100);
+    fault.label(data.faultA);
+    const int nvertices = fault.numVerticesNoMesh(mesh);
+    int firstFaultVertex = 0;
+    int firstLagrangeVertex = nvertices;
+    int firstFaultCell = 2*nvertices; // shadow + Lagrange vertices
+    fault.adjustTopology(&mesh, &firstFaultVertex, &firstLagrangeVertex, &firstFaultCell);
+  } // if
+
+  RefineUniform refiner;
+  refiner.retainHierarchy(true);
+  Mesh newMesh(data.cellDim);
+  refiner.refine(&newMesh, mesh, data.refineLevel);
+
+  const int spaceDim = data.spaceDim;
+  Field field(newMesh);
+  PetscErrorCode err = 0;
+  if (withLagrange) {
+    // DOF on vertices and hybrid edges, like the solution field.
+    PetscInt vStart = 0, vEnd = 0, eEnd = 0, eMax = -1;
+    err = DMPlexGetDepthStratum(newMesh.dmMesh(), 0, &vStart, &vEnd);PYLITH_CHECK_ERROR(err);
+    err = DMPlexGetDepthStratum(newMesh.dmMesh(), 1, NULL, &eEnd);PYLITH_CHECK_ERROR(err);
+    err = DMPlexGetHybridBounds(newMesh.dmMesh(), NULL, NULL, &eMax, NULL);PYLITH_CHECK_ERROR(err);
+    CPPUNIT_ASSERT(eMax >= 0 && eEnd > eMax);
+    int_array points((vEnd-vStart) + (eEnd-eMax));
+    PetscInt index = 0;
+    for (PetscInt v = vStart; v < vEnd; ++v) {
+      points[index++] = v;
+    } // for
+    for (PetscInt e = eMax; e < eEnd; ++e) {
+      points[index++] = e;
+    } // for
+    field.newSection(points, spaceDim);
+  } else {
+    field.newSection(FieldBase::VERTICES_FIELD, spaceDim);
+  } // if/else
+  field.allocate();
+
+  RefineInterpolator interpolator;
+  interpolator.initialize(field);
+  CPPUNIT_ASSERT_EQUAL(data.refineLevel+1, interpolator.numLevels());
+  CPPUNIT_ASSERT_EQUAL(withLagrange, interpolator.hasEdgeDof());
+  const int level = interpolator.numLevels()-1;
+
+  PetscMat interpMat = interpolator.interpolation(level);CPPUNIT_ASSERT(interpMat);
+  PetscVec coarseVec = NULL, fineVec = NULL;
+  err = MatCreateVecs(interpMat, &coarseVec, &fineVec);PYLITH_CHECK_ERROR(err);
+
+  // Set coarse vector to coordinates of vertices in coarse mesh. DOF
+  // on hybrid edges get the coordinates of the first vertex in the
+  // cone of the edge.
+  const PetscDM dmCoarse = mesh.dmMesh();CPPUNIT_ASSERT(dmCoarse);
+  PetscSection coarseSection = interpolator.globalSection(level-1);CPPUNIT_ASSERT(coarseSection);
+  _setCoordinates(coarseVec, dmCoarse, coarseSection, spaceDim, withLagrange);
+
+  err = MatMult(interpMat, coarseVec, fineVec);PYLITH_CHECK_ERROR(err);
+
+  // Check fine vector against coordinates of vertices in refined mesh.
+  const PetscDM dmFine = newMesh.dmMesh();CPPUNIT_ASSERT(dmFine);
+  PetscSection fineSection = field.globalSection();CPPUNIT_ASSERT(fineSection);
+  PetscVec fineVecE = NULL;
+  err = VecDuplicate(fineVec, &fineVecE);PYLITH_CHECK_ERROR(err);
+  _setCoordinates(fineVecE, dmFine, fineSection, spaceDim, withLagrange);
+
+  PetscInt size = 0;
+  const PetscScalar* vecArray = NULL;
+  const PetscScalar* vecArrayE = NULL;
+  err = VecGetLocalSize(fineVec, &size);PYLITH_CHECK_ERROR(err);
+  err = VecGetArrayRead(fineVec, &vecArray);PYLITH_CHECK_ERROR(err);
+  err = VecGetArrayRead(fineVecE, &vecArrayE);PYLITH_CHECK_ERROR(err);
+  const PylithScalar tolerance = 1.0e-6;
+  for (PetscInt i=0; i < size; ++i) {
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(vecArrayE[i], vecArray[i], tolerance);
+  } // for
+  err = VecRestoreArrayRead(fineVec, &vecArray);PYLITH_CHECK_ERROR(err);
+  err = VecRestoreArrayRead(fineVecE, &vecArrayE);PYLITH_CHECK_ERROR(err);
+
+  // Check index sets for DOF on vertices and hybrid edges.
+  for (int iLevel=0; iLevel < interpolator.numLevels(); ++iLevel) {
+    PetscIS isVertices = NULL, isEdges = NULL;
+    interpolator.createFieldIS(&isVertices, &isEdges, iLevel);
+    PetscInt numVertexDof = 0, numEdgeDof = 0, numDof = 0;
+    err = ISGetLocalSize(isVertices, &numVertexDof);PYLITH_CHECK_ERROR(err);
+    err = ISGetLocalSize(isEdges, &numEdgeDof);PYLITH_CHECK_ERROR(err);
+    err = PetscSectionGetConstrainedStorageSize(interpolator.globalSection(iLevel), &numDof);PYLITH_CHECK_ERROR(err);
+    CPPUNIT_ASSERT_EQUAL(numDof, numVertexDof+numEdgeDof);
+    CPPUNIT_ASSERT_EQUAL(withLagrange, numEdgeDof > 0);
+    err = ISDestroy(&isVertices);PYLITH_CHECK_ERROR(err);
+    err = ISDestroy(&isEdges);PYLITH_CHECK_ERROR(err);
+  } // for
+
+  err = VecDestroy(&coarseVec);PYLITH_CHECK_ERROR(err);
+  err = VecDestroy(&fineVec);PYLITH_CHECK_ERROR(err);
+  err = VecDestroy(&fineVecE);PYLITH_CHECK_ERROR(err);
+
+  PYLITH_METHOD_END;
+} // _testInterpolation
+
+// ----------------------------------------------------------------------
+// Set values of vector to coordinates of vertices.
+void
+pylith::topology::TestRefineInterpolator::_setCoordinates(PetscVec vec,
+							  PetscDM dm,
+							  PetscSection globalSection,
+							  const int spaceDim,
+							  const bool withLagrange)
+{ // _setCoordinates
+  PYLITH_METHOD_BEGIN;
+
+  PetscErrorCode err = 0;
+  PetscSection coordSection = NULL;
+  PetscVec coordVec = NULL;
+  const PetscScalar* coordArray = NULL;
+  PetscScalar* vecArray = NULL;
+  PetscInt vStart = 0, vEnd = 0, eEnd = 0, eMax = -1;
+  err = DMPlexGetDepthStratum(dm, 0, &vStart, &vEnd);PYLITH_CHECK_ERROR(err);
+  err = DMPlexGetDepthStratum(dm, 1, NULL, &eEnd);PYLITH_CHECK_ERROR(err);
+  err = DMPlexGetHybridBounds(dm, NULL, NULL, &eMax, NULL);PYLITH_CHECK_ERROR(err);
+  err = DMGetCoordinateSection(dm, &coordSection);PYLITH_CHECK_ERROR(err);
+  err = DMGetCoordinatesLocal(dm, &coordVec);PYLITH_CHECK_ERROR(err);
+  err = VecGetArrayRead(coordVec, &coordArray);PYLITH_CHECK_ERROR(err);
+  err = VecGetArray(vec, &vecArray);PYLITH_CHECK_ERROR(err);
+  const PetscInt pEnd = (withLagrange && eMax >= 0) ? eEnd : vEnd;
+  for (PetscInt p = vStart; p < pEnd; ++p) {
+    if (p >= vEnd && p < eMax) {
+      continue;
+    } // if
+    PetscInt v = p;
+    if (p >= vEnd) {
+      const PetscInt* cone = NULL;
+      err = DMPlexGetCone(dm, p, &cone);PYLITH_CHECK_ERROR(err);
+      v = cone[0];
+    } // if
+    PetscInt coff = 0, goff = 0;
+    err = PetscSectionGetOffset(coordSection, v, &coff);PYLITH_CHECK_ERROR(err);
+    err = PetscSectionGetOffset(globalSection, p, &goff);PYLITH_CHECK_ERROR(err);
+    for (int d=0; d < spaceDim; ++d) {
+      vecArray[goff+d] = coordArray[coff+d];
+    } // for
+  } // for
+  err = VecRestoreArray(vec, &vecArray);PYLITH_CHECK_ERROR(err);
+  err = VecRestoreArrayRead(coordVec, &coordArray);PYLITH_CHECK_ERROR(err);
+
+  PYLITH_METHOD_END;
+} // _setCoordinates
+
+
+// End of file 
@@ -0,0 +1,132 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+
+/**
+ * @file unittests/libtests/topology/TestRefineInterpolator.hh
+ *
+ * @brief C++ TestRefineInterpolator object
+ *
+ * C++ unit testing for RefineInterpolator.
+ */
+
+#if !defined(pylith_topology_testrefineinterpolator_hh)
+#define pylith_topology_testrefineinterpolator_hh
+
+// Include directives ---------------------------------------------------
+#include <cppunit/extensions/HelperMacros.h>
+
+#include "pylith/topology/topologyfwd.hh" // USES Mesh
+#include "pylith/utils/petscfwd.h" // USES PetscVec, PetscDM, PetscSection
+
+// Forward declarations -------------------------------------------------
+/// Namespace for pylith package
+namespace pylith {
+  namespace topology {
+    class TestRefineInterpolator;
+
+    class MeshDataCohesive; // test data
+  } // topology
+} // pylith
+
+// RefineInterpolator ---------------------------------------------------
+class pylith::topology::TestRefineInterpolator : public CppUnit::TestFixture
+{ // class TestRefineInterpolator
+
+  // CPPUNIT TEST SUITE /////////////////////////////////////////////////
+  CPPUNIT_TEST_SUITE( TestRefineInterpolator );
+
+  CPPUNIT_TEST( testConstructor );
+  CPPUNIT_TEST( testInterpolationTri3 );
+  CPPUNIT_TEST( testInterpolationQuad4 );
+  CPPUNIT_TEST( testInterpolationTet4 );
+  CPPUNIT_TEST( testInterpolationHex8 );
+  CPPUNIT_TEST( testInterpolationLagrangeTri3 );
+  CPPUNIT_TEST( testInterpolationLagrangeQuad4 );
+  CPPUNIT_TEST( testInterpolationLagrangeTet4 );
+  CPPUNIT_TEST( testInterpolationLagrangeHex8 );
+
+  CPPUNIT_TEST_SUITE_END();
+
+  // PUBLIC METHODS /////////////////////////////////////////////////////
+public :
+
+  /// Test constructor.
+  void testConstructor(void);
+
+  /// Test initialize() and interpolation() with tri3 cells and one fault.
+  void testInterpolationTri3(void);
+
+  /// Test initialize() and interpolation() with quad4 cells and one fault.
+  void testInterpolationQuad4(void);
+
+  /// Test initialize() and interpolation() with tet4 cells and one fault.
+  void testInterpolationTet4(void);
+
+  /// Test initialize() and interpolation() with hex8 cells and one fault.
+  void testInterpolationHex8(void);
+
+  /// Test interpolation() of DOF on vertices and hybrid edges with tri3 cells and one fault.
+  void testInterpolationLagrangeTri3(void);
+
+  /// Test interpolation() of DOF on vertices and hybrid edges with quad4 cells and one fault.
+  void testInterpolationLagrangeQuad4(void);
+
+  /// Test interpolation() of DOF on vertices and hybrid edges with tet4 cells and one fault.
+  void testInterpolationLagrangeTet4(void);
+
+  /// Test interpolation() of DOF on vertices and hybrid edges with hex8 cells and one fault.
+  void testInterpolationLagrangeHex8(void);
+
+// PRIVATE METHODS //////////////////////////////////////////////////////
+private :
+
+  /** Test interpolation of vertex coordinates from coarse mesh to
+   * refined mesh.
+   *
+   * Interpolation is linear, so it must reproduce the coordinates of
+   * the vertices in the refined mesh exactly. DOF on hybrid edges
+   * hold the coordinates of the first vertex in the cone of the edge,
+   * so they must also be reproduced exactly.
+   *
+   * @param data Test data.
+   * @param withLagrange True if field has DOF on hybrid edges.
+   */
+  void _testInterpolation(const MeshDataCohesive& data,
+			  const bool withLagrange);
+
+  /** Set values of vector to coordinates of vertices.
+   *
+   * @param vec Global vector.
+   * @param dm PETSc DM for mesh.
+   * @param globalSection Global section for layout of vector.
+   * @param spaceDim Spatial dimension.
+   * @param withLagrange True if vector has DOF on hybrid edges.
+   */
+  void _setCoordinates(PetscVec vec,
+		       PetscDM dm,
+		       PetscSection globalSection,
+		       const int spaceDim,
+		       const bool withLagrange);
+
+}; // class TestRefineInterpolator
+
+#endif // pylith_topology_testrefineinterpolator_hh
+
+
+// End of file 
@@ -231,6 +231,25 @@ pylith::topology::TestRefineUniform::_testRefine(const MeshDataCohesive& data,
 
   const PetscDM& dmMesh = newMesh.dmMesh();CPPUNIT_ASSERT(dmMesh);
 
+  // Check refinement hierarchy is not retained by default
+  PetscDM dmCoarse = NULL;
+  PetscErrorCode err = DMGetCoarseDM(dmMesh, &dmCoarse);PYLITH_CHECK_ERROR(err);
+  CPPUNIT_ASSERT(!dmCoarse);
+
+  // Check refinement hierarchy is retained when requested
+  { // hierarchy
+    RefineUniform refinerMG;
+    refinerMG.retainHierarchy(true);
+    Mesh newMeshMG(data.cellDim);
+    refinerMG.refine(&newMeshMG, mesh, data.refineLevel);
+    dmCoarse = newMeshMG.dmMesh();
+    for (int i=0; i < data.refineLevel; ++i) {
+      err = DMGetCoarseDM(dmCoarse, &dmCoarse);PYLITH_CHECK_ERROR(err);
+      CPPUNIT_ASSERT(dmCoarse);
+    } // for
+    CPPUNIT_ASSERT(mesh.dmMesh() == dmCoarse);
+  } // hierarchy
+
   // Check vertices
   topology::Stratum verticesStratum(dmMesh, topology::Stratum::DEPTH, 0);
   CPPUNIT_ASSERT_EQUAL(data.numVertices, verticesStratum.size());
@@ -250,7 +269,6 @@ pylith::topology::TestRefineUniform::_testRefine(const MeshDataCohesive& data,
   const PetscInt numCells = cellsStratum.size();
 
   CPPUNIT_ASSERT_EQUAL(data.numCells+data.numCellsCohesive, numCells);
-  PetscErrorCode err;
   // Normal cells
   for(PetscInt c = cStart, index = 0; c < data.numCells; ++c) {
     PetscInt *closure = PETSC_NULL;
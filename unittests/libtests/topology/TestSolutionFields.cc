@@ -105,6 +105,59 @@ pylith::topology::TestSolutionFields::testSolution(void)
   PYLITH_METHOD_END;
 } // testSolution
 
+// ----------------------------------------------------------------------
+// Test createHistory(), shiftHistory(), and historyVector().
+void
+pylith::topology::TestSolutionFields::testHistory(void)
+{ // testHistory
+  PYLITH_METHOD_BEGIN;
+
+  Mesh mesh;
+  _initialize(&mesh);
+  SolutionFields manager(mesh);
+
+  const char* name = "solution";
+  const int fiberDim = 2;
+  manager.add(name, "displacement");
+  Field& field = manager.get(name);
+  field.newSection(FieldBase::VERTICES_FIELD, fiberDim);
+  field.allocate();
+  manager.solutionName(name);
+
+  const int size = 2;
+  manager.createHistory(size);
+  CPPUNIT_ASSERT_EQUAL(size, manager.historySize());
+  CPPUNIT_ASSERT_EQUAL(0, manager.historyLength());
+  CPPUNIT_ASSERT_THROW(manager.historyVector(0), std::runtime_error);
+
+  PetscVec solutionVec = manager.solution().globalVector();CPPUNIT_ASSERT(solutionVec);
+  const PylithScalar values[3] = { 1.0, 2.0, 3.0 };
+  const int numShifts = 3;
+  PetscErrorCode err = 0;
+  for (int i=0; i < numShifts; ++i) {
+    err = VecSet(solutionVec, values[i]);CPPUNIT_ASSERT(!err);
+    manager.shiftHistory();
+  } // for
+  CPPUNIT_ASSERT_EQUAL(size, manager.historyLength());
+
+  // Most recent solution is first.
+  const PylithScalar tolerance = 1.0e-6;
+  for (int i=0; i < size; ++i) {
+    PetscReal valueMin = 0.0, valueMax = 0.0;
+    err = VecMin(manager.historyVector(i), NULL, &valueMin);CPPUNIT_ASSERT(!err);
+    err = VecMax(manager.historyVector(i), NULL, &valueMax);CPPUNIT_ASSERT(!err);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(values[numShifts-1-i], valueMin, tolerance);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(values[numShifts-1-i], valueMax, tolerance);
+  } // for
+  CPPUNIT_ASSERT_THROW(manager.historyVector(size), std::runtime_error);
+
+  manager.clearHistory();
+  CPPUNIT_ASSERT_EQUAL(0, manager.historyLength());
+  CPPUNIT_ASSERT_EQUAL(size, manager.historySize());
+
+  PYLITH_METHOD_END;
+} // testHistory
+
 // ----------------------------------------------------------------------
 void
 pylith::topology::TestSolutionFields::_initialize(Mesh* mesh) const
@@ -48,6 +48,7 @@ class pylith::topology::TestSolutionFields : public CppUnit::TestFixture
   CPPUNIT_TEST( testConstructor );
   CPPUNIT_TEST( testSolutionName );
   CPPUNIT_TEST( testSolution );
+  CPPUNIT_TEST( testHistory );
 
   CPPUNIT_TEST_SUITE_END();
 
@@ -63,6 +64,9 @@ public :
   /// Test solution().
   void testSolution(void);
 
+  /// Test createHistory(), shiftHistory(), and historyVector().
+  void testHistory(void);
+
   // PRIVATE METHODS ////////////////////////////////////////////////////
 private :
 
@@ -0,0 +1,261 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "TestSpaceFillingCurve.hh" // Implementation of class methods
+
+#include "pylith/topology/SpaceFillingCurve.hh" // USES SpaceFillingCurve
+
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/Stratum.hh" // USES Stratum
+#include "pylith/topology/CoordsVisitor.hh" // USES CoordsVisitor
+#include "pylith/meshio/MeshIOAscii.hh" // USES MeshIOAscii
+#include "pylith/faults/FaultCohesiveKin.hh" // USES FaultCohesiveKin
+
+#include <set> // USES std::set
+#include <stdexcept> // USES std::logic_error
+
+// ----------------------------------------------------------------------
+CPPUNIT_TEST_SUITE_REGISTRATION( pylith::topology::TestSpaceFillingCurve );
+
+// ----------------------------------------------------------------------
+// Test reorder() with tri3 cells.
+void
+pylith::topology::TestSpaceFillingCurve::testReorderTri3(void)
+{ // testReorderTri3
+  PYLITH_METHOD_BEGIN;
+
+  _testReorder("data/reorder_tri3.mesh");
+
+  PYLITH_METHOD_END;
+} // testReorderTri3
+
+// ----------------------------------------------------------------------
+// Test reorder() with quad4 cells.
+void
+pylith::topology::TestSpaceFillingCurve::testReorderQuad4(void)
+{ // testReorderQuad4
+  PYLITH_METHOD_BEGIN;
+
+  _testReorder("data/reorder_quad4.mesh");
+
+  PYLITH_METHOD_END;
+} // testReorderQuad4
+
+// ----------------------------------------------------------------------
+// Test reorder() with tet4 cells.
+void
+pylith::topology::TestSpaceFillingCurve::testReorderTet4(void)
+{ // testReorderTet4
+  PYLITH_METHOD_BEGIN;
+
+  _testReorder("data/reorder_tet4.mesh");
+
+  PYLITH_METHOD_END;
+} // testReorderTet4
+
+// ----------------------------------------------------------------------
+// Test reorder() with hex8 cells.
+void
+pylith::topology::TestSpaceFillingCurve::testReorderHex8(void)
+{ // testReorderHex8
+  PYLITH_METHOD_BEGIN;
+
+  _testReorder("data/reorder_hex8.mesh");
+
+  PYLITH_METHOD_END;
+} // testReorderHex8
+
+// ----------------------------------------------------------------------
+// Test reorder() with cohesive cells.
+void
+pylith::topology::TestSpaceFillingCurve::testReorderFault(void)
+{ // testReorderFault
+  PYLITH_METHOD_BEGIN;
+
+  Mesh mesh;
+  _setupMesh(&mesh, "data/reorder_tri3.mesh");
+
+  int firstFaultVertex = 0;
+  int firstLagrangeVertex = 0;
+  int firstFaultCell = 0;
+  faults::FaultCohesiveKin fault;
+  fault.id(100);
+  fault.label("fault");
+  const int nvertices = fault.numVerticesNoMesh(mesh);
+  firstLagrangeVertex += nvertices;
+  firstFaultCell += 2*nvertices; // shadow + Lagrange vertices
+  fault.adjustTopology(&mesh, &firstFaultVertex, &firstLagrangeVertex, &firstFaultCell);
+
+  CPPUNIT_ASSERT_THROW(SpaceFillingCurve::reorder(&mesh), std::logic_error);
+
+  PYLITH_METHOD_END;
+} // testReorderFault
+
+// ----------------------------------------------------------------------
+// Test closureSpan().
+void
+pylith::topology::TestSpaceFillingCurve::testClosureSpan(void)
+{ // testClosureSpan
+  PYLITH_METHOD_BEGIN;
+
+  Mesh mesh;
+  _setupMesh(&mesh, "data/reorder_tri3.mesh");
+
+  // Cells: 0 7 5, 2 4 7, 1 6 4, 6 3 5, 7 4 5, 4 6 5
+  const double meanSpanE = (7+5+5+3+3+2) / 6.0;
+  const int maxSpanE = 7;
+
+  const double tolerance = 1.0e-6;
+  double meanSpan = 0.0;
+  int maxSpan = 0;
+  SpaceFillingCurve::closureSpan(&meanSpan, &maxSpan, mesh);
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(meanSpanE, meanSpan, tolerance);
+  CPPUNIT_ASSERT_EQUAL(maxSpanE, maxSpan);
+
+  PYLITH_METHOD_END;
+} // testClosureSpan
+
+// ----------------------------------------------------------------------
+void
+pylith::topology::TestSpaceFillingCurve::_setupMesh(Mesh* const mesh,
+						    const char* filename)
+{ // _setupMesh
+  PYLITH_METHOD_BEGIN;
+
+  assert(mesh);
+
+  meshio::MeshIOAscii iohandler;
+  iohandler.filename(filename);
+  iohandler.interpolate(true);
+
+  iohandler.read(mesh);
+  CPPUNIT_ASSERT(mesh->numCells() > 0);
+  CPPUNIT_ASSERT(mesh->numVertices() > 0);
+
+  PYLITH_METHOD_END;
+} // _setupMesh
+
+// ----------------------------------------------------------------------
+// Test reorder().
+void
+pylith::topology::TestSpaceFillingCurve::_testReorder(const char* filename)
+{ // _testReorder
+  PYLITH_METHOD_BEGIN;
+
+  Mesh mesh;
+  _setupMesh(&mesh, filename);
+
+  // Get original DM and create Mesh for it
+  const PetscDM dmOrig = mesh.dmMesh();
+  PetscObjectReference((PetscObject) dmOrig);
+  Mesh meshOrig;
+  meshOrig.dmMesh(dmOrig);
+
+  SpaceFillingCurve::reorder(&mesh);
+
+  const PetscDM& dmMesh = mesh.dmMesh();CPPUNIT_ASSERT(dmMesh);
+
+  // Check points in each depth stratum (size only)
+  PetscInt depth = 0;
+  PetscErrorCode err;
+  err = DMPlexGetDepth(dmMesh, &depth);PYLITH_CHECK_ERROR(err);
+  for (PetscInt d=0; d <= depth; ++d) {
+    topology::Stratum stratumE(dmOrig, topology::Stratum::DEPTH, d);
+    topology::Stratum stratum(dmMesh, topology::Stratum::DEPTH, d);
+    CPPUNIT_ASSERT_EQUAL(stratumE.begin(), stratum.begin());
+    CPPUNIT_ASSERT_EQUAL(stratumE.size(), stratum.size());
+  } // for
+
+  // Check groups
+  PetscInt numGroupsE, numGroups;
+  err = DMGetNumLabels(dmOrig, &numGroupsE);PYLITH_CHECK_ERROR(err);
+  err = DMGetNumLabels(dmMesh, &numGroups);PYLITH_CHECK_ERROR(err);
+  CPPUNIT_ASSERT_EQUAL(numGroupsE, numGroups);
+
+  for (PetscInt iGroup = 0; iGroup < numGroups; ++iGroup) {
+    const char *name = NULL;
+    err = DMGetLabelName(dmMesh, iGroup, &name);PYLITH_CHECK_ERROR(err);
+
+    PetscInt numPointsE, numPoints;
+    err = DMGetStratumSize(dmOrig, name, 1, &numPointsE);PYLITH_CHECK_ERROR(err);
+    err = DMGetStratumSize(dmMesh, name, 1, &numPoints);PYLITH_CHECK_ERROR(err);
+    CPPUNIT_ASSERT_EQUAL(numPointsE, numPoints);
+  } // for
+
+  // Check cells of each material are contiguous.
+  topology::Stratum cellsStratum(dmMesh, topology::Stratum::HEIGHT, 0);
+  const PetscInt cStart = cellsStratum.begin();
+  const PetscInt cEnd = cellsStratum.end();
+  DMLabel materialsLabel = NULL;
+  err = DMGetLabel(dmMesh, "material-id", &materialsLabel);PYLITH_CHECK_ERROR(err);CPPUNIT_ASSERT(materialsLabel);
+  std::set<PetscInt> materialsDone;
+  PetscInt materialPrev = -1;
+  for (PetscInt cell = cStart; cell < cEnd; ++cell) {
+    PetscInt materialId = -1;
+    err = DMLabelGetValue(materialsLabel, cell, &materialId);PYLITH_CHECK_ERROR(err);
+    if (cell > cStart && materialId != materialPrev) {
+      materialsDone.insert(materialPrev);
+    } // if
+    CPPUNIT_ASSERT(materialsDone.find(materialId) == materialsDone.end());
+    materialPrev = materialId;
+  } // for
+
+  // Check element centroids
+  PylithScalar coordsCheckOrig = 0.0;
+  { // original
+    Stratum cellsStratum(dmOrig, Stratum::HEIGHT, 0);
+    const PetscInt cStart = cellsStratum.begin();
+    const PetscInt cEnd = cellsStratum.end();
+    topology::CoordsVisitor coordsVisitor(dmOrig);
+    for (PetscInt cell = cStart; cell < cEnd; ++cell) {
+      PetscScalar* coordsCell = NULL;
+      PetscInt coordsSize = 0;
+      PylithScalar value = 0.0;
+      coordsVisitor.getClosure(&coordsCell, &coordsSize, cell);
+      for (int i=0; i < coordsSize; ++i) {
+	value += coordsCell[i];
+      } // for
+      coordsCheckOrig += value*value;
+      coordsVisitor.restoreClosure(&coordsCell, &coordsSize, cell);
+    } // for
+  } // original
+  PylithScalar coordsCheck = 0.0;
+  { // reordered
+    topology::CoordsVisitor coordsVisitor(dmMesh);
+    for (PetscInt cell = cStart; cell < cEnd; ++cell) {
+      PetscScalar* coordsCell = NULL;
+      PetscInt coordsSize = 0;
+      PylithScalar value = 0.0;
+      coordsVisitor.getClosure(&coordsCell, &coordsSize, cell);
+      for (int i=0; i < coordsSize; ++i) {
+	value += coordsCell[i];
+      } // for
+      coordsCheck += value*value;
+      coordsVisitor.restoreClosure(&coordsCell, &coordsSize, cell);
+    } // for
+  } // reordered
+  const PylithScalar tolerance = 1.0e-6;
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(coordsCheckOrig, coordsCheck, tolerance*coordsCheckOrig);
+
+  PYLITH_METHOD_END;
+} // _testReorder
+
+
+// End of file 
@@ -0,0 +1,102 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+/**
+ * @file unittests/libtests/topology/TestSpaceFillingCurve.hh
+ *
+ * @brief C++ TestSpaceFillingCurve object
+ *
+ * C++ unit testing for SpaceFillingCurve.
+ */
+
+#if !defined(pylith_topology_testspacefillingcurve_hh)
+#define pylith_topology_testspacefillingcurve_hh
+
+// Include directives ---------------------------------------------------
+#include <cppunit/extensions/HelperMacros.h>
+
+#include "pylith/topology/topologyfwd.hh" // USES Mesh
+
+// Forward declarations -------------------------------------------------
+/// Namespace for pylith package
+namespace pylith {
+  namespace topology {
+    class TestSpaceFillingCurve;
+  } // topology
+} // pylith
+
+// SpaceFillingCurve ----------------------------------------------------
+class pylith::topology::TestSpaceFillingCurve : public CppUnit::TestFixture
+{ // class TestSpaceFillingCurve
+
+  // CPPUNIT TEST SUITE /////////////////////////////////////////////////
+  CPPUNIT_TEST_SUITE( TestSpaceFillingCurve );
+
+  CPPUNIT_TEST( testReorderTri3 );
+  CPPUNIT_TEST( testReorderQuad4 );
+  CPPUNIT_TEST( testReorderTet4 );
+  CPPUNIT_TEST( testReorderHex8 );
+  CPPUNIT_TEST( testReorderFault );
+  CPPUNIT_TEST( testClosureSpan );
+
+  CPPUNIT_TEST_SUITE_END();
+
+  // PUBLIC METHODS /////////////////////////////////////////////////////
+public :
+
+  /// Test reorder() with tri3 cells.
+  void testReorderTri3(void);
+
+  /// Test reorder() with quad4 cells.
+  void testReorderQuad4(void);
+
+  /// Test reorder() with tet4 cells.
+  void testReorderTet4(void);
+
+  /// Test reorder() with hex8 cells.
+  void testReorderHex8(void);
+
+  /// Test reorder() with cohesive cells.
+  void testReorderFault(void);
+
+  /// Test closureSpan().
+  void testClosureSpan(void);
+
+// PRIVATE METHODS //////////////////////////////////////////////////////
+private :
+
+  /** Setup mesh.
+   *
+   * @mesh Mesh to setup.
+   * @param filename Mesh filename.
+   */
+  void _setupMesh(Mesh* const mesh,
+		  const char* filename);
+
+  /** Test reorder().
+   *
+   * @param filename Mesh filename.
+   */
+  void _testReorder(const char* filename);
+
+}; // class TestSpaceFillingCurve
+
+#endif // pylith_topology_testspacefillingcurve_hh
+
+
+// End of file 
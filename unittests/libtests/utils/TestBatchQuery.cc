@@ -0,0 +1,315 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "TestBatchQuery.hh" // Implementation of class methods
+
+#include "pylith/utils/BatchQuery.hh" // USES BatchQuery
+#include "pylith/utils/BulkQueryDB.hh" // ISA BulkQueryDB
+
+#include "pylith/utils/error.h" // USES PYLITH_METHOD_BEGIN/END
+
+#include "spatialdata/geocoords/CSCart.hh" // USES CSCart
+#include "spatialdata/spatialdb/UniformDB.hh" // ISA UniformDB
+
+#include <vector> // USES std::vector
+
+
+// ----------------------------------------------------------------------
+CPPUNIT_TEST_SUITE_REGISTRATION( pylith::utils::TestBatchQuery );
+
+// ----------------------------------------------------------------------
+namespace pylith {
+  namespace utils {
+    namespace _TestBatchQuery {
+      /// Uniform database with bulk queries that fail for x < xMin.
+      class BulkUniformDB : public spatialdata::spatialdb::UniformDB,
+			    public BulkQueryDB
+      { // BulkUniformDB
+      public :
+	BulkUniformDB(const double xMin) : numBulkQueries(0), _xMin(xMin) {}
+
+	int queryBulk(PylithScalar* values,
+		      const int numValues,
+		      const double* coords,
+		      const int numPoints,
+		      const int spaceDim,
+		      const spatialdata::geocoords::CoordSys* cs) {
+	  ++numBulkQueries;
+	  coordsQuery.assign(coords, coords+numPoints*spaceDim);
+	  int errIndex = -1;
+	  for (int iPt=0; iPt < numPoints; ++iPt) {
+	    query(&values[iPt*numValues], numValues, &coords[iPt*spaceDim], spaceDim, cs);
+	    if (coords[iPt*spaceDim] < _xMin && errIndex < 0)
+	      errIndex = iPt;
+	  } // for
+	  return errIndex;
+	} // queryBulk
+
+	int numBulkQueries; ///< Number of calls to queryBulk().
+	std::vector<double> coordsQuery; ///< Coordinates of points in last bulk query.
+
+      private :
+	const double _xMin; ///< Minimum x coordinate for successful query.
+      }; // BulkUniformDB
+    } // _TestBatchQuery
+  } // utils
+} // pylith
+
+// ----------------------------------------------------------------------
+// Test constructor.
+void
+pylith::utils::TestBatchQuery::testConstructor(void)
+{ // testConstructor
+  PYLITH_METHOD_BEGIN;
+
+  BatchQuery batch;
+  CPPUNIT_ASSERT_EQUAL(0, batch.numPoints());
+
+  PYLITH_METHOD_END;
+} // testConstructor
+
+// ----------------------------------------------------------------------
+// Test resize(), numPoints(), and point().
+void
+pylith::utils::TestBatchQuery::testPoint(void)
+{ // testPoint
+  PYLITH_METHOD_BEGIN;
+
+  const int numPoints = 3;
+  const int spaceDim = 2;
+  const PylithScalar coords[numPoints*spaceDim] = {
+    1.0, 2.0,
+    -3.0, 4.0,
+    5.0, -6.0,
+  };
+
+  BatchQuery batch;
+  batch.resize(numPoints, spaceDim);
+  CPPUNIT_ASSERT_EQUAL(numPoints, batch.numPoints());
+  for (int iPt=0; iPt < numPoints; ++iPt)
+    batch.point(iPt, &coords[iPt*spaceDim]);
+
+  for (int iPt=0; iPt < numPoints; ++iPt) {
+    const double* xy = batch.point(iPt);
+    for (int i=0; i < spaceDim; ++i)
+      CPPUNIT_ASSERT_EQUAL(double(coords[iPt*spaceDim+i]), xy[i]);
+  } // for
+
+  PYLITH_METHOD_END;
+} // testPoint
+
+// ----------------------------------------------------------------------
+// Test mortonOrder() with 2-D points.
+void
+pylith::utils::TestBatchQuery::testMortonOrder2D(void)
+{ // testMortonOrder2D
+  PYLITH_METHOD_BEGIN;
+
+  const int numPoints = 4;
+  const int spaceDim = 2;
+  const double coords[numPoints*spaceDim] = {
+    0.0, 0.0,
+    2.0, 3.0,
+    0.0, 3.0,
+    2.0, 0.0,
+  };
+  const int orderE[numPoints] = { 0, 2, 3, 1 };
+
+  std::vector<int> order;
+  BatchQuery::mortonOrder(&order, coords, numPoints, spaceDim);
+  CPPUNIT_ASSERT_EQUAL(size_t(numPoints), order.size());
+  for (int i=0; i < numPoints; ++i)
+    CPPUNIT_ASSERT_EQUAL(orderE[i], order[i]);
+
+  PYLITH_METHOD_END;
+} // testMortonOrder2D
+
+// ----------------------------------------------------------------------
+// Test mortonOrder() with 3-D points.
+void
+pylith::utils::TestBatchQuery::testMortonOrder3D(void)
+{ // testMortonOrder3D
+  PYLITH_METHOD_BEGIN;
+
+  const int numPoints = 9;
+  const int spaceDim = 3;
+  const double coords[numPoints*spaceDim] = {
+    1.0, 1.0, 1.0,
+    1.0, 1.0, -1.0,
+    1.0, -1.0, 1.0,
+    1.0, -1.0, -1.0,
+    -1.0, 1.0, 1.0,
+    -1.0, 1.0, -1.0,
+    -1.0, -1.0, 1.0,
+    -1.0, -1.0, -1.0,
+    -0.9, -0.9, -0.9,
+  };
+  const int orderE[numPoints] = { 7, 8, 6, 5, 4, 3, 2, 1, 0 };
+
+  std::vector<int> order;
+  BatchQuery::mortonOrder(&order, coords, numPoints, spaceDim);
+  CPPUNIT_ASSERT_EQUAL(size_t(numPoints), order.size());
+  for (int i=0; i < numPoints; ++i)
+    CPPUNIT_ASSERT_EQUAL(orderE[i], order[i]);
+
+  PYLITH_METHOD_END;
+} // testMortonOrder3D
+
+// ----------------------------------------------------------------------
+// Test query().
+void
+pylith::utils::TestBatchQuery::testQuery(void)
+{ // testQuery
+  PYLITH_METHOD_BEGIN;
+
+  const int numPoints = 5;
+  const int spaceDim = 3;
+  const PylithScalar coords[numPoints*spaceDim] = {
+    1.0, 2.0, 3.0,
+    -1.0, 0.5, 2.0,
+    4.0, -2.0, 0.0,
+    0.0, 0.0, 0.0,
+    2.0, 2.0, -1.0,
+  };
+
+  const int numValues = 2;
+  const char* names[numValues] = { "density", "vs" };
+  const char* units[numValues] = { "kg/m**3", "m/s" };
+  const double values[numValues] = { 2500.0, 3000.0 };
+  spatialdata::spatialdb::UniformDB db;
+  db.setData(names, units, values, numValues);
+  db.open();
+  db.queryVals(names, numValues);
+
+  spatialdata::geocoords::CSCart cs;
+  cs.setSpaceDim(spaceDim);
+  cs.initialize();
+
+  BatchQuery batch;
+  batch.resize(numPoints, spaceDim);
+  for (int iPt=0; iPt < numPoints; ++iPt)
+    batch.point(iPt, &coords[iPt*spaceDim]);
+
+  PylithScalar queryValues[numPoints*numValues];
+  const int err = batch.query(queryValues, numValues, &db, &cs);
+  db.close();
+  CPPUNIT_ASSERT_EQUAL(-1, err);
+
+  const PylithScalar tolerance = 1.0e-6;
+  for (int iPt=0; iPt < numPoints; ++iPt)
+    for (int i=0; i < numValues; ++i)
+      CPPUNIT_ASSERT_DOUBLES_EQUAL(values[i], queryValues[iPt*numValues+i], tolerance*values[i]);
+
+  PYLITH_METHOD_END;
+} // testQuery
+
+// ----------------------------------------------------------------------
+// Test query() with no points.
+void
+pylith::utils::TestBatchQuery::testQueryEmpty(void)
+{ // testQueryEmpty
+  PYLITH_METHOD_BEGIN;
+
+  const int spaceDim = 2;
+  const int numValues = 1;
+  const char* names[numValues] = { "density" };
+  const char* units[numValues] = { "kg/m**3" };
+  const double values[numValues] = { 2500.0 };
+  spatialdata::spatialdb::UniformDB db;
+  db.setData(names, units, values, numValues);
+  db.open();
+  db.queryVals(names, numValues);
+
+  spatialdata::geocoords::CSCart cs;
+  cs.setSpaceDim(spaceDim);
+  cs.initialize();
+
+  BatchQuery batch;
+  batch.resize(0, spaceDim);
+  CPPUNIT_ASSERT_EQUAL(0, batch.numPoints());
+  const int err = batch.query(0, numValues, &db, &cs);
+  db.close();
+  CPPUNIT_ASSERT_EQUAL(-1, err);
+
+  PYLITH_METHOD_END;
+} // testQueryEmpty
+
+// ----------------------------------------------------------------------
+// Test query() with database that implements BulkQueryDB.
+void
+pylith::utils::TestBatchQuery::testQueryBulk(void)
+{ // testQueryBulk
+  PYLITH_METHOD_BEGIN;
+
+  const int numPoints = 5;
+  const int spaceDim = 3;
+  const PylithScalar coords[numPoints*spaceDim] = {
+    1.0, 2.0, 3.0,
+    -1.0, 0.5, 2.0,
+    4.0, -2.0, 0.0,
+    0.0, 0.0, 0.0,
+    2.0, 2.0, -1.0,
+  };
+
+  const int numValues = 2;
+  const char* names[numValues] = { "density", "vs" };
+  const char* units[numValues] = { "kg/m**3", "m/s" };
+  const double values[numValues] = { 2500.0, 3000.0 };
+  _TestBatchQuery::BulkUniformDB db(-0.5);
+  db.setData(names, units, values, numValues);
+  db.open();
+  db.queryVals(names, numValues);
+
+  spatialdata::geocoords::CSCart cs;
+  cs.setSpaceDim(spaceDim);
+  cs.initialize();
+
+  BatchQuery batch;
+  batch.resize(numPoints, spaceDim);
+  for (int iPt=0; iPt < numPoints; ++iPt)
+    batch.point(iPt, &coords[iPt*spaceDim]);
+
+  PylithScalar queryValues[numPoints*numValues];
+  const int err = batch.query(queryValues, numValues, &db, &cs);
+  db.close();
+
+  // Query fails only at point 1 (x < -0.5).
+  CPPUNIT_ASSERT_EQUAL(1, err);
+  CPPUNIT_ASSERT_EQUAL(1, db.numBulkQueries);
+
+  // Points are passed to the database in Morton order.
+  std::vector<int> order;
+  BatchQuery::mortonOrder(&order, coords, numPoints, spaceDim);
+  CPPUNIT_ASSERT_EQUAL(size_t(numPoints*spaceDim), db.coordsQuery.size());
+  for (int iPt=0; iPt < numPoints; ++iPt)
+    for (int iDim=0; iDim < spaceDim; ++iDim)
+      CPPUNIT_ASSERT_EQUAL(double(coords[order[iPt]*spaceDim+iDim]), db.coordsQuery[iPt*spaceDim+iDim]);
+
+  // Values are returned in the original order.
+  const PylithScalar tolerance = 1.0e-6;
+  for (int iPt=0; iPt < numPoints; ++iPt)
+    for (int i=0; i < numValues; ++i)
+      CPPUNIT_ASSERT_DOUBLES_EQUAL(values[i], queryValues[iPt*numValues+i], tolerance*values[i]);
+
+  PYLITH_METHOD_END;
+} // testQueryBulk
+
+
+// End of file 
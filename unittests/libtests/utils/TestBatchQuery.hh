@@ -0,0 +1,85 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+/**
+ * @file unittests/libtests/utils/TestBatchQuery.hh
+ *
+ * @brief C++ TestBatchQuery object
+ *
+ * C++ unit testing for BatchQuery.
+ */
+
+#if !defined(pylith_utils_testbatchquery_hh)
+#define pylith_utils_testbatchquery_hh
+
+#include <cppunit/extensions/HelperMacros.h>
+
+/// Namespace for pylith package
+namespace pylith {
+  namespace utils {
+    class TestBatchQuery;
+  } // utils
+} // pylith
+
+/// C++ unit testing for BatchQuery
+class pylith::utils::TestBatchQuery : public CppUnit::TestFixture
+{ // class TestBatchQuery
+
+  // CPPUNIT TEST SUITE /////////////////////////////////////////////////
+  CPPUNIT_TEST_SUITE( TestBatchQuery );
+
+  CPPUNIT_TEST( testConstructor );
+  CPPUNIT_TEST( testPoint );
+  CPPUNIT_TEST( testMortonOrder2D );
+  CPPUNIT_TEST( testMortonOrder3D );
+  CPPUNIT_TEST( testQuery );
+  CPPUNIT_TEST( testQueryEmpty );
+  CPPUNIT_TEST( testQueryBulk );
+
+  CPPUNIT_TEST_SUITE_END();
+
+// PUBLIC METHODS ///////////////////////////////////////////////////////
+public :
+
+  /// Test constructor.
+  void testConstructor(void);
+
+  /// Test resize(), numPoints(), and point().
+  void testPoint(void);
+
+  /// Test mortonOrder() with 2-D points.
+  void testMortonOrder2D(void);
+
+  /// Test mortonOrder() with 3-D points.
+  void testMortonOrder3D(void);
+
+  /// Test query().
+  void testQuery(void);
+
+  /// Test query() with no points.
+  void testQueryEmpty(void);
+
+  /// Test query() with database that implements BulkQueryDB.
+  void testQueryBulk(void);
+
+}; // class TestBatchQuery
+
+#endif // pylith_utils_testbatchquery_hh
+
+
+// End of file 
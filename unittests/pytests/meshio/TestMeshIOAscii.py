@@ -50,6 +50,18 @@ class TestMeshIOAscii(unittest.TestCase):
     return
 
 
+  def test_useFastParser(self):
+    """
+    Test useFastParser().
+    """
+    io = MeshIOAscii()
+    self.assertEqual(True, io.useFastParser())
+
+    io.useFastParser(False)
+    self.assertEqual(False, io.useFastParser())
+    return
+
+
   def test_readwrite(self):
     """
     Test write() and read().
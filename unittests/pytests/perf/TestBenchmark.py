@@ -0,0 +1,125 @@
+#!/usr/bin/env python
+#
+# ======================================================================
+#
+# Brad T. Aagaard, U.S. Geological Survey
+# Charles A. Williams, GNS Science
+# Matthew G. Knepley, University of Chicago
+#
+# This code was developed as part of the Computational Infrastructure
+# for Geodynamics (http://geodynamics.org).
+#
+# Copyright (c) 2010-2017 University of California, Davis
+#
+# See COPYING for license information.
+#
+# ======================================================================
+#
+
+## @file unittests/pytests/perf/TestBenchmark.py
+
+## @brief Unit testing of comparing benchmark results.
+
+import unittest
+
+from pylith.perf.Benchmark import compare
+
+# ----------------------------------------------------------------------
+class TestBenchmark(unittest.TestCase):
+  """
+  Unit testing of comparing benchmark results.
+  """
+  
+
+  def test_compareSame(self):
+    """
+    Test compare() with identical results.
+    """
+    baseline = self._results()
+    current = self._results()
+    self.assertEqual([], compare(baseline, current))
+    return
+
+
+  def test_compareSlower(self):
+    """
+    Test compare() with an event that is slower than the threshold.
+    """
+    baseline = self._results()
+    current = self._results()
+    events = current['cases']['case']['events']
+    events['SoLi solve']['time'] *= 1.2
+    events['ElIR compute']['time'] *= 1.05
+
+    flagged = compare(baseline, current, threshold=0.10)
+    self.assertEqual(1, len(flagged))
+    self.assertEqual("case", flagged[0]['case'])
+    self.assertEqual("event 'SoLi solve'", flagged[0]['item'])
+    self.assertAlmostEqual(1.2, flagged[0]['ratio'])
+    return
+
+
+  def test_compareMinTime(self):
+    """
+    Test compare() ignores short times and events that are not key
+    events.
+    """
+    baseline = self._results()
+    current = self._results()
+    current['cases']['case']['events']['VecSet']['time'] *= 10.0
+    self.assertEqual([], compare(baseline, current))
+
+    current['cases']['case']['key_events'] = []
+    self.assertEqual([], compare(baseline, current, minTime=0.01))
+
+    flagged = compare(baseline, current, minTime=0.0)
+    self.assertEqual(["event 'VecSet'"], [f['item'] for f in flagged])
+    return
+
+
+  def test_compareMissingEvent(self):
+    """
+    Test compare() with key events missing from a run.
+    """
+    baseline = self._results()
+    current = self._results()
+    del current['cases']['case']['events']['SoLi solve']
+    flagged = compare(baseline, current)
+    self.assertEqual(["key event 'SoLi solve' missing from run"], [f['item'] for f in flagged])
+
+    current = self._results()
+    del baseline['cases']['case']['events']['ElIR compute']
+    flagged = compare(baseline, current)
+    self.assertEqual(["key event 'ElIR compute' missing from baseline"], [f['item'] for f in flagged])
+    return
+
+
+  def test_compareFailed(self):
+    """
+    Test compare() with failed cases and cases missing from baseline.
+    """
+    baseline = self._results()
+    current = self._results()
+    current['cases']['case']['status'] = 1
+    current['cases']['other'] = self._results()['cases']['case']
+    flagged = compare(baseline, current)
+    self.assertEqual([("case", "failed with status 1"), ("other", "missing from baseline")],
+                     [(f['case'], f['item']) for f in flagged])
+    return
+
+
+  # PRIVATE METHODS ////////////////////////////////////////////////////
+
+  def _results(self):
+    """
+    Create benchmark results from canned PETSc log.
+    """
+    from pylith.perf.LogView import LogView
+    result = {'status': 0,
+              'walltime': 15.0,
+              'key_events': ["ElIR compute", "SoLi solve"]}
+    result.update(LogView().read("data/log_detail.py").summary())
+    return {'cases': {'case': result}}
+
+
+# End of file 
@@ -0,0 +1,80 @@
+#!/usr/bin/env python
+#
+# ======================================================================
+#
+# Brad T. Aagaard, U.S. Geological Survey
+# Charles A. Williams, GNS Science
+# Matthew G. Knepley, University of Chicago
+#
+# This code was developed as part of the Computational Infrastructure
+# for Geodynamics (http://geodynamics.org).
+#
+# Copyright (c) 2010-2017 University of California, Davis
+#
+# See COPYING for license information.
+#
+# ======================================================================
+#
+
+## @file unittests/pytests/perf/TestLogView.py
+
+## @brief Unit testing of LogView object.
+
+import unittest
+
+from pylith.perf.LogView import LogView
+
+# ----------------------------------------------------------------------
+class TestLogView(unittest.TestCase):
+  """
+  Unit testing of LogView object.
+  """
+  
+
+  def test_read(self):
+    """
+    Test read().
+    """
+    log = LogView().read("data/log_detail.py")
+    self.assertEqual(2, log.nprocs)
+    self.assertEqual({0: 10.0, 1: 12.0}, log.times)
+    self.assertEqual({0: 1.0e+6, 1: 3.0e+6}, log.flop)
+    self.assertEqual(["Main Stage", "Solve"], sorted(log.stages.keys()))
+    return
+
+
+  def test_summary(self):
+    """
+    Test summary().
+    """
+    summary = LogView().read("data/log_detail.py").summary()
+
+    self.assertEqual(2, summary['nprocs'])
+    self.assertAlmostEqual(12.0, summary['time'])
+    self.assertAlmostEqual(4.0e+6, summary['flop'])
+
+    # Stage times are the maximum and flop the sum over processes.
+    stagesE = {"Main Stage": (2.5, 3.0e+5),
+               "Solve": (7.0, 3.7e+6)}
+    stages = summary['stages']
+    self.assertEqual(sorted(stagesE.keys()), sorted(stages.keys()))
+    for name, (timeE, flopE) in stagesE.items():
+      self.assertAlmostEqual(timeE, stages[name]['time'])
+      self.assertAlmostEqual(flopE, stages[name]['flop'])
+
+    # Events are combined over stages, skipping stages in which the
+    # event did not occur.
+    eventsE = {"ElIR compute": (4, 3.0, 4.0e+5),
+               "SoLi solve": (2, 4.5, 3.2e+6),
+               "VecSet": (12, 0.002, 0.0)}
+    events = summary['events']
+    self.assertEqual(sorted(eventsE.keys()), sorted(events.keys()))
+    for name, (countE, timeE, flopE) in eventsE.items():
+      self.assertEqual(countE, events[name]['count'])
+      self.assertAlmostEqual(timeE, events[name]['time'])
+      self.assertAlmostEqual(flopE, events[name]['flop'])
+      self.assertAlmostEqual(flopE/timeE, events[name]['flop_rate'])
+    return
+
+
+# End of file 
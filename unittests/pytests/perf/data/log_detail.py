@@ -0,0 +1,41 @@
+#------------------------------------------------------------------------------
+# PETSc performance log in detailed Python format (-log_view
+# :FILENAME:ascii_info_detail), reduced to a few events, for testing
+# pylith.perf.LogView.
+#------------------------------------------------------------------------------
+size = 2
+LocalTimes = {}
+LocalMessages = {}
+LocalMessageLens = {}
+LocalReductions = {}
+LocalFlop = {}
+LocalObjects = {}
+LocalMemory = {}
+LocalTimes[0] = 10.0
+LocalTimes[1] = 12.0
+LocalFlop[0] = 1.0e+6
+LocalFlop[1] = 3.0e+6
+Stages = {}
+Stages["Main Stage"] = {}
+Stages["Main Stage"]["summary"] = {}
+Stages["Main Stage"]["summary"][0] = {"time" : 2.0, "numMessages" : 4, "messageLength" : 96, "numReductions" : 2, "flop" : 1.0e+5}
+Stages["Main Stage"]["summary"][1] = {"time" : 2.5, "numMessages" : 4, "messageLength" : 96, "numReductions" : 2, "flop" : 2.0e+5}
+Stages["Main Stage"]["ElIR compute"] = {}
+Stages["Main Stage"]["ElIR compute"][0] = {"count" : 1, "time" : 0.5, "syncTime" : 0.0, "numMessages" : 0, "messageLength" : 0, "numReductions" : 0, "flop" : 4.0e+4}
+Stages["Main Stage"]["ElIR compute"][1] = {"count" : 1, "time" : 0.75, "syncTime" : 0.0, "numMessages" : 0, "messageLength" : 0, "numReductions" : 0, "flop" : 6.0e+4}
+Stages["Main Stage"]["SoLi solve"] = {}
+Stages["Main Stage"]["SoLi solve"][0] = {"count" : 0, "time" : 0.0, "syncTime" : 0.0, "numMessages" : 0, "messageLength" : 0, "numReductions" : 0, "flop" : 0.0}
+Stages["Main Stage"]["SoLi solve"][1] = {"count" : 0, "time" : 0.0, "syncTime" : 0.0, "numMessages" : 0, "messageLength" : 0, "numReductions" : 0, "flop" : 0.0}
+Stages["Solve"] = {}
+Stages["Solve"]["summary"] = {}
+Stages["Solve"]["summary"][0] = {"time" : 6.0, "numMessages" : 40, "messageLength" : 960, "numReductions" : 20, "flop" : 9.0e+5}
+Stages["Solve"]["summary"][1] = {"time" : 7.0, "numMessages" : 40, "messageLength" : 960, "numReductions" : 20, "flop" : 2.8e+6}
+Stages["Solve"]["ElIR compute"] = {}
+Stages["Solve"]["ElIR compute"][0] = {"count" : 3, "time" : 1.5, "syncTime" : 0.0, "numMessages" : 0, "messageLength" : 0, "numReductions" : 0, "flop" : 1.2e+5}
+Stages["Solve"]["ElIR compute"][1] = {"count" : 3, "time" : 2.25, "syncTime" : 0.0, "numMessages" : 0, "messageLength" : 0, "numReductions" : 0, "flop" : 1.8e+5}
+Stages["Solve"]["SoLi solve"] = {}
+Stages["Solve"]["SoLi solve"][0] = {"count" : 2, "time" : 4.0, "syncTime" : 0.1, "numMessages" : 40, "messageLength" : 960, "numReductions" : 20, "flop" : 7.0e+5}
+Stages["Solve"]["SoLi solve"][1] = {"count" : 2, "time" : 4.5, "syncTime" : 0.2, "numMessages" : 40, "messageLength" : 960, "numReductions" : 20, "flop" : 2.5e+6}
+Stages["Solve"]["VecSet"] = {}
+Stages["Solve"]["VecSet"][0] = {"count" : 12, "time" : 0.001, "syncTime" : 0.0, "numMessages" : 0, "messageLength" : 0, "numReductions" : 0, "flop" : 0.0}
+Stages["Solve"]["VecSet"][1] = {"count" : 12, "time" : 0.002, "syncTime" : 0.0, "numMessages" : 0, "messageLength" : 0, "numReductions" : 0, "flop" : 0.0}
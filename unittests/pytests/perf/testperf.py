@@ -0,0 +1,62 @@
+#!/usr/bin/env nemesis
+#
+# ======================================================================
+#
+# Brad T. Aagaard, U.S. Geological Survey
+# Charles A. Williams, GNS Science
+# Matthew G. Knepley, University of Chicago
+#
+# This code was developed as part of the Computational Infrastructure
+# for Geodynamics (http://geodynamics.org).
+#
+# Copyright (c) 2010-2017 University of California, Davis
+#
+# See COPYING for license information.
+#
+# ======================================================================
+#
+
+# @file unittests/perf/testperf.py
+
+# @brief Python application for testing perf code.
+
+from pylith.tests.UnitTestApp import UnitTestApp
+
+import unittest
+
+
+class TestApp(UnitTestApp):
+    """
+    Test application.
+    """
+
+    def __init__(self):
+        """
+        Constructor.
+        """
+        UnitTestApp.__init__(self)
+        return
+
+    def _suite(self):
+        """
+        Setup the test suite.
+        """
+
+        suite = unittest.TestSuite()
+
+        from TestLogView import TestLogView
+        suite.addTest(unittest.makeSuite(TestLogView))
+
+        from TestBenchmark import TestBenchmark
+        suite.addTest(unittest.makeSuite(TestBenchmark))
+
+        return suite
+
+
+# ----------------------------------------------------------------------
+if __name__ == '__main__':
+    app = TestApp()
+    app.run()
+
+
+# End of file
@@ -0,0 +1,126 @@
+#!/usr/bin/env python
+#
+# ======================================================================
+#
+# Brad T. Aagaard, U.S. Geological Survey
+# Charles A. Williams, GNS Science
+# Matthew G. Knepley, University of Chicago
+#
+# This code was developed as part of the Computational Infrastructure
+# for Geodynamics (http://geodynamics.org).
+#
+# Copyright (c) 2010-2017 University of California, Davis
+#
+# See COPYING for license information.
+#
+# ======================================================================
+#
+
+## @file unittests/pytests/problems/TestSolverNonlinear.py
+
+## @brief Unit testing of SolverNonlinear object.
+
+import unittest
+from pylith.problems.SolverNonlinear import SolverNonlinear
+
+# ----------------------------------------------------------------------
+class TestSolverNonlinear(unittest.TestCase):
+  """
+  Unit testing of SolverNonlinear object.
+  """
+
+  def test_constructor(self):
+    """
+    Test constructor.
+    """
+    solver = SolverNonlinear()
+    return
+
+
+  def test_configureDefaults(self):
+    """
+    Test _configure() with default settings.
+    """
+    solver = SolverNonlinear()
+    solver._configure()
+
+    self.assertEqual("newton", solver.inventory.solverType)
+    self.assertEqual(False, solver.inventory.adaptiveLinearTolerance)
+    self.assertEqual(1, solver.inventory.lagJacobian)
+    self.assertEqual(1, solver.inventory.lagPreconditioner)
+    return
+
+
+  def test_configureSolverType(self):
+    """
+    Test _configure() with each nonlinear solver type.
+    """
+    for solverType in ["newton", "nrichardson", "quasi_newton"]:
+      solver = SolverNonlinear()
+      solver.inventory.solverType = solverType
+      solver.inventory.adaptiveLinearTolerance = True
+      solver.inventory.lagJacobian = 2
+      solver.inventory.lagPreconditioner = 3
+      solver._configure()
+      self.assertEqual(solverType, solver.inventory.solverType)
+      self.assertEqual(True, solver.inventory.adaptiveLinearTolerance)
+      self.assertEqual(2, solver.inventory.lagJacobian)
+      self.assertEqual(3, solver.inventory.lagPreconditioner)
+    return
+
+
+  def test_validateSolverType(self):
+    """
+    Test validation of nonlinear solver type.
+    """
+    from pylith.problems.SolverNonlinear import validateSolverType
+    for solverType in ["newton", "nrichardson", "quasi_newton"]:
+      self.assertEqual(solverType, validateSolverType(solverType))
+    self.assertRaises(ValueError, validateSolverType, "bfgs")
+
+    solver = SolverNonlinear()
+    caught = False
+    try:
+      solver.inventory.solverType = "bfgs"
+    except ValueError:
+      caught = True
+    self.failUnless(caught)
+    return
+
+
+  def test_validateLag(self):
+    """
+    Test validation of Jacobian and preconditioner lags.
+    """
+    solver = SolverNonlinear()
+    caught = False
+    try:
+      solver.inventory.lagJacobian = 0
+    except ValueError:
+      caught = True
+    self.failUnless(caught)
+
+    caught = False
+    try:
+      solver.inventory.lagPreconditioner = 0
+    except ValueError:
+      caught = True
+    self.failUnless(caught)
+
+    # C++ object also rejects nonpositive lags.
+    from pylith.problems.problems import SolverNonlinear as ModuleSolverNonlinear
+    self.assertRaises(RuntimeError, ModuleSolverNonlinear.lagJacobian, solver, 0)
+    self.assertRaises(RuntimeError, ModuleSolverNonlinear.lagPreconditioner, solver, -1)
+    return
+
+
+  def test_factory(self):
+    """
+    Test factory method.
+    """
+    from pylith.problems.SolverNonlinear import solver
+    s = solver()
+    return
+
+
+# End of file 
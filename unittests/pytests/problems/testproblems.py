@@ -65,6 +65,9 @@ class TestApp(UnitTestApp):
     from TestProgressMonitorStep import TestProgressMonitorStep
     suite.addTest(unittest.makeSuite(TestProgressMonitorStep))
 
+    from TestSolverNonlinear import TestSolverNonlinear
+    suite.addTest(unittest.makeSuite(TestSolverNonlinear))
+
     return suite
 
 